@@ -0,0 +1,161 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/common/CMakeLists.txt"
+  "/root/repo/common/cmakes/FindJNI.cmake"
+  "/root/repo/common/cmakes/bolt.cmake"
+  "/root/repo/common/cmakes/cpuinfo.cmake"
+  "/root/repo/common/model_spec/CMakeLists.txt"
+  "/root/repo/common/model_spec/src/CMakeLists.txt"
+  "/root/repo/common/model_spec/tests/CMakeLists.txt"
+  "/root/repo/common/uni/CMakeLists.txt"
+  "/root/repo/common/uni/src/CMakeLists.txt"
+  "/root/repo/compute/CMakeLists.txt"
+  "/root/repo/compute/blas_enhance/CMakeLists.txt"
+  "/root/repo/compute/blas_enhance/src/CMakeLists.txt"
+  "/root/repo/compute/blas_enhance/tests/CMakeLists.txt"
+  "/root/repo/compute/image/CMakeLists.txt"
+  "/root/repo/compute/image/src/CMakeLists.txt"
+  "/root/repo/compute/image/tests/CMakeLists.txt"
+  "/root/repo/compute/tensor/CMakeLists.txt"
+  "/root/repo/compute/tensor/src/CMakeLists.txt"
+  "/root/repo/compute/tensor/tests/CMakeLists.txt"
+  "/root/repo/inference/CMakeLists.txt"
+  "/root/repo/inference/engine/CMakeLists.txt"
+  "/root/repo/inference/engine/src/CMakeLists.txt"
+  "/root/repo/inference/engine/tools/CMakeLists.txt"
+  "/root/repo/inference/examples/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "common/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "common/uni/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "common/uni/src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "common/model_spec/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "common/model_spec/src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "common/model_spec/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "compute/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "compute/blas_enhance/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "compute/blas_enhance/src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "compute/blas_enhance/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "compute/tensor/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "compute/tensor/src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "compute/tensor/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "compute/image/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "compute/image/src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "compute/image/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "inference/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "inference/engine/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "inference/engine/src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "inference/engine/tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "inference/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "common/uni/src/CMakeFiles/uni.dir/DependInfo.cmake"
+  "common/uni/src/CMakeFiles/uni_static.dir/DependInfo.cmake"
+  "common/model_spec/src/CMakeFiles/model_spec.dir/DependInfo.cmake"
+  "common/model_spec/src/CMakeFiles/model_spec_static.dir/DependInfo.cmake"
+  "common/model_spec/tests/CMakeFiles/test_model_deserialize.dir/DependInfo.cmake"
+  "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/DependInfo.cmake"
+  "compute/blas_enhance/src/CMakeFiles/blas_enhance_static.dir/DependInfo.cmake"
+  "compute/blas_enhance/tests/CMakeFiles/test_mmm.dir/DependInfo.cmake"
+  "compute/blas_enhance/tests/CMakeFiles/test_mvm.dir/DependInfo.cmake"
+  "compute/tensor/src/CMakeFiles/tensor.dir/DependInfo.cmake"
+  "compute/tensor/src/CMakeFiles/tensor_static.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_activation.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_argmax.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_attention.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_check.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_clip.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_concat.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_convolution.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_deconvolution.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_depthwise_convolution.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_dilated_convolution.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_detectionoutput.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_eltwise.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_fully_connected.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_rnn.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_power.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_post_ops.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_reduction.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_pooling.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_pooling_bp.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_padding.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_priorbox.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_reshape.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_softmax.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_scaled_dot_product_attention.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_split.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_slice.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_scale.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_transpose.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_expand.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_non_max_suppression.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_roialign.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_l2norm.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_prelu.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_layer_norm.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_tile.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_matmul_int8.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_fully_connected_int8.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_convolution_int8.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_depthwise_convolution_int8.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_concat_int8.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_pooling_int8.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/test_convolution_bnn.dir/DependInfo.cmake"
+  "compute/tensor/tests/CMakeFiles/benchmark_operators.dir/DependInfo.cmake"
+  "compute/image/src/CMakeFiles/image.dir/DependInfo.cmake"
+  "compute/image/src/CMakeFiles/image_static.dir/DependInfo.cmake"
+  "compute/image/tests/CMakeFiles/test_image_processing.dir/DependInfo.cmake"
+  "compute/image/tests/CMakeFiles/test_image_resize.dir/DependInfo.cmake"
+  "inference/engine/src/CMakeFiles/engine.dir/DependInfo.cmake"
+  "inference/engine/src/CMakeFiles/engine_static.dir/DependInfo.cmake"
+  "inference/engine/src/CMakeFiles/bolt_library.dir/DependInfo.cmake"
+  "inference/examples/CMakeFiles/benchmark.dir/DependInfo.cmake"
+  "inference/examples/CMakeFiles/schedule_benchmark.dir/DependInfo.cmake"
+  "inference/examples/CMakeFiles/batch_server_test.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_x86_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(quick_benchmark "bash" "/root/repo/scripts/quick_benchmark.sh" "--host_dir=/usr/local" "-d" "host")
+set_tests_properties(quick_benchmark PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;95;add_test;/root/repo/CMakeLists.txt;0;")
+subdirs("common")
+subdirs("compute")
+subdirs("inference")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/model_spec.dir/model_common.cpp.o"
+  "CMakeFiles/model_spec.dir/model_common.cpp.o.d"
+  "CMakeFiles/model_spec.dir/model_deserialize.cpp.o"
+  "CMakeFiles/model_spec.dir/model_deserialize.cpp.o.d"
+  "CMakeFiles/model_spec.dir/model_print.cpp.o"
+  "CMakeFiles/model_spec.dir/model_print.cpp.o.d"
+  "CMakeFiles/model_spec.dir/model_serialize.cpp.o"
+  "CMakeFiles/model_spec.dir/model_serialize.cpp.o.d"
+  "CMakeFiles/model_spec.dir/model_spec.cpp.o"
+  "CMakeFiles/model_spec.dir/model_spec.cpp.o.d"
+  "libmodel_spec.pdb"
+  "libmodel_spec.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/model_spec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/common/model_spec/src/model_common.cpp" "common/model_spec/src/CMakeFiles/model_spec_static.dir/model_common.cpp.o" "gcc" "common/model_spec/src/CMakeFiles/model_spec_static.dir/model_common.cpp.o.d"
+  "/root/repo/common/model_spec/src/model_deserialize.cpp" "common/model_spec/src/CMakeFiles/model_spec_static.dir/model_deserialize.cpp.o" "gcc" "common/model_spec/src/CMakeFiles/model_spec_static.dir/model_deserialize.cpp.o.d"
+  "/root/repo/common/model_spec/src/model_print.cpp" "common/model_spec/src/CMakeFiles/model_spec_static.dir/model_print.cpp.o" "gcc" "common/model_spec/src/CMakeFiles/model_spec_static.dir/model_print.cpp.o.d"
+  "/root/repo/common/model_spec/src/model_serialize.cpp" "common/model_spec/src/CMakeFiles/model_spec_static.dir/model_serialize.cpp.o" "gcc" "common/model_spec/src/CMakeFiles/model_spec_static.dir/model_serialize.cpp.o.d"
+  "/root/repo/common/model_spec/src/model_spec.cpp" "common/model_spec/src/CMakeFiles/model_spec_static.dir/model_spec.cpp.o" "gcc" "common/model_spec/src/CMakeFiles/model_spec_static.dir/model_spec.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
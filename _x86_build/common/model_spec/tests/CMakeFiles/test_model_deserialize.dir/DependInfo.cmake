@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/common/model_spec/tests/test_model_deserialize.cpp" "common/model_spec/tests/CMakeFiles/test_model_deserialize.dir/test_model_deserialize.cpp.o" "gcc" "common/model_spec/tests/CMakeFiles/test_model_deserialize.dir/test_model_deserialize.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_x86_build/common/model_spec/src/CMakeFiles/model_spec_static.dir/DependInfo.cmake"
+  "/root/repo/_x86_build/common/uni/src/CMakeFiles/uni_static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_model_deserialize.dir/test_model_deserialize.cpp.o"
+  "CMakeFiles/test_model_deserialize.dir/test_model_deserialize.cpp.o.d"
+  "test_model_deserialize"
+  "test_model_deserialize.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_model_deserialize.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
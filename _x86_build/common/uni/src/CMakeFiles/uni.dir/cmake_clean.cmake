@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/uni.dir/op_profiler.cpp.o"
+  "CMakeFiles/uni.dir/op_profiler.cpp.o.d"
+  "CMakeFiles/uni.dir/profiling.cpp.o"
+  "CMakeFiles/uni.dir/profiling.cpp.o.d"
+  "CMakeFiles/uni.dir/tensor_transpose.cpp.o"
+  "CMakeFiles/uni.dir/tensor_transpose.cpp.o.d"
+  "libuni.pdb"
+  "libuni.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/uni.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/common/uni/src/op_profiler.cpp" "common/uni/src/CMakeFiles/uni_static.dir/op_profiler.cpp.o" "gcc" "common/uni/src/CMakeFiles/uni_static.dir/op_profiler.cpp.o.d"
+  "/root/repo/common/uni/src/profiling.cpp" "common/uni/src/CMakeFiles/uni_static.dir/profiling.cpp.o" "gcc" "common/uni/src/CMakeFiles/uni_static.dir/profiling.cpp.o.d"
+  "/root/repo/common/uni/src/tensor_transpose.cpp" "common/uni/src/CMakeFiles/uni_static.dir/tensor_transpose.cpp.o" "gcc" "common/uni/src/CMakeFiles/uni_static.dir/tensor_transpose.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/uni_static.dir/op_profiler.cpp.o"
+  "CMakeFiles/uni_static.dir/op_profiler.cpp.o.d"
+  "CMakeFiles/uni_static.dir/profiling.cpp.o"
+  "CMakeFiles/uni_static.dir/profiling.cpp.o.d"
+  "CMakeFiles/uni_static.dir/tensor_transpose.cpp.o"
+  "CMakeFiles/uni_static.dir/tensor_transpose.cpp.o.d"
+  "libuni.a"
+  "libuni.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/uni_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
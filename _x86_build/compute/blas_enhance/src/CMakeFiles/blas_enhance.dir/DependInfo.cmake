@@ -0,0 +1,38 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/compute/blas_enhance/src/axpby.cpp" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/axpby.cpp.o" "gcc" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/axpby.cpp.o.d"
+  "/root/repo/compute/blas_enhance/src/cpu/general/axpby.cpp" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/general/axpby.cpp.o" "gcc" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/general/axpby.cpp.o.d"
+  "/root/repo/compute/blas_enhance/src/cpu/general/mmm.cpp" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/general/mmm.cpp.o" "gcc" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/general/mmm.cpp.o.d"
+  "/root/repo/compute/blas_enhance/src/cpu/general/mvm.cpp" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/general/mvm.cpp.o" "gcc" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/general/mvm.cpp.o.d"
+  "/root/repo/compute/blas_enhance/src/cpu/x86/axpby.cpp" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/axpby.cpp.o" "gcc" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/axpby.cpp.o.d"
+  "/root/repo/compute/blas_enhance/src/cpu/x86/fp32/avx512/mmm_avx512.cpp" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/fp32/avx512/mmm_avx512.cpp.o" "gcc" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/fp32/avx512/mmm_avx512.cpp.o.d"
+  "/root/repo/compute/blas_enhance/src/cpu/x86/fp32/avx512/mvm_avx512_pack.cpp" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/fp32/avx512/mvm_avx512_pack.cpp.o" "gcc" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/fp32/avx512/mvm_avx512_pack.cpp.o.d"
+  "/root/repo/compute/blas_enhance/src/cpu/x86/fp32/axpby.cpp" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/fp32/axpby.cpp.o" "gcc" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/fp32/axpby.cpp.o.d"
+  "/root/repo/compute/blas_enhance/src/cpu/x86/fp32/mmm_avx2.cpp" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mmm_avx2.cpp.o" "gcc" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mmm_avx2.cpp.o.d"
+  "/root/repo/compute/blas_enhance/src/cpu/x86/fp32/mmm_bf16.cpp" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mmm_bf16.cpp.o" "gcc" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mmm_bf16.cpp.o.d"
+  "/root/repo/compute/blas_enhance/src/cpu/x86/fp32/mmm_int4.cpp" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mmm_int4.cpp.o" "gcc" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mmm_int4.cpp.o.d"
+  "/root/repo/compute/blas_enhance/src/cpu/x86/fp32/mmm_sparse.cpp" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mmm_sparse.cpp.o" "gcc" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mmm_sparse.cpp.o.d"
+  "/root/repo/compute/blas_enhance/src/cpu/x86/fp32/mvm_avx2_col.cpp" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mvm_avx2_col.cpp.o" "gcc" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mvm_avx2_col.cpp.o.d"
+  "/root/repo/compute/blas_enhance/src/cpu/x86/fp32/mvm_avx2_pack.cpp" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mvm_avx2_pack.cpp.o" "gcc" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mvm_avx2_pack.cpp.o.d"
+  "/root/repo/compute/blas_enhance/src/cpu/x86/fp32/mvm_avx2_row.cpp" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mvm_avx2_row.cpp.o" "gcc" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mvm_avx2_row.cpp.o.d"
+  "/root/repo/compute/blas_enhance/src/cpu/x86/mmm.cpp" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/mmm.cpp.o" "gcc" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/mmm.cpp.o.d"
+  "/root/repo/compute/blas_enhance/src/cpu/x86/mvm.cpp" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/mvm.cpp.o" "gcc" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/cpu/x86/mvm.cpp.o.d"
+  "/root/repo/compute/blas_enhance/src/mmm.cpp" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/mmm.cpp.o" "gcc" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/mmm.cpp.o.d"
+  "/root/repo/compute/blas_enhance/src/mvm.cpp" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/mvm.cpp.o" "gcc" "compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/mvm.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_x86_build/common/uni/src/CMakeFiles/uni.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
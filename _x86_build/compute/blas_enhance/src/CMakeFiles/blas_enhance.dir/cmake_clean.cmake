@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/blas_enhance.dir/axpby.cpp.o"
+  "CMakeFiles/blas_enhance.dir/axpby.cpp.o.d"
+  "CMakeFiles/blas_enhance.dir/cpu/general/axpby.cpp.o"
+  "CMakeFiles/blas_enhance.dir/cpu/general/axpby.cpp.o.d"
+  "CMakeFiles/blas_enhance.dir/cpu/general/mmm.cpp.o"
+  "CMakeFiles/blas_enhance.dir/cpu/general/mmm.cpp.o.d"
+  "CMakeFiles/blas_enhance.dir/cpu/general/mvm.cpp.o"
+  "CMakeFiles/blas_enhance.dir/cpu/general/mvm.cpp.o.d"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/axpby.cpp.o"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/axpby.cpp.o.d"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/fp32/avx512/mmm_avx512.cpp.o"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/fp32/avx512/mmm_avx512.cpp.o.d"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/fp32/avx512/mvm_avx512_pack.cpp.o"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/fp32/avx512/mvm_avx512_pack.cpp.o.d"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/fp32/axpby.cpp.o"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/fp32/axpby.cpp.o.d"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mmm_avx2.cpp.o"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mmm_avx2.cpp.o.d"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mmm_bf16.cpp.o"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mmm_bf16.cpp.o.d"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mmm_int4.cpp.o"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mmm_int4.cpp.o.d"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mmm_sparse.cpp.o"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mmm_sparse.cpp.o.d"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mvm_avx2_col.cpp.o"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mvm_avx2_col.cpp.o.d"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mvm_avx2_pack.cpp.o"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mvm_avx2_pack.cpp.o.d"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mvm_avx2_row.cpp.o"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/fp32/mvm_avx2_row.cpp.o.d"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/mmm.cpp.o"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/mmm.cpp.o.d"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/mvm.cpp.o"
+  "CMakeFiles/blas_enhance.dir/cpu/x86/mvm.cpp.o.d"
+  "CMakeFiles/blas_enhance.dir/mmm.cpp.o"
+  "CMakeFiles/blas_enhance.dir/mmm.cpp.o.d"
+  "CMakeFiles/blas_enhance.dir/mvm.cpp.o"
+  "CMakeFiles/blas_enhance.dir/mvm.cpp.o.d"
+  "libblas_enhance.pdb"
+  "libblas_enhance.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/blas_enhance.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
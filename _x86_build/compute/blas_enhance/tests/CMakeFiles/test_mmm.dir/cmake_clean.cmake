@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_mmm.dir/test_mmm.cpp.o"
+  "CMakeFiles/test_mmm.dir/test_mmm.cpp.o.d"
+  "test_mmm"
+  "test_mmm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_mmm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
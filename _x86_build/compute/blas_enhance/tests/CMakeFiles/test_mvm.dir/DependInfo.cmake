@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/compute/blas_enhance/tests/test_mvm.cpp" "compute/blas_enhance/tests/CMakeFiles/test_mvm.dir/test_mvm.cpp.o" "gcc" "compute/blas_enhance/tests/CMakeFiles/test_mvm.dir/test_mvm.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_x86_build/compute/blas_enhance/src/CMakeFiles/blas_enhance_static.dir/DependInfo.cmake"
+  "/root/repo/_x86_build/common/uni/src/CMakeFiles/uni_static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_mvm.dir/test_mvm.cpp.o"
+  "CMakeFiles/test_mvm.dir/test_mvm.cpp.o.d"
+  "test_mvm"
+  "test_mvm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_mvm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/image.dir/convert_color.cpp.o"
+  "CMakeFiles/image.dir/convert_color.cpp.o.d"
+  "CMakeFiles/image.dir/cpu/convert_color.cpp.o"
+  "CMakeFiles/image.dir/cpu/convert_color.cpp.o.d"
+  "CMakeFiles/image.dir/cpu/general/resize_bilinear.cpp.o"
+  "CMakeFiles/image.dir/cpu/general/resize_bilinear.cpp.o.d"
+  "CMakeFiles/image.dir/cpu/grid_sample.cpp.o"
+  "CMakeFiles/image.dir/cpu/grid_sample.cpp.o.d"
+  "CMakeFiles/image.dir/cpu/resize_nearest.cpp.o"
+  "CMakeFiles/image.dir/cpu/resize_nearest.cpp.o.d"
+  "CMakeFiles/image.dir/cpu/x86/resize_bilinear.cpp.o"
+  "CMakeFiles/image.dir/cpu/x86/resize_bilinear.cpp.o.d"
+  "CMakeFiles/image.dir/cpu/x86/resize_nearest.cpp.o"
+  "CMakeFiles/image.dir/cpu/x86/resize_nearest.cpp.o.d"
+  "CMakeFiles/image.dir/grid_sample.cpp.o"
+  "CMakeFiles/image.dir/grid_sample.cpp.o.d"
+  "CMakeFiles/image.dir/image_processing.cpp.o"
+  "CMakeFiles/image.dir/image_processing.cpp.o.d"
+  "CMakeFiles/image.dir/lut.cpp.o"
+  "CMakeFiles/image.dir/lut.cpp.o.d"
+  "CMakeFiles/image.dir/lut_preprocess.cpp.o"
+  "CMakeFiles/image.dir/lut_preprocess.cpp.o.d"
+  "CMakeFiles/image.dir/resize.cpp.o"
+  "CMakeFiles/image.dir/resize.cpp.o.d"
+  "libimage.pdb"
+  "libimage.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/image.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/compute/image/src/convert_color.cpp" "compute/image/src/CMakeFiles/image_static.dir/convert_color.cpp.o" "gcc" "compute/image/src/CMakeFiles/image_static.dir/convert_color.cpp.o.d"
+  "/root/repo/compute/image/src/cpu/convert_color.cpp" "compute/image/src/CMakeFiles/image_static.dir/cpu/convert_color.cpp.o" "gcc" "compute/image/src/CMakeFiles/image_static.dir/cpu/convert_color.cpp.o.d"
+  "/root/repo/compute/image/src/cpu/general/resize_bilinear.cpp" "compute/image/src/CMakeFiles/image_static.dir/cpu/general/resize_bilinear.cpp.o" "gcc" "compute/image/src/CMakeFiles/image_static.dir/cpu/general/resize_bilinear.cpp.o.d"
+  "/root/repo/compute/image/src/cpu/grid_sample.cpp" "compute/image/src/CMakeFiles/image_static.dir/cpu/grid_sample.cpp.o" "gcc" "compute/image/src/CMakeFiles/image_static.dir/cpu/grid_sample.cpp.o.d"
+  "/root/repo/compute/image/src/cpu/resize_nearest.cpp" "compute/image/src/CMakeFiles/image_static.dir/cpu/resize_nearest.cpp.o" "gcc" "compute/image/src/CMakeFiles/image_static.dir/cpu/resize_nearest.cpp.o.d"
+  "/root/repo/compute/image/src/cpu/x86/resize_bilinear.cpp" "compute/image/src/CMakeFiles/image_static.dir/cpu/x86/resize_bilinear.cpp.o" "gcc" "compute/image/src/CMakeFiles/image_static.dir/cpu/x86/resize_bilinear.cpp.o.d"
+  "/root/repo/compute/image/src/cpu/x86/resize_nearest.cpp" "compute/image/src/CMakeFiles/image_static.dir/cpu/x86/resize_nearest.cpp.o" "gcc" "compute/image/src/CMakeFiles/image_static.dir/cpu/x86/resize_nearest.cpp.o.d"
+  "/root/repo/compute/image/src/grid_sample.cpp" "compute/image/src/CMakeFiles/image_static.dir/grid_sample.cpp.o" "gcc" "compute/image/src/CMakeFiles/image_static.dir/grid_sample.cpp.o.d"
+  "/root/repo/compute/image/src/image_processing.cpp" "compute/image/src/CMakeFiles/image_static.dir/image_processing.cpp.o" "gcc" "compute/image/src/CMakeFiles/image_static.dir/image_processing.cpp.o.d"
+  "/root/repo/compute/image/src/lut.cpp" "compute/image/src/CMakeFiles/image_static.dir/lut.cpp.o" "gcc" "compute/image/src/CMakeFiles/image_static.dir/lut.cpp.o.d"
+  "/root/repo/compute/image/src/lut_preprocess.cpp" "compute/image/src/CMakeFiles/image_static.dir/lut_preprocess.cpp.o" "gcc" "compute/image/src/CMakeFiles/image_static.dir/lut_preprocess.cpp.o.d"
+  "/root/repo/compute/image/src/resize.cpp" "compute/image/src/CMakeFiles/image_static.dir/resize.cpp.o" "gcc" "compute/image/src/CMakeFiles/image_static.dir/resize.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
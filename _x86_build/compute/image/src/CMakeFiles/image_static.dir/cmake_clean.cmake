@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/image_static.dir/convert_color.cpp.o"
+  "CMakeFiles/image_static.dir/convert_color.cpp.o.d"
+  "CMakeFiles/image_static.dir/cpu/convert_color.cpp.o"
+  "CMakeFiles/image_static.dir/cpu/convert_color.cpp.o.d"
+  "CMakeFiles/image_static.dir/cpu/general/resize_bilinear.cpp.o"
+  "CMakeFiles/image_static.dir/cpu/general/resize_bilinear.cpp.o.d"
+  "CMakeFiles/image_static.dir/cpu/grid_sample.cpp.o"
+  "CMakeFiles/image_static.dir/cpu/grid_sample.cpp.o.d"
+  "CMakeFiles/image_static.dir/cpu/resize_nearest.cpp.o"
+  "CMakeFiles/image_static.dir/cpu/resize_nearest.cpp.o.d"
+  "CMakeFiles/image_static.dir/cpu/x86/resize_bilinear.cpp.o"
+  "CMakeFiles/image_static.dir/cpu/x86/resize_bilinear.cpp.o.d"
+  "CMakeFiles/image_static.dir/cpu/x86/resize_nearest.cpp.o"
+  "CMakeFiles/image_static.dir/cpu/x86/resize_nearest.cpp.o.d"
+  "CMakeFiles/image_static.dir/grid_sample.cpp.o"
+  "CMakeFiles/image_static.dir/grid_sample.cpp.o.d"
+  "CMakeFiles/image_static.dir/image_processing.cpp.o"
+  "CMakeFiles/image_static.dir/image_processing.cpp.o.d"
+  "CMakeFiles/image_static.dir/lut.cpp.o"
+  "CMakeFiles/image_static.dir/lut.cpp.o.d"
+  "CMakeFiles/image_static.dir/lut_preprocess.cpp.o"
+  "CMakeFiles/image_static.dir/lut_preprocess.cpp.o.d"
+  "CMakeFiles/image_static.dir/resize.cpp.o"
+  "CMakeFiles/image_static.dir/resize.cpp.o.d"
+  "libimage.a"
+  "libimage.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/image_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
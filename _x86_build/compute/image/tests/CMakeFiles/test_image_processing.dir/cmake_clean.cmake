@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_image_processing.dir/test_image_processing.cpp.o"
+  "CMakeFiles/test_image_processing.dir/test_image_processing.cpp.o.d"
+  "test_image_processing"
+  "test_image_processing.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_image_processing.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
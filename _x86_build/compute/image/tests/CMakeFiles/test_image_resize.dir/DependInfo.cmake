@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/compute/image/tests/test_image_resize.cpp" "compute/image/tests/CMakeFiles/test_image_resize.dir/test_image_resize.cpp.o" "gcc" "compute/image/tests/CMakeFiles/test_image_resize.dir/test_image_resize.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_x86_build/compute/image/src/CMakeFiles/image_static.dir/DependInfo.cmake"
+  "/root/repo/_x86_build/compute/tensor/src/CMakeFiles/tensor_static.dir/DependInfo.cmake"
+  "/root/repo/_x86_build/compute/blas_enhance/src/CMakeFiles/blas_enhance_static.dir/DependInfo.cmake"
+  "/root/repo/_x86_build/common/uni/src/CMakeFiles/uni_static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_image_resize.dir/test_image_resize.cpp.o"
+  "CMakeFiles/test_image_resize.dir/test_image_resize.cpp.o.d"
+  "test_image_resize"
+  "test_image_resize.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_image_resize.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,201 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/compute/tensor/src/activation.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/activation.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/activation.cpp.o.d"
+  "/root/repo/compute/tensor/src/argmax.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/argmax.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/argmax.cpp.o.d"
+  "/root/repo/compute/tensor/src/attention.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/attention.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/attention.cpp.o.d"
+  "/root/repo/compute/tensor/src/attention_mask.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/attention_mask.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/attention_mask.cpp.o.d"
+  "/root/repo/compute/tensor/src/batch_norm.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/batch_norm.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/batch_norm.cpp.o.d"
+  "/root/repo/compute/tensor/src/bilateral_slice_apply.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/bilateral_slice_apply.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/bilateral_slice_apply.cpp.o.d"
+  "/root/repo/compute/tensor/src/cast.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cast.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cast.cpp.o.d"
+  "/root/repo/compute/tensor/src/channel_resize.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/channel_resize.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/channel_resize.cpp.o.d"
+  "/root/repo/compute/tensor/src/check.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/check.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/check.cpp.o.d"
+  "/root/repo/compute/tensor/src/clip.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/clip.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/clip.cpp.o.d"
+  "/root/repo/compute/tensor/src/concat.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/concat.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/concat.cpp.o.d"
+  "/root/repo/compute/tensor/src/convolution.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/convolution.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/convolution.cpp.o.d"
+  "/root/repo/compute/tensor/src/copy.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/copy.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/copy.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/activation.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/activation.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/activation.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/argmax.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/argmax.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/argmax.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/bilateral_slice_apply.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/bilateral_slice_apply.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/bilateral_slice_apply.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/cast.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/cast.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/cast.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/check.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/check.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/check.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/clip.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/clip.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/clip.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/concat.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/concat.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/concat.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/convolution.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/convolution.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/convolution.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/deconvolution.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/deconvolution.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/deconvolution.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/depth2space.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/depth2space.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/depth2space.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/depthwise_convolution.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/depthwise_convolution.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/depthwise_convolution.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/depthwise_pointwise_convolution.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/depthwise_pointwise_convolution.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/depthwise_pointwise_convolution.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/detectionoutput.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/detectionoutput.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/detectionoutput.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/eltwise.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/eltwise.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/eltwise.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/embedding.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/embedding.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/embedding.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/gat.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/gat.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/gat.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/gather.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/gather.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/gather.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/general/attention.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/attention.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/attention.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/general/attention_mask.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/attention_mask.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/attention_mask.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/general/clip.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/clip.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/clip.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/general/convolution.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/convolution.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/convolution.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/general/cum.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/cum.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/cum.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/general/deconvolution.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/deconvolution.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/deconvolution.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/general/depthwise_convolution.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/depthwise_convolution.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/depthwise_convolution.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/general/depthwise_pointwise_convolution.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/depthwise_pointwise_convolution.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/depthwise_pointwise_convolution.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/general/dequantize.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/dequantize.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/dequantize.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/general/detectionoutput.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/detectionoutput.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/detectionoutput.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/general/eltwise.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/eltwise.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/eltwise.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/general/layer_norm.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/layer_norm.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/layer_norm.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/general/padding.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/padding.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/padding.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/general/pooling.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/pooling.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/pooling.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/general/pooling_bp.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/pooling_bp.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/pooling_bp.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/general/prelu.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/prelu.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/prelu.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/general/rnn.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/rnn.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/rnn.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/general/scale.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/scale.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/scale.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/general/scaled_dot_product_attention.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/scaled_dot_product_attention.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/scaled_dot_product_attention.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/general/softmax.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/softmax.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/softmax.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/general/transpose.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/transpose.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/general/transpose.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/instance_norm.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/instance_norm.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/instance_norm.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/l2norm.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/l2norm.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/l2norm.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/non_max_suppression.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/non_max_suppression.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/non_max_suppression.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/non_zero.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/non_zero.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/non_zero.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/onehot.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/onehot.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/onehot.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/padding.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/padding.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/padding.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/post_ops.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/post_ops.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/post_ops.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/power.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/power.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/power.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/priorbox.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/priorbox.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/priorbox.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/quantize.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/quantize.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/quantize.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/reduction.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/reduction.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/reduction.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/requantize.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/requantize.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/requantize.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/reshape.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/reshape.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/reshape.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/rnn.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/rnn.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/rnn.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/roialign.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/roialign.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/roialign.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/scale.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/scale.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/scale.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/scatter.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/scatter.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/scatter.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/slice.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/slice.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/slice.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/space2depth.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/space2depth.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/space2depth.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/split.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/split.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/split.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/tfslice.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/tfslice.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/tfslice.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/topk.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/topk.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/topk.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/transpose.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/transpose.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/transpose.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/attention.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/attention.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/attention.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/attention_mask.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/attention_mask.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/attention_mask.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/clip.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/clip.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/clip.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/convolution.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/convolution.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/convolution.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/deconvolution.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/deconvolution.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/deconvolution.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/depthwise_convolution.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/depthwise_convolution.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/depthwise_convolution.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/depthwise_pointwise_convolution.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/depthwise_pointwise_convolution.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/depthwise_pointwise_convolution.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/dequantize.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/dequantize.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/dequantize.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/detectionoutput.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/detectionoutput.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/detectionoutput.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/eltwise.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/eltwise.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/eltwise.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/attention.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/attention.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/attention.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/attention_mask.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/attention_mask.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/attention_mask.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/clip.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/clip.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/clip.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/convolution.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/convolution.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/convolution.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/convolution_1x1_direct.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/convolution_1x1_direct.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/convolution_1x1_direct.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/convolution_direct.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/convolution_direct.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/convolution_direct.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/convolution_direct_nchw.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/convolution_direct_nchw.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/convolution_direct_nchw.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/convolution_transform.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/convolution_transform.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/convolution_transform.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/convolution_winograd.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/convolution_winograd.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/convolution_winograd.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/deconvolution_transform.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/deconvolution_transform.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/deconvolution_transform.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/depthwise_convolution_direct.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/depthwise_convolution_direct.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/depthwise_convolution_direct.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/depthwise_convolution_transform.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/depthwise_convolution_transform.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/depthwise_convolution_transform.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/depthwise_pointwise_convolution.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/depthwise_pointwise_convolution.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/depthwise_pointwise_convolution.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/depthwise_pointwise_convolution_transform.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/depthwise_pointwise_convolution_transform.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/depthwise_pointwise_convolution_transform.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/detectionoutput.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/detectionoutput.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/detectionoutput.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/eltwise.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/eltwise.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/eltwise.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/gru.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/gru.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/gru.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/instance_norm.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/instance_norm.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/instance_norm.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/l2norm.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/l2norm.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/l2norm.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/layer_norm.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/layer_norm.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/layer_norm.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/lstm.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/lstm.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/lstm.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/pooling.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/pooling.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/pooling.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/pooling_avx512.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/pooling_avx512.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/pooling_avx512.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/pooling_bp.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/pooling_bp.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/pooling_bp.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/pooling_nchw.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/pooling_nchw.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/pooling_nchw.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/prelu.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/prelu.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/prelu.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/rnn.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/rnn.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/rnn.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/scale.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/scale.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/scale.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/scaled_dot_product_attention.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/scaled_dot_product_attention.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/scaled_dot_product_attention.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/fp32/softmax.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/softmax.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/fp32/softmax.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/instance_norm.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/instance_norm.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/instance_norm.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/int32/clip.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/int32/clip.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/int32/clip.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/int32/scale.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/int32/scale.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/int32/scale.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/layer_norm.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/layer_norm.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/layer_norm.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/pooling.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/pooling.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/pooling.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/prelu.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/prelu.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/prelu.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/quantize.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/quantize.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/quantize.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/rnn.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/rnn.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/rnn.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/scale.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/scale.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/scale.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/scaled_dot_product_attention.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/scaled_dot_product_attention.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/scaled_dot_product_attention.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/x86/softmax.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/softmax.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/x86/softmax.cpp.o.d"
+  "/root/repo/compute/tensor/src/cpu/yolov3detectionoutput.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/yolov3detectionoutput.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cpu/yolov3detectionoutput.cpp.o.d"
+  "/root/repo/compute/tensor/src/cum.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/cum.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/cum.cpp.o.d"
+  "/root/repo/compute/tensor/src/deconvolution.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/deconvolution.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/deconvolution.cpp.o.d"
+  "/root/repo/compute/tensor/src/depth2space.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/depth2space.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/depth2space.cpp.o.d"
+  "/root/repo/compute/tensor/src/depthwise_convolution.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/depthwise_convolution.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/depthwise_convolution.cpp.o.d"
+  "/root/repo/compute/tensor/src/depthwise_pointwise_convolution.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/depthwise_pointwise_convolution.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/depthwise_pointwise_convolution.cpp.o.d"
+  "/root/repo/compute/tensor/src/dequantize.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/dequantize.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/dequantize.cpp.o.d"
+  "/root/repo/compute/tensor/src/detectionoutput.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/detectionoutput.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/detectionoutput.cpp.o.d"
+  "/root/repo/compute/tensor/src/einsum.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/einsum.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/einsum.cpp.o.d"
+  "/root/repo/compute/tensor/src/eltwise.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/eltwise.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/eltwise.cpp.o.d"
+  "/root/repo/compute/tensor/src/embedding.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/embedding.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/embedding.cpp.o.d"
+  "/root/repo/compute/tensor/src/expand.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/expand.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/expand.cpp.o.d"
+  "/root/repo/compute/tensor/src/fully_connected.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/fully_connected.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/fully_connected.cpp.o.d"
+  "/root/repo/compute/tensor/src/gat.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/gat.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/gat.cpp.o.d"
+  "/root/repo/compute/tensor/src/gather.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/gather.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/gather.cpp.o.d"
+  "/root/repo/compute/tensor/src/generate_proposals.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/generate_proposals.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/generate_proposals.cpp.o.d"
+  "/root/repo/compute/tensor/src/instance_norm.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/instance_norm.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/instance_norm.cpp.o.d"
+  "/root/repo/compute/tensor/src/kl.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/kl.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/kl.cpp.o.d"
+  "/root/repo/compute/tensor/src/l2norm.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/l2norm.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/l2norm.cpp.o.d"
+  "/root/repo/compute/tensor/src/layer_norm.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/layer_norm.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/layer_norm.cpp.o.d"
+  "/root/repo/compute/tensor/src/matmul.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/matmul.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/matmul.cpp.o.d"
+  "/root/repo/compute/tensor/src/non_max_suppression.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/non_max_suppression.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/non_max_suppression.cpp.o.d"
+  "/root/repo/compute/tensor/src/non_zero.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/non_zero.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/non_zero.cpp.o.d"
+  "/root/repo/compute/tensor/src/onehot.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/onehot.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/onehot.cpp.o.d"
+  "/root/repo/compute/tensor/src/padding.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/padding.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/padding.cpp.o.d"
+  "/root/repo/compute/tensor/src/pooling.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/pooling.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/pooling.cpp.o.d"
+  "/root/repo/compute/tensor/src/pooling_bp.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/pooling_bp.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/pooling_bp.cpp.o.d"
+  "/root/repo/compute/tensor/src/post_ops.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/post_ops.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/post_ops.cpp.o.d"
+  "/root/repo/compute/tensor/src/power.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/power.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/power.cpp.o.d"
+  "/root/repo/compute/tensor/src/preallocated_memory.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/preallocated_memory.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/preallocated_memory.cpp.o.d"
+  "/root/repo/compute/tensor/src/prelu.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/prelu.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/prelu.cpp.o.d"
+  "/root/repo/compute/tensor/src/priorbox.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/priorbox.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/priorbox.cpp.o.d"
+  "/root/repo/compute/tensor/src/quantize.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/quantize.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/quantize.cpp.o.d"
+  "/root/repo/compute/tensor/src/random.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/random.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/random.cpp.o.d"
+  "/root/repo/compute/tensor/src/reduction.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/reduction.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/reduction.cpp.o.d"
+  "/root/repo/compute/tensor/src/reshape.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/reshape.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/reshape.cpp.o.d"
+  "/root/repo/compute/tensor/src/rnn.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/rnn.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/rnn.cpp.o.d"
+  "/root/repo/compute/tensor/src/roialign.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/roialign.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/roialign.cpp.o.d"
+  "/root/repo/compute/tensor/src/scale.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/scale.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/scale.cpp.o.d"
+  "/root/repo/compute/tensor/src/scaled_dot_product_attention.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/scaled_dot_product_attention.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/scaled_dot_product_attention.cpp.o.d"
+  "/root/repo/compute/tensor/src/scan.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/scan.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/scan.cpp.o.d"
+  "/root/repo/compute/tensor/src/scatter.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/scatter.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/scatter.cpp.o.d"
+  "/root/repo/compute/tensor/src/select.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/select.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/select.cpp.o.d"
+  "/root/repo/compute/tensor/src/slice.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/slice.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/slice.cpp.o.d"
+  "/root/repo/compute/tensor/src/softmax.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/softmax.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/softmax.cpp.o.d"
+  "/root/repo/compute/tensor/src/space2depth.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/space2depth.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/space2depth.cpp.o.d"
+  "/root/repo/compute/tensor/src/split.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/split.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/split.cpp.o.d"
+  "/root/repo/compute/tensor/src/squeeze.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/squeeze.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/squeeze.cpp.o.d"
+  "/root/repo/compute/tensor/src/tfslice.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/tfslice.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/tfslice.cpp.o.d"
+  "/root/repo/compute/tensor/src/tile.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/tile.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/tile.cpp.o.d"
+  "/root/repo/compute/tensor/src/topk.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/topk.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/topk.cpp.o.d"
+  "/root/repo/compute/tensor/src/transpose.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/transpose.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/transpose.cpp.o.d"
+  "/root/repo/compute/tensor/src/unpooling.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/unpooling.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/unpooling.cpp.o.d"
+  "/root/repo/compute/tensor/src/unsqueeze.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/unsqueeze.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/unsqueeze.cpp.o.d"
+  "/root/repo/compute/tensor/src/where.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/where.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/where.cpp.o.d"
+  "/root/repo/compute/tensor/src/yolov3detectionoutput.cpp" "compute/tensor/src/CMakeFiles/tensor.dir/yolov3detectionoutput.cpp.o" "gcc" "compute/tensor/src/CMakeFiles/tensor.dir/yolov3detectionoutput.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_x86_build/compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/DependInfo.cmake"
+  "/root/repo/_x86_build/common/uni/src/CMakeFiles/uni.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,371 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tensor.dir/activation.cpp.o"
+  "CMakeFiles/tensor.dir/activation.cpp.o.d"
+  "CMakeFiles/tensor.dir/argmax.cpp.o"
+  "CMakeFiles/tensor.dir/argmax.cpp.o.d"
+  "CMakeFiles/tensor.dir/attention.cpp.o"
+  "CMakeFiles/tensor.dir/attention.cpp.o.d"
+  "CMakeFiles/tensor.dir/attention_mask.cpp.o"
+  "CMakeFiles/tensor.dir/attention_mask.cpp.o.d"
+  "CMakeFiles/tensor.dir/batch_norm.cpp.o"
+  "CMakeFiles/tensor.dir/batch_norm.cpp.o.d"
+  "CMakeFiles/tensor.dir/bilateral_slice_apply.cpp.o"
+  "CMakeFiles/tensor.dir/bilateral_slice_apply.cpp.o.d"
+  "CMakeFiles/tensor.dir/cast.cpp.o"
+  "CMakeFiles/tensor.dir/cast.cpp.o.d"
+  "CMakeFiles/tensor.dir/channel_resize.cpp.o"
+  "CMakeFiles/tensor.dir/channel_resize.cpp.o.d"
+  "CMakeFiles/tensor.dir/check.cpp.o"
+  "CMakeFiles/tensor.dir/check.cpp.o.d"
+  "CMakeFiles/tensor.dir/clip.cpp.o"
+  "CMakeFiles/tensor.dir/clip.cpp.o.d"
+  "CMakeFiles/tensor.dir/concat.cpp.o"
+  "CMakeFiles/tensor.dir/concat.cpp.o.d"
+  "CMakeFiles/tensor.dir/convolution.cpp.o"
+  "CMakeFiles/tensor.dir/convolution.cpp.o.d"
+  "CMakeFiles/tensor.dir/copy.cpp.o"
+  "CMakeFiles/tensor.dir/copy.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/activation.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/activation.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/argmax.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/argmax.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/bilateral_slice_apply.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/bilateral_slice_apply.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/cast.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/cast.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/check.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/check.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/clip.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/clip.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/concat.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/concat.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/convolution.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/convolution.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/deconvolution.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/deconvolution.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/depth2space.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/depth2space.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/depthwise_convolution.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/depthwise_convolution.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/depthwise_pointwise_convolution.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/depthwise_pointwise_convolution.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/detectionoutput.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/detectionoutput.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/eltwise.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/eltwise.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/embedding.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/embedding.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/gat.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/gat.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/gather.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/gather.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/general/attention.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/general/attention.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/general/attention_mask.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/general/attention_mask.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/general/clip.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/general/clip.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/general/convolution.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/general/convolution.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/general/cum.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/general/cum.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/general/deconvolution.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/general/deconvolution.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/general/depthwise_convolution.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/general/depthwise_convolution.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/general/depthwise_pointwise_convolution.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/general/depthwise_pointwise_convolution.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/general/dequantize.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/general/dequantize.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/general/detectionoutput.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/general/detectionoutput.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/general/eltwise.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/general/eltwise.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/general/layer_norm.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/general/layer_norm.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/general/padding.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/general/padding.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/general/pooling.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/general/pooling.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/general/pooling_bp.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/general/pooling_bp.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/general/prelu.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/general/prelu.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/general/rnn.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/general/rnn.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/general/scale.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/general/scale.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/general/scaled_dot_product_attention.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/general/scaled_dot_product_attention.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/general/softmax.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/general/softmax.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/general/transpose.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/general/transpose.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/instance_norm.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/instance_norm.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/l2norm.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/l2norm.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/non_max_suppression.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/non_max_suppression.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/non_zero.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/non_zero.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/onehot.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/onehot.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/padding.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/padding.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/post_ops.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/post_ops.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/power.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/power.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/priorbox.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/priorbox.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/quantize.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/quantize.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/reduction.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/reduction.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/requantize.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/requantize.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/reshape.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/reshape.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/rnn.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/rnn.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/roialign.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/roialign.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/scale.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/scale.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/scatter.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/scatter.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/slice.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/slice.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/space2depth.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/space2depth.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/split.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/split.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/tfslice.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/tfslice.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/topk.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/topk.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/transpose.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/transpose.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/attention.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/attention.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/attention_mask.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/attention_mask.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/clip.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/clip.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/convolution.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/convolution.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/deconvolution.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/deconvolution.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/depthwise_convolution.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/depthwise_convolution.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/depthwise_pointwise_convolution.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/depthwise_pointwise_convolution.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/dequantize.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/dequantize.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/detectionoutput.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/detectionoutput.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/eltwise.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/eltwise.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/attention.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/attention.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/attention_mask.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/attention_mask.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/clip.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/clip.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/convolution.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/convolution.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/convolution_1x1_direct.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/convolution_1x1_direct.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/convolution_direct.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/convolution_direct.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/convolution_direct_nchw.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/convolution_direct_nchw.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/convolution_transform.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/convolution_transform.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/convolution_winograd.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/convolution_winograd.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/deconvolution_transform.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/deconvolution_transform.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/depthwise_convolution_direct.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/depthwise_convolution_direct.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/depthwise_convolution_transform.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/depthwise_convolution_transform.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/depthwise_pointwise_convolution.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/depthwise_pointwise_convolution.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/depthwise_pointwise_convolution_transform.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/depthwise_pointwise_convolution_transform.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/detectionoutput.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/detectionoutput.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/eltwise.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/eltwise.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/gru.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/gru.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/instance_norm.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/instance_norm.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/l2norm.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/l2norm.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/layer_norm.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/layer_norm.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/lstm.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/lstm.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/pooling.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/pooling.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/pooling_avx512.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/pooling_avx512.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/pooling_bp.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/pooling_bp.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/pooling_nchw.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/pooling_nchw.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/prelu.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/prelu.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/rnn.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/rnn.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/scale.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/scale.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/scaled_dot_product_attention.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/scaled_dot_product_attention.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/softmax.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/fp32/softmax.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/instance_norm.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/instance_norm.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/int32/clip.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/int32/clip.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/int32/scale.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/int32/scale.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/layer_norm.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/layer_norm.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/pooling.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/pooling.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/prelu.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/prelu.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/quantize.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/quantize.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/rnn.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/rnn.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/scale.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/scale.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/scaled_dot_product_attention.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/scaled_dot_product_attention.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/x86/softmax.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/x86/softmax.cpp.o.d"
+  "CMakeFiles/tensor.dir/cpu/yolov3detectionoutput.cpp.o"
+  "CMakeFiles/tensor.dir/cpu/yolov3detectionoutput.cpp.o.d"
+  "CMakeFiles/tensor.dir/cum.cpp.o"
+  "CMakeFiles/tensor.dir/cum.cpp.o.d"
+  "CMakeFiles/tensor.dir/deconvolution.cpp.o"
+  "CMakeFiles/tensor.dir/deconvolution.cpp.o.d"
+  "CMakeFiles/tensor.dir/depth2space.cpp.o"
+  "CMakeFiles/tensor.dir/depth2space.cpp.o.d"
+  "CMakeFiles/tensor.dir/depthwise_convolution.cpp.o"
+  "CMakeFiles/tensor.dir/depthwise_convolution.cpp.o.d"
+  "CMakeFiles/tensor.dir/depthwise_pointwise_convolution.cpp.o"
+  "CMakeFiles/tensor.dir/depthwise_pointwise_convolution.cpp.o.d"
+  "CMakeFiles/tensor.dir/dequantize.cpp.o"
+  "CMakeFiles/tensor.dir/dequantize.cpp.o.d"
+  "CMakeFiles/tensor.dir/detectionoutput.cpp.o"
+  "CMakeFiles/tensor.dir/detectionoutput.cpp.o.d"
+  "CMakeFiles/tensor.dir/einsum.cpp.o"
+  "CMakeFiles/tensor.dir/einsum.cpp.o.d"
+  "CMakeFiles/tensor.dir/eltwise.cpp.o"
+  "CMakeFiles/tensor.dir/eltwise.cpp.o.d"
+  "CMakeFiles/tensor.dir/embedding.cpp.o"
+  "CMakeFiles/tensor.dir/embedding.cpp.o.d"
+  "CMakeFiles/tensor.dir/expand.cpp.o"
+  "CMakeFiles/tensor.dir/expand.cpp.o.d"
+  "CMakeFiles/tensor.dir/fully_connected.cpp.o"
+  "CMakeFiles/tensor.dir/fully_connected.cpp.o.d"
+  "CMakeFiles/tensor.dir/gat.cpp.o"
+  "CMakeFiles/tensor.dir/gat.cpp.o.d"
+  "CMakeFiles/tensor.dir/gather.cpp.o"
+  "CMakeFiles/tensor.dir/gather.cpp.o.d"
+  "CMakeFiles/tensor.dir/generate_proposals.cpp.o"
+  "CMakeFiles/tensor.dir/generate_proposals.cpp.o.d"
+  "CMakeFiles/tensor.dir/instance_norm.cpp.o"
+  "CMakeFiles/tensor.dir/instance_norm.cpp.o.d"
+  "CMakeFiles/tensor.dir/kl.cpp.o"
+  "CMakeFiles/tensor.dir/kl.cpp.o.d"
+  "CMakeFiles/tensor.dir/l2norm.cpp.o"
+  "CMakeFiles/tensor.dir/l2norm.cpp.o.d"
+  "CMakeFiles/tensor.dir/layer_norm.cpp.o"
+  "CMakeFiles/tensor.dir/layer_norm.cpp.o.d"
+  "CMakeFiles/tensor.dir/matmul.cpp.o"
+  "CMakeFiles/tensor.dir/matmul.cpp.o.d"
+  "CMakeFiles/tensor.dir/non_max_suppression.cpp.o"
+  "CMakeFiles/tensor.dir/non_max_suppression.cpp.o.d"
+  "CMakeFiles/tensor.dir/non_zero.cpp.o"
+  "CMakeFiles/tensor.dir/non_zero.cpp.o.d"
+  "CMakeFiles/tensor.dir/onehot.cpp.o"
+  "CMakeFiles/tensor.dir/onehot.cpp.o.d"
+  "CMakeFiles/tensor.dir/padding.cpp.o"
+  "CMakeFiles/tensor.dir/padding.cpp.o.d"
+  "CMakeFiles/tensor.dir/pooling.cpp.o"
+  "CMakeFiles/tensor.dir/pooling.cpp.o.d"
+  "CMakeFiles/tensor.dir/pooling_bp.cpp.o"
+  "CMakeFiles/tensor.dir/pooling_bp.cpp.o.d"
+  "CMakeFiles/tensor.dir/post_ops.cpp.o"
+  "CMakeFiles/tensor.dir/post_ops.cpp.o.d"
+  "CMakeFiles/tensor.dir/power.cpp.o"
+  "CMakeFiles/tensor.dir/power.cpp.o.d"
+  "CMakeFiles/tensor.dir/preallocated_memory.cpp.o"
+  "CMakeFiles/tensor.dir/preallocated_memory.cpp.o.d"
+  "CMakeFiles/tensor.dir/prelu.cpp.o"
+  "CMakeFiles/tensor.dir/prelu.cpp.o.d"
+  "CMakeFiles/tensor.dir/priorbox.cpp.o"
+  "CMakeFiles/tensor.dir/priorbox.cpp.o.d"
+  "CMakeFiles/tensor.dir/quantize.cpp.o"
+  "CMakeFiles/tensor.dir/quantize.cpp.o.d"
+  "CMakeFiles/tensor.dir/random.cpp.o"
+  "CMakeFiles/tensor.dir/random.cpp.o.d"
+  "CMakeFiles/tensor.dir/reduction.cpp.o"
+  "CMakeFiles/tensor.dir/reduction.cpp.o.d"
+  "CMakeFiles/tensor.dir/reshape.cpp.o"
+  "CMakeFiles/tensor.dir/reshape.cpp.o.d"
+  "CMakeFiles/tensor.dir/rnn.cpp.o"
+  "CMakeFiles/tensor.dir/rnn.cpp.o.d"
+  "CMakeFiles/tensor.dir/roialign.cpp.o"
+  "CMakeFiles/tensor.dir/roialign.cpp.o.d"
+  "CMakeFiles/tensor.dir/scale.cpp.o"
+  "CMakeFiles/tensor.dir/scale.cpp.o.d"
+  "CMakeFiles/tensor.dir/scaled_dot_product_attention.cpp.o"
+  "CMakeFiles/tensor.dir/scaled_dot_product_attention.cpp.o.d"
+  "CMakeFiles/tensor.dir/scan.cpp.o"
+  "CMakeFiles/tensor.dir/scan.cpp.o.d"
+  "CMakeFiles/tensor.dir/scatter.cpp.o"
+  "CMakeFiles/tensor.dir/scatter.cpp.o.d"
+  "CMakeFiles/tensor.dir/select.cpp.o"
+  "CMakeFiles/tensor.dir/select.cpp.o.d"
+  "CMakeFiles/tensor.dir/slice.cpp.o"
+  "CMakeFiles/tensor.dir/slice.cpp.o.d"
+  "CMakeFiles/tensor.dir/softmax.cpp.o"
+  "CMakeFiles/tensor.dir/softmax.cpp.o.d"
+  "CMakeFiles/tensor.dir/space2depth.cpp.o"
+  "CMakeFiles/tensor.dir/space2depth.cpp.o.d"
+  "CMakeFiles/tensor.dir/split.cpp.o"
+  "CMakeFiles/tensor.dir/split.cpp.o.d"
+  "CMakeFiles/tensor.dir/squeeze.cpp.o"
+  "CMakeFiles/tensor.dir/squeeze.cpp.o.d"
+  "CMakeFiles/tensor.dir/tfslice.cpp.o"
+  "CMakeFiles/tensor.dir/tfslice.cpp.o.d"
+  "CMakeFiles/tensor.dir/tile.cpp.o"
+  "CMakeFiles/tensor.dir/tile.cpp.o.d"
+  "CMakeFiles/tensor.dir/topk.cpp.o"
+  "CMakeFiles/tensor.dir/topk.cpp.o.d"
+  "CMakeFiles/tensor.dir/transpose.cpp.o"
+  "CMakeFiles/tensor.dir/transpose.cpp.o.d"
+  "CMakeFiles/tensor.dir/unpooling.cpp.o"
+  "CMakeFiles/tensor.dir/unpooling.cpp.o.d"
+  "CMakeFiles/tensor.dir/unsqueeze.cpp.o"
+  "CMakeFiles/tensor.dir/unsqueeze.cpp.o.d"
+  "CMakeFiles/tensor.dir/where.cpp.o"
+  "CMakeFiles/tensor.dir/where.cpp.o.d"
+  "CMakeFiles/tensor.dir/yolov3detectionoutput.cpp.o"
+  "CMakeFiles/tensor.dir/yolov3detectionoutput.cpp.o.d"
+  "libtensor.pdb"
+  "libtensor.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tensor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,371 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tensor_static.dir/activation.cpp.o"
+  "CMakeFiles/tensor_static.dir/activation.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/argmax.cpp.o"
+  "CMakeFiles/tensor_static.dir/argmax.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/attention.cpp.o"
+  "CMakeFiles/tensor_static.dir/attention.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/attention_mask.cpp.o"
+  "CMakeFiles/tensor_static.dir/attention_mask.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/batch_norm.cpp.o"
+  "CMakeFiles/tensor_static.dir/batch_norm.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/bilateral_slice_apply.cpp.o"
+  "CMakeFiles/tensor_static.dir/bilateral_slice_apply.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cast.cpp.o"
+  "CMakeFiles/tensor_static.dir/cast.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/channel_resize.cpp.o"
+  "CMakeFiles/tensor_static.dir/channel_resize.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/check.cpp.o"
+  "CMakeFiles/tensor_static.dir/check.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/clip.cpp.o"
+  "CMakeFiles/tensor_static.dir/clip.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/concat.cpp.o"
+  "CMakeFiles/tensor_static.dir/concat.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/convolution.cpp.o"
+  "CMakeFiles/tensor_static.dir/convolution.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/copy.cpp.o"
+  "CMakeFiles/tensor_static.dir/copy.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/activation.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/activation.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/argmax.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/argmax.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/bilateral_slice_apply.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/bilateral_slice_apply.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/cast.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/cast.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/check.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/check.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/clip.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/clip.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/concat.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/concat.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/convolution.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/convolution.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/deconvolution.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/deconvolution.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/depth2space.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/depth2space.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/depthwise_convolution.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/depthwise_convolution.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/depthwise_pointwise_convolution.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/depthwise_pointwise_convolution.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/detectionoutput.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/detectionoutput.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/eltwise.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/eltwise.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/embedding.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/embedding.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/gat.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/gat.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/gather.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/gather.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/general/attention.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/general/attention.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/general/attention_mask.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/general/attention_mask.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/general/clip.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/general/clip.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/general/convolution.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/general/convolution.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/general/cum.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/general/cum.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/general/deconvolution.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/general/deconvolution.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/general/depthwise_convolution.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/general/depthwise_convolution.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/general/depthwise_pointwise_convolution.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/general/depthwise_pointwise_convolution.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/general/dequantize.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/general/dequantize.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/general/detectionoutput.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/general/detectionoutput.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/general/eltwise.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/general/eltwise.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/general/layer_norm.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/general/layer_norm.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/general/padding.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/general/padding.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/general/pooling.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/general/pooling.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/general/pooling_bp.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/general/pooling_bp.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/general/prelu.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/general/prelu.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/general/rnn.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/general/rnn.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/general/scale.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/general/scale.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/general/scaled_dot_product_attention.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/general/scaled_dot_product_attention.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/general/softmax.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/general/softmax.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/general/transpose.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/general/transpose.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/instance_norm.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/instance_norm.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/l2norm.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/l2norm.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/non_max_suppression.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/non_max_suppression.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/non_zero.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/non_zero.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/onehot.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/onehot.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/padding.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/padding.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/post_ops.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/post_ops.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/power.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/power.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/priorbox.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/priorbox.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/quantize.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/quantize.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/reduction.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/reduction.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/requantize.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/requantize.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/reshape.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/reshape.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/rnn.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/rnn.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/roialign.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/roialign.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/scale.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/scale.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/scatter.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/scatter.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/slice.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/slice.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/space2depth.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/space2depth.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/split.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/split.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/tfslice.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/tfslice.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/topk.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/topk.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/transpose.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/transpose.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/attention.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/attention.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/attention_mask.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/attention_mask.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/clip.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/clip.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/convolution.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/convolution.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/deconvolution.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/deconvolution.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/depthwise_convolution.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/depthwise_convolution.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/depthwise_pointwise_convolution.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/depthwise_pointwise_convolution.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/dequantize.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/dequantize.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/detectionoutput.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/detectionoutput.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/eltwise.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/eltwise.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/attention.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/attention.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/attention_mask.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/attention_mask.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/clip.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/clip.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/convolution.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/convolution.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/convolution_1x1_direct.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/convolution_1x1_direct.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/convolution_direct.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/convolution_direct.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/convolution_direct_nchw.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/convolution_direct_nchw.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/convolution_transform.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/convolution_transform.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/convolution_winograd.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/convolution_winograd.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/deconvolution_transform.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/deconvolution_transform.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/depthwise_convolution_direct.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/depthwise_convolution_direct.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/depthwise_convolution_transform.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/depthwise_convolution_transform.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/depthwise_pointwise_convolution.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/depthwise_pointwise_convolution.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/depthwise_pointwise_convolution_transform.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/depthwise_pointwise_convolution_transform.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/detectionoutput.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/detectionoutput.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/eltwise.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/eltwise.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/gru.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/gru.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/instance_norm.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/instance_norm.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/l2norm.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/l2norm.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/layer_norm.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/layer_norm.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/lstm.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/lstm.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/pooling.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/pooling.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/pooling_avx512.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/pooling_avx512.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/pooling_bp.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/pooling_bp.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/pooling_nchw.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/pooling_nchw.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/prelu.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/prelu.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/rnn.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/rnn.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/scale.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/scale.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/scaled_dot_product_attention.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/scaled_dot_product_attention.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/softmax.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/fp32/softmax.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/instance_norm.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/instance_norm.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/int32/clip.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/int32/clip.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/int32/scale.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/int32/scale.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/layer_norm.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/layer_norm.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/pooling.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/pooling.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/prelu.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/prelu.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/quantize.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/quantize.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/rnn.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/rnn.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/scale.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/scale.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/scaled_dot_product_attention.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/scaled_dot_product_attention.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/x86/softmax.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/x86/softmax.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cpu/yolov3detectionoutput.cpp.o"
+  "CMakeFiles/tensor_static.dir/cpu/yolov3detectionoutput.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/cum.cpp.o"
+  "CMakeFiles/tensor_static.dir/cum.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/deconvolution.cpp.o"
+  "CMakeFiles/tensor_static.dir/deconvolution.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/depth2space.cpp.o"
+  "CMakeFiles/tensor_static.dir/depth2space.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/depthwise_convolution.cpp.o"
+  "CMakeFiles/tensor_static.dir/depthwise_convolution.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/depthwise_pointwise_convolution.cpp.o"
+  "CMakeFiles/tensor_static.dir/depthwise_pointwise_convolution.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/dequantize.cpp.o"
+  "CMakeFiles/tensor_static.dir/dequantize.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/detectionoutput.cpp.o"
+  "CMakeFiles/tensor_static.dir/detectionoutput.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/einsum.cpp.o"
+  "CMakeFiles/tensor_static.dir/einsum.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/eltwise.cpp.o"
+  "CMakeFiles/tensor_static.dir/eltwise.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/embedding.cpp.o"
+  "CMakeFiles/tensor_static.dir/embedding.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/expand.cpp.o"
+  "CMakeFiles/tensor_static.dir/expand.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/fully_connected.cpp.o"
+  "CMakeFiles/tensor_static.dir/fully_connected.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/gat.cpp.o"
+  "CMakeFiles/tensor_static.dir/gat.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/gather.cpp.o"
+  "CMakeFiles/tensor_static.dir/gather.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/generate_proposals.cpp.o"
+  "CMakeFiles/tensor_static.dir/generate_proposals.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/instance_norm.cpp.o"
+  "CMakeFiles/tensor_static.dir/instance_norm.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/kl.cpp.o"
+  "CMakeFiles/tensor_static.dir/kl.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/l2norm.cpp.o"
+  "CMakeFiles/tensor_static.dir/l2norm.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/layer_norm.cpp.o"
+  "CMakeFiles/tensor_static.dir/layer_norm.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/matmul.cpp.o"
+  "CMakeFiles/tensor_static.dir/matmul.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/non_max_suppression.cpp.o"
+  "CMakeFiles/tensor_static.dir/non_max_suppression.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/non_zero.cpp.o"
+  "CMakeFiles/tensor_static.dir/non_zero.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/onehot.cpp.o"
+  "CMakeFiles/tensor_static.dir/onehot.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/padding.cpp.o"
+  "CMakeFiles/tensor_static.dir/padding.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/pooling.cpp.o"
+  "CMakeFiles/tensor_static.dir/pooling.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/pooling_bp.cpp.o"
+  "CMakeFiles/tensor_static.dir/pooling_bp.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/post_ops.cpp.o"
+  "CMakeFiles/tensor_static.dir/post_ops.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/power.cpp.o"
+  "CMakeFiles/tensor_static.dir/power.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/preallocated_memory.cpp.o"
+  "CMakeFiles/tensor_static.dir/preallocated_memory.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/prelu.cpp.o"
+  "CMakeFiles/tensor_static.dir/prelu.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/priorbox.cpp.o"
+  "CMakeFiles/tensor_static.dir/priorbox.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/quantize.cpp.o"
+  "CMakeFiles/tensor_static.dir/quantize.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/random.cpp.o"
+  "CMakeFiles/tensor_static.dir/random.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/reduction.cpp.o"
+  "CMakeFiles/tensor_static.dir/reduction.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/reshape.cpp.o"
+  "CMakeFiles/tensor_static.dir/reshape.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/rnn.cpp.o"
+  "CMakeFiles/tensor_static.dir/rnn.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/roialign.cpp.o"
+  "CMakeFiles/tensor_static.dir/roialign.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/scale.cpp.o"
+  "CMakeFiles/tensor_static.dir/scale.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/scaled_dot_product_attention.cpp.o"
+  "CMakeFiles/tensor_static.dir/scaled_dot_product_attention.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/scan.cpp.o"
+  "CMakeFiles/tensor_static.dir/scan.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/scatter.cpp.o"
+  "CMakeFiles/tensor_static.dir/scatter.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/select.cpp.o"
+  "CMakeFiles/tensor_static.dir/select.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/slice.cpp.o"
+  "CMakeFiles/tensor_static.dir/slice.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/softmax.cpp.o"
+  "CMakeFiles/tensor_static.dir/softmax.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/space2depth.cpp.o"
+  "CMakeFiles/tensor_static.dir/space2depth.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/split.cpp.o"
+  "CMakeFiles/tensor_static.dir/split.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/squeeze.cpp.o"
+  "CMakeFiles/tensor_static.dir/squeeze.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/tfslice.cpp.o"
+  "CMakeFiles/tensor_static.dir/tfslice.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/tile.cpp.o"
+  "CMakeFiles/tensor_static.dir/tile.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/topk.cpp.o"
+  "CMakeFiles/tensor_static.dir/topk.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/transpose.cpp.o"
+  "CMakeFiles/tensor_static.dir/transpose.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/unpooling.cpp.o"
+  "CMakeFiles/tensor_static.dir/unpooling.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/unsqueeze.cpp.o"
+  "CMakeFiles/tensor_static.dir/unsqueeze.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/where.cpp.o"
+  "CMakeFiles/tensor_static.dir/where.cpp.o.d"
+  "CMakeFiles/tensor_static.dir/yolov3detectionoutput.cpp.o"
+  "CMakeFiles/tensor_static.dir/yolov3detectionoutput.cpp.o.d"
+  "libtensor.a"
+  "libtensor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tensor_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_operators.dir/benchmark_operators.cpp.o"
+  "CMakeFiles/benchmark_operators.dir/benchmark_operators.cpp.o.d"
+  "benchmark_operators"
+  "benchmark_operators.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_operators.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_argmax.dir/test_argmax.cpp.o"
+  "CMakeFiles/test_argmax.dir/test_argmax.cpp.o.d"
+  "test_argmax"
+  "test_argmax.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_argmax.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
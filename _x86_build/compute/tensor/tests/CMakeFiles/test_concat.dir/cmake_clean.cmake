@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_concat.dir/test_concat.cpp.o"
+  "CMakeFiles/test_concat.dir/test_concat.cpp.o.d"
+  "test_concat"
+  "test_concat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_concat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
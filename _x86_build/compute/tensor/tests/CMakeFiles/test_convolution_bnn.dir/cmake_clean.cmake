@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_convolution_bnn.dir/test_convolution_bnn.cpp.o"
+  "CMakeFiles/test_convolution_bnn.dir/test_convolution_bnn.cpp.o.d"
+  "test_convolution_bnn"
+  "test_convolution_bnn.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_convolution_bnn.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_convolution_int8.dir/test_convolution_int8.cpp.o"
+  "CMakeFiles/test_convolution_int8.dir/test_convolution_int8.cpp.o.d"
+  "test_convolution_int8"
+  "test_convolution_int8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_convolution_int8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
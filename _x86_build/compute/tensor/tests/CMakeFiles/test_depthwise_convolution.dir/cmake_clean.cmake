@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_depthwise_convolution.dir/test_depthwise_convolution.cpp.o"
+  "CMakeFiles/test_depthwise_convolution.dir/test_depthwise_convolution.cpp.o.d"
+  "test_depthwise_convolution"
+  "test_depthwise_convolution.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_depthwise_convolution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
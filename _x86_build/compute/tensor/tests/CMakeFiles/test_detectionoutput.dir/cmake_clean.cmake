@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_detectionoutput.dir/test_detectionoutput.cpp.o"
+  "CMakeFiles/test_detectionoutput.dir/test_detectionoutput.cpp.o.d"
+  "test_detectionoutput"
+  "test_detectionoutput.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_detectionoutput.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_dilated_convolution.dir/test_dilated_convolution.cpp.o"
+  "CMakeFiles/test_dilated_convolution.dir/test_dilated_convolution.cpp.o.d"
+  "test_dilated_convolution"
+  "test_dilated_convolution.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_dilated_convolution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_fully_connected.dir/test_fully_connected.cpp.o"
+  "CMakeFiles/test_fully_connected.dir/test_fully_connected.cpp.o.d"
+  "test_fully_connected"
+  "test_fully_connected.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_fully_connected.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_l2norm.dir/test_l2norm.cpp.o"
+  "CMakeFiles/test_l2norm.dir/test_l2norm.cpp.o.d"
+  "test_l2norm"
+  "test_l2norm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_l2norm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_layer_norm.dir/test_layer_norm.cpp.o"
+  "CMakeFiles/test_layer_norm.dir/test_layer_norm.cpp.o.d"
+  "test_layer_norm"
+  "test_layer_norm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_layer_norm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_non_max_suppression.dir/test_non_max_suppression.cpp.o"
+  "CMakeFiles/test_non_max_suppression.dir/test_non_max_suppression.cpp.o.d"
+  "test_non_max_suppression"
+  "test_non_max_suppression.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_non_max_suppression.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_pooling_bp.dir/test_pooling_bp.cpp.o"
+  "CMakeFiles/test_pooling_bp.dir/test_pooling_bp.cpp.o.d"
+  "test_pooling_bp"
+  "test_pooling_bp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_pooling_bp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_post_ops.dir/test_post_ops.cpp.o"
+  "CMakeFiles/test_post_ops.dir/test_post_ops.cpp.o.d"
+  "test_post_ops"
+  "test_post_ops.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_post_ops.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
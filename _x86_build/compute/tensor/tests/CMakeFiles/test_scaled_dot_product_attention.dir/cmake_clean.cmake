@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_scaled_dot_product_attention.dir/test_scaled_dot_product_attention.cpp.o"
+  "CMakeFiles/test_scaled_dot_product_attention.dir/test_scaled_dot_product_attention.cpp.o.d"
+  "test_scaled_dot_product_attention"
+  "test_scaled_dot_product_attention.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_scaled_dot_product_attention.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bolt_library"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/bolt_library.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
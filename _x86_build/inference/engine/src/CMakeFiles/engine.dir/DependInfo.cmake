@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/inference/engine/src/batch_server.cpp" "inference/engine/src/CMakeFiles/engine.dir/batch_server.cpp.o" "gcc" "inference/engine/src/CMakeFiles/engine.dir/batch_server.cpp.o.d"
+  "/root/repo/inference/engine/src/bolt_c.cpp" "inference/engine/src/CMakeFiles/engine.dir/bolt_c.cpp.o" "gcc" "inference/engine/src/CMakeFiles/engine.dir/bolt_c.cpp.o.d"
+  "/root/repo/inference/engine/src/bolt_c_simplify.cpp" "inference/engine/src/CMakeFiles/engine.dir/bolt_c_simplify.cpp.o" "gcc" "inference/engine/src/CMakeFiles/engine.dir/bolt_c_simplify.cpp.o.d"
+  "/root/repo/inference/engine/src/cnn.cpp" "inference/engine/src/CMakeFiles/engine.dir/cnn.cpp.o" "gcc" "inference/engine/src/CMakeFiles/engine.dir/cnn.cpp.o.d"
+  "/root/repo/inference/engine/src/model.cpp" "inference/engine/src/CMakeFiles/engine.dir/model.cpp.o" "gcc" "inference/engine/src/CMakeFiles/engine.dir/model.cpp.o.d"
+  "/root/repo/inference/engine/src/tdnn_fully_connected_cpu.cpp" "inference/engine/src/CMakeFiles/engine.dir/tdnn_fully_connected_cpu.cpp.o" "gcc" "inference/engine/src/CMakeFiles/engine.dir/tdnn_fully_connected_cpu.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_x86_build/compute/tensor/src/CMakeFiles/tensor.dir/DependInfo.cmake"
+  "/root/repo/_x86_build/compute/image/src/CMakeFiles/image.dir/DependInfo.cmake"
+  "/root/repo/_x86_build/common/model_spec/src/CMakeFiles/model_spec.dir/DependInfo.cmake"
+  "/root/repo/_x86_build/compute/blas_enhance/src/CMakeFiles/blas_enhance.dir/DependInfo.cmake"
+  "/root/repo/_x86_build/common/uni/src/CMakeFiles/uni.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
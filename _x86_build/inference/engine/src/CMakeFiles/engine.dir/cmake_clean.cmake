@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/engine.dir/batch_server.cpp.o"
+  "CMakeFiles/engine.dir/batch_server.cpp.o.d"
+  "CMakeFiles/engine.dir/bolt_c.cpp.o"
+  "CMakeFiles/engine.dir/bolt_c.cpp.o.d"
+  "CMakeFiles/engine.dir/bolt_c_simplify.cpp.o"
+  "CMakeFiles/engine.dir/bolt_c_simplify.cpp.o.d"
+  "CMakeFiles/engine.dir/cnn.cpp.o"
+  "CMakeFiles/engine.dir/cnn.cpp.o.d"
+  "CMakeFiles/engine.dir/model.cpp.o"
+  "CMakeFiles/engine.dir/model.cpp.o.d"
+  "CMakeFiles/engine.dir/tdnn_fully_connected_cpu.cpp.o"
+  "CMakeFiles/engine.dir/tdnn_fully_connected_cpu.cpp.o.d"
+  "libengine.pdb"
+  "libengine.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/engine.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
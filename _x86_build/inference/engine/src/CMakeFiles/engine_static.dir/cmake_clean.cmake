@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/engine_static.dir/batch_server.cpp.o"
+  "CMakeFiles/engine_static.dir/batch_server.cpp.o.d"
+  "CMakeFiles/engine_static.dir/bolt_c.cpp.o"
+  "CMakeFiles/engine_static.dir/bolt_c.cpp.o.d"
+  "CMakeFiles/engine_static.dir/bolt_c_simplify.cpp.o"
+  "CMakeFiles/engine_static.dir/bolt_c_simplify.cpp.o.d"
+  "CMakeFiles/engine_static.dir/cnn.cpp.o"
+  "CMakeFiles/engine_static.dir/cnn.cpp.o.d"
+  "CMakeFiles/engine_static.dir/model.cpp.o"
+  "CMakeFiles/engine_static.dir/model.cpp.o.d"
+  "CMakeFiles/engine_static.dir/tdnn_fully_connected_cpu.cpp.o"
+  "CMakeFiles/engine_static.dir/tdnn_fully_connected_cpu.cpp.o.d"
+  "libengine.a"
+  "libengine.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/engine_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
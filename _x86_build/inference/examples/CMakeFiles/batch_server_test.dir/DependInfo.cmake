@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/inference/examples/benchmark/batch_server_test.cpp" "inference/examples/CMakeFiles/batch_server_test.dir/benchmark/batch_server_test.cpp.o" "gcc" "inference/examples/CMakeFiles/batch_server_test.dir/benchmark/batch_server_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_x86_build/inference/engine/src/CMakeFiles/engine_static.dir/DependInfo.cmake"
+  "/root/repo/_x86_build/common/model_spec/src/CMakeFiles/model_spec_static.dir/DependInfo.cmake"
+  "/root/repo/_x86_build/common/uni/src/CMakeFiles/uni_static.dir/DependInfo.cmake"
+  "/root/repo/_x86_build/compute/image/src/CMakeFiles/image_static.dir/DependInfo.cmake"
+  "/root/repo/_x86_build/compute/tensor/src/CMakeFiles/tensor_static.dir/DependInfo.cmake"
+  "/root/repo/_x86_build/compute/blas_enhance/src/CMakeFiles/blas_enhance_static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
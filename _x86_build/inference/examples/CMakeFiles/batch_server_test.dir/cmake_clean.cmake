@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/batch_server_test.dir/benchmark/batch_server_test.cpp.o"
+  "CMakeFiles/batch_server_test.dir/benchmark/batch_server_test.cpp.o.d"
+  "batch_server_test"
+  "batch_server_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/batch_server_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/schedule_benchmark.dir/benchmark/schedule_benchmark.cpp.o"
+  "CMakeFiles/schedule_benchmark.dir/benchmark/schedule_benchmark.cpp.o.d"
+  "schedule_benchmark"
+  "schedule_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/schedule_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -76,7 +76,8 @@ macro (set_c_cxx_flags)
         endif ()
     endif(USE_OPENMP)
 
-    if (USE_THREAD_SAFE OR USE_CAFFE OR USE_ONNX OR USE_FLOW OR WIN32)
+    # inference engine uses threads to run independent operators concurrently
+    if (USE_THREAD_SAFE OR USE_CAFFE OR USE_ONNX OR USE_FLOW OR WIN32 OR (NOT USE_LITE))
         set(COMMON_FLAGS "${COMMON_FLAGS} -pthread")
     endif ()
 
@@ -93,6 +93,14 @@ public:
         }
     }
 
+    // val is a part of a bigger buffer that can hold capacity bytes.
+    void set_shared_ptr(std::shared_ptr<U8> val, U32 capacity)
+    {
+        this->val = val;
+        this->allocated = true;
+        this->capacitySize = UNI_MAX(this->bytes(), capacity);
+    }
+
     std::shared_ptr<U8> get_shared_ptr()
     {
         return this->val;
@@ -18,7 +18,7 @@
 #include "model_spec.h"
 #include "memory_cpu.h"
 
-inline void *mt_malloc(U32 size)
+inline void *mt_malloc(size_t size)
 {
     return UNI_OPERATOR_NEW(size);
 }
@@ -35,8 +35,16 @@ inline void mt_free(T *&p)
 template <typename T>
 inline void mt_free(T *&p, ModelSpec *spec)
 {
-    if (spec == nullptr || spec->file == nullptr || (uintptr_t(p) < uintptr_t(spec->file->content)) ||
-        (uintptr_t(p) >= uintptr_t(spec->file->content + spec->file->length))) {
+    bool mapped = false;
+    for (ModelFileDescriptor *file = (spec == nullptr) ? nullptr : spec->file; file != nullptr;
+         file = file->next) {
+        if ((uintptr_t(p) >= uintptr_t(file->content)) &&
+            (uintptr_t(p) < uintptr_t(file->content + file->length))) {
+            mapped = true;
+            break;
+        }
+    }
+    if (!mapped) {
         UNI_OPERATOR_DELETE(p);
     }
     p = nullptr;
@@ -20,8 +20,10 @@
 #include <pthread.h>
 #endif
 
-static const I32 sg_boltVersion = 20220831;
+static const I32 sg_boltVersion = 20241018;
 static const I32 sg_magicNumber = 1141119;
+// models of this version and later keep weight data in page aligned sections with 64-bit offsets.
+static const I32 sg_boltWeightSectionVersion = 20241018;
 
 #pragma pack(8)
 typedef struct OperatorSpec {
@@ -40,9 +42,9 @@ typedef struct OperatorSpec {
 typedef struct WeightSpec {
     I8 op_name[NAME_LEN];
     DataType mdt = DT_U8;
-    U32 bytes_of_weight = 0;
+    U64 bytes_of_weight = 0;
     U8 *weight = NULL;
-    U32 bytes_of_vec = 0;
+    U64 bytes_of_vec = 0;
     U8 *vec = NULL;
     // Merged FC may have multiple weight scales
     U32 num_quant_scale = 0;
@@ -68,6 +70,8 @@ typedef struct ModelFileDescriptor {
 #else
     I32 file;
 #endif
+    // weight files that the model refers to
+    struct ModelFileDescriptor *next = NULL;
 } ModelFileDescriptor;
 
 typedef struct ModelSpec{
@@ -98,7 +102,9 @@ typedef struct ModelSpec{
 #pragma pack()
 
 EE mt_create_model(ModelSpec *spec);
-EE serialize_model_to_file(const ModelSpec *spec, const char *filePath);
+// weightFileBytes > 0 moves weights to side files <filePath>.weight<i> of at most that many bytes
+// (a larger weight takes a file of its own), 0 keeps weights in the model file.
+EE serialize_model_to_file(const ModelSpec *spec, const char *filePath, U64 weightFileBytes = 0);
 EE deserialize_model_from_file(
     const char *filePath, ModelSpec *spec, DataType targetDt, bool useFileStream = false);
 EE mt_destroy_model(ModelSpec *spec);
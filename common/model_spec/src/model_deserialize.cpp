@@ -15,12 +15,14 @@
 #include <map>
 #include <set>
 #include <vector>
+#include <stdint.h>
 #if defined(__GLIBC__) || defined(__linux__)
 #include <sys/mman.h>
 #include <fcntl.h>
 #include <sys/stat.h>
 #endif
 
+#include "uni.h"
 #include "model_common.h"
 #include "profiling.h"
 #include "thread_affinity.h"
@@ -184,26 +186,30 @@ void dequantize_int8_weight(int num, F32 scale, INT8 *q, T *d)
     }
 }
 
+// scale is shared by group weights, group = num / num_scale.
 template <DataType dt, typename T>
-void dequantize_int4_weight(int num, F32 scale, INT8 *q, T *d)
+void dequantize_int4_weight(int num, const F32 *scale, int num_scale, INT8 *q, T *d)
 {
-    F32 factor = 1 / scale;
-    T table[16];
-    for (int i = 0; i < 15; i++) {
-        F32 value = factor * (i - 7);
+    int group = num / num_scale;
+    for (int g = 0; g < num_scale; g++) {
+        F32 factor = 1 / scale[g];
+        T table[16];
+        for (int i = 0; i < 15; i++) {
+            F32 value = factor * (i - 7);
 #ifndef _USE_FP16_TYPE
-        if (dt != DT_F16) {
+            if (dt != DT_F16) {
 #endif
-            table[i] = value;
+                table[i] = value;
 #ifndef _USE_FP16_TYPE
-        } else {
-            transformFromFloat(DT_F16, &value, table + i, 1);
-        }
+            } else {
+                transformFromFloat(DT_F16, &value, table + i, 1);
+            }
 #endif
-    }
-    T *mid = table;
-    for (int i = 0; i < num; i++) {
-        d[i] = *(mid + ((q[i / 2] >> ((i % 2) * 4)) & 0xF));
+        }
+        T *mid = table;
+        for (int i = g * group; i < (g + 1) * group; i++) {
+            d[i] = *(mid + ((q[i / 2] >> ((i % 2) * 4)) & 0xF));
+        }
     }
 }
 
@@ -221,6 +227,31 @@ void dequantize_int4_u8_q(int num, INT8 *q, UINT8 *d)
     }
 }
 
+// group scales are requantized to one scale of int8, so that the group with the widest range
+// takes [-127, 127]. d is shifted by offset(128 for u8), return the new scale.
+F32 requantize_int4_int8(int num, const F32 *scale, int num_scale, INT8 *q, INT8 *d, int offset)
+{
+    F32 minScale = scale[0];
+    for (int g = 1; g < num_scale; g++) {
+        minScale = UNI_MIN(minScale, scale[g]);
+    }
+    F32 ret = minScale * 127 / 7;
+    int group = num / num_scale;
+    for (int g = 0; g < num_scale; g++) {
+        F32 factor = ret / scale[g];
+        for (int i = g * group; i < (g + 1) * group; i++) {
+            int value = round((((q[i / 2] >> ((i % 2) * 4)) & 0xF) - 7) * factor);
+            value = UNI_MAX(UNI_MIN(value, 127), -127);
+            if (offset == 0) {
+                d[i] = value;
+            } else {
+                ((UINT8 *)d)[i] = value + offset;
+            }
+        }
+    }
+    return ret;
+}
+
 Arch updateInferDtByArch(ModelSpec *spec, DataType targetDt)
 {
     Arch arch = get_cpu_arch();
@@ -274,41 +305,53 @@ void TransWeightFromBINToF32(WeightSpec *ptr, INT8 *src)
 void TransWeightFromI4ToF32(WeightSpec *ptr, INT8 *src)
 {
     ptr->bytes_of_weight *= 8;
-    CHECK_REQUIREMENT(1 == ptr->num_quant_scale && 1 == ptr->weight_scale[0].num_scale);
+    CHECK_REQUIREMENT(1 == ptr->num_quant_scale && ptr->weight_scale[0].num_scale > 0);
     ptr->weight = (U8 *)mt_malloc(ptr->bytes_of_weight);
-    F32 scale = ptr->weight_scale[0].scale[0];
-    dequantize_int4_weight<DT_F32, F32>(
-        ptr->bytes_of_weight / 4, scale, (INT8 *)src, (F32 *)(ptr->weight));
+    dequantize_int4_weight<DT_F32, F32>(ptr->bytes_of_weight / 4, ptr->weight_scale[0].scale,
+        ptr->weight_scale[0].num_scale, (INT8 *)src, (F32 *)(ptr->weight));
+    ptr->weight_scale[0].num_scale = 1;
     ptr->weight_scale[0].scale[0] = 0;
 }
 
 void TransWeightFromI4ToF16(WeightSpec *ptr, INT8 *src)
 {
     ptr->bytes_of_weight *= 4;
-    CHECK_REQUIREMENT(1 == ptr->num_quant_scale && 1 == ptr->weight_scale[0].num_scale);
+    CHECK_REQUIREMENT(1 == ptr->num_quant_scale && ptr->weight_scale[0].num_scale > 0);
     ptr->weight = (U8 *)mt_malloc(ptr->bytes_of_weight);
-    F32 scale = ptr->weight_scale[0].scale[0];
-    dequantize_int4_weight<DT_F16, F16>(
-        ptr->bytes_of_weight / 2, scale, (INT8 *)src, (F16 *)(ptr->weight));
+    dequantize_int4_weight<DT_F16, F16>(ptr->bytes_of_weight / 2, ptr->weight_scale[0].scale,
+        ptr->weight_scale[0].num_scale, (INT8 *)src, (F16 *)(ptr->weight));
+    ptr->weight_scale[0].num_scale = 1;
     ptr->weight_scale[0].scale[0] = 0;
 }
 
 void TransWeightFromI4ToI8(WeightSpec *ptr, INT8 *src)
 {
     ptr->bytes_of_weight *= 2;
-    CHECK_REQUIREMENT(1 == ptr->num_quant_scale && 1 == ptr->weight_scale[0].num_scale);
+    CHECK_REQUIREMENT(1 == ptr->num_quant_scale && ptr->weight_scale[0].num_scale > 0);
     ptr->weight = (U8 *)mt_malloc(ptr->bytes_of_weight);
-    F32 scale = ptr->weight_scale[0].scale[0];
-    dequantize_int4_int8(ptr->bytes_of_weight, (INT8 *)src, (INT8 *)ptr->weight);
+    if (ptr->weight_scale[0].num_scale == 1) {
+        dequantize_int4_int8(ptr->bytes_of_weight, (INT8 *)src, (INT8 *)ptr->weight);
+    } else {
+        ptr->weight_scale[0].scale[0] = requantize_int4_int8(ptr->bytes_of_weight,
+            ptr->weight_scale[0].scale, ptr->weight_scale[0].num_scale, (INT8 *)src,
+            (INT8 *)ptr->weight, 0);
+        ptr->weight_scale[0].num_scale = 1;
+    }
 }
 
 void TransWeightFromI4ToU8(WeightSpec *ptr, INT8 *src)
 {
     ptr->bytes_of_weight *= 2;
-    CHECK_REQUIREMENT(1 == ptr->num_quant_scale && 1 == ptr->weight_scale[0].num_scale);
+    CHECK_REQUIREMENT(1 == ptr->num_quant_scale && ptr->weight_scale[0].num_scale > 0);
     ptr->weight = (U8 *)mt_malloc(ptr->bytes_of_weight);
-    F32 scale = ptr->weight_scale[0].scale[0];
-    dequantize_int4_u8_q(ptr->bytes_of_weight, (INT8 *)src, (UINT8 *)ptr->weight);
+    if (ptr->weight_scale[0].num_scale == 1) {
+        dequantize_int4_u8_q(ptr->bytes_of_weight, (INT8 *)src, (UINT8 *)ptr->weight);
+    } else {
+        ptr->weight_scale[0].scale[0] = requantize_int4_int8(ptr->bytes_of_weight,
+            ptr->weight_scale[0].scale, ptr->weight_scale[0].num_scale, (INT8 *)src,
+            (INT8 *)ptr->weight, 128);
+        ptr->weight_scale[0].num_scale = 1;
+    }
 }
 
 void TransWeightFromI8ToF32(WeightSpec *ptr, INT8 *src)
@@ -361,8 +404,45 @@ void TransWeightFromF16ToF32(WeightSpec *ptr, F16 *src)
     transformToFloat(DT_F16, src, (F32 *)ptr->weight, ptr->bytes_of_weight / 4);
 }
 
+void TransWeightFromBF16ToF32(WeightSpec *ptr, U16 *src)
+{
+    ptr->bytes_of_weight *= 2;
+    ptr->weight = (U8 *)mt_malloc(ptr->bytes_of_weight);
+    transformToFloat(DT_BF16, src, (F32 *)ptr->weight, ptr->bytes_of_weight / 4);
+}
+
+void TransWeightFromBF16ToF16(WeightSpec *ptr, U16 *src)
+{
+    U32 num = ptr->bytes_of_weight / 2;
+    std::vector<F32> tmp(num);
+    transformToFloat(DT_BF16, src, tmp.data(), num);
+    ptr->weight = (U8 *)mt_malloc(ptr->bytes_of_weight);
+    transformFromFloat(DT_F16, tmp.data(), ptr->weight, num);
+}
+
+// bf16 weight is kept for operators that have bf16 kernel on this arch, currently only
+// x86 fully connected. Other operators get widened fp32/fp16 weights at load time.
+inline bool keepBF16Weight(Arch arch, OperatorType type)
+{
+    bool ret = false;
+#if defined(_USE_X86) && defined(_USE_FP32)
+    ret = IS_X86(arch) && (type == OT_FC);
+#endif
+    return ret;
+}
+
+// int4 weight is kept packed for operators that have int4 kernel on this arch.
+inline bool keepI4Weight(Arch arch, OperatorType type)
+{
+    bool ret = false;
+#if defined(_USE_X86) && defined(_USE_FP32)
+    ret = IS_X86(arch) && (type == OT_FC);
+#endif
+    return ret;
+}
+
 template <typename T>
-inline void deserialize_field(const U8 **buffer, U32 *position, T *element, int length = 1)
+inline void deserialize_field(const U8 **buffer, U64 *position, T *element, int length = 1)
 {
     int size = length * sizeof(T);
     UNI_MEMCPY(element, *buffer, size);
@@ -370,7 +450,7 @@ inline void deserialize_field(const U8 **buffer, U32 *position, T *element, int
     *position += size;
 }
 
-EE deserialize_header(const U8 *bytes, ModelSpec *spec, DataType targetDt, U32 *pos)
+EE deserialize_header(const U8 *bytes, ModelSpec *spec, DataType targetDt, U64 *pos)
 {
     const U8 *header_pointer = bytes + *pos;
     const U8 **pointer = &header_pointer;
@@ -451,10 +531,32 @@ EE model_compatibility(OperatorSpec *p, int version)
             p->ps.resize_spec.pad_end = 0;
         }
     }
+    if (version < 20231018) {
+        if (p->type == OT_Conv || p->type == OT_Deconvolution) {
+            p->ps.conv_spec.post_ops.num = 0;
+        }
+        if (p->type == OT_FC) {
+            p->ps.fc_spec.post_ops.num = 0;
+        }
+        if (p->type == OT_MatMul) {
+            p->ps.matmul_spec.post_ops.num = 0;
+        }
+    }
+    if (version < 20231019) {
+        if (p->type == OT_NonMaxSuppression) {
+            p->ps.non_max_suppression_spec.mode = NMS_GREEDY;
+        }
+        if (p->type == OT_DetectionOutput) {
+            p->ps.detection_output_spec.nms_mode = NMS_GREEDY;
+        }
+        if (p->type == OT_Yolov3DetectionOutput) {
+            p->ps.yolov3_detection_output_spec.nms_mode = NMS_GREEDY;
+        }
+    }
     return SUCCESS;
 }
 
-EE deserialize_operator(const U8 *bytes, ModelSpec *spec, U32 *pos)
+EE deserialize_operator(const U8 *bytes, ModelSpec *spec, U64 *pos)
 {
     const U8 *operator_pointer = bytes + *pos;
     const U8 **pointer = &operator_pointer;
@@ -501,7 +603,260 @@ EE deserialize_operator(const U8 *bytes, ModelSpec *spec, U32 *pos)
     return SUCCESS;
 }
 
-EE deserialize_weight(const U8 *bytes, ModelSpec *spec, U32 *pos)
+static void *func(void *arg)
+{
+    ModelFileDescriptor *file = (ModelFileDescriptor *)arg;
+    volatile char sum = 0;
+    for (size_t i = 0; i < file->length; i += 4 * 1024) {
+        sum = file->content[i];
+    }
+    return NULL;
+}
+
+static EE map_model_file(const char *filePath, ModelFileDescriptor *file)
+{
+#if defined(__GLIBC__) || defined(__linux__)
+    file->file = open(filePath, O_RDONLY);
+    if (-1 == file->file) {
+        UNI_ERROR_LOG("Cannot open bolt model file %s.\n", filePath);
+        return FILE_ERROR;
+    }
+    struct stat ss;
+    if (-1 == fstat(file->file, &ss)) {
+        UNI_ERROR_LOG("Cannot get size from bolt model file %s descriptor.\n", filePath);
+        return FILE_ERROR;
+    }
+    file->length = ss.st_size;
+    file->content = (U8 *)mmap(nullptr, file->length, PROT_READ, MAP_SHARED, file->file, 0);
+    if (MAP_FAILED == file->content) {
+        file->content = nullptr;
+        UNI_ERROR_LOG("Map bolt model file %s failed.\n", filePath);
+        return FILE_ERROR;
+    }
+#elif defined(_WIN32)
+    file->file =
+        CreateFile(filePath, GENERIC_READ, 0, NULL, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, NULL);
+    if (file->file == INVALID_HANDLE_VALUE) {
+        UNI_ERROR_LOG("Cannot open bolt model file %s.\n", filePath);
+        return FILE_ERROR;
+    }
+    LARGE_INTEGER length;
+    if (!GetFileSizeEx(file->file, &length)) {
+        UNI_ERROR_LOG("Cannot get size from bolt model file %s descriptor.\n", filePath);
+        return FILE_ERROR;
+    }
+    file->length = length.QuadPart;
+    file->map = CreateFileMapping(file->file, NULL, PAGE_READONLY, 0, 0, 0);
+    if (file->map == NULL) {
+        UNI_ERROR_LOG("CreateFileMapping failed\n");
+        return FILE_ERROR;
+    }
+    file->content = (U8 *)MapViewOfFile(file->map, FILE_MAP_READ, 0, 0, 0);
+    if (file->content == NULL) {
+        UNI_ERROR_LOG("Map bolt model file %s failed.\n", filePath);
+        return FILE_ERROR;
+    }
+    int ret = pthread_create(&(file->thread), NULL, func, file);
+    if (ret != 0) {
+        UNI_ERROR_LOG("pthread create failed.\n");
+    }
+#else
+    EE ret = load_binary(filePath, (void **)&(file->content), &(file->length));
+    if (ret != SUCCESS) {
+        return ret;
+    }
+#endif
+    return SUCCESS;
+}
+
+// side file must stay in the directory of the model file, no absolute path and no "..".
+static bool is_weight_file_name(const std::string &name)
+{
+    if (name.empty() || name[0] == '/' || name[0] == '\\' ||
+        (name.size() > 1 && name[1] == ':')) {
+        return false;
+    }
+    size_t begin = 0;
+    while (begin <= name.size()) {
+        size_t end = name.find_first_of("/\\", begin);
+        end = (end == std::string::npos) ? name.size() : end;
+        if (name.compare(begin, end - begin, "..") == 0) {
+            return false;
+        }
+        begin = end + 1;
+    }
+    return true;
+}
+
+// side files are named relative to the directory of the model file, they are mapped like it.
+static EE open_weight_files(const U8 **pointer,
+    U64 *pos,
+    ModelSpec *spec,
+    const char *path,
+    std::vector<ModelFileDescriptor *> *files)
+{
+    I32 num = 0;
+    deserialize_field<I32>(pointer, pos, &num);
+    std::string directory = "";
+    if (path != nullptr) {
+        directory = path;
+        size_t i = directory.find_last_of("/\\");
+        directory = (i == std::string::npos) ? "" : directory.substr(0, i + 1);
+    }
+    ModelFileDescriptor *tail = spec->file;
+    for (I32 i = 0; i < num; i++) {
+        I8 name[NAME_LEN];
+        deserialize_field<I8>(pointer, pos, name, NAME_LEN);
+        name[NAME_LEN - 1] = '\0';
+        if (!is_weight_file_name(name)) {
+            UNI_ERROR_LOG("bolt model refers to weight file %s out of its directory.\n", name);
+            return NOT_SUPPORTED;
+        }
+        if (spec->file->stream_mode) {
+            UNI_ERROR_LOG("bolt model in file stream can not refer to weight file %s.\n", name);
+            return NOT_SUPPORTED;
+        }
+        ModelFileDescriptor *file = (ModelFileDescriptor *)mt_malloc(sizeof(ModelFileDescriptor));
+        UNI_MEMSET(file, 0, sizeof(ModelFileDescriptor));
+        tail->next = file;
+        tail = file;
+        files->push_back(file);
+        std::string filePath = directory + name;
+        CHECK_STATUS(map_model_file(filePath.c_str(), file));
+    }
+    return SUCCESS;
+}
+
+// convert serialized weight to the inference data type, it only touches ws.
+static void convert_weight(const ModelSpec *spec,
+    WeightSpec *ws,
+    U8 *serialWeight,
+    U8 *serialBias,
+    Arch arch,
+    OperatorType type,
+    bool shared)
+{
+    if (spec->dt == DT_F32) {
+        if (ws->mdt == DT_F16) {
+            // trans w&b from 16 to 32
+            TransWeightFromF16ToF32(ws, (F16 *)serialWeight);
+            TransBiasFromF16ToF32(ws, (F16 *)serialBias);
+            ws->mdt = DT_F32;
+        } else if (ws->mdt == DT_F16_8Q) {
+            // trans w from 8 to 32
+            // trans b from 16 to 32
+            TransWeightFromI8ToF32(ws, (INT8 *)serialWeight);
+            TransBiasFromF16ToF32(ws, (F16 *)serialBias);
+            ws->mdt = DT_F32;
+        } else if ((ws->mdt == DT_I8) || (ws->mdt == DT_F32_8Q)) {
+            // trans w from 8 to 32
+            TransWeightFromI8ToF32(ws, (INT8 *)serialWeight);
+            ws->vec = serialBias;
+            ws->mdt = DT_F32;
+        } else if (ws->mdt == DT_I4 && !keepI4Weight(arch, type)) {
+            // trans w from 4 to 32
+            TransWeightFromI4ToF32(ws, (INT8 *)serialWeight);
+            ws->vec = serialBias;
+            ws->mdt = DT_F32;
+        } else if (ws->mdt == DT_BIN01 || ws->mdt == DT_BIN11) {
+            TransWeightFromBINToF32(ws, (INT8 *)serialWeight);
+            TransBiasFromF16ToF32(ws, (F16 *)serialBias);
+            ws->mdt = DT_F32;
+        } else if (ws->mdt == DT_BF16 && !keepBF16Weight(arch, type)) {
+            // trans w from bf16 to 32, b is stored in 32
+            TransWeightFromBF16ToF32(ws, (U16 *)serialWeight);
+            ws->vec = serialBias;
+            ws->mdt = DT_F32;
+        } else {
+            ws->weight = serialWeight;
+            ws->vec = serialBias;
+        }
+    }
+
+    if (spec->dt == DT_F16) {
+        if (ws->mdt == DT_F32) {
+            // trans w&b from 32 to 16
+            TransWeightFromF32ToF16(ws, (F32 *)serialWeight);
+            TransBiasFromF32ToF16(ws, (F32 *)serialBias);
+            ws->mdt = DT_F16;
+        } else if ((ws->mdt == DT_I8) || (ws->mdt == DT_F16_8Q)) {
+            // trans w from 8 to 16
+            TransWeightFromI8ToF16(ws, (INT8 *)serialWeight);
+            ws->vec = serialBias;
+            ws->mdt = DT_F16;
+        } else if (ws->mdt == DT_I4) {
+            // trans w from 4 to 16
+            TransWeightFromI4ToF16(ws, (INT8 *)serialWeight);
+            ws->vec = serialBias;
+            ws->mdt = DT_F16;
+        } else if (ws->mdt == DT_BF16) {
+            // trans w from bf16 to 16, b from 32 to 16
+            TransWeightFromBF16ToF16(ws, (U16 *)serialWeight);
+            TransBiasFromF32ToF16(ws, (F32 *)serialBias);
+            ws->mdt = DT_F16;
+        } else {
+            ws->weight = serialWeight;
+            ws->vec = serialBias;
+        }
+    }
+
+    if (spec->dt == DT_F32_8Q) {
+        if (ws->mdt == DT_F32_8Q) {
+            // trans w from 8 to 32
+            TransWeightFromI8ToF32(ws, (INT8 *)serialWeight);
+            ws->vec = serialBias;
+            ws->mdt = DT_F32;
+        } else if (ws->mdt == DT_F16) {
+            // trans w&b from 16 to 32
+            TransWeightFromF16ToF32(ws, (F16 *)serialWeight);
+            TransBiasFromF16ToF32(ws, (F16 *)serialBias);
+            ws->mdt = DT_F32;
+        } else if (ws->mdt == DT_I4) {
+            // trans w from 4 to 8
+            if (shared && IS_X86_AVX512(arch)) {
+                ws->mdt = DT_U8_Q;
+                TransWeightFromI4ToU8(ws, (INT8 *)serialWeight);
+            } else {
+                ws->mdt = DT_I8;
+                TransWeightFromI4ToI8(ws, (INT8 *)serialWeight);
+            }
+            ws->vec = serialBias;
+        } else {
+            ws->weight = serialWeight;
+            ws->vec = serialBias;
+        }
+    }
+
+    if (spec->dt == DT_F16_8Q) {
+        if (ws->mdt == DT_F32) {
+            // trans w&b from 32 to 16
+            TransWeightFromF32ToF16(ws, (F32 *)serialWeight);
+            TransBiasFromF32ToF16(ws, (F32 *)serialBias);
+            ws->mdt = DT_F16;
+        } else if (ws->mdt == DT_F32_8Q) {
+            // trans w from 8 to 16
+            // trans b from 32 to 16
+            TransWeightFromI8ToF16(ws, (INT8 *)serialWeight);
+            TransBiasFromF32ToF16(ws, (F32 *)serialBias);
+            ws->mdt = DT_F16;
+        } else if (ws->mdt == DT_I8) {
+            // trans b from 32 to 16
+            ws->weight = serialWeight;
+            TransBiasFromF32ToF16(ws, (F32 *)serialBias);
+        } else if (ws->mdt == DT_I4) {
+            // trans w from 4 to 8
+            // trans b from 32 to 16
+            TransWeightFromI4ToI8(ws, (INT8 *)serialWeight);
+            TransBiasFromF32ToF16(ws, (F32 *)serialBias);
+            ws->mdt = DT_I8;
+        } else {
+            ws->weight = serialWeight;
+            ws->vec = serialBias;
+        }
+    }
+}
+
+EE deserialize_weight(const U8 *bytes, ModelSpec *spec, U64 *pos, const char *path)
 {
     const U8 *weight_pointer = bytes + *pos;
     const U8 **pointer = &weight_pointer;
@@ -511,36 +866,85 @@ EE deserialize_weight(const U8 *bytes, ModelSpec *spec, U32 *pos)
     WeightSpec *ptr = spec->ws;
     std::map<std::string, DataType> sharedWeightDataTypeMap;
     Arch arch = get_cpu_arch();
+    std::map<std::string, OperatorType> operatorTypeMap;
     for (I32 i = 0; i < spec->num_operator_specs; i++) {
         if (OT_SharedWeight == spec->ops[i].type) {
             sharedWeightDataTypeMap[spec->ops[i].name] = spec->ops[i].ps.shared_weight_spec.desc.dt;
         }
+        operatorTypeMap[spec->ops[i].name] = spec->ops[i].type;
     }
 
+    bool section = (spec->version >= sg_boltWeightSectionVersion);
+    std::vector<ModelFileDescriptor *> weightFiles;
+    if (section) {
+        CHECK_STATUS(open_weight_files(pointer, pos, spec, path, &weightFiles));
+    }
+    // end of weight data in model file
+    U64 end = 0;
+    std::vector<U8 *> weights(spec->num_weight_specs), biases(spec->num_weight_specs);
+    std::vector<OperatorType> types(spec->num_weight_specs, OT_None);
+    std::vector<bool> shared(spec->num_weight_specs, false);
     for (I32 i = 0; i < spec->num_weight_specs; i++) {
+        U8 *serialWeight = nullptr;
+        U8 *serialBias = nullptr;
         U32 length = 0, count = 0;
-        deserialize_field<U32>(pointer, pos, &length);
+        if (section) {
+            I32 fileId = -1;
+            U64 weightOffset = 0, vecOffset = 0;
+            deserialize_field<I8>(pointer, pos, ptr[i].op_name, NAME_LEN);
+            deserialize_field<DataType>(pointer, pos, &ptr[i].mdt);
+            deserialize_field<I32>(pointer, pos, &fileId);
+            deserialize_field<U64>(pointer, pos, &weightOffset);
+            deserialize_field<U64>(pointer, pos, &ptr[i].bytes_of_weight);
+            deserialize_field<U64>(pointer, pos, &vecOffset);
+            deserialize_field<U64>(pointer, pos, &ptr[i].bytes_of_vec);
+            if (fileId >= (I32)weightFiles.size()) {
+                UNI_ERROR_LOG("weight %s is in weight file %d, but model has %d weight files.\n",
+                    ptr[i].op_name, fileId, (int)weightFiles.size());
+                return NOT_MATCH;
+            }
+            ModelFileDescriptor *file = (fileId < 0) ? spec->file : weightFiles[fileId];
+            if (weightOffset > file->length ||
+                ptr[i].bytes_of_weight > file->length - weightOffset ||
+                vecOffset > file->length || ptr[i].bytes_of_vec > file->length - vecOffset) {
+                UNI_ERROR_LOG("weight %s is out of range of bolt model file.\n", ptr[i].op_name);
+                return FILE_ERROR;
+            }
+            if (ptr[i].bytes_of_weight > 0) {
+                serialWeight = file->content + weightOffset;
+            }
+            if (ptr[i].bytes_of_vec > 0) {
+                serialBias = file->content + vecOffset;
+            }
+            if (fileId < 0) {
+                end = UNI_MAX(end, weightOffset + ptr[i].bytes_of_weight);
+                end = UNI_MAX(end, vecOffset + ptr[i].bytes_of_vec);
+            }
+        } else {
+            U32 bytes = 0;
+            deserialize_field<U32>(pointer, pos, &length);
 
-        deserialize_field<I8>(pointer, pos, ptr[i].op_name, NAME_LEN);
-        deserialize_field<DataType>(pointer, pos, &ptr[i].mdt);
+            deserialize_field<I8>(pointer, pos, ptr[i].op_name, NAME_LEN);
+            deserialize_field<DataType>(pointer, pos, &ptr[i].mdt);
 
-        deserialize_field<U32>(pointer, pos, &ptr[i].bytes_of_weight);
-        U8 *serialWeight = (U8 *)(*pointer);
-        if (ptr[i].bytes_of_weight == 0) {
-            serialWeight = nullptr;
-        }
-        *pointer += ptr[i].bytes_of_weight;
-        *pos += ptr[i].bytes_of_weight;
-        count += ptr[i].bytes_of_weight;
+            deserialize_field<U32>(pointer, pos, &bytes);
+            ptr[i].bytes_of_weight = bytes;
+            if (bytes > 0) {
+                serialWeight = (U8 *)(*pointer);
+            }
+            *pointer += bytes;
+            *pos += bytes;
+            count += bytes;
 
-        deserialize_field<U32>(pointer, pos, &ptr[i].bytes_of_vec);
-        U8 *serialBias = (U8 *)(*pointer);
-        if (ptr[i].bytes_of_vec == 0) {
-            serialBias = nullptr;
+            deserialize_field<U32>(pointer, pos, &bytes);
+            ptr[i].bytes_of_vec = bytes;
+            if (bytes > 0) {
+                serialBias = (U8 *)(*pointer);
+            }
+            *pointer += bytes;
+            *pos += bytes;
+            count += bytes;
         }
-        *pointer += ptr[i].bytes_of_vec;
-        *pos += ptr[i].bytes_of_vec;
-        count += ptr[i].bytes_of_vec;
 
         deserialize_field<U32>(pointer, pos, &ptr[i].num_quant_scale);
         ptr[i].weight_scale = (QuantSpec *)mt_malloc(ptr[i].num_quant_scale * sizeof(QuantSpec));
@@ -552,121 +956,34 @@ EE deserialize_weight(const U8 *bytes, ModelSpec *spec, U32 *pos)
                 pointer, pos, ptr[i].weight_scale[j].scale, ptr[i].weight_scale[j].num_scale);
         }
 
-        CHECK_REQUIREMENT(length == count);
-        if (spec->dt == DT_F32) {
-            if (ptr[i].mdt == DT_F16) {
-                // trans w&b from 16 to 32
-                TransWeightFromF16ToF32(ptr + i, (F16 *)serialWeight);
-                TransBiasFromF16ToF32(ptr + i, (F16 *)serialBias);
-                ptr[i].mdt = DT_F32;
-            } else if (ptr[i].mdt == DT_F16_8Q) {
-                // trans w from 8 to 32
-                // trans b from 16 to 32
-                TransWeightFromI8ToF32(ptr + i, (INT8 *)serialWeight);
-                TransBiasFromF16ToF32(ptr + i, (F16 *)serialBias);
-                ptr[i].mdt = DT_F32;
-            } else if ((ptr[i].mdt == DT_I8) || (ptr[i].mdt == DT_F32_8Q)) {
-                // trans w from 8 to 32
-                TransWeightFromI8ToF32(ptr + i, (INT8 *)serialWeight);
-                ptr[i].vec = serialBias;
-                ptr[i].mdt = DT_F32;
-            } else if (ptr[i].mdt == DT_I4) {
-                // trans w from 4 to 32
-                TransWeightFromI4ToF32(ptr + i, (INT8 *)serialWeight);
-                ptr[i].vec = serialBias;
-                ptr[i].mdt = DT_F32;
-            } else if (ptr[i].mdt == DT_BIN01 || ptr[i].mdt == DT_BIN11) {
-                TransWeightFromBINToF32(ptr + i, (INT8 *)serialWeight);
-                TransBiasFromF16ToF32(ptr + i, (F16 *)serialBias);
-                ptr[i].mdt = DT_F32;
-            } else {
-                ptr[i].weight = serialWeight;
-                ptr[i].vec = serialBias;
-            }
-        }
-
-        if (spec->dt == DT_F16) {
-            if (ptr[i].mdt == DT_F32) {
-                // trans w&b from 32 to 16
-                TransWeightFromF32ToF16(ptr + i, (F32 *)serialWeight);
-                TransBiasFromF32ToF16(ptr + i, (F32 *)serialBias);
-                ptr[i].mdt = DT_F16;
-            } else if ((ptr[i].mdt == DT_I8) || (ptr[i].mdt == DT_F16_8Q)) {
-                // trans w from 8 to 16
-                TransWeightFromI8ToF16(ptr + i, (INT8 *)serialWeight);
-                ptr[i].vec = serialBias;
-                ptr[i].mdt = DT_F16;
-            } else if (ptr[i].mdt == DT_I4) {
-                // trans w from 4 to 16
-                TransWeightFromI4ToF16(ptr + i, (INT8 *)serialWeight);
-                ptr[i].vec = serialBias;
-                ptr[i].mdt = DT_F16;
-            } else {
-                ptr[i].weight = serialWeight;
-                ptr[i].vec = serialBias;
-            }
-        }
-
-        if (spec->dt == DT_F32_8Q) {
-            if (ptr[i].mdt == DT_F32_8Q) {
-                // trans w from 8 to 32
-                TransWeightFromI8ToF32(ptr + i, (INT8 *)serialWeight);
-                ptr[i].vec = serialBias;
-                ptr[i].mdt = DT_F32;
-            } else if (ptr[i].mdt == DT_F16) {
-                // trans w&b from 16 to 32
-                TransWeightFromF16ToF32(ptr + i, (F16 *)serialWeight);
-                TransBiasFromF16ToF32(ptr + i, (F16 *)serialBias);
-                ptr[i].mdt = DT_F32;
-            } else if (ptr[i].mdt == DT_I4) {
-                // trans w from 4 to 8
-                if (sharedWeightDataTypeMap.count(ptr[i].op_name) && IS_X86_AVX512(arch)) {
-                    ptr[i].mdt = DT_U8_Q;
-                    TransWeightFromI4ToU8(ptr + i, (INT8 *)serialWeight);
-                } else {
-                    ptr[i].mdt = DT_I8;
-                    TransWeightFromI4ToI8(ptr + i, (INT8 *)serialWeight);
-                }
-                ptr[i].vec = serialBias;
-            } else {
-                ptr[i].weight = serialWeight;
-                ptr[i].vec = serialBias;
-            }
+        if (!section) {
+            CHECK_REQUIREMENT(length == count);
         }
-
-        if (spec->dt == DT_F16_8Q) {
-            if (ptr[i].mdt == DT_F32) {
-                // trans w&b from 32 to 16
-                TransWeightFromF32ToF16(ptr + i, (F32 *)serialWeight);
-                TransBiasFromF32ToF16(ptr + i, (F32 *)serialBias);
-                ptr[i].mdt = DT_F16;
-            } else if (ptr[i].mdt == DT_F32_8Q) {
-                // trans w from 8 to 16
-                // trans b from 32 to 16
-                TransWeightFromI8ToF16(ptr + i, (INT8 *)serialWeight);
-                TransBiasFromF32ToF16(ptr + i, (F32 *)serialBias);
-                ptr[i].mdt = DT_F16;
-            } else if (ptr[i].mdt == DT_I8) {
-                // trans b from 32 to 16
-                ptr[i].weight = serialWeight;
-                TransBiasFromF32ToF16(ptr + i, (F32 *)serialBias);
-            } else if (ptr[i].mdt == DT_I4) {
-                // trans w from 4 to 8
-                // trans b from 32 to 16
-                TransWeightFromI4ToI8(ptr + i, (INT8 *)serialWeight);
-                TransBiasFromF32ToF16(ptr + i, (F32 *)serialBias);
-                ptr[i].mdt = DT_I8;
-            } else {
-                ptr[i].weight = serialWeight;
-                ptr[i].vec = serialBias;
-            }
+        auto iter = operatorTypeMap.find(ptr[i].op_name);
+        if (iter != operatorTypeMap.end()) {
+            types[i] = iter->second;
         }
+        shared[i] = (sharedWeightDataTypeMap.count(ptr[i].op_name) > 0);
+        weights[i] = serialWeight;
+        biases[i] = serialBias;
+    }
+    // weights are independent, they are converted in parallel.
+#ifdef _USE_OPENMP
+#pragma omp parallel for num_threads(OMP_NUM_THREADS) schedule(dynamic)
+#endif
+    for (I32 i = 0; i < spec->num_weight_specs; i++) {
+        convert_weight(spec, ptr + i, weights[i], biases[i], arch, types[i], shared[i]);
+    }
+    for (I32 i = 0; i < spec->num_weight_specs; i++) {
         sharedWeightDataTypeMap[ptr[i].op_name] = ptr[i].mdt;
     }
+    // weight data of new version is after the weight table
+    *pos = UNI_MAX(*pos, end);
 
     for (int i = 0; i < spec->num_operator_specs; i++) {
         if (OT_SharedWeight == spec->ops[i].type) {
-            std::set<DataType> innerTypes = {DT_F32_8Q, DT_F16_8Q, DT_I8, DT_I4, DT_F16, DT_F32};
+            std::set<DataType> innerTypes = {
+                DT_F32_8Q, DT_F16_8Q, DT_I8, DT_I4, DT_F16, DT_F32, DT_BF16};
             DataType &sdt = spec->ops[i].ps.shared_weight_spec.desc.dt;
             if (innerTypes.count(sdt)) {
                 sdt = sharedWeightDataTypeMap[spec->ops[i].name];
@@ -685,15 +1002,15 @@ EE deserialize_weight(const U8 *bytes, ModelSpec *spec, U32 *pos)
     return SUCCESS;
 }
 
-EE deserialize_model(const U8 *bytes, ModelSpec *spec, DataType targetDt)
+EE deserialize_model(const U8 *bytes, ModelSpec *spec, DataType targetDt, const char *path)
 {
-    U32 pos = 0;
+    U64 pos = 0;
     EE ret = deserialize_header(bytes, spec, targetDt, &pos);
     if (ret == SUCCESS) {
         ret = deserialize_operator(bytes, spec, &pos);
     }
     if (ret == SUCCESS) {
-        ret = deserialize_weight(bytes, spec, &pos);
+        ret = deserialize_weight(bytes, spec, &pos, path);
     }
 #ifdef _USE_OP_TENSOR_RELATIONS
     if (ret == SUCCESS) {
@@ -707,16 +1024,6 @@ EE deserialize_model(const U8 *bytes, ModelSpec *spec, DataType targetDt)
     return ret;
 }
 
-static void *func(void *arg)
-{
-    ModelFileDescriptor *file = (ModelFileDescriptor *)arg;
-    volatile char sum = 0;
-    for (U32 i = 0; i < file->length; i += 4 * 1024) {
-        sum = file->content[i];
-    }
-    return NULL;
-}
-
 EE deserialize_model_from_file(
     const char *filePath, ModelSpec *spec, DataType targetDt, bool useFileStream)
 {
@@ -729,63 +1036,14 @@ EE deserialize_model_from_file(
             spec->file->stream_mode = useFileStream;
             if (spec->file->stream_mode) {
                 spec->file->content = (U8 *)filePath;
-                spec->file->length = INT_MAX;
-                ret = SUCCESS;
+                spec->file->length = SIZE_MAX;
+                ret = deserialize_model(spec->file->content, spec, targetDt, nullptr);
             } else {
-#if defined(__GLIBC__) || defined(__linux__)
-                spec->file->file = open(filePath, O_RDONLY);
-                if (-1 == spec->file->file) {
-                    UNI_ERROR_LOG("Cannot open bolt model file %s.\n", filePath);
-                    return FILE_ERROR;
-                }
-                struct stat ss;
-                if (-1 == fstat(spec->file->file, &ss)) {
-                    UNI_ERROR_LOG("Cannot get size from bolt model file %s descriptor.\n", filePath);
-                    return FILE_ERROR;
+                ret = map_model_file(filePath, spec->file);
+                if (ret == SUCCESS) {
+                    ret = deserialize_model(spec->file->content, spec, targetDt, filePath);
                 }
-                spec->file->length = ss.st_size;
-                spec->file->content = (U8 *)mmap(
-                    nullptr, spec->file->length, PROT_READ, MAP_SHARED, spec->file->file, 0);
-                if (MAP_FAILED == spec->file->content) {
-                    UNI_ERROR_LOG("Map bolt model file %s failed.\n", filePath);
-                    return FILE_ERROR;
-                }
-#elif defined(_WIN32)
-                spec->file->file = CreateFile(
-                    filePath, GENERIC_READ, 0, NULL, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, NULL);
-                if (spec->file->file == INVALID_HANDLE_VALUE) {
-                    UNI_ERROR_LOG("Cannot open bolt model file %s.\n", filePath);
-                    return FILE_ERROR;
-                }
-                LARGE_INTEGER length;
-                if (!GetFileSizeEx(spec->file->file, &length)) {
-                    UNI_ERROR_LOG("Cannot get size from bolt model file %s descriptor.\n", filePath);
-                    return FILE_ERROR;
-                }
-                spec->file->length = length.QuadPart;
-                spec->file->map = CreateFileMapping(spec->file->file, NULL, PAGE_READONLY, 0, 0, 0);
-                if (spec->file->map == NULL) {
-                    UNI_ERROR_LOG("CreateFileMapping failed\n");
-                    return FILE_ERROR;
-                }
-                spec->file->content = (U8 *)MapViewOfFile(spec->file->map, FILE_MAP_READ, 0, 0, 0);
-                if (spec->file->content == NULL) {
-                    UNI_ERROR_LOG("Map bolt model file %s failed.\n", filePath);
-                    return FILE_ERROR;
-                }
-                int ret = pthread_create(&(spec->file->thread), NULL, func, spec->file);
-                if (ret != 0) {
-                    UNI_ERROR_LOG("pthread create failed.\n");
-                }
-#else
-                EE ret =
-                    load_binary(filePath, (void **)&(spec->file->content), &(spec->file->length));
-                if (ret != SUCCESS) {
-                    return ret;
-                }
-#endif
             }
-            ret = deserialize_model(spec->file->content, spec, targetDt);
         },
         std::string("deserialize_model_from_file"), std::string("prepare"));
     UNI_DEBUG_LOG("Read bolt model end.\n");
@@ -100,16 +100,26 @@ void print_weights(const ModelSpec ms)
     }
     for (int i = 0; i < number; i++) {
         if (isDeprecatedOpWeight(&ms, i)) {
-            printf("        %3d %32s | delete %16s %12u %10u\n", i, ms.ws[i].op_name,
-                DataTypeName()[ms.ws[i].mdt], ms.ws[i].bytes_of_weight, ms.ws[i].bytes_of_vec);
+            printf("        %3d %32s | delete %16s %12llu %10llu\n", i, ms.ws[i].op_name,
+                DataTypeName()[ms.ws[i].mdt], (unsigned long long)ms.ws[i].bytes_of_weight,
+                (unsigned long long)ms.ws[i].bytes_of_vec);
             continue;
         }
 
-        printf("        %3d %32s | retain %16s %12u %10u", i, ms.ws[i].op_name,
-            DataTypeName()[ms.ws[i].mdt], ms.ws[i].bytes_of_weight, ms.ws[i].bytes_of_vec);
+        printf("        %3d %32s | retain %16s %12llu %10llu", i, ms.ws[i].op_name,
+            DataTypeName()[ms.ws[i].mdt], (unsigned long long)ms.ws[i].bytes_of_weight,
+            (unsigned long long)ms.ws[i].bytes_of_vec);
         if (ms.ws[i].bytes_of_weight > 0 && ms.ws[i].weight != nullptr) {
             F32 value;
-            transformToFloat(ms.ws[i].mdt, ms.ws[i].weight, &value, 1);
+            if (DT_I4 == ms.ws[i].mdt) {
+                // low 4 bits of the first byte, code is q + 7
+                value = (ms.ws[i].weight[0] & 0xF) - 7;
+                if (ms.ws[i].num_quant_scale > 0 && ms.ws[i].weight_scale[0].num_scale > 0) {
+                    value /= ms.ws[i].weight_scale[0].scale[0];
+                }
+            } else {
+                transformToFloat(ms.ws[i].mdt, ms.ws[i].weight, &value, 1);
+            }
             printf(" %10.4f ...", value);
         } else {
             printf("               ");
@@ -122,6 +132,8 @@ void print_weights(const ModelSpec ms)
             DataType dt = ms.ws[i].mdt;
             if (DT_BIN01 == ms.ws[i].mdt || DT_BIN11 == ms.ws[i].mdt) {
                 dt = DT_F16;
+            } else if (DT_BF16 == ms.ws[i].mdt || DT_I4 == ms.ws[i].mdt) {
+                dt = DT_F32;
             } else if (vec_data_type.find(ms.ws[i].op_name) != vec_data_type.end()) {
                 dt = vec_data_type[ms.ws[i].op_name];
             }
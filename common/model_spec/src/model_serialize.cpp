@@ -11,6 +11,8 @@
 // COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
+#include <vector>
+#include "uni.h"
 #include "model_common.h"
 #include "file.h"
 
@@ -136,47 +138,139 @@ EE serialize_operators(const ModelSpec *spec, std::string *tmp)
     return SUCCESS;
 }
 
-EE serialize_weights(const ModelSpec *spec, std::string *tmp)
+// weight data is written after the weight table, each weight is placed in the model file or a
+// side file by placement.
+typedef struct {
+    const U8 *data;
+    U64 bytes;
+} WeightBlob;
+
+typedef struct {
+    I32 file_id;
+    WeightBlob weight;
+    U64 weight_offset;
+    WeightBlob vec;
+    U64 vec_offset;
+} WeightPlacement;
+
+// data in files is aligned for mapping, weight data of model file starts at a page.
+static const U64 WEIGHT_DATA_ALIGN = 64;
+static const U64 WEIGHT_SECTION_ALIGN = 4096;
+
+static std::string weight_file_path(const char *filePath, I32 id)
 {
-    I32 removeWeightNum = 0;
-    U32 bufSize = sizeof(I32);
+    return std::string(filePath) + ".weight" + std::to_string(id);
+}
+
+// place weights in side files of at most weightFileBytes, a larger weight takes a file of its own.
+static U32 place_weights_in_files(std::vector<WeightPlacement> *placements, U64 weightFileBytes)
+{
+    I32 id = -1;
+    U64 offset = 0;
+    for (U32 i = 0; i < placements->size(); i++) {
+        WeightPlacement &p = (*placements)[i];
+        U64 bytes = UNI_ALIGN(p.weight.bytes, WEIGHT_DATA_ALIGN) + p.vec.bytes;
+        if (id < 0 || (offset > 0 && offset + bytes > weightFileBytes)) {
+            id++;
+            offset = 0;
+        }
+        p.file_id = id;
+        p.weight_offset = offset;
+        offset = UNI_ALIGN(offset + p.weight.bytes, WEIGHT_DATA_ALIGN);
+        p.vec_offset = offset;
+        offset = UNI_ALIGN(offset + p.vec.bytes, WEIGHT_DATA_ALIGN);
+    }
+    return id + 1;
+}
+
+static void place_weights_in_model(std::vector<WeightPlacement> *placements, U64 offset)
+{
+    offset = UNI_ALIGN(offset, WEIGHT_SECTION_ALIGN);
+    for (U32 i = 0; i < placements->size(); i++) {
+        WeightPlacement &p = (*placements)[i];
+        p.file_id = -1;
+        p.weight_offset = offset;
+        offset = UNI_ALIGN(offset + p.weight.bytes, WEIGHT_DATA_ALIGN);
+        p.vec_offset = offset;
+        offset = UNI_ALIGN(offset + p.vec.bytes, WEIGHT_DATA_ALIGN);
+    }
+}
+
+// weight table of model file, weight data is written by write_weights. tableOffset is the
+// position of the table in model file.
+EE serialize_weights(const ModelSpec *spec,
+    const char *filePath,
+    U64 tableOffset,
+    U64 weightFileBytes,
+    std::string *tmp,
+    std::vector<WeightPlacement> *placements)
+{
+    placements->clear();
+    std::vector<int> ids;
+    U32 bufSize = sizeof(I32) * 2;
     auto p = spec->ws;
     for (int i = 0; i < spec->num_weight_specs; i++) {
         if (isDeprecatedOpWeight(spec, i)) {
-            removeWeightNum++;
             continue;
         }
+        ids.push_back(i);
+        WeightPlacement placement;
+        placement.weight = {p[i].weight, p[i].bytes_of_weight};
+        placement.vec = {p[i].vec, p[i].bytes_of_vec};
+        placements->push_back(placement);
 
-        // U32 x 5: length, mdt, bytes_of_weight, bytes_of_vec, num_quant_scale
-        bufSize += sizeof(I8) * NAME_LEN + sizeof(DataType) + sizeof(U32) * 4 + p[i].bytes_of_weight +
-            p[i].bytes_of_vec;
+        // name, mdt, file id, offset and bytes of weight and vec, num_quant_scale
+        bufSize += sizeof(I8) * NAME_LEN + sizeof(DataType) + sizeof(I32) + sizeof(U64) * 4 +
+            sizeof(U32);
         for (U32 j = 0; j < p[i].num_quant_scale; j++) {
             bufSize += sizeof(I32);  // num_scale
             bufSize += p[i].weight_scale[j].num_scale * sizeof(F32);
         }
     }
+    I32 numFiles = 0;
+    if (weightFileBytes > 0) {
+        numFiles = place_weights_in_files(placements, weightFileBytes);
+        bufSize += sizeof(I8) * NAME_LEN * numFiles;
+    } else {
+        place_weights_in_model(placements, tableOffset + bufSize);
+    }
+
     U8 *buf = (U8 *)mt_malloc(bufSize);
-    U8* _pointer = buf;
+    U8 *_pointer = buf;
     U32 _pos = 0;
-    U8** pointer = &_pointer;
+    U8 **pointer = &_pointer;
     U32 *pos = &_pos;
 
-    I32 num = spec->num_weight_specs - removeWeightNum;
+    I32 num = ids.size();
     serialize_field<I32>(pointer, pos, &num);
-    for (int i = 0; i < spec->num_weight_specs; i++) {
-        if (isDeprecatedOpWeight(spec, i)) {
-            continue;
+    serialize_field<I32>(pointer, pos, &numFiles);
+    for (I32 i = 0; i < numFiles; i++) {
+        // side files are found in the directory of model file
+        std::string name = weight_file_path(filePath, i);
+        size_t k = name.find_last_of("/\\");
+        if (k != std::string::npos) {
+            name = name.substr(k + 1);
         }
-
-        U32 length = p[i].bytes_of_weight + p[i].bytes_of_vec;
-        serialize_field<U32>(pointer, pos, &length);
-
+        if (name.size() >= NAME_LEN) {
+            UNI_ERROR_LOG("weight file name %s is longer than %d.\n", name.c_str(), NAME_LEN - 1);
+            mt_free(buf);
+            return NOT_SUPPORTED;
+        }
+        I8 fileName[NAME_LEN];
+        UNI_MEMSET(fileName, 0, NAME_LEN);
+        UNI_MEMCPY(fileName, name.c_str(), name.size());
+        serialize_field<I8>(pointer, pos, fileName, NAME_LEN);
+    }
+    for (U32 k = 0; k < ids.size(); k++) {
+        int i = ids[k];
+        WeightPlacement &placement = (*placements)[k];
         serialize_field<I8>(pointer, pos, p[i].op_name, NAME_LEN);
         serialize_field<DataType>(pointer, pos, &(p[i].mdt));
-        serialize_field<U32>(pointer, pos, &(p[i].bytes_of_weight));
-        serialize_field<U8>(pointer, pos, p[i].weight, p[i].bytes_of_weight);
-        serialize_field<U32>(pointer, pos, &(p[i].bytes_of_vec));
-        serialize_field<U8>(pointer, pos, p[i].vec, p[i].bytes_of_vec);
+        serialize_field<I32>(pointer, pos, &(placement.file_id));
+        serialize_field<U64>(pointer, pos, &(placement.weight_offset));
+        serialize_field<U64>(pointer, pos, &(p[i].bytes_of_weight));
+        serialize_field<U64>(pointer, pos, &(placement.vec_offset));
+        serialize_field<U64>(pointer, pos, &(p[i].bytes_of_vec));
 
         serialize_field<U32>(pointer, pos, &(p[i].num_quant_scale));
         for (U32 j = 0; j < p[i].num_quant_scale; j++) {
@@ -193,38 +287,82 @@ EE serialize_weights(const ModelSpec *spec, std::string *tmp)
     return SUCCESS;
 }
 
-EE serialize_model(const ModelSpec *spec, std::string *bytes)
+static EE write_bytes(FILE *fp, U64 *pos, const void *data, U64 bytes, const char *filePath)
 {
-    bytes->clear();
-    std::string tmp;
-
-    CHECK_STATUS(serialize_header(spec, &tmp));
-    *bytes += tmp;
-
-    CHECK_STATUS(serialize_operators(spec, &tmp));
-    *bytes += tmp;
-
-    CHECK_STATUS(serialize_weights(spec, &tmp));
-    *bytes += tmp;
+    if (bytes > 0 && fwrite(data, 1, bytes, fp) != bytes) {
+        UNI_ERROR_LOG(
+            "can not write %llu bytes to file %s.\n", (unsigned long long)bytes, filePath);
+        return FILE_ERROR;
+    }
+    *pos += bytes;
     return SUCCESS;
 }
 
-EE write_to_file(std::string *bytes, const char *filePath)
+static EE write_blob(FILE *fp, U64 *pos, U64 offset, const WeightBlob &blob, const char *filePath)
 {
-    if (bytes == NULL || filePath == NULL) {
-        return NULL_POINTER;
+    if (blob.bytes == 0) {
+        return SUCCESS;
+    }
+    static const U8 zeros[WEIGHT_SECTION_ALIGN] = {0};
+    while (*pos < offset) {
+        U64 bytes = UNI_MIN(offset - *pos, WEIGHT_SECTION_ALIGN);
+        CHECK_STATUS(write_bytes(fp, pos, zeros, bytes, filePath));
+    }
+    return write_bytes(fp, pos, blob.data, blob.bytes, filePath);
+}
+
+// weights are streamed to files, they are not copied into one buffer.
+static EE write_weights(
+    FILE *fp, U64 pos, I32 id, const std::vector<WeightPlacement> &placements, const char *filePath)
+{
+    for (U32 i = 0; i < placements.size(); i++) {
+        const WeightPlacement &p = placements[i];
+        if (p.file_id == id) {
+            CHECK_STATUS(write_blob(fp, &pos, p.weight_offset, p.weight, filePath));
+            CHECK_STATUS(write_blob(fp, &pos, p.vec_offset, p.vec, filePath));
+        }
     }
-    return save_binary(filePath, bytes->c_str(), bytes->size());
+    return SUCCESS;
 }
 
-EE serialize_model_to_file(const ModelSpec *spec, const char *filePath)
+EE serialize_model_to_file(const ModelSpec *spec, const char *filePath, U64 weightFileBytes)
 {
     UNI_DEBUG_LOG("Write bolt model to %s...\n", filePath);
+    if (filePath == NULL) {
+        return NULL_POINTER;
+    }
     std::string bytes = "";
-    EE ret = serialize_model(spec, &bytes);
-    if (ret == SUCCESS) {
-        ret = write_to_file(&bytes, filePath);
+    std::string tmp;
+    CHECK_STATUS(serialize_header(spec, &tmp));
+    bytes += tmp;
+    CHECK_STATUS(serialize_operators(spec, &tmp));
+    bytes += tmp;
+    std::vector<WeightPlacement> placements;
+    CHECK_STATUS(
+        serialize_weights(spec, filePath, bytes.size(), weightFileBytes, &tmp, &placements));
+    bytes += tmp;
+
+    I32 numFiles = 0;
+    for (U32 i = 0; i < placements.size(); i++) {
+        numFiles = UNI_MAX(numFiles, placements[i].file_id + 1);
+    }
+    EE ret = SUCCESS;
+    for (I32 id = -1; id < numFiles && ret == SUCCESS; id++) {
+        std::string path = (id < 0) ? filePath : weight_file_path(filePath, id);
+        FILE *fp = fopen(path.c_str(), "wb");
+        if (!fp) {
+            UNI_ERROR_LOG("can not write bolt model to file %s.\n", path.c_str());
+            return FILE_ERROR;
+        }
+        U64 pos = 0;
+        if (id < 0) {
+            ret = write_bytes(fp, &pos, bytes.c_str(), bytes.size(), filePath);
+        }
+        if (ret == SUCCESS) {
+            ret = write_weights(fp, pos, id, placements, path.c_str());
+        }
+        fclose(fp);
     }
     UNI_DEBUG_LOG("Write bolt model end.\n");
-    return SUCCESS;
+    return ret;
 }
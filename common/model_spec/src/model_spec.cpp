@@ -141,7 +141,8 @@ EE mt_destroy_model(ModelSpec *ms)
         mt_free(ms->op_relationship_entries);
     }
 
-    if (ms->file != nullptr) {
+    while (ms->file != nullptr) {
+        ModelFileDescriptor *next = ms->file->next;
         if (ms->file->stream_mode) {
             ms->file->content = nullptr;
             ms->file->length = 0;
@@ -175,6 +176,7 @@ EE mt_destroy_model(ModelSpec *ms)
 #endif
         }
         mt_free(ms->file);
+        ms->file = next;
     }
     return SUCCESS;
 }
@@ -0,0 +1,160 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include <string>
+#include "model_spec.h"
+#include "ut_util.h"
+
+// parameters of conv, fc and matmul before post ops were appended to them(version 20231018).
+typedef struct {
+    U32 fields[18];
+    ConvolutionMode convolution_type;
+    ActivationMode dw_activation_type;
+    ActivationMode pw_activation_type;
+    ActivationSpec activation_spec;
+    RoundMode round_mode;
+    U32 output_pad[3];
+} OldConvolutionParamSpec;
+
+typedef struct {
+    U32 num_outputs;
+    U32 num_slices;
+    I32 slice_point[32];
+} OldFullyConnectedParamSpec;
+
+typedef struct {
+    bool transpose_a;
+    bool transpose_b;
+} OldMatMulParamSpec;
+
+static void write_bytes(std::string &stream, const void *data, U32 bytes)
+{
+    stream.append((const char *)data, bytes);
+}
+
+template <typename T>
+static void write_field(std::string &stream, T value)
+{
+    write_bytes(stream, &value, sizeof(T));
+}
+
+static void write_name(std::string &stream, const char *name)
+{
+    I8 buffer[NAME_LEN] = {0};
+    UNI_STRCPY(buffer, name);
+    write_bytes(stream, buffer, NAME_LEN);
+}
+
+// old models are 4 bytes aligned except version 20201120.
+static U32 old_size(I32 version, U32 size)
+{
+    return (version == 20201120) ? size : (size + 3) / 4 * 4;
+}
+
+static void write_operator(std::string &stream,
+    const char *name,
+    OperatorType type,
+    const char *input,
+    const char *output,
+    const void *ps,
+    U32 size,
+    U32 bytes)
+{
+    write_name(stream, name);
+    write_field<OperatorType>(stream, type);
+    write_field<U32>(stream, 1);
+    write_name(stream, input);
+    write_field<U32>(stream, 1);
+    write_name(stream, output);
+    write_field<I32>(stream, -1);
+    write_field<I32>(stream, -1);
+    write_field<U32>(stream, 0);
+    // padding of parameters is 0
+    std::string p(bytes, 0);
+    UNI_MEMCPY(&p[0], ps, UNI_MIN(size, bytes));
+    write_bytes(stream, p.data(), bytes);
+}
+
+// matmul -> fc -> conv -> relu, every operator is followed by another one, so that a wrong
+// parameter size of an old model moves the next operator.
+static std::string old_model(I32 version)
+{
+    std::string stream;
+    write_field<I32>(stream, version);
+    write_field<I32>(stream, sg_magicNumber);
+    write_name(stream, "old");
+    write_field<DataType>(stream, DT_F32);
+    write_field<I32>(stream, 1);
+    write_name(stream, "data");
+    TensorDesc desc = tensor4df(DT_F32, DF_NCHW, 1, 8, 4, 4);
+    write_bytes(stream, &desc, get_operator_parameter_size(version, OT_Input));
+    write_field<I32>(stream, 1);
+    write_name(stream, "relu");
+
+    write_field<I32>(stream, 4);
+    OldMatMulParamSpec matmul = {true, false};
+    write_operator(stream, "matmul", OT_MatMul, "data", "matmul", &matmul, sizeof(matmul),
+        old_size(version, sizeof(matmul)));
+    OldFullyConnectedParamSpec fc;
+    UNI_MEMSET(&fc, 0, sizeof(fc));
+    fc.num_outputs = 7;
+    fc.num_slices = 1;
+    write_operator(stream, "fc", OT_FC, "matmul", "fc", &fc, sizeof(fc),
+        old_size(version, sizeof(fc)));
+    OldConvolutionParamSpec conv;
+    UNI_MEMSET(&conv, 0, sizeof(conv));
+    conv.fields[0] = 5;
+    conv.convolution_type = CONVOLUTION_POINTWISE;
+    U32 convBytes = sizeof(conv) - ((version == 20201120) ? sizeof(conv.output_pad) : 0);
+    write_operator(
+        stream, "conv", OT_Conv, "fc", "conv", &conv, convBytes, old_size(version, convBytes));
+    ReLUParamSpec relu = {0.25};
+    write_operator(stream, "relu", OT_Relu, "conv", "relu", &relu, sizeof(relu),
+        get_operator_parameter_size(version, OT_Relu));
+
+    write_field<I32>(stream, 0);
+    return stream;
+}
+
+static int deserializeTest(I32 version)
+{
+    std::string stream = old_model(version);
+    ModelSpec spec;
+    CHECK_STATUS(mt_create_model(&spec));
+    CHECK_STATUS(deserialize_model_from_file(stream.data(), &spec, DT_F32, true));
+    CHECK_REQUIREMENT(spec.num_operator_specs == 4);
+    OperatorSpec *ops = spec.ops;
+    CHECK_REQUIREMENT(ops[0].type == OT_MatMul && ops[0].ps.matmul_spec.transpose_a &&
+        !ops[0].ps.matmul_spec.transpose_b && ops[0].ps.matmul_spec.post_ops.num == 0);
+    CHECK_REQUIREMENT(
+        ops[1].type == OT_FC && std::string(ops[1].input_tensors_name[0]) == "matmul");
+    CHECK_REQUIREMENT(ops[1].ps.fc_spec.num_outputs == 7 && ops[1].ps.fc_spec.num_slices == 1 &&
+        ops[1].ps.fc_spec.post_ops.num == 0);
+    CHECK_REQUIREMENT(ops[2].type == OT_Conv && ops[2].ps.conv_spec.num_outputs == 5 &&
+        ops[2].ps.conv_spec.convolution_type == CONVOLUTION_POINTWISE &&
+        ops[2].ps.conv_spec.post_ops.num == 0);
+    CHECK_REQUIREMENT(ops[3].type == OT_Relu && ops[3].ps.relu_spec.neg_slope == 0.25);
+    CHECK_REQUIREMENT(spec.file->length == stream.size());
+    CHECK_STATUS(mt_destroy_model(&spec));
+    UNI_INFO_LOG("deserialize model of version %d: pass.\n", version);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    deserializeTest(20201120);
+    deserializeTest(20211021);
+    deserializeTest(20220831);
+    return 0;
+}
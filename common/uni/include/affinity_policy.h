@@ -22,7 +22,13 @@
 #else
 #define OMP_MAX_NUM_THREADS 1
 #endif
-extern int OMP_NUM_THREADS;
+// threads of a thread that has not set its own, it is set by set_cpu_num_threads.
+extern int OMP_DEFAULT_NUM_THREADS;
+// threads of parallel regions started by the calling thread. It is thread_local, a thread starts
+// from OMP_DEFAULT_NUM_THREADS when it first reads it, so threads created by users or thread
+// pools follow set_cpu_num_threads. Models and operators that run on fewer threads change it on
+// their own thread only, other threads are not affected.
+extern thread_local int OMP_NUM_THREADS;
 const int CPU_MAX_NUMBER = 128;
 
 typedef enum {
@@ -44,6 +50,11 @@ typedef struct DeviceInfo {
     float occupys[CPU_MAX_NUMBER];
     int cpuids[CPU_MAX_NUMBER];
     CpuStat cpuStats[CPU_MAX_NUMBER];
+    // NUMA node of each cpu, numaNode is the node that threads and memory are bound to, -1 means
+    // not bound.
+    int numaNodes[CPU_MAX_NUMBER];
+    int numaNodeNum;
+    int numaNode;
 
     float maxOccupy;
     AffinityPolicy affinityPolicy;
@@ -92,6 +103,26 @@ inline void set_cpu_num_threads(int threadNum)
     if (threadNum > OMP_MAX_NUM_THREADS) {
         threadNum = OMP_MAX_NUM_THREADS;
     }
+    OMP_DEFAULT_NUM_THREADS = threadNum;
     OMP_NUM_THREADS = threadNum;
 }
+
+// run parallel regions of the calling thread on threadNum threads in a scope, 0 keeps the threads.
+class ThreadNumScope {
+public:
+    ThreadNumScope(int threadNum) : saved(OMP_NUM_THREADS)
+    {
+        if (threadNum > 0) {
+            OMP_NUM_THREADS = threadNum;
+        }
+    }
+
+    ~ThreadNumScope()
+    {
+        OMP_NUM_THREADS = this->saved;
+    }
+
+private:
+    int saved;
+};
 #endif
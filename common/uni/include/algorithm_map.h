@@ -94,6 +94,15 @@ public:
         }
     }
 
+    std::string getAlgorithmInfoString(std::string name)
+    {
+        std::string algoInfo = "";
+        if (this->algorithmMap.find(name) != this->algorithmMap.end()) {
+            algoInfo = this->algorithmMap[name];
+        }
+        return algoInfo;
+    }
+
     bool getAlgorithmInfoFromMap(
         std::string name, I32 *algorithmArray, U32 arrayNum, bool commonAlgo = false)
     {
@@ -0,0 +1,127 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#ifndef _H_LOCK_FREE_QUEUE
+#define _H_LOCK_FREE_QUEUE
+
+#include <atomic>
+#include <memory>
+#include <stdint.h>
+#include "data_type.h"
+
+// Bounded multi-producer multi-consumer queue. Every cell carries a sequence number, producers
+// and consumers claim a position with one CAS and then only touch their own cell, so there is
+// no lock and no contention between a producer and a consumer that work on different cells.
+template <typename T>
+class LockFreeQueue {
+public:
+    explicit LockFreeQueue(U32 capacity = 4096)
+    {
+        U32 size = 2;
+        while (size < capacity) {
+            size *= 2;
+        }
+        this->mask = size - 1;
+        this->cells = std::unique_ptr<Cell[]>(new Cell[size]);
+        for (U32 i = 0; i < size; i++) {
+            this->cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        this->enqueuePos.store(0, std::memory_order_relaxed);
+        this->dequeuePos.store(0, std::memory_order_relaxed);
+    }
+
+    // return false when queue is full.
+    bool push(const T &item)
+    {
+        Cell *cell;
+        size_t pos = this->enqueuePos.load(std::memory_order_relaxed);
+        while (1) {
+            cell = &(this->cells[pos & this->mask]);
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+            if (diff == 0) {
+                if (this->enqueuePos.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = this->enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->data = item;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // return false when queue is empty.
+    bool pop(T *item)
+    {
+        Cell *cell;
+        size_t pos = this->dequeuePos.load(std::memory_order_relaxed);
+        while (1) {
+            cell = &(this->cells[pos & this->mask]);
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = (intptr_t)sequence - (intptr_t)(pos + 1);
+            if (diff == 0) {
+                if (this->dequeuePos.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = this->dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        *item = cell->data;
+        cell->sequence.store(pos + this->mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    // pop at most num items, return the number of items that have been popped.
+    U32 pop_batch(T *items, U32 num)
+    {
+        U32 i = 0;
+        for (; i < num; i++) {
+            if (!this->pop(items + i)) {
+                break;
+            }
+        }
+        return i;
+    }
+
+    // approximate, an item that is being pushed already counts.
+    bool empty()
+    {
+        return this->dequeuePos.load() >= this->enqueuePos.load();
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    std::unique_ptr<Cell[]> cells;
+    size_t mask;
+    // keep producer and consumer positions on different cache lines.
+    char pad0[64];
+    std::atomic<size_t> enqueuePos;
+    char pad1[64];
+    std::atomic<size_t> dequeuePos;
+    char pad2[64];
+};
+#endif
@@ -0,0 +1,73 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef _H_OP_PROFILER
+#define _H_OP_PROFILER
+
+#include <atomic>
+#include <string>
+#include "data_type.h"
+#include "error.h"
+
+// Per-operator profiler that is compiled into every build and is off by default.
+//
+// It is switched by op_profiler_enable, or by environment variable BOLT_PROFILE=ON at load time.
+// Every thread records into its own preallocated ring buffer(BOLT_PROFILE_CAPACITY events, 16384
+// by default), the oldest events are overwritten. Buffers are freed when their threads exit,
+// the latest events of exited threads(one capacity in all) are kept for reports. Wall time is
+// taken from a monotonic clock, and cycles, instructions and last level cache misses are read
+// from perf_event_open on linux when the kernel allows it, otherwise they are 0. Counters only
+// cover the thread that runs the operator, work of its OpenMP or thread pool workers is not
+// counted, so IPC and cache misses of parallel operators are those of the calling thread. When
+// BOLT_PROFILE is set, the summary is printed at exit and Chrome trace is written to
+// BOLT_PROFILE_TRACE if it is set.
+extern std::atomic<bool> uniOpProfilerEnabled;
+
+typedef struct {
+    double start;
+    U64 counters[3];
+} OpProfilerEvent;
+
+inline bool op_profiler_enabled()
+{
+    return uniOpProfilerEnabled.load(std::memory_order_relaxed);
+}
+
+void op_profiler_enable(bool enable);
+
+// drop all recorded events.
+void op_profiler_reset();
+
+void op_profiler_begin_event(OpProfilerEvent *event);
+
+// return false when profiler is disabled, then op_profiler_end must not be called.
+inline bool op_profiler_begin(OpProfilerEvent *event)
+{
+    if (!op_profiler_enabled()) {
+        return false;
+    }
+    op_profiler_begin_event(event);
+    return true;
+}
+
+// bytes is the size of data touched by operator, such as input and output tensors.
+void op_profiler_end(
+    const OpProfilerEvent *event, const char *name, const char *category, U64 bytes);
+
+// write events of all threads in Chrome trace format, which can be opened by chrome://tracing.
+// Model should not be running when dumping.
+EE op_profiler_dump_trace(const char *path);
+
+// time, cycles, instructions, cache misses and bandwidth of every operator type.
+std::string op_profiler_summary();
+#endif  // _H_OP_PROFILER
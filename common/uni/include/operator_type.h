@@ -136,6 +136,7 @@ typedef enum OperatorType : uint32_t {
     OT_ConvertColor = 107,
     OT_Lut = 108,
     OT_LutPreprocess = 109,
+    OT_ScaledDotProductAttention = 110,
 } OperatorType;
 
 inline const char *const *OperatorTypeName()
@@ -172,7 +173,7 @@ inline const char *const *OperatorTypeName()
         "OT_GridSample", "OT_NonMaxSuppression", "OT_Range",
 
         "OT_Swish", "OT_Sin", "OT_Cos", "OT_Elu", "OT_Einsum", "OT_UnPooling", "OT_Flatten",
-        "OT_ConvertColor", "OT_Lut", "OT_LutPreprocess"};
+        "OT_ConvertColor", "OT_Lut", "OT_LutPreprocess", "OT_ScaledDotProductAttention"};
     return names;
 }
 #endif
@@ -14,6 +14,7 @@
 #ifndef _H_PARAMETER_SPEC
 #define _H_PARAMETER_SPEC
 
+#include <stddef.h>
 #include <map>
 #include "operator_type.h"
 #include "tensor_desc.h"
@@ -186,11 +187,18 @@ typedef struct {
     bool propagate_down;
 } PReLUParamSpec;
 
+// NMS_GREEDY suppresses a box by the kept boxes with higher scores.
+// NMS_FAST suppresses a box by all boxes with higher scores, whether they are kept or not.
+// NMS_MATRIX decays score of a box by its IoUs with boxes of higher scores(linear Matrix NMS),
+// boxes whose decayed score is still above score threshold are kept, IoU threshold is not used.
+typedef enum NMSMode : ENUM_TYPE { NMS_GREEDY, NMS_FAST, NMS_MATRIX } NMSMode;
+
 typedef struct {
     I32 center_point_box;
     U32 max_output_boxes_per_class;
     float iou_threshold;
     float score_threshold;
+    NMSMode mode;
 } NonMaxSuppressionParamSpec;
 
 typedef struct {
@@ -253,6 +261,34 @@ typedef struct {
     ActivationSpec activation_spec;
 } EltwiseParamSpec;
 
+typedef enum PostOpType : ENUM_TYPE {
+    POST_OP_ELTWISE_SUM,
+    POST_OP_SCALE,
+    POST_OP_CLIP,
+    POST_OP_ACTIVATION
+} PostOpType;
+
+#define MAX_POST_OPS 4
+
+// operation applied to output of conv/fc/matmul before it is stored.
+// POST_OP_ELTWISE_SUM adds the next extra input of operator, which has the same shape as output.
+// POST_OP_SCALE computes alpha * x + beta, when channel_wise is not 0, alpha and beta are
+// channel vectors that follow bias in weight.
+// POST_OP_CLIP uses activation_spec.clip_spec, POST_OP_ACTIVATION uses activation_type.
+typedef struct {
+    PostOpType type;
+    ActivationMode activation_type;
+    ActivationSpec activation_spec;
+    U32 channel_wise;
+    float alpha;
+    float beta;
+} PostOpSpec;
+
+typedef struct {
+    U32 num;
+    PostOpSpec ops[MAX_POST_OPS];
+} PostOpsParamSpec;
+
 typedef struct {
     U32 num_outputs;
     U32 kernel_t;
@@ -280,6 +316,7 @@ typedef struct {
     U32 output_pad_t;
     U32 output_pad_h;
     U32 output_pad_w;
+    PostOpsParamSpec post_ops;
 } ConvolutionParamSpec;
 
 typedef struct {
@@ -306,6 +343,7 @@ typedef struct FullyConnectedParamSpec {
     U32 num_outputs;
     U32 num_slices = 1;
     I32 slice_point[32];
+    PostOpsParamSpec post_ops;
 } FullyConnectedParamSpec;
 
 typedef struct {
@@ -435,6 +473,7 @@ typedef struct {
 typedef struct {
     bool transpose_a;
     bool transpose_b;
+    PostOpsParamSpec post_ops;
 } MatMulParamSpec;
 
 typedef struct {
@@ -489,6 +528,7 @@ typedef struct {
     U32 nms_top_k;
     U32 keep_top_k;
     float confidence_threshold;
+    NMSMode nms_mode;
 } DetectionOutputParamSpec;
 
 typedef struct {
@@ -500,6 +540,7 @@ typedef struct {
     U32 anchors_scale[3];
     U32 mask_group_num;
     U32 mask[9];
+    NMSMode nms_mode;
 } Yolov3DetectionOutputParamSpec;
 
 typedef struct {
@@ -681,6 +722,12 @@ typedef struct LutParamSpec {
     ResizeMode mode;
 } LutParamSpec;
 
+// softmax(scale * Q x K^T + mask) x V, transpose_k is same as MatMul transpose_b
+typedef struct ScaledDotProductAttentionParamSpec {
+    float scale;
+    bool transpose_k;
+} ScaledDotProductAttentionParamSpec;
+
 typedef union ParameterSpec {
     ParameterSpec()
     {}
@@ -749,6 +796,7 @@ typedef union ParameterSpec {
     FlattenParamSpec flatten_spec;
     ConvertColorParamSpec convert_color_spec;
     LutParamSpec lut_spec;
+    ScaledDotProductAttentionParamSpec sdpa_spec;
 } ParameterSpec;
 
 typedef struct {
@@ -831,6 +879,7 @@ inline I32 get_operator_parameter_size(I32 version, OperatorType operatorType)
         {OT_Random, sizeof(RandomParamSpec)},
         {OT_Flatten, sizeof(FlattenParamSpec)},
         {OT_ConvertColor, sizeof(ConvertColorParamSpec)},
+        {OT_ScaledDotProductAttention, sizeof(ScaledDotProductAttentionParamSpec)},
     };
     I32 size;
     if (operatorParameterSizeMap.find(operatorType) == operatorParameterSizeMap.end()) {
@@ -838,6 +887,19 @@ inline I32 get_operator_parameter_size(I32 version, OperatorType operatorType)
     } else {
         size = operatorParameterSizeMap[operatorType];
     }
+    // post ops are appended to these parameters, old models store the fields before them.
+    // the end of the last old field is used, post_ops is aligned after the bools of MatMul.
+    if (version < 20231018) {
+        if (operatorType == OT_Conv || operatorType == OT_Deconvolution) {
+            size = offsetof(ConvolutionParamSpec, post_ops);
+        }
+        if (operatorType == OT_FC) {
+            size = offsetof(FullyConnectedParamSpec, post_ops);
+        }
+        if (operatorType == OT_MatMul) {
+            size = offsetof(MatMulParamSpec, transpose_b) + sizeof(bool);
+        }
+    }
     if (version == 20201120) {
         if (operatorType == OT_Conv || operatorType == OT_Deconvolution) {
             size -= 3 * sizeof(U32);
@@ -863,6 +925,12 @@ inline I32 get_operator_parameter_size(I32 version, OperatorType operatorType)
             size = size - sizeof(float) - 2 * sizeof(I32);
         }
     }
+    if (version < 20231019) {
+        if (operatorType == OT_NonMaxSuppression || operatorType == OT_DetectionOutput ||
+            operatorType == OT_Yolov3DetectionOutput) {
+            size -= (sizeof(NMSMode) + 3) / 4 * 4;
+        }
+    }
     if (version < 20220831) {
         if (operatorType == OT_Input || operatorType == OT_SharedWeight) {
             size -= (DIM_LEN - 6) * sizeof(U32);
@@ -875,6 +943,30 @@ inline I32 get_operator_parameter_size(I32 version, OperatorType operatorType)
     return size;
 }
 
+// extra inputs taken by POST_OP_ELTWISE_SUM, they are the last inputs of operator.
+inline U32 get_post_ops_input_num(const PostOpsParamSpec &p)
+{
+    U32 num = 0;
+    for (U32 i = 0; i < p.num; i++) {
+        if (p.ops[i].type == POST_OP_ELTWISE_SUM) {
+            num++;
+        }
+    }
+    return num;
+}
+
+// channel wise POST_OP_SCALE, every one stores alpha and beta vectors after bias.
+inline U32 get_post_ops_channel_wise_num(const PostOpsParamSpec &p)
+{
+    U32 num = 0;
+    for (U32 i = 0; i < p.num; i++) {
+        if (p.ops[i].type == POST_OP_SCALE && p.ops[i].channel_wise) {
+            num++;
+        }
+    }
+    return num;
+}
+
 inline ConvolutionParamSpec createConvolutionParamSpec(U32 group,
     U32 kernel_t,
     U32 kernel_h,
@@ -916,6 +1008,7 @@ inline ConvolutionParamSpec createConvolutionParamSpec(U32 group,
     p.output_pad_t = 0;
     p.output_pad_h = 0;
     p.output_pad_w = 0;
+    p.post_ops.num = 0;
     return p;
 }
 
@@ -930,6 +1023,7 @@ inline FullyConnectedParamSpec createFullyConnectedParamSpec(
             p.slice_point[i] = slice_point[i];
         }
     }
+    p.post_ops.num = 0;
     return p;
 }
 
@@ -16,32 +16,31 @@
 
 #define _USE_WEIGHT_SHARE
 
-#include <queue>
 #include <map>
 #include <vector>
 #include <string>
 
 #include "graph.h"
 #include "task.h"
+#include "task_dispatcher.h"
 
 template <class GraphParameter, class ComputeNode, class DataTensor>
 class Schedule {
 public:
     Schedule()
     {
-        pthread_mutex_init(&(this->taskQueueLock), NULL);
-        pthread_cond_init(&(this->condition), NULL);
         this->threadNum = 0;
+        this->threads = nullptr;
         this->stop = false;
+        this->workerIndex = 0;
     }
 
     ~Schedule()
     {
-        pthread_mutex_lock(&(this->taskQueueLock));
-        pthread_mutex_destroy(&(this->taskQueueLock));
-        pthread_cond_destroy(&(this->condition));
 #if !defined(__ANDROID_API__) && !defined(__APPLE__)
-        pthread_barrier_destroy(&(this->barrier));
+        if (this->threadNum > 0) {
+            pthread_barrier_destroy(&(this->barrier));
+        }
 #endif
         delete[] this->threads;
     }
@@ -56,12 +55,6 @@ public:
         if (threadNum <= 0) {
             return 1;
         }
-        if (pthread_mutex_init(&(this->taskQueueLock), NULL)) {
-            return 1;
-        }
-        if (pthread_cond_init(&(this->condition), NULL)) {
-            return 1;
-        }
 #if !defined(__ANDROID_API__) && !defined(__APPLE__)
         if (pthread_barrier_init(&(this->barrier), NULL, threadNum)) {
             return 1;
@@ -87,6 +80,8 @@ public:
         set_thread_affinity(0, &cpuId, 1);
 #endif
         this->threadNum = threadNum;
+        this->dispatcher =
+            std::shared_ptr<TaskDispatcher<Task *>>(new TaskDispatcher<Task *>(threadNum));
         this->threads = new pthread_t[threadNum];
         for (int i = 0; i < threadNum; i++) {
             if (pthread_create(this->threads + i, NULL, worker, reinterpret_cast<void *>(this)) !=
@@ -104,17 +99,11 @@ public:
     int end()
     {
         UNI_DEBUG_LOG("schedule exit begin\n");
-        if (pthread_mutex_lock(&(this->taskQueueLock)) != 0) {
-            return 1;
+        if (this->stop || this->dispatcher == nullptr) {
+            return 0;
         }
-
         this->stop = true;
-
-        if ((pthread_cond_broadcast(&(this->condition)) != 0) ||
-            (pthread_mutex_unlock(&(this->taskQueueLock)) != 0)) {
-            return 1;
-        }
-
+        this->dispatcher->close();
         for (int i = 0; i < this->threadNum; i++) {
             if (pthread_join(this->threads[i], NULL) != 0) {
                 return 1;
@@ -132,35 +121,23 @@ public:
                             "deprecated\n");
             return 1;
         }
-        if (pthread_mutex_lock(&(this->taskQueueLock)) != 0) {
-            UNI_WARNING_LOG("schedule enqueue task failed because of can not acquire task queue "
-                            "lock\n");
-            return 1;
-        }
-        if (this->stop) {
+        if (this->stop || !this->dispatcher->push(task)) {
             UNI_WARNING_LOG("schedule enqueue task failed because schedule has end\n");
             return 1;
         }
-        this->taskQueue.push(task);
-        if (pthread_cond_signal(&(this->condition)) != 0) {
-            UNI_WARNING_LOG("schedule enqueue task failed because can not find worker\n");
-            return 1;
-        }
-        pthread_mutex_unlock(&(this->taskQueueLock));
         UNI_DEBUG_LOG("schedule enqueue task end\n");
         return 0;
     }
 
 private:
     int threadNum;
-    pthread_mutex_t taskQueueLock;
-    std::queue<Task *> taskQueue;
-    pthread_cond_t condition;
+    std::shared_ptr<TaskDispatcher<Task *>> dispatcher;
+    std::atomic<int> workerIndex;
 #if !defined(__ANDROID_API__) && !defined(__APPLE__)
     pthread_barrier_t barrier;
 #endif
     pthread_t *threads;
-    int stop;
+    std::atomic<bool> stop;
 
     std::vector<std::string> graphPath;
     std::map<std::string, Graph<GraphParameter, ComputeNode, DataTensor>> graph;
@@ -169,20 +146,11 @@ private:
     DeviceInfo deviceInfo;
     DataType precision;
 
-    int getThreadId(pthread_t tid)
-    {
-        for (int i = 0; i < this->threadNum; i++) {
-            if (this->threads[i] == tid) {
-                return i;
-            }
-        }
-        return -1;
-    }
-
     static void *worker(void *_schedule)
     {
         Schedule *schedule = reinterpret_cast<Schedule *>(_schedule);
-        int threadId = schedule->getThreadId(pthread_self());
+        // threads[i] may not be set yet when the thread starts, so ids are handed out in order.
+        int threadId = schedule->workerIndex.fetch_add(1);
         UNI_DEBUG_LOG("worker(%d) begin\n", threadId);
         std::map<std::string, Graph<GraphParameter, ComputeNode, DataTensor>> threadPrivateGraph;
 #ifdef _USE_WEIGHT_SHARE
@@ -240,28 +208,11 @@ private:
         }
 #endif
         UNI_DEBUG_LOG("start to wait task\n");
-        while (1) {
-            pthread_mutex_lock(&(schedule->taskQueueLock));
-            while (schedule->taskQueue.empty() && !(schedule->stop)) {
-                pthread_cond_wait(&(schedule->condition), &(schedule->taskQueueLock));
-            }
-            if (schedule->stop) {
-                break;
-            }
-
-            Task *task = nullptr;
-            if (!(schedule->taskQueue.empty())) {
-                task = schedule->taskQueue.front();
-                schedule->taskQueue.pop();
-            }
-            pthread_mutex_unlock(&(schedule->taskQueueLock));
-            if (task != nullptr) {
-                threadPrivateGraph[task->graphPath].run(task->data);
-                task->status = TASK_END;
-            }
+        Task *task = nullptr;
+        while (schedule->dispatcher->pop(threadId, &task)) {
+            threadPrivateGraph[task->graphPath].run(task->data);
+            task->status = TASK_END;
         }
-
-        pthread_mutex_unlock(&(schedule->taskQueueLock));
         UNI_DEBUG_LOG("worker end\n");
         return (NULL);
     }
@@ -20,7 +20,11 @@
 #define IS_GENERAL(arch) (arch == CPU_GENERAL)
 #define IS_X86_AVX512(arch) (arch == X86_AVX512)
 #define IS_X86_AVXVNNI(arch) (arch == X86_AVXVNNI)
-#define IS_X86_AVX2(arch) ((arch == X86_AVX2) || IS_X86_AVX512(arch) || IS_X86_AVXVNNI(arch))
+// processors with avx512f but without avx512_vnni(Skylake-SP), int8 kernels stay on AVX2.
+#define IS_X86_AVX512_NOVNNI(arch) (arch == X86_AVX512_NOVNNI)
+#define IS_X86_AVX2(arch)                                                                   \
+    ((arch == X86_AVX2) || IS_X86_AVX512(arch) || IS_X86_AVXVNNI(arch) ||                   \
+        IS_X86_AVX512_NOVNNI(arch))
 #define IS_X86_VNNI(arch) (IS_X86_AVX512(arch) || IS_X86_AVXVNNI(arch))
 #define IS_X86(arch) (IS_X86_AVX2(arch) || IS_X86_AVX512(arch) || IS_X86_AVXVNNI(arch))
 #define IS_ARM_V7(arch) (arch == ARM_V7)
@@ -51,13 +55,15 @@ typedef enum {
     QUALCOMM = 7,
     X86_AVX2 = 8,
     X86_AVX512 = 9,
-    X86_AVXVNNI = 10
+    X86_AVXVNNI = 10,
+    X86_AVX512_NOVNNI = 11
 } Arch;
 
 inline const char *const *ArchName()
 {
     static const char *const names[] = {"UNKNOWN", "SERIAL", "MALI", "ARM_V7", "ARM_V8",
-        "ARM_V8.2_LITTLE", "ARM_V8.2_BIG", "QUALCOMM", "X86_AVX2", "X86_AVX512"};
+        "ARM_V8.2_LITTLE", "ARM_V8.2_BIG", "QUALCOMM", "X86_AVX2", "X86_AVX512", "X86_AVXVNNI",
+        "X86_AVX512_NOVNNI"};
     return names;
 }
 
@@ -0,0 +1,151 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#ifndef _H_TASK_DISPATCHER
+#define _H_TASK_DISPATCHER
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "uni.h"
+#include "lock_free_queue.h"
+#include "work_stealing_queue.h"
+
+// Hand tasks from any number of producers to a fixed set of workers.
+// Producers push into a lock free queue. A worker takes a batch from it into its own deque,
+// runs tasks from the deque and steals from other workers' deques when the queue is empty.
+// Idle workers sleep, producers only touch the lock when somebody sleeps.
+template <typename T>
+class TaskDispatcher {
+public:
+    TaskDispatcher(U32 workerNum, U32 capacity = 4096, U32 batchSize = 4)
+        : queue(capacity)
+    {
+        this->workerNum = UNI_MAX(workerNum, 1);
+        this->batchSize = UNI_MIN(UNI_MAX(batchSize, 1), (U32)MAX_BATCH_SIZE);
+        this->locals = std::unique_ptr<LocalQueue[]>(new LocalQueue[this->workerNum]);
+        this->sleepers.store(0);
+        this->closed.store(false);
+    }
+
+    // return false when dispatcher has been closed. block when queue is full.
+    bool push(const T &item)
+    {
+        while (!this->queue.push(item)) {
+            if (this->closed.load(std::memory_order_relaxed)) {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+        this->notify();
+        return !this->closed.load(std::memory_order_relaxed);
+    }
+
+    // block until a task is available, return false when dispatcher has been closed.
+    bool pop(U32 workerId, T *item)
+    {
+        U32 spin = 0;
+        while (!this->closed.load(std::memory_order_acquire)) {
+            if (this->try_pop(workerId, item)) {
+                return true;
+            }
+            // tasks usually come in bursts, waking a sleeping thread costs more than a short spin.
+            if (spin++ < SPIN_COUNT) {
+                std::this_thread::yield();
+                continue;
+            }
+            spin = 0;
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->sleepers.fetch_add(1);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (this->idle() && !this->closed.load()) {
+                this->condition.wait(lock);
+            }
+            this->sleepers.fetch_sub(1);
+        }
+        return false;
+    }
+
+    void close()
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->closed.store(true);
+        this->condition.notify_all();
+    }
+
+private:
+    void notify()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (this->sleepers.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->condition.notify_one();
+        }
+    }
+
+    bool idle()
+    {
+        if (!this->queue.empty()) {
+            return false;
+        }
+        for (U32 i = 0; i < this->workerNum; i++) {
+            if (!this->locals[i].empty()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool try_pop(U32 workerId, T *item)
+    {
+        LocalQueue &local = this->locals[workerId % this->workerNum];
+        if (local.pop(item)) {
+            return true;
+        }
+        T batch[MAX_BATCH_SIZE];
+        U32 num = this->queue.pop_batch(batch, this->batchSize);
+        if (num > 0) {
+            // keep first in first out, the deque owner pops from the back.
+            for (U32 i = num - 1; i > 0; i--) {
+                local.push(batch[i]);
+            }
+            *item = batch[0];
+            if (num > 1) {
+                this->notify();
+            }
+            return true;
+        }
+        for (U32 i = 1; i < this->workerNum; i++) {
+            if (this->locals[(workerId + i) % this->workerNum].steal(item)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static const U32 MAX_BATCH_SIZE = 16;
+    static const U32 SPIN_COUNT = 64;
+    U32 workerNum;
+    U32 batchSize;
+    LockFreeQueue<T> queue;
+    // a worker only refills its deque when the deque is empty, so one batch always fits.
+    typedef LockFreeWorkStealingQueue<T, MAX_BATCH_SIZE> LocalQueue;
+    std::unique_ptr<LocalQueue[]> locals;
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::atomic<U32> sleepers;
+    std::atomic<bool> closed;
+};
+#endif
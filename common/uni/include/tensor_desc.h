@@ -74,7 +74,10 @@ typedef enum DataFormat : ENUM_TYPE {
     DF_NKNx_NKN32,  // Optimized LSTM filter
     DF_NCHWC16,     // vectorize for C=16, for input and output
     DF_NCHWC2NxC4,
-    DF_SCALAR
+    DF_SCALAR,
+    DF_NKN16_BSR,  // sparse MMM filter, nonzero 16x1 blocks, dims[2] is bytes
+    DF_NKN8_2_4,   // sparse MMM filter, 2:4 sparsity along K, dims[2] is bytes
+    DF_NKN32K512   // Optimized MMM filter for FP32 AVX-512, 32 column panels of 512 K blocks
 } DataFormat;
 
 inline const char *const *DataFormatName()
@@ -86,7 +89,7 @@ inline const char *const *DataFormatName()
         "DF_NCHWC3", "DF_NHWC", "DF_NCHWN4C4", "DF_NCHWN4", "DF_HWCN", "DF_NCWHN4C4", "DF_NHWCN4",
         "DF_CHWNC4", "DF_CHWNC8", "DF_CHWNC16", "DF_CHWC8_NCN8", "DF_RGB", "DF_HWNCN8", "DF_NKN24",
         "DF_NKN12", "DF_NKN8", "DF_NKN12K4", "DF_NKNx_NKN32", "DF_NCHWC16", "DF_NCHWC2NxC4",
-        "DF_SCALAR"};
+        "DF_SCALAR", "DF_NKN16_BSR", "DF_NKN8_2_4", "DF_NKN32K512"};
     return names;
 }
 
@@ -352,6 +355,10 @@ inline U32 tensorNumBytes(TensorDesc desc)
 {
     if (desc.dt == DT_BIN01 || desc.dt == DT_BIN11) {
         return tensorNumElements(desc) / 8;
+    } else if (desc.df == DF_NKN16_BSR || desc.df == DF_NKN8_2_4) {
+        return desc.dims[2];
+    } else if (desc.dt == DT_I4) {
+        return (tensorNumElements(desc) + 1) / 2;
     } else {
         return tensorNumElements(desc) * bytesOf(desc.dt);
     }
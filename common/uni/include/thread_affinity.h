@@ -65,19 +65,29 @@ inline int get_cpus_num()
     return cpuNum;
 }
 
-inline void get_cpus_arch(Arch *archs, int cpuNum)
-{
-#ifdef __APPLE__
-    for (int cpuid = 0; cpuid < cpuNum; cpuid++) {
-        archs[cpuid] = ARM_A76;
-    }
-    return;
+#ifdef _USE_X86
+#define X86_OSXSAVE (1U << 0)
+#define X86_AVX (1U << 1)
+#define X86_FMA (1U << 2)
+#define X86_AVX2_FMA (1U << 3)
+#define X86_AVX512F (1U << 4)
+#define X86_AVX512_VNNI (1U << 5)
+#define X86_AVX_VNNI (1U << 6)
+#define X86_AVX512_BF16 (1U << 7)
+
+// kernel marked with them is built for avx512 whatever the compile options are, caller must check
+// X86_AVX512F or X86_AVX512_BF16 of get_x86_features() first.
+#if defined(__GNUC__) || defined(__clang__)
+#define X86_AVX512_TARGET __attribute__((target("avx512f,popcnt")))
+#define X86_AVX512_BF16_TARGET __attribute__((target("avx512f,avx512bf16")))
+#else
+#define X86_AVX512_TARGET
+#define X86_AVX512_BF16_TARGET
 #endif
-    *archs = CPU_GENERAL;
 
-#ifdef _USE_X86
-    _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
-    _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+// instruction set extensions that both cpu and os support.
+inline U32 detect_x86_features()
+{
     U32 data[4] = {};
     const U32 &eax = data[0];
     const U32 &ebx = data[1];
@@ -85,39 +95,31 @@ inline void get_cpus_arch(Arch *archs, int cpuNum)
     const U32 &edx = data[3];
     uint64_t bv = 0;
 
-    const U32 osxsave = 1U << 0;
-    const U32 avx = 1U << 1;
-    const U32 fma = 1U << 2;
-    const U32 avx2_fma = 1U << 3;
-    const U32 avx512f = 1U << 4;
-    const U32 avx512_vnni = 1U << 5;
-    const U32 avx_vnni = 1U << 6;
-
     get_cpuid_ax(data, 0);
     const U32 maxNum = eax;
 
-    U32 cpuArch = 0;
+    U32 features = 0;
     get_cpuid_ax(data, 1);
     if (ecx & (1U << 27)) {
-        cpuArch |= osxsave;
+        features |= X86_OSXSAVE;
     }
-    if (cpuArch & osxsave) {
+    if (features & X86_OSXSAVE) {
         get_bv(data);
         bv = ((uint64_t)edx << 32) | eax;
         if ((bv & (1U << 1)) && (bv & (1U << 2))) { // xmm & ymm
             if (ecx & (1U << 28)) {
-                cpuArch |= avx;
+                features |= X86_AVX;
             }
             if (ecx & (1U << 12)) {
-                cpuArch |= fma;
+                features |= X86_FMA;
             }
             if ((bv & (1U << 6)) && (bv & (1U << 7))) { // zmm0-15 && zmm16-31
                 get_cpuid_axcx(data, 7, 0);
                 if (ebx & (1U << 16)) {
-                    cpuArch |= avx512f;
+                    features |= X86_AVX512F;
                 }
-                if ((cpuArch & avx512f) && (ecx & (1U << 11))) {
-                    cpuArch |= avx512_vnni;
+                if ((features & X86_AVX512F) && (ecx & (1U << 11))) {
+                    features |= X86_AVX512_VNNI;
                 }
             }
         }
@@ -125,22 +127,61 @@ inline void get_cpus_arch(Arch *archs, int cpuNum)
 
     if (maxNum >= 7) {
         get_cpuid_axcx(data, 7, 0);
-        if ((cpuArch & avx) && (ebx & (1U << 5))) {
-            cpuArch |= avx2_fma;
+        if ((features & X86_AVX) && (ebx & (1U << 5))) {
+            features |= X86_AVX2_FMA;
         }
         if (eax >= 1) {
             get_cpuid_axcx(data, 7, 1);
             if (eax & (1U << 4)) {
-                cpuArch |= avx_vnni;
+                features |= X86_AVX_VNNI;
+            }
+            if ((features & X86_AVX512F) && (eax & (1U << 5))) {
+                features |= X86_AVX512_BF16;
             }
         }
     }
+    return features;
+}
+
+inline U32 get_x86_features()
+{
+    static const U32 features = detect_x86_features();
+    return features;
+}
+#endif
+
+// int8 mmm and mvm kernels use vnni, avx512_vnni ones are selected at run time when the
+// processor has it, otherwise avx_vnni ones. They can not run on processors without either.
+inline bool has_x86_int8_vnni(Arch arch)
+{
+    bool ret = false;
+#ifdef _USE_X86
+    ret = IS_X86_VNNI(arch) && (get_x86_features() & (X86_AVX512_VNNI | X86_AVX_VNNI));
+#endif
+    return ret;
+}
+
+inline void get_cpus_arch(Arch *archs, int cpuNum)
+{
+#ifdef __APPLE__
+    for (int cpuid = 0; cpuid < cpuNum; cpuid++) {
+        archs[cpuid] = ARM_A76;
+    }
+    return;
+#endif
+    *archs = CPU_GENERAL;
 
-    if (cpuArch & avx_vnni) {
+#ifdef _USE_X86
+    _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
+    _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+    U32 cpuArch = get_x86_features();
+    if (cpuArch & X86_AVX_VNNI) {
         archs[0] = X86_AVXVNNI;
-    }else if (cpuArch & avx512_vnni) {
+    } else if (cpuArch & X86_AVX512_VNNI) {
         archs[0] = X86_AVX512;
-    } else if (cpuArch & avx2_fma) {
+    } else if ((cpuArch & X86_AVX512F) && (cpuArch & X86_AVX2_FMA)) {
+        archs[0] = X86_AVX512_NOVNNI;
+    } else if (cpuArch & X86_AVX2_FMA) {
         archs[0] = X86_AVX2;
     } else {
         UNI_WARNING_LOG("The least arch AVX2-FMA is not available, use general implementation.\n");
@@ -316,6 +357,66 @@ inline void get_cpus_occupy(CpuStat *cpuStat, float *cpuOccupy, int cpuNum)
     fclose(fp);
 }
 
+// mark cpus of a cpulist like 0-15,32-47 as on node. return whether any cpu is marked.
+inline bool parse_numa_cpulist(const char *list, int node, int *nodes, int cpuNum)
+{
+    bool found = false;
+    char *p = (char *)list;
+    while (*p >= '0' && *p <= '9') {
+        int begin = strtol(p, &p, 10);
+        int end = begin;
+        if (*p == '-') {
+            end = strtol(p + 1, &p, 10);
+        }
+        for (int i = begin; i <= end && i < cpuNum; i++) {
+            nodes[i] = node;
+            found = true;
+        }
+        if (*p == ',') {
+            p++;
+        }
+    }
+    return found;
+}
+
+// NUMA node of every cpu is read from /sys/devices/system/node, all cpus are on node 0 if the
+// kernel does not expose NUMA. BOLT_NUMA_CPULIST simulates a topology, cpulists of nodes are
+// separated by ';', such as 0-3;4-7. return the number of nodes.
+inline int get_cpus_numa_node(int *nodes, int cpuNum)
+{
+    int nodeNum = 1;
+    for (int i = 0; i < cpuNum; i++) {
+        nodes[i] = 0;
+    }
+    const char *simulation = getenv("BOLT_NUMA_CPULIST");
+    if (simulation != NULL && simulation[0] != '\0') {
+        int node = 0;
+        for (const char *p = simulation; p != NULL; node++) {
+            parse_numa_cpulist(p, node, nodes, cpuNum);
+            p = strchr(p, ';');
+            p = (p == NULL) ? NULL : p + 1;
+        }
+        return node;
+    }
+#if defined(__linux__)
+    for (int node = 0; node < CPU_MAX_NUMBER; node++) {
+        char path[256];
+        UNI_SNPRINTF(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+        FILE *fp = fopen(path, "rb");
+        if (fp == NULL) {
+            continue;
+        }
+        char buffer[1024];
+        if (fgets(buffer, sizeof(buffer), fp) != NULL &&
+            parse_numa_cpulist(buffer, node, nodes, cpuNum)) {
+            nodeNum = (node + 1 > nodeNum) ? node + 1 : nodeNum;
+        }
+        fclose(fp);
+    }
+#endif
+    return nodeNum;
+}
+
 inline void swap_variable(void *a, void *b, const int size)
 {
     char buffer[size];
@@ -504,6 +605,80 @@ inline void thread_affinity_set_by_arch(
     }
 }
 
+// bind the OpenMP team of the calling thread to cpus. OpenMP threads are created once and keep
+// the affinity they are bound to, so the team is only bound again when cpus change or the team
+// grows. teams of other sizes reuse the threads of the biggest one.
+inline void thread_affinity_set_team(const int *cpus, int count, int threadNum)
+{
+#ifdef _USE_OPENMP
+    static thread_local int boundCpus[CPU_MAX_NUMBER];
+    static thread_local int boundCount = 0;
+    static thread_local int boundThreadNum = 0;
+    if (count == boundCount && threadNum <= boundThreadNum &&
+        memcmp(cpus, boundCpus, sizeof(int) * count) == 0) {
+        return;
+    }
+#pragma omp parallel num_threads(threadNum)
+    {
+        set_thread_affinity(omp_get_thread_num(), cpus, count);
+    }
+    UNI_MEMCPY(boundCpus, cpus, sizeof(int) * count);
+    boundCount = count;
+    boundThreadNum = threadNum;
+#endif
+}
+
+// bind the calling thread and its OpenMP threads to the cpus of a NUMA node.
+inline int thread_affinity_set_by_numa_node(DeviceInfo *deviceInfo, int node, int threadId)
+{
+    int cpus[CPU_MAX_NUMBER];
+    int count = 0;
+    for (int i = 0; i < deviceInfo->cpuNum; i++) {
+        if (deviceInfo->numaNodes[i] == node) {
+            cpus[count++] = i;
+        }
+    }
+    if (count == 0) {
+        UNI_WARNING_LOG("there is no cpu on NUMA node %d.\n", node);
+        return -1;
+    }
+    if (OMP_NUM_THREADS > count) {
+        UNI_WARNING_LOG(
+            "%d threads run on %d cpus of NUMA node %d.\n", OMP_NUM_THREADS, count, node);
+    }
+    int ret = set_thread_affinity(threadId, cpus, count);
+    thread_affinity_set_team(cpus, count, OMP_NUM_THREADS);
+    if (ret == 0) {
+        deviceInfo->numaNode = node;
+    }
+    return ret;
+}
+
+// move pages of [ptr, ptr + bytes) to a NUMA node, new pages of it are also allocated on the node
+// when possible. pages that are partly in the range are not moved.
+inline void numa_bind_memory(const void *ptr, size_t bytes, int node)
+{
+#if defined(__linux__) && defined(__NR_mbind)
+    if (ptr == nullptr || node < 0 || node >= 64) {
+        return;
+    }
+    uintptr_t page = sysconf(_SC_PAGESIZE);
+    uintptr_t begin = ((uintptr_t)ptr + page - 1) / page * page;
+    uintptr_t end = ((uintptr_t)ptr + bytes) / page * page;
+    if (end <= begin) {
+        return;
+    }
+    unsigned long mask = 1UL << node;
+    const int MPOL_PREFERRED_ = 1;
+    const int MPOL_MF_MOVE_ = 2;
+    // the kernel counts one more bit in maxnode
+    if (syscall(__NR_mbind, begin, end - begin, MPOL_PREFERRED_, &mask, sizeof(mask) * 8 + 1,
+            MPOL_MF_MOVE_) != 0) {
+        UNI_DEBUG_LOG("fail to move memory %p(%zu bytes) to NUMA node %d.\n", ptr, bytes, node);
+    }
+#endif
+}
+
 inline DeviceInfo get_cpu_info(AffinityPolicy affinityPolicy)
 {
     DeviceInfo deviceInfo;
@@ -516,6 +691,8 @@ inline DeviceInfo get_cpu_info(AffinityPolicy affinityPolicy)
         deviceInfo.cpuStats[i].total = 0;
     }
     get_cpus_occupy(deviceInfo.cpuStats, deviceInfo.occupys, deviceInfo.cpuNum);
+    deviceInfo.numaNodeNum = get_cpus_numa_node(deviceInfo.numaNodes, deviceInfo.cpuNum);
+    deviceInfo.numaNode = -1;
     return deviceInfo;
 }
 
@@ -530,6 +707,10 @@ inline void set_cpu_dynamic(DeviceInfo *deviceInfo, int threadId)
     }
     deviceInfo->schedule = thread_affinity_set_by_policy(
         deviceInfo->archs, deviceInfo->cpuids, deviceInfo->cpuNum, policy, threadId);
+    // keep threads on the bound NUMA node
+    if (deviceInfo->numaNode >= 0) {
+        thread_affinity_set_by_numa_node(deviceInfo, deviceInfo->numaNode, threadId);
+    }
     if (deviceInfo->affinityPolicy == AFFINITY_GPU) {
         deviceInfo->schedule = MALI;
     }
@@ -0,0 +1,254 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef _H_THREAD_POOL
+#define _H_THREAD_POOL
+
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <vector>
+#include "thread_affinity.h"
+
+// work of the smallest loop that is worth another thread, it is about the number of float
+// operations that costs as much as waking a thread and waiting for it.
+const double PARALLEL_MIN_WORK = 16384;
+
+inline bool &in_thread_pool()
+{
+    static thread_local bool flag = false;
+    return flag;
+}
+
+// A team of threads owned by a model, the thread that calls run is thread 0 of the team.
+// Loops are handed to the first threadNum - 1 workers only, others keep waiting. A waiting worker
+// spins for a while before it sleeps, so back to back operators do not pay the wake up cost.
+class ThreadPool {
+public:
+    // workers are bound to cpus when they are given.
+    explicit ThreadPool(int threadNum, std::vector<int> cpus = std::vector<int>())
+    {
+        this->threadNum = UNI_MAX(threadNum, 1);
+        this->closed.store(false);
+        this->pending.store(0);
+        this->workers = std::unique_ptr<Worker[]>(new Worker[this->threadNum]);
+        for (int i = 1; i < this->threadNum; i++) {
+            this->workers[i].thread = std::thread(&ThreadPool::work, this, i, cpus);
+        }
+    }
+
+    ~ThreadPool()
+    {
+        this->closed.store(true);
+        for (int i = 1; i < this->threadNum; i++) {
+            this->wake(i);
+        }
+        for (int i = 1; i < this->threadNum; i++) {
+            this->workers[i].thread.join();
+        }
+    }
+
+    int size() const
+    {
+        return this->threadNum;
+    }
+
+    // run func(begin, end) over ranges of [0, n) on threadNum threads. Nested loops and loops of
+    // other threads while the team is busy run on the calling thread.
+    template <typename Func>
+    void run(int threadNum, I32 n, const Func &func)
+    {
+        threadNum = UNI_MIN(UNI_MIN(threadNum, this->threadNum), n);
+        std::unique_lock<std::mutex> busy(this->runMutex, std::defer_lock);
+        if (threadNum <= 1 || in_thread_pool() || !busy.try_lock()) {
+            func(0, n);
+            return;
+        }
+        this->func = &func;
+        this->call = &ThreadPool::invoke<Func>;
+        this->n = n;
+        // several ranges per thread balance cores of different speed.
+        this->chunk = UNI_MAX((n + threadNum * 4 - 1) / (threadNum * 4), 1);
+        this->next.store(0, std::memory_order_relaxed);
+        this->pending.store(threadNum - 1, std::memory_order_relaxed);
+        for (int i = 1; i < threadNum; i++) {
+            this->wake(i);
+        }
+        in_thread_pool() = true;
+        this->process();
+        in_thread_pool() = false;
+        for (U32 spin = 0; this->pending.load(std::memory_order_acquire) > 0; spin++) {
+            if (spin >= SPIN_COUNT) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+private:
+    struct Worker {
+        std::atomic<U32> ticket;
+        std::atomic<bool> sleeping;
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::thread thread;
+        // keep tickets of workers on different cache lines
+        char padding[64];
+
+        Worker()
+        {
+            this->ticket.store(0);
+            this->sleeping.store(false);
+        }
+    };
+
+    template <typename Func>
+    static void invoke(const void *func, I32 begin, I32 end)
+    {
+        (*(const Func *)func)(begin, end);
+    }
+
+    void process()
+    {
+        I32 begin;
+        while ((begin = this->next.fetch_add(this->chunk)) < this->n) {
+            this->call(this->func, begin, UNI_MIN(begin + this->chunk, this->n));
+        }
+    }
+
+    void wake(int id)
+    {
+        Worker &worker = this->workers[id];
+        worker.ticket.fetch_add(1);
+        if (worker.sleeping.load()) {
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            worker.condition.notify_one();
+        }
+    }
+
+    void work(int id, std::vector<int> cpus)
+    {
+        if (cpus.size() > 0) {
+            set_thread_affinity(id, cpus.data(), cpus.size());
+        }
+        in_thread_pool() = true;
+        Worker &worker = this->workers[id];
+        U32 seen = 0;
+        while (true) {
+            for (U32 spin = 0; worker.ticket.load(std::memory_order_acquire) == seen; spin++) {
+                if (spin < SPIN_COUNT) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                std::unique_lock<std::mutex> lock(worker.mutex);
+                worker.sleeping.store(true);
+                while (worker.ticket.load() == seen) {
+                    worker.condition.wait(lock);
+                }
+                worker.sleeping.store(false);
+            }
+            seen = worker.ticket.load(std::memory_order_acquire);
+            if (this->closed.load()) {
+                break;
+            }
+            this->process();
+            this->pending.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    static const U32 SPIN_COUNT = 2048;
+    int threadNum;
+    std::unique_ptr<Worker[]> workers;
+    std::mutex runMutex;
+    std::atomic<bool> closed;
+    std::atomic<int> pending;
+
+    // the loop being run, it is written before workers are woken.
+    const void *func;
+    void (*call)(const void *, I32, I32);
+    I32 n;
+    I32 chunk;
+    std::atomic<I32> next;
+};
+
+// the thread pool that parallel_for of the calling thread runs on, nullptr means OpenMP.
+inline ThreadPool *&current_thread_pool()
+{
+    static thread_local ThreadPool *pool = nullptr;
+    return pool;
+}
+
+// make parallel_for of the calling thread run on pool until the scope ends.
+class ThreadPoolScope {
+public:
+    explicit ThreadPoolScope(ThreadPool *pool)
+    {
+        this->last = current_thread_pool();
+        current_thread_pool() = pool;
+    }
+
+    ~ThreadPoolScope()
+    {
+        current_thread_pool() = this->last;
+    }
+
+private:
+    ThreadPool *last;
+};
+
+// threads of a loop of n items that each costs cost, one thread per PARALLEL_MIN_WORK.
+inline int parallel_threads(I32 n, double cost)
+{
+    double threadNum = n * cost / PARALLEL_MIN_WORK;
+    if (threadNum > OMP_NUM_THREADS) {
+        threadNum = OMP_NUM_THREADS;
+    }
+    return UNI_MAX(UNI_MIN((int)threadNum, n), 1);
+}
+
+// run func(begin, end) over ranges of [0, n), cost is the work of one item. Small loops run on
+// fewer threads than OMP_NUM_THREADS or on the calling thread only.
+template <typename Func>
+inline void parallel_for(I32 n, double cost, const Func &func)
+{
+    int threadNum = parallel_threads(n, cost);
+    if (threadNum <= 1) {
+        func(0, n);
+        return;
+    }
+    ThreadPool *pool = current_thread_pool();
+    if (pool != nullptr) {
+        pool->run(threadNum, n, func);
+        return;
+    }
+#ifdef _USE_OPENMP
+    if (omp_in_parallel()) {
+        func(0, n);
+        return;
+    }
+#pragma omp parallel num_threads(threadNum)
+    {
+        I32 num = omp_get_num_threads();
+        I32 id = omp_get_thread_num();
+        I32 begin = (I64)n * id / num;
+        I32 end = (I64)n * (id + 1) / num;
+        if (begin < end) {
+            func(begin, end);
+        }
+    }
+#else
+    func(0, n);
+#endif
+}
+#endif
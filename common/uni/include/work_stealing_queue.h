@@ -0,0 +1,149 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef _H_WORK_STEALING_QUEUE
+#define _H_WORK_STEALING_QUEUE
+
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include "data_type.h"
+
+// Per-worker task deque. The owner thread pushes and pops at the back (LIFO, cache friendly),
+// other workers steal from the front (FIFO, oldest and usually largest pending work).
+template <typename T>
+class WorkStealingQueue {
+public:
+    WorkStealingQueue()
+    {}
+
+    void push(T item)
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->items.push_back(item);
+    }
+
+    bool pop(T *item)
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (this->items.empty()) {
+            return false;
+        }
+        *item = this->items.back();
+        this->items.pop_back();
+        return true;
+    }
+
+    bool steal(T *item)
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (this->items.empty()) {
+            return false;
+        }
+        *item = this->items.front();
+        this->items.pop_front();
+        return true;
+    }
+
+    bool empty()
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->items.empty();
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->items.clear();
+    }
+
+private:
+    std::mutex mutex;
+    std::deque<T> items;
+};
+
+// Bounded lock free version of WorkStealingQueue(Chase-Lev deque). Only the owner thread can
+// push and pop, any thread can steal. push fails when there are already N items.
+template <typename T, U32 N>
+class LockFreeWorkStealingQueue {
+public:
+    LockFreeWorkStealingQueue()
+    {
+        this->top.store(0, std::memory_order_relaxed);
+        this->bottom.store(0, std::memory_order_relaxed);
+    }
+
+    bool push(T item)
+    {
+        I64 b = this->bottom.load(std::memory_order_relaxed);
+        I64 t = this->top.load(std::memory_order_acquire);
+        if (b - t >= (I64)N) {
+            return false;
+        }
+        this->items[b % N].store(item, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        this->bottom.store(b + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool pop(T *item)
+    {
+        I64 b = this->bottom.load(std::memory_order_relaxed) - 1;
+        this->bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        I64 t = this->top.load(std::memory_order_relaxed);
+        bool ret = false;
+        if (t <= b) {
+            *item = this->items[b % N].load(std::memory_order_relaxed);
+            ret = true;
+            if (t == b) {
+                // the last item, race with thieves.
+                ret = this->top.compare_exchange_strong(
+                    t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+                this->bottom.store(b + 1, std::memory_order_relaxed);
+            }
+        } else {
+            this->bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return ret;
+    }
+
+    bool steal(T *item)
+    {
+        I64 t = this->top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        I64 b = this->bottom.load(std::memory_order_acquire);
+        if (t >= b) {
+            return false;
+        }
+        T value = this->items[t % N].load(std::memory_order_relaxed);
+        if (!this->top.compare_exchange_strong(
+                t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return false;
+        }
+        *item = value;
+        return true;
+    }
+
+    bool empty()
+    {
+        return this->bottom.load() <= this->top.load();
+    }
+
+private:
+    std::atomic<I64> top;
+    char pad[64];
+    std::atomic<I64> bottom;
+    std::atomic<T> items[N];
+};
+#endif
@@ -0,0 +1,348 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <chrono>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <algorithm>
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define _USE_PERF_EVENT
+#endif
+
+#include "op_profiler.h"
+#include "secure_c_wrapper.h"
+#include "uni.h"
+
+#define PROFILE_COUNTER_NUM 3
+
+typedef struct {
+    char name[64];
+    char category[32];
+    double start;
+    double duration;
+    U64 counters[PROFILE_COUNTER_NUM];
+    U64 bytes;
+} OpProfilerRecord;
+
+static bool op_profiler_env_on()
+{
+    const char *env = getenv("BOLT_PROFILE");
+    return env != NULL && std::string(env) == std::string("ON");
+}
+
+static U32 op_profiler_env_capacity()
+{
+    const char *env = getenv("BOLT_PROFILE_CAPACITY");
+    int capacity = (env != NULL) ? atoi(env) : 0;
+    return (capacity > 0) ? capacity : 16384;
+}
+
+std::atomic<bool> uniOpProfilerEnabled(op_profiler_env_on());
+
+// events and counters of one thread, only the owner thread writes it.
+class OpProfilerBuffer {
+public:
+    OpProfilerBuffer(U32 capacity) : records(capacity)
+    {
+        UNI_THREADID;
+        this->tid = tid;
+        this->count = 0;
+        this->fdNum = 0;
+#ifdef _USE_PERF_EVENT
+        // cycles leads the group, so that all counters are read by one syscall. Counters are
+        // not inherited, worker threads that already exist could not be covered anyway.
+        U64 configs[PROFILE_COUNTER_NUM] = {
+            PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES};
+        for (U32 i = 0; i < PROFILE_COUNTER_NUM; i++) {
+            int fd = open_counter(configs[i], (this->fdNum > 0) ? this->fds[0] : -1);
+            if (fd < 0) {
+                if (i == 0) {
+                    break;
+                }
+                continue;
+            }
+            this->fds[this->fdNum] = fd;
+            this->ids[this->fdNum] = i;
+            this->fdNum++;
+        }
+#endif
+    }
+
+    ~OpProfilerBuffer()
+    {
+#ifdef _USE_PERF_EVENT
+        for (U32 i = 0; i < this->fdNum; i++) {
+            close(this->fds[i]);
+        }
+#endif
+    }
+
+    void read_counters(U64 *counters)
+    {
+        UNI_MEMSET(counters, 0, sizeof(U64) * PROFILE_COUNTER_NUM);
+#ifdef _USE_PERF_EVENT
+        if (this->fdNum == 0) {
+            return;
+        }
+        U64 data[PROFILE_COUNTER_NUM + 1];
+        if (read(this->fds[0], data, sizeof(data)) < (ssize_t)sizeof(U64)) {
+            return;
+        }
+        for (U32 i = 0; i < data[0] && i < this->fdNum; i++) {
+            counters[this->ids[i]] = data[i + 1];
+        }
+#endif
+    }
+
+    std::vector<OpProfilerRecord> records;
+    U64 count;
+    int tid;
+
+private:
+#ifdef _USE_PERF_EVENT
+    static int open_counter(U64 config, int group)
+    {
+        struct perf_event_attr attr;
+        UNI_MEMSET(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = config;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        return syscall(__NR_perf_event_open, &attr, 0, -1, group, 0);
+    }
+#endif
+
+    int fds[PROFILE_COUNTER_NUM];
+    U32 ids[PROFILE_COUNTER_NUM];
+    U32 fdNum;
+};
+
+static std::mutex profilerMutex;
+// buffers of running threads.
+static std::vector<OpProfilerBuffer *> profilerBuffers;
+// events of exited threads, the oldest are dropped beyond the capacity of one thread.
+static std::deque<std::pair<int, OpProfilerRecord>> profilerRetiredRecords;
+
+// visit recorded events of a buffer from oldest to newest.
+template <typename Function>
+static void op_profiler_visit_buffer(const OpProfilerBuffer *buffer, Function func)
+{
+    U64 size = buffer->records.size();
+    U64 begin = (buffer->count > size) ? buffer->count - size : 0;
+    for (U64 i = begin; i < buffer->count; i++) {
+        func(buffer->tid, buffer->records[i % size]);
+    }
+}
+
+// owns the buffer of one thread. When the thread exits, its events are moved to the retired
+// events that are still reported, and its counters are closed.
+class OpProfilerOwner {
+public:
+    ~OpProfilerOwner()
+    {
+        if (this->buffer == nullptr) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(profilerMutex);
+        profilerBuffers.erase(
+            std::find(profilerBuffers.begin(), profilerBuffers.end(), this->buffer.get()));
+        op_profiler_visit_buffer(this->buffer.get(), [](int tid, const OpProfilerRecord &r) {
+            profilerRetiredRecords.push_back(std::make_pair(tid, r));
+        });
+        while (profilerRetiredRecords.size() > this->buffer->records.size()) {
+            profilerRetiredRecords.pop_front();
+        }
+    }
+
+    std::unique_ptr<OpProfilerBuffer> buffer;
+};
+
+static thread_local OpProfilerOwner profilerOwner;
+// cached pointer of profilerOwner.buffer, so that recording does not check thread_local init.
+static thread_local OpProfilerBuffer *profilerBuffer = nullptr;
+
+static double op_profiler_time_us()
+{
+    return std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+static void op_profiler_copy_name(char *dst, const char *src, U32 size)
+{
+    U32 len = (src == NULL) ? 0 : UNI_MIN((U32)strlen(src), size - 1);
+    UNI_MEMCPY(dst, src, len);
+    dst[len] = '\0';
+}
+
+void op_profiler_enable(bool enable)
+{
+    uniOpProfilerEnabled.store(enable, std::memory_order_relaxed);
+}
+
+void op_profiler_reset()
+{
+    std::lock_guard<std::mutex> lock(profilerMutex);
+    for (auto &buffer : profilerBuffers) {
+        buffer->count = 0;
+    }
+    profilerRetiredRecords.clear();
+}
+
+void op_profiler_begin_event(OpProfilerEvent *event)
+{
+    if (profilerBuffer == nullptr) {
+        profilerOwner.buffer = std::unique_ptr<OpProfilerBuffer>(
+            new OpProfilerBuffer(op_profiler_env_capacity()));
+        profilerBuffer = profilerOwner.buffer.get();
+        std::lock_guard<std::mutex> lock(profilerMutex);
+        profilerBuffers.push_back(profilerBuffer);
+    }
+    profilerBuffer->read_counters(event->counters);
+    event->start = op_profiler_time_us();
+}
+
+void op_profiler_end(const OpProfilerEvent *event, const char *name, const char *category, U64 bytes)
+{
+    double end = op_profiler_time_us();
+    U64 counters[PROFILE_COUNTER_NUM];
+    profilerBuffer->read_counters(counters);
+    auto &records = profilerBuffer->records;
+    OpProfilerRecord &record = records[profilerBuffer->count % records.size()];
+    op_profiler_copy_name(record.name, name, sizeof(record.name));
+    op_profiler_copy_name(record.category, category, sizeof(record.category));
+    record.start = event->start;
+    record.duration = end - event->start;
+    for (U32 i = 0; i < PROFILE_COUNTER_NUM; i++) {
+        record.counters[i] = counters[i] - event->counters[i];
+    }
+    record.bytes = bytes;
+    profilerBuffer->count++;
+}
+
+// visit recorded events of exited threads, and then those of running threads.
+template <typename Function>
+static void op_profiler_visit(Function func)
+{
+    std::lock_guard<std::mutex> lock(profilerMutex);
+    for (auto &p : profilerRetiredRecords) {
+        func(p.first, p.second);
+    }
+    for (auto &buffer : profilerBuffers) {
+        op_profiler_visit_buffer(buffer, func);
+    }
+}
+
+static std::string op_profiler_escape(const char *str)
+{
+    std::string ret;
+    for (; *str != '\0'; str++) {
+        if (*str == '"' || *str == '\\') {
+            ret += '\\';
+        }
+        ret += *str;
+    }
+    return ret;
+}
+
+EE op_profiler_dump_trace(const char *path)
+{
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        UNI_ERROR_LOG("can not write profile trace to %s.\n", path);
+        return FILE_ERROR;
+    }
+    fprintf(file, "{\"traceEvents\": [\n");
+    bool first = true;
+    op_profiler_visit([&](int tid, const OpProfilerRecord &r) {
+        fprintf(file,
+            "%s{\"name\": \"%s\", \"cat\": \"%s\", \"ph\": \"X\", \"pid\": 0, \"tid\": %d, "
+            "\"ts\": %.3f, \"dur\": %.3f, \"args\": {\"thread_cycles\": %llu, "
+            "\"thread_instructions\": %llu, \"thread_llc_misses\": %llu, \"bytes\": %llu}}",
+            first ? "" : ",\n", op_profiler_escape(r.name).c_str(),
+            op_profiler_escape(r.category).c_str(), tid, r.start, r.duration,
+            (unsigned long long)r.counters[0], (unsigned long long)r.counters[1],
+            (unsigned long long)r.counters[2], (unsigned long long)r.bytes);
+        first = false;
+    });
+    fprintf(file, "\n], \"displayTimeUnit\": \"ms\"}\n");
+    fclose(file);
+    return SUCCESS;
+}
+
+std::string op_profiler_summary()
+{
+    typedef struct {
+        U64 num;
+        double time;
+        U64 counters[PROFILE_COUNTER_NUM];
+        U64 bytes;
+    } Statistics;
+    std::map<std::string, Statistics> statistics;
+    double total = 0;
+    op_profiler_visit([&](int tid, const OpProfilerRecord &r) {
+        Statistics &s = statistics[r.category];
+        s.num++;
+        s.time += r.duration;
+        for (U32 i = 0; i < PROFILE_COUNTER_NUM; i++) {
+            s.counters[i] += r.counters[i];
+        }
+        s.bytes += r.bytes;
+        total += r.duration;
+    });
+    std::vector<std::pair<std::string, Statistics>> vec(statistics.begin(), statistics.end());
+    std::sort(vec.begin(), vec.end(),
+        [](const std::pair<std::string, Statistics> &a,
+            const std::pair<std::string, Statistics> &b) { return a.second.time > b.second.time; });
+    char line[256];
+    UNI_SNPRINTF(line, sizeof(line), "%32s %8s %12s %8s %12s %6s %12s %10s\n", "category", "count",
+        "time(ms)", "ratio", "avg(us)", "IPC", "LLC miss", "GB/s");
+    std::string ret = line;
+    for (auto &p : vec) {
+        const Statistics &s = p.second;
+        double ipc = (s.counters[0] > 0) ? (double)s.counters[1] / s.counters[0] : 0;
+        double bandwidth = (s.time > 0) ? s.bytes / s.time / 1000 : 0;
+        UNI_SNPRINTF(line, sizeof(line), "%32s %8llu %12.4f %7.2f%% %12.3f %6.2f %12llu %10.2f\n",
+            p.first.c_str(), (unsigned long long)s.num, s.time / 1000, s.time / total * 100,
+            s.time / s.num, ipc, (unsigned long long)s.counters[2], bandwidth);
+        ret += line;
+    }
+    ret += "IPC and LLC miss are counted on the calling thread of operators, not on workers.\n";
+    return ret;
+}
+
+// report at exit when profiler is enabled by environment variable.
+class OpProfilerReporter {
+public:
+    ~OpProfilerReporter()
+    {
+        if (!op_profiler_env_on()) {
+            return;
+        }
+        printf("\nOperator Profile:\n%s\n", op_profiler_summary().c_str());
+        const char *path = getenv("BOLT_PROFILE_TRACE");
+        if (path != NULL) {
+            op_profiler_dump_trace(path);
+        }
+    }
+};
+
+static OpProfilerReporter profilerReporter;
@@ -20,7 +20,9 @@
 #include "error.h"
 #include "thread_affinity.h"
 
-int OMP_NUM_THREADS = OMP_MAX_NUM_THREADS;
+int OMP_DEFAULT_NUM_THREADS = OMP_MAX_NUM_THREADS;
+// dynamic initialization, every thread copies the process-wide value on its first use.
+thread_local int OMP_NUM_THREADS = OMP_DEFAULT_NUM_THREADS;
 
 #ifdef _THREAD_SAFE
 pthread_mutex_t uniThreadMutex = PTHREAD_MUTEX_INITIALIZER;
@@ -68,6 +68,16 @@ EE matrix_vector_multiply(TensorDesc matrixDesc,
 // If you want to reorder weight matrix for mmm, you can use these functions.
 DataFormat matrix_matrix_multiply_rhs_format(DataType dt);
 
+// format of matrix transformed on arch, x86 fp32 matrix is packed differently for AVX-512.
+DataFormat matrix_matrix_multiply_transform_rhs_format(DataType dt, Arch arch);
+
+// whether fp32 mmm and mvm with weight of type dt(DT_F32, DT_BF16 or DT_I4) run AVX-512 kernels
+// on arch, X86_AVX2 always runs the AVX2 ones.
+bool matrix_multiply_use_avx512(DataType dt, Arch arch);
+
+// whether matrix of format df has been transformed by matrix_matrix_multiply_transform_rhs.
+bool matrix_matrix_multiply_rhs_transformed(DataType dt, DataFormat df);
+
 // bytes contains all needed, and rhsBytes only contains packed matrix bytes.
 EE matrix_matrix_multiply_transform_rhs_bytes(TensorDesc desc, U32 *bytes, U32 *rhsBytes, Arch arch);
 
@@ -75,6 +85,26 @@ EE matrix_matrix_multiply_transform_rhs_bytes(TensorDesc desc, U32 *bytes, U32 *
 EE matrix_matrix_multiply_transform_rhs(
     TensorDesc desc, const void *src, TensorDesc *descTran, void *dst, Arch arch);
 
+// pack DF_TRANSPOSE int4 matrix(low 4 bits first, code is q + 7, value is q / scale) for fp32 mmm
+// and mvm, scale[i] is shared by group weights. NOT_SUPPORTED means the groups can not be packed,
+// matrix should be dequantized then. bytes are given by matrix_matrix_multiply_transform_rhs_bytes.
+EE matrix_matrix_multiply_transform_rhs_int4(TensorDesc desc,
+    const void *src,
+    const F32 *scale,
+    U32 group,
+    TensorDesc *descTran,
+    void *dst,
+    Arch arch);
+
+// pack DF_TRANSPOSE fp32 matrix by its zeros, blocks of 16 output channels(DF_NKN16_BSR) or 2 of
+// every 4 input channels(DF_NKN8_2_4). NOT_SUPPORTED means matrix is too dense and should be
+// packed by matrix_matrix_multiply_transform_rhs. descTran is only used by mmm, dims[2] is bytes.
+EE matrix_matrix_multiply_transform_rhs_sparse_bytes(
+    TensorDesc desc, const void *src, DataFormat *df, U32 *bytes, Arch arch);
+
+EE matrix_matrix_multiply_transform_rhs_sparse(
+    TensorDesc desc, const void *src, DataFormat df, TensorDesc *descTran, void *dst, Arch arch);
+
 // If you want to reorder weight matrix for mvm, you can use these functions.
 DataFormat matrix_vector_multiply_weight_format(DataType dt);
 
@@ -14,6 +14,7 @@
 #ifndef _H_BLAS_X86
 #define _H_BLAS_X86
 
+#include "sys.h"
 #include "tensor_desc.h"
 
 EE axpby_x86(I32 len, DataType dt, F32 a, const void *x, F32 b, void *y);
@@ -28,7 +29,8 @@ EE mvm_x86(U32 row,
     const void *vector,
     void *result,
     void *offsetCBias,
-    const F32 *scale);
+    const F32 *scale,
+    Arch arch);
 
 EE matrix_matrix_multiply_tmp_bytes_x86(U32 matrixC_N,
     U32 matrixC_M,
@@ -37,7 +39,8 @@ EE matrix_matrix_multiply_tmp_bytes_x86(U32 matrixC_N,
     DataFormat adf,
     DataType bdt,
     DataFormat bdf,
-    U32 *bytes);
+    U32 *bytes,
+    Arch arch);
 
 EE mmm_x86(U32 matrixC_N,
     U32 matrixC_M,
@@ -45,10 +48,12 @@ EE mmm_x86(U32 matrixC_N,
     DataType matrixADataType,
     DataFormat matrixADataFormat,
     const void *matrixAData,
+    DataFormat matrixBDataFormat,
     const void *matrixBData,
     void *tmp,
     void *matrixCData,
-    const F32 *scale);
+    const F32 *scale,
+    Arch arch);
 
 EE matrix_vector_multiply_transform_weight_bytes_x86(
     U32 row, U32 col, DataType dt, DataFormat df, U32 *bytes);
@@ -56,9 +61,27 @@ EE matrix_vector_multiply_transform_weight_bytes_x86(
 EE matrix_vector_multiply_transform_weight_x86(
     TensorDesc desc, const void *src, TensorDesc *descTran, void *dst, void *offsetCBias);
 
-EE matrix_matrix_multiply_transform_rhs_bytes_x86(
-    U32 matrixC_N, U32 matrixA_K, DataType bdt, DataFormat bdf, U32 *bytes, U32 *rhsBytes);
+EE matrix_matrix_multiply_transform_rhs_bytes_x86(U32 matrixC_N,
+    U32 matrixA_K,
+    DataType bdt,
+    DataFormat bdf,
+    U32 *bytes,
+    U32 *rhsBytes,
+    Arch arch);
 
 EE matrix_matrix_multiply_transform_rhs_x86(
-    TensorDesc desc, const void *src, TensorDesc *descTran, void *dst);
+    TensorDesc desc, const void *src, TensorDesc *descTran, void *dst, Arch arch);
+
+EE matrix_matrix_multiply_transform_rhs_int4_x86(TensorDesc desc,
+    const void *src,
+    const F32 *scale,
+    U32 group,
+    TensorDesc *descTran,
+    void *dst);
+
+EE matrix_matrix_multiply_transform_rhs_sparse_bytes_x86(
+    TensorDesc desc, const void *src, DataFormat *df, U32 *bytes);
+
+EE matrix_matrix_multiply_transform_rhs_sparse_x86(
+    TensorDesc desc, const void *src, DataFormat df, TensorDesc *descTran, void *dst);
 #endif
@@ -0,0 +1,219 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "cpu/x86/fp32/blas_fp32.h"
+#include "blas_enhance.h"
+#include "thread_pool.h"
+
+#define UNROLL_N 32
+#define UNROLL_M 12
+#define BOLCK_M_DIM 384
+#define BOLCK_K_DIM 512
+#define align_addr(addr, unit) (((uintptr_t)addr + unit - 1) / unit * unit)
+
+// B is packed into K blocks, every K block is split into panels of 32 columns, the last
+// panel is 16 wide when no more than 16 columns are left. Panel is stored as [blockK][32].
+static inline U32 edge_block_n_size(U32 N)
+{
+    U32 resN = N % UNROLL_N;
+    return (resN == 0) ? 0 : ((resN > 16) ? 32 : 16);
+}
+
+static inline U32 aligned_n(U32 N)
+{
+    return N / UNROLL_N * UNROLL_N + edge_block_n_size(N);
+}
+
+void matrix_matrix_multiply_transform_rhs_bytes_avx512_fp32(
+    U32 N, U32 K, DataFormat bdf, U32 *bytes, U32 *rhsBytes)
+{
+    U32 matrix = 0;
+    U32 pad = 0;
+    if (!matrix_matrix_multiply_rhs_transformed(DT_F32, bdf)) {
+        matrix = aligned_n(N) * K * bytesOf(DT_F32);
+        pad = matrix + 64;
+    }
+    if (rhsBytes != nullptr) {
+        *rhsBytes = matrix;
+    }
+    if (bytes != nullptr) {
+        *bytes = pad;
+    }
+}
+
+void matrix_matrix_multiply_tmp_bytes_avx512_fp32(
+    U32 N, U32 M, U32 K, DataFormat adf, DataFormat bdf, U32 *bytes)
+{
+    matrix_matrix_multiply_transform_rhs_bytes_avx512_fp32(N, K, bdf, bytes, nullptr);
+    *bytes += M * UNI_MIN(K, BOLCK_K_DIM) * bytesOf(DT_F32);
+    *bytes += 64;
+}
+
+// src(k, n) is at src[k * ldk + n * ldn]
+static EE matrix_matrix_multiply_transform_rhs_avx512(
+    U32 N, U32 K, U32 ldk, U32 ldn, F32 *src, F32 *dst)
+{
+    U32 edgeBlockNSize = edge_block_n_size(N);
+    U32 blockNNum = (N + UNROLL_N - 1) / UNROLL_N;
+    U32 blockKNum = (K + BOLCK_K_DIM - 1) / BOLCK_K_DIM;
+    U32 alignedN = aligned_n(N);
+    U32 loopNum = blockKNum * blockNNum;
+
+    // buffer addr aligned to 64
+    F32 *packB = (F32 *)align_addr(dst, 64);
+#ifdef _USE_OPENMP
+#pragma omp parallel for num_threads(OMP_NUM_THREADS)
+#endif
+    for (U32 l = 0; l < loopNum; ++l) {
+        U32 bk = l / blockNNum * BOLCK_K_DIM;
+        U32 blockSizeK = UNI_MIN(BOLCK_K_DIM, K - bk);
+        U32 un = (l % blockNNum) * UNROLL_N;
+        U32 unrollSizeN = UNI_MAX(UNI_MIN(UNROLL_N, N - un), edgeBlockNSize);
+        U32 realSizeN = UNI_MIN(N - un, unrollSizeN);
+        F32 *curB = packB + bk * alignedN + un * blockSizeK;
+        for (U32 k = 0; k < blockSizeK; ++k) {
+            F32 *curSrc = src + (bk + k) * ldk + un * ldn;
+            if (ldn == 1) {
+                UNI_MEMCPY(curB, curSrc, realSizeN * sizeof(F32));
+            } else {
+                for (U32 n = 0; n < realSizeN; ++n) {
+                    curB[n] = curSrc[n * ldn];
+                }
+            }
+            UNI_MEMSET(curB + realSizeN, 0, (unrollSizeN - realSizeN) * sizeof(F32));
+            curB += unrollSizeN;
+        }
+    }
+    return SUCCESS;
+}
+
+EE matrix_matrix_multiply_transform_rhsN_avx512_fp32(TensorDesc desc, F32 *src, F32 *dst)
+{
+    DataType dt;
+    DataFormat df;
+    U32 N, K;
+    CHECK_STATUS(tensor2dGet(desc, &dt, &df, &K, &N));
+    return matrix_matrix_multiply_transform_rhs_avx512(N, K, N, 1, src, dst);
+}
+
+EE matrix_matrix_multiply_transform_rhsT_avx512_fp32(TensorDesc desc, F32 *src, F32 *dst)
+{
+    DataType dt;
+    DataFormat df;
+    U32 N, K;
+    CHECK_STATUS(tensor2dGet(desc, &dt, &df, &N, &K));
+    return matrix_matrix_multiply_transform_rhs_avx512(N, K, 1, K, src, dst);
+}
+
+typedef void (*kernel_func)(
+    U32 bk, const F32 *matrixA, U32 lda, const F32 *matrixB, F32 *matrixC, U32 ldc, __mmask16 mask);
+
+// C[M][NV * 16] += A[M][bk] * B[bk][NV * 16], mask is for the columns of the last vector.
+template <U32 M, U32 NV>
+X86_AVX512_TARGET static void mmm_avx512_kernel(
+    U32 bk, const F32 *matrixA, U32 lda, const F32 *matrixB, F32 *matrixC, U32 ldc, __mmask16 mask)
+{
+    __m512 c[M][NV];
+    for (U32 i = 0; i < M; ++i) {
+        for (U32 j = 0; j < NV; ++j) {
+            c[i][j] = _mm512_setzero_ps();
+        }
+    }
+    const I64 stride = lda;
+    for (U32 k = 0; k < bk; ++k) {
+        __m512 b[NV];
+        for (U32 j = 0; j < NV; ++j) {
+            b[j] = _mm512_loadu_ps(matrixB + j * 16);
+        }
+        for (U32 i = 0; i < M; ++i) {
+            __m512 a = _mm512_set1_ps(matrixA[i * stride]);
+            for (U32 j = 0; j < NV; ++j) {
+                c[i][j] = _mm512_fmadd_ps(a, b[j], c[i][j]);
+            }
+        }
+        matrixA++;
+        matrixB += NV * 16;
+    }
+    for (U32 i = 0; i < M; ++i) {
+        F32 *curC = matrixC + i * ldc;
+        for (U32 j = 0; j < NV - 1; ++j) {
+            _mm512_storeu_ps(curC + j * 16, _mm512_add_ps(_mm512_loadu_ps(curC + j * 16), c[i][j]));
+        }
+        curC += (NV - 1) * 16;
+        _mm512_mask_storeu_ps(
+            curC, mask, _mm512_add_ps(_mm512_maskz_loadu_ps(mask, curC), c[i][NV - 1]));
+    }
+}
+
+#define kernel_row(m) {mmm_avx512_kernel<m, 1>, mmm_avx512_kernel<m, 2>}
+
+EE mmm_avx512_fp32(
+    int N, int M, int K, DataFormat matrix1Df, F32 *matrix1, F32 *matrix2, F32 *tmp, F32 *result)
+{
+    // buffer addr aligned to 64
+    F32 *packA = (F32 *)align_addr(tmp, 64);
+    F32 *packB = (F32 *)align_addr(matrix2, 64);
+    kernel_func kernel[UNROLL_M][2] = {kernel_row(1), kernel_row(2), kernel_row(3),
+        kernel_row(4), kernel_row(5), kernel_row(6), kernel_row(7), kernel_row(8), kernel_row(9),
+        kernel_row(10), kernel_row(11), kernel_row(12)};
+    I32 resN = N % UNROLL_N;
+    I32 edgeBlockNSize = edge_block_n_size(N);
+    I32 blockNNum = N / UNROLL_N + (resN > 0);
+    I32 alignedN = aligned_n(N);
+    __mmask16 edgeMask = (resN % 16 == 0) ? 0xFFFF : ((1 << (resN % 16)) - 1);
+    I32 blockNum = (M + UNROLL_M - 1) / UNROLL_M * blockNNum;
+    I32 mainBlockNum = BOLCK_M_DIM / UNROLL_M * blockNNum;
+
+    I32 blockSizeK = 0;
+    for (int k = 0; k < K; k += blockSizeK) {
+        blockSizeK = UNI_MIN(BOLCK_K_DIM, K - k);
+        if (matrix1Df == DF_TRANSPOSE) {
+            parallel_for((M + 15) / 16, 16.0 * blockSizeK, [&](I32 begin, I32 end) {
+                for (int m = begin * 16; m < UNI_MIN(end * 16, M); m += 16) {
+                    matrix1_trans(blockSizeK, UNI_MIN(16, M - m), M, matrix1 + k * M + m,
+                        packA + m * blockSizeK);
+                }
+            });
+        }
+
+        // a block is UNROLL_M x UNROLL_N outputs of blockSizeK multiply-adds.
+        parallel_for(blockNum, (double)UNROLL_M * UNROLL_N * blockSizeK, [&](I32 begin, I32 end) {
+            for (int mnIdx = begin; mnIdx < end; ++mnIdx) {
+                I32 j = mnIdx / mainBlockNum * BOLCK_M_DIM;
+                I32 blockSizeM = UNI_MIN(BOLCK_M_DIM, M - j);
+                I32 blockMNum = (blockSizeM + UNROLL_M - 1) / UNROLL_M;
+
+                I32 n = (mnIdx % mainBlockNum) / blockMNum * UNROLL_N;
+                I32 blockSizeN = UNI_MAX(UNI_MIN(UNROLL_N, N - n), edgeBlockNSize);
+                F32 *curB = packB + k * alignedN + n * blockSizeK;
+                __mmask16 mask = ((blockSizeN + n) > N) ? edgeMask : 0xFFFF;
+
+                I32 m = ((mnIdx % mainBlockNum) % blockMNum) * UNROLL_M;
+                I32 unrollSizeM = UNI_MIN(UNROLL_M, blockSizeM - m);
+
+                F32 *curA;
+                U32 lda;
+                if (matrix1Df == DF_TRANSPOSE) {
+                    curA = packA + (j + m) * blockSizeK;
+                    lda = blockSizeK;
+                } else {
+                    curA = matrix1 + k + (j + m) * K;
+                    lda = K;
+                }
+                kernel[unrollSizeM - 1][blockSizeN / 16 - 1](blockSizeK, curA, lda, curB,
+                    result + (m + j) * N + n, N, mask);
+            }
+        });
+    }
+    return SUCCESS;
+}
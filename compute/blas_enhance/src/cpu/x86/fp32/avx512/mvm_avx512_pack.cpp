@@ -0,0 +1,123 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "cpu/x86/fp32/blas_fp32.h"
+#include "thread_pool.h"
+
+#define UNROLL_N 64
+#define BOLCK_K_DIM 1024
+// the number of columns to prefetch ahead, packed weight is too large for cache in most cases.
+#define PREFETCH_K 16
+
+typedef void (*kernel_func)(U32 bk, F32 *matrix, F32 *vector, F32 *result, __mmask16 mask);
+
+#define load_vec(i)                                                                                \
+    ((i < NV - 1) ? _mm512_loadu_ps(matrix + i * 16) : _mm512_maskz_loadu_ps(mask, matrix + i * 16))
+
+#define fma_vec(c, i, v)                                                                           \
+    if (i < NV) {                                                                                  \
+        c##i = _mm512_fmadd_ps(load_vec(i), v, c##i);                                              \
+    }
+
+#define store_vec(i)                                                                               \
+    if (i < NV - 1) {                                                                              \
+        __m512 sum = _mm512_add_ps(c0##i, c1##i);                                                  \
+        _mm512_storeu_ps(result + i * 16, _mm512_add_ps(_mm512_loadu_ps(result + i * 16), sum));   \
+    } else if (i == NV - 1) {                                                                      \
+        __m512 sum = _mm512_add_ps(c0##i, c1##i);                                                  \
+        sum = _mm512_add_ps(_mm512_maskz_loadu_ps(mask, result + i * 16), sum);                    \
+        _mm512_mask_storeu_ps(result + i * 16, mask, sum);                                         \
+    }
+
+// result[NV * 16] += matrix[bk][NV * 16] * vector[bk], mask is for the rows of the last vector.
+// even and odd columns are accumulated separately to hide the fma latency.
+template <U32 NV>
+X86_AVX512_TARGET static void mvm_row_avx512(U32 bk, F32 *matrix, F32 *vector, F32 *result, __mmask16 mask)
+{
+    const U32 step = (NV - 1) * 16 + _mm_popcnt_u32(mask);
+    __m512 c00 = _mm512_setzero_ps(), c01 = c00, c02 = c00, c03 = c00;
+    __m512 c10 = c00, c11 = c00, c12 = c00, c13 = c00;
+    U32 k = 0;
+    for (; k + 1 < bk; k += 2) {
+        for (U32 i = 0; i < NV * 2; ++i) {
+            _mm_prefetch((const char *)(matrix + PREFETCH_K * step + i * 16), _MM_HINT_T0);
+        }
+        __m512 v0 = _mm512_set1_ps(vector[k]);
+        fma_vec(c0, 0, v0);
+        fma_vec(c0, 1, v0);
+        fma_vec(c0, 2, v0);
+        fma_vec(c0, 3, v0);
+        matrix += step;
+        __m512 v1 = _mm512_set1_ps(vector[k + 1]);
+        fma_vec(c1, 0, v1);
+        fma_vec(c1, 1, v1);
+        fma_vec(c1, 2, v1);
+        fma_vec(c1, 3, v1);
+        matrix += step;
+    }
+    if (k < bk) {
+        __m512 v0 = _mm512_set1_ps(vector[k]);
+        fma_vec(c0, 0, v0);
+        fma_vec(c0, 1, v0);
+        fma_vec(c0, 2, v0);
+        fma_vec(c0, 3, v0);
+    }
+    store_vec(0);
+    store_vec(1);
+    store_vec(2);
+    store_vec(3);
+}
+
+void mvm_pack_avx512_fp32(U32 numRows, U32 numColumns, F32 *packB, F32 *vector, F32 *result)
+{
+    // Same layout as mvm_pack_fp32, K is blocked by 1024 and rows are packed by 64/32/16/8/tail.
+    kernel_func kernel[4] = {
+        mvm_row_avx512<1>, mvm_row_avx512<1>, mvm_row_avx512<2>, mvm_row_avx512<4>};
+    U32 unrollSize[4] = {8, 16, 32, 64};
+    I32 resN = numRows % 64;
+    I32 blockNum = numRows / 64;
+    I32 edgeblockNSizeArray[6] = {0};
+    for (U32 i = 0; resN > 0; ++i) {
+        U32 value = UNI_MIN(unrollSize[UNI_MIN(resN >> 4, 2)], (U32)resN);
+        edgeblockNSizeArray[i] += value;
+        edgeblockNSizeArray[i + 1] = edgeblockNSizeArray[i];
+        resN -= value;
+        blockNum += 1;
+    }
+    // rows of a block are accumulated over all K blocks by one thread.
+    parallel_for(blockNum, (double)UNROLL_N * numColumns, [&](I32 begin, I32 end) {
+        for (U32 bIdx = begin; bIdx < (U32)end; ++bIdx) {
+            U32 bn = bIdx * UNROLL_N;
+            if (bn >= numRows) {
+                U32 idx = (bn - numRows) / UNROLL_N;
+                CHECK_REQUIREMENT(idx <= 5);
+                bn = numRows / UNROLL_N * UNROLL_N + edgeblockNSizeArray[idx];
+            }
+            U32 private_blockKSize = 0;
+            for (U32 bk = 0; bk < numColumns; bk += private_blockKSize) {
+                private_blockKSize = UNI_MIN(numColumns - bk, BOLCK_K_DIM);
+                int blockNSize = UNI_MIN(numRows - bn, UNROLL_N);
+                F32 *curB = packB + bk * numRows + bn * private_blockKSize;
+                if (blockNSize < 8) {
+                    mvm_row_avx512<1>(private_blockKSize, curB, vector + bk, result + bn,
+                        (1 << blockNSize) - 1);
+                } else {
+                    I32 idx = blockNSize / 16 - (blockNSize >= 48);
+                    blockNSize = unrollSize[idx];
+                    __mmask16 mask = (blockNSize == 8) ? 0xFF : 0xFFFF;
+                    kernel[idx](private_blockKSize, curB, vector + bk, result + bn, mask);
+                }
+            }
+        }
+    });
+}
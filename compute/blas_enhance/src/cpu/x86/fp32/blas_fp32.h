@@ -15,6 +15,7 @@
 #define _H_BLAS_FP32
 
 #include "cpu/x86/fp32/blas_common_fp32.h"
+#include "thread_affinity.h"
 
 EE axpby_fp32(I32 len, F32 a, const F32 *x, F32 b, F32 *y);
 
@@ -61,4 +62,110 @@ void matrix_matrix_multiply_transform_rhs_bytes_fp32(
 EE matrix_matrix_multiply_transform_rhsN_fp32(TensorDesc desc, F32 *src, F32 *dst);
 
 EE matrix_matrix_multiply_transform_rhsT_fp32(TensorDesc desc, F32 *src, F32 *dst);
+
+// AVX-512 kernels are built into every x86 library and selected at run time, they are used on
+// avx512 archs(with or without vnni) when the processor supports avx512f. X86_AVX2 forces the
+// AVX2 kernels.
+inline bool use_avx512_fp32(Arch arch)
+{
+    return IS_X86(arch) && arch != X86_AVX2 && (get_x86_features() & X86_AVX512F);
+}
+
+void mvm_pack_avx512_fp32(U32 row, U32 col, F32 *matrix, F32 *vector, F32 *result);
+
+// packed weight is shared with AVX2, only the kernel is different.
+inline EE mvm_avx512_fp32(U32 row, U32 col, DataFormat df, F32 *matrix, F32 *vector, F32 *result)
+{
+    EE ret = SUCCESS;
+    if (df == DF_NKN16) {
+        mvm_pack_avx512_fp32(row, col, matrix, vector, result);
+    } else {
+        ret = mvm_avx2_fp32(row, col, df, matrix, vector, result);
+    }
+    return ret;
+}
+
+void matrix_matrix_multiply_tmp_bytes_avx512_fp32(
+    U32 M, U32 N, U32 K, DataFormat matrixA_df, DataFormat matrixB_df, U32 *bytes);
+
+// packed rhs uses 32 column panels, it can not be shared with AVX2.
+EE mmm_avx512_fp32(int M,
+    int N,
+    int K,
+    DataFormat matrixADataFormat,
+    F32 *matrix1,
+    F32 *matrix2,
+    F32 *tmp,
+    F32 *result);
+
+void matrix_matrix_multiply_transform_rhs_bytes_avx512_fp32(
+    U32 N, U32 K, DataFormat matrixB_df, U32 *bytes, U32 *rhsBytes);
+
+EE matrix_matrix_multiply_transform_rhsN_avx512_fp32(TensorDesc desc, F32 *src, F32 *dst);
+
+EE matrix_matrix_multiply_transform_rhsT_avx512_fp32(TensorDesc desc, F32 *src, F32 *dst);
+
+// bf16 weight is multiplied with fp32 input and accumulated in fp32, by vdpbf16ps when the
+// processor supports avx512_bf16, otherwise bf16 is widened to fp32 in the AVX2 kernel.
+inline bool use_avx512_bf16(Arch arch)
+{
+    return IS_X86(arch) && arch != X86_AVX2 && (get_x86_features() & X86_AVX512_BF16);
+}
+
+void matrix_matrix_multiply_tmp_bytes_bf16(U32 N, U32 M, U32 K, DataFormat bdf, U32 *bytes);
+
+void matrix_matrix_multiply_transform_rhs_bytes_bf16(U32 N, U32 K, U32 *bytes, U32 *rhsBytes);
+
+void matrix_matrix_multiply_transform_rhs_bf16(
+    U32 N, U32 K, U32 ldk, U32 ldn, const U16 *src, U16 *dst);
+
+EE mmm_bf16(U32 N,
+    U32 M,
+    U32 K,
+    DataFormat matrixADataFormat,
+    const F32 *matrixA,
+    const U16 *packB,
+    void *tmp,
+    F32 *result,
+    Arch arch);
+
+// int4 weight is kept packed and dequantized in registers, scale is shared by group weights,
+// group must be a multiple of K or a multiple of 32 that divides K.
+void matrix_matrix_multiply_tmp_bytes_int4(U32 N, U32 M, U32 K, DataFormat adf, U32 *bytes);
+
+void matrix_matrix_multiply_transform_rhs_bytes_int4(U32 N, U32 K, U32 *bytes, U32 *rhsBytes);
+
+EE matrix_matrix_multiply_pack_rhs_int4(
+    U32 N, U32 K, const U8 *src, const F32 *scale, U32 group, U8 *dst);
+
+EE mmm_int4(U32 N,
+    U32 M,
+    U32 K,
+    DataFormat matrixADataFormat,
+    const F32 *matrixA,
+    const U8 *packB,
+    void *tmp,
+    F32 *result,
+    Arch arch);
+
+// sparse rhs is chosen by the density of nonzero blocks of B(N x K in row major), NOT_SUPPORTED
+// means dense kernels are better.
+EE matrix_matrix_multiply_transform_rhs_bytes_sparse(
+    U32 N, U32 K, const F32 *src, DataFormat *df, U32 *bytes);
+
+EE matrix_matrix_multiply_transform_rhs_sparse(
+    U32 N, U32 K, const F32 *src, DataFormat df, U8 *dst);
+
+void matrix_matrix_multiply_tmp_bytes_sparse(U32 N, U32 M, U32 K, DataFormat adf, U32 *bytes);
+
+EE mmm_sparse(U32 N,
+    U32 M,
+    U32 K,
+    DataFormat matrixADataFormat,
+    const F32 *matrixA,
+    DataFormat matrixBDataFormat,
+    const U8 *matrixB,
+    void *tmp,
+    F32 *result,
+    Arch arch);
 #endif
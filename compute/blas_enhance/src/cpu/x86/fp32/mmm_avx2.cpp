@@ -13,6 +13,7 @@
 
 #include "cpu/x86/fp32/blas_fp32.h"
 #include "blas_enhance.h"
+#include "thread_pool.h"
 
 #define UNROLL_K 4
 #define UNROLL_N 24
@@ -26,7 +27,7 @@ void matrix_matrix_multiply_transform_rhs_bytes_fp32(
 {
     U32 matrix = 0;
     U32 pad = 0;
-    if (bdf != matrix_matrix_multiply_rhs_format(DT_F32)) {
+    if (!matrix_matrix_multiply_rhs_transformed(DT_F32, bdf)) {
         matrix = UNI_ALIGN(N, 8) * K * bytesOf(DT_F32);
         pad = matrix + 32;
     }
@@ -700,7 +701,6 @@ EE mmm_avx2_fp32(
     if (resN != edgeBlockNSize) {
         UNI_MEMSET(mask + resN % 8, 0, (edgeBlockNSize - resN) * 4);
     }
-    I32 *maskPtr = (N % 4 != 0) ? mask : nullptr;
     I32 alginedN = (blockNNum - 1) * UNROLL_N + edgeBlockNSize;
     if (edgeBlockNSize == 0) {
         alginedN += UNROLL_N;
@@ -708,22 +708,16 @@ EE mmm_avx2_fp32(
     I32 blockNum = (M + 3) / 4 * blockNNum;
     I32 mainBlockNum = (BOLCK_M_DIM + 3) / 4 * blockNNum;
 
-#ifdef _USE_OPENMP
-    int in_parallel = omp_in_parallel();
-#pragma omp parallel num_threads(OMP_NUM_THREADS) if (in_parallel == 0)
-#endif
-    {
-        I32 blockSizeK = 0;
-        for (int k = 0; k < K; k += blockSizeK) {
-            blockSizeK = UNI_MIN(BOLCK_K_DIM, K - k);
-            if (matrix1Df == DF_TRANSPOSE) {
-                matrix1_trans(blockSizeK, M, M, matrix1 + k * M, packA);
-            }
+    I32 blockSizeK = 0;
+    for (int k = 0; k < K; k += blockSizeK) {
+        blockSizeK = UNI_MIN(BOLCK_K_DIM, K - k);
+        if (matrix1Df == DF_TRANSPOSE) {
+            matrix1_trans(blockSizeK, M, M, matrix1 + k * M, packA);
+        }
 
-#ifdef _USE_OPENMP
-#pragma omp for schedule(static)
-#endif
-            for (int mnIdx = 0; mnIdx < blockNum; ++mnIdx) {
+        // a block is UNROLL_M x UNROLL_N outputs of blockSizeK multiply-adds.
+        parallel_for(blockNum, (double)UNROLL_M * UNROLL_N * blockSizeK, [&](I32 begin, I32 end) {
+            for (int mnIdx = begin; mnIdx < end; ++mnIdx) {
                 I32 j = mnIdx / mainBlockNum * BOLCK_M_DIM;
                 I32 blockSizeM = UNI_MIN(BOLCK_M_DIM, M - j);
                 I32 blockMNum = (blockSizeM + 3) / 4;
@@ -731,7 +725,7 @@ EE mmm_avx2_fp32(
                 I32 n = (mnIdx % mainBlockNum) / blockMNum * UNROLL_N;
                 I32 blockSizeN = UNI_MAX(UNI_MIN(UNROLL_N, N - n), edgeBlockNSize);
                 F32 *curB = packB + k * alginedN + n * blockSizeK;
-                maskPtr = ((blockSizeN + n) > N) ? mask : nullptr;
+                I32 *maskPtr = ((blockSizeN + n) > N) ? mask : nullptr;
 
                 I32 m = ((mnIdx % mainBlockNum) % blockMNum) * UNROLL_M;
                 I32 unrollSizeM = UNI_MIN(UNROLL_M, blockSizeM - m);
@@ -753,7 +747,7 @@ EE mmm_avx2_fp32(
                     blockSizeN, blockSizeK, curA, curB, result + (m + j) * N + n, N, maskPtr, A1,
                     A2, A3);
             }
-        }
+        });
     }
     return SUCCESS;
 }
@@ -0,0 +1,246 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "cpu/x86/fp32/blas_fp32.h"
+
+// bf16 rhs is packed as [N / 16][K / 2][16][2], every 32 bits hold 2 adjacent k of a column,
+// which is the operand layout of vdpbf16ps. N and K are padded with 0.
+#define UNROLL_N 16
+#define UNROLL_M 6
+#define UNROLL_P 4
+
+void matrix_matrix_multiply_transform_rhs_bytes_bf16(U32 N, U32 K, U32 *bytes, U32 *rhsBytes)
+{
+    U32 size = UNI_ALIGN(N, UNROLL_N) * UNI_ALIGN(K, 2) * bytesOf(DT_BF16);
+    if (bytes != nullptr) {
+        *bytes = size;
+    }
+    if (rhsBytes != nullptr) {
+        *rhsBytes = size;
+    }
+}
+
+void matrix_matrix_multiply_tmp_bytes_bf16(U32 N, U32 M, U32 K, DataFormat bdf, U32 *bytes)
+{
+    *bytes = 0;
+    if (bdf != DF_NKNxKx) {
+        matrix_matrix_multiply_transform_rhs_bytes_bf16(N, K, bytes, nullptr);
+    }
+    // lhs is converted to bf16 or padded fp32 rows
+    *bytes += M * UNI_ALIGN(K, 2) * bytesOf(DT_F32);
+}
+
+// src(k, n) is at src[k * ldk + n * ldn]
+void matrix_matrix_multiply_transform_rhs_bf16(
+    U32 N, U32 K, U32 ldk, U32 ldn, const U16 *src, U16 *dst)
+{
+    U32 alignedK = UNI_ALIGN(K, 2);
+    U32 blockNNum = (N + UNROLL_N - 1) / UNROLL_N;
+#ifdef _USE_OPENMP
+#pragma omp parallel for num_threads(OMP_NUM_THREADS)
+#endif
+    for (U32 b = 0; b < blockNNum; b++) {
+        U16 *packB = dst + b * alignedK * UNROLL_N;
+        for (U32 k = 0; k < alignedK; k += 2) {
+            for (U32 i = 0; i < UNROLL_N; i++) {
+                U32 n = b * UNROLL_N + i;
+                for (U32 j = 0; j < 2; j++) {
+                    packB[i * 2 + j] = (n < N && k + j < K) ? src[(k + j) * ldk + n * ldn] : 0;
+                }
+            }
+            packB += UNROLL_N * 2;
+        }
+    }
+}
+
+// C[MR][NP * 16] += A[MR][K] * B[K][NP * 16], A is converted to bf16, mask is for the
+// columns of the last panel.
+template <U32 MR, U32 NP>
+X86_AVX512_BF16_TARGET static void mmm_avx512_bf16_kernel(U32 K,
+    const U16 *A,
+    U32 lda,
+    const U16 *B,
+    U32 ldb,
+    F32 *C,
+    U32 ldc,
+    __mmask16 mask)
+{
+    __m512 c[MR][NP];
+    for (U32 r = 0; r < MR; r++) {
+        for (U32 p = 0; p < NP; p++) {
+            c[r][p] = _mm512_setzero_ps();
+        }
+    }
+    for (U32 k = 0; k < K; k += 2) {
+        __m512i b[NP];
+        for (U32 p = 0; p < NP; p++) {
+            b[p] = _mm512_loadu_si512(B + p * ldb + k * UNROLL_N);
+        }
+        for (U32 r = 0; r < MR; r++) {
+            __m512i a = _mm512_set1_epi32(*(const I32 *)(A + r * lda + k));
+            for (U32 p = 0; p < NP; p++) {
+                c[r][p] = _mm512_dpbf16_ps(c[r][p], (__m512bh)a, (__m512bh)b[p]);
+            }
+        }
+    }
+    for (U32 r = 0; r < MR; r++) {
+        for (U32 p = 0; p < NP; p++) {
+            F32 *dst = C + r * ldc + p * UNROLL_N;
+            __mmask16 m = (p == NP - 1) ? mask : 0xFFFF;
+            __m512 sum = _mm512_add_ps(_mm512_maskz_loadu_ps(m, dst), c[r][p]);
+            _mm512_mask_storeu_ps(dst, m, sum);
+        }
+    }
+}
+
+// emulated by widening bf16 to fp32 with a shift, A keeps fp32 precision.
+template <U32 MR>
+static void mmm_avx2_bf16_kernel(
+    U32 K, const F32 *A, U32 lda, const U16 *B, F32 *C, U32 ldc, U32 validN)
+{
+    __m256 c0[MR], c1[MR];
+    for (U32 r = 0; r < MR; r++) {
+        c0[r] = _mm256_setzero_ps();
+        c1[r] = _mm256_setzero_ps();
+    }
+    const __m256i high = _mm256_set1_epi32(0xFFFF0000);
+    for (U32 k = 0; k < K; k += 2) {
+        __m256i b0 = _mm256_loadu_si256((const __m256i *)(B + k * UNROLL_N));
+        __m256i b1 = _mm256_loadu_si256((const __m256i *)(B + k * UNROLL_N + UNROLL_N));
+        __m256 b00 = _mm256_castsi256_ps(_mm256_slli_epi32(b0, 16));
+        __m256 b01 = _mm256_castsi256_ps(_mm256_and_si256(b0, high));
+        __m256 b10 = _mm256_castsi256_ps(_mm256_slli_epi32(b1, 16));
+        __m256 b11 = _mm256_castsi256_ps(_mm256_and_si256(b1, high));
+        for (U32 r = 0; r < MR; r++) {
+            __m256 a0 = _mm256_set1_ps(A[r * lda + k]);
+            __m256 a1 = _mm256_set1_ps(A[r * lda + k + 1]);
+            c0[r] = _mm256_fmadd_ps(b00, a0, c0[r]);
+            c1[r] = _mm256_fmadd_ps(b10, a0, c1[r]);
+            c0[r] = _mm256_fmadd_ps(b01, a1, c0[r]);
+            c1[r] = _mm256_fmadd_ps(b11, a1, c1[r]);
+        }
+    }
+    for (U32 r = 0; r < MR; r++) {
+        F32 *dst = C + r * ldc;
+        if (validN == UNROLL_N) {
+            _mm256_storeu_ps(dst, _mm256_add_ps(_mm256_loadu_ps(dst), c0[r]));
+            _mm256_storeu_ps(dst + 8, _mm256_add_ps(_mm256_loadu_ps(dst + 8), c1[r]));
+        } else {
+            F32 buffer[UNROLL_N];
+            _mm256_storeu_ps(buffer, c0[r]);
+            _mm256_storeu_ps(buffer + 8, c1[r]);
+            for (U32 i = 0; i < validN; i++) {
+                dst[i] += buffer[i];
+            }
+        }
+    }
+}
+
+typedef void (*avx512_kernel_func)(
+    U32 K, const U16 *A, U32 lda, const U16 *B, U32 ldb, F32 *C, U32 ldc, __mmask16 mask);
+typedef void (*avx2_kernel_func)(
+    U32 K, const F32 *A, U32 lda, const U16 *B, F32 *C, U32 ldc, U32 validN);
+
+// A(m, k) is at A[m * ldm + k * ldk]
+static void mmm_avx512_bf16(U32 N, U32 M, U32 K, const F32 *A, U32 ldm, U32 ldk, const U16 *B, U16 *packA, F32 *C)
+{
+    U32 alignedK = UNI_ALIGN(K, 2);
+    for (U32 m = 0; m < M; m++) {
+        for (U32 k = 0; k < alignedK; k++) {
+            packA[m * alignedK + k] = (k < K) ? float32ToBfloat16(A[m * ldm + k * ldk]) : 0;
+        }
+    }
+    avx512_kernel_func kernel[UNROLL_M][UNROLL_P] = {
+        {mmm_avx512_bf16_kernel<1, 1>, mmm_avx512_bf16_kernel<1, 2>, mmm_avx512_bf16_kernel<1, 3>,
+            mmm_avx512_bf16_kernel<1, 4>},
+        {mmm_avx512_bf16_kernel<2, 1>, mmm_avx512_bf16_kernel<2, 2>, mmm_avx512_bf16_kernel<2, 3>,
+            mmm_avx512_bf16_kernel<2, 4>},
+        {mmm_avx512_bf16_kernel<3, 1>, mmm_avx512_bf16_kernel<3, 2>, mmm_avx512_bf16_kernel<3, 3>,
+            mmm_avx512_bf16_kernel<3, 4>},
+        {mmm_avx512_bf16_kernel<4, 1>, mmm_avx512_bf16_kernel<4, 2>, mmm_avx512_bf16_kernel<4, 3>,
+            mmm_avx512_bf16_kernel<4, 4>},
+        {mmm_avx512_bf16_kernel<5, 1>, mmm_avx512_bf16_kernel<5, 2>, mmm_avx512_bf16_kernel<5, 3>,
+            mmm_avx512_bf16_kernel<5, 4>},
+        {mmm_avx512_bf16_kernel<6, 1>, mmm_avx512_bf16_kernel<6, 2>, mmm_avx512_bf16_kernel<6, 3>,
+            mmm_avx512_bf16_kernel<6, 4>}};
+    U32 panelNum = (N + UNROLL_N - 1) / UNROLL_N;
+    U32 resN = N % UNROLL_N;
+    __mmask16 edgeMask = (resN == 0) ? 0xFFFF : ((1 << resN) - 1);
+    U32 blockMNum = (M + UNROLL_M - 1) / UNROLL_M;
+    U32 blockNNum = (panelNum + UNROLL_P - 1) / UNROLL_P;
+    U32 ldb = alignedK * UNROLL_N;
+    // rows are inner loop, so that a block of packed B is reused in cache.
+#ifdef _USE_OPENMP
+#pragma omp parallel for num_threads(OMP_NUM_THREADS)
+#endif
+    for (U32 l = 0; l < blockMNum * blockNNum; l++) {
+        U32 m = l % blockMNum * UNROLL_M;
+        U32 p = l / blockMNum * UNROLL_P;
+        U32 mr = UNI_MIN(UNROLL_M, M - m);
+        U32 np = UNI_MIN(UNROLL_P, panelNum - p);
+        __mmask16 mask = (p + np == panelNum) ? edgeMask : 0xFFFF;
+        kernel[mr - 1][np - 1](alignedK, packA + m * alignedK, alignedK, B + p * ldb, ldb,
+            C + m * N + p * UNROLL_N, N, mask);
+    }
+}
+
+static void mmm_avx2_bf16(U32 N, U32 M, U32 K, const F32 *A, U32 ldm, U32 ldk, const U16 *B, F32 *packA, F32 *C)
+{
+    U32 alignedK = UNI_ALIGN(K, 2);
+    for (U32 m = 0; m < M; m++) {
+        for (U32 k = 0; k < alignedK; k++) {
+            packA[m * alignedK + k] = (k < K) ? A[m * ldm + k * ldk] : 0;
+        }
+    }
+    avx2_kernel_func kernel[UNROLL_M] = {mmm_avx2_bf16_kernel<1>, mmm_avx2_bf16_kernel<2>,
+        mmm_avx2_bf16_kernel<3>, mmm_avx2_bf16_kernel<4>, mmm_avx2_bf16_kernel<5>,
+        mmm_avx2_bf16_kernel<6>};
+    U32 panelNum = (N + UNROLL_N - 1) / UNROLL_N;
+    U32 blockMNum = (M + UNROLL_M - 1) / UNROLL_M;
+    U32 ldb = alignedK * UNROLL_N;
+#ifdef _USE_OPENMP
+#pragma omp parallel for num_threads(OMP_NUM_THREADS)
+#endif
+    for (U32 l = 0; l < blockMNum * panelNum; l++) {
+        U32 m = l % blockMNum * UNROLL_M;
+        U32 p = l / blockMNum;
+        U32 mr = UNI_MIN(UNROLL_M, M - m);
+        U32 validN = UNI_MIN(UNROLL_N, N - p * UNROLL_N);
+        kernel[mr - 1](
+            alignedK, packA + m * alignedK, alignedK, B + p * ldb, C + m * N + p * UNROLL_N, N, validN);
+    }
+}
+
+EE mmm_bf16(U32 N,
+    U32 M,
+    U32 K,
+    DataFormat matrixADataFormat,
+    const F32 *matrixA,
+    const U16 *packB,
+    void *tmp,
+    F32 *result,
+    Arch arch)
+{
+    U32 ldm = K, ldk = 1;
+    if (matrixADataFormat == DF_TRANSPOSE) {
+        ldm = 1;
+        ldk = M;
+    }
+    if (use_avx512_bf16(arch)) {
+        mmm_avx512_bf16(N, M, K, matrixA, ldm, ldk, packB, (U16 *)tmp, result);
+    } else {
+        mmm_avx2_bf16(N, M, K, matrixA, ldm, ldk, packB, (F32 *)tmp, result);
+    }
+    return SUCCESS;
+}
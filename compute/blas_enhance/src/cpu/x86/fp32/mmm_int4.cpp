@@ -0,0 +1,243 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "cpu/x86/fp32/blas_fp32.h"
+
+// int4 rhs is packed as [N / 16][K / 32] blocks, a block is 16 fp32 dequantize factors of the
+// columns followed by [32][8] bytes, byte j of a k holds column j in low 4 bits and column j + 8
+// in high 4 bits. Codes are q + 7, padded columns and k are 7(q = 0) with factor 0.
+#define UNROLL_N 16
+#define UNROLL_M_AVX2 4
+#define UNROLL_M_AVX512 8
+#define BLOCK_K 32
+#define BLOCK_BYTES (UNROLL_N * bytesOf(DT_F32) + BLOCK_K * UNROLL_N / 2)
+
+void matrix_matrix_multiply_transform_rhs_bytes_int4(U32 N, U32 K, U32 *bytes, U32 *rhsBytes)
+{
+    U32 size = (N + UNROLL_N - 1) / UNROLL_N * ((K + BLOCK_K - 1) / BLOCK_K) * BLOCK_BYTES;
+    if (bytes != nullptr) {
+        *bytes = size;
+    }
+    if (rhsBytes != nullptr) {
+        *rhsBytes = size;
+    }
+}
+
+void matrix_matrix_multiply_tmp_bytes_int4(U32 N, U32 M, U32 K, DataFormat adf, U32 *bytes)
+{
+    // transposed lhs is copied to rows
+    *bytes = (adf == DF_TRANSPOSE) ? M * K * bytesOf(DT_F32) : 0;
+}
+
+inline U8 int4_code(const U8 *src, U32 N, U32 K, U32 n, U32 k)
+{
+    if (n >= N || k >= K) {
+        return 7;
+    }
+    U32 i = n * K + k;
+    return (src[i / 2] >> ((i % 2) * 4)) & 0xF;
+}
+
+EE matrix_matrix_multiply_pack_rhs_int4(
+    U32 N, U32 K, const U8 *src, const F32 *scale, U32 group, U8 *dst)
+{
+    // a block of K must share one scale
+    if (group == 0 || (group % K != 0 && (K % group != 0 || group % BLOCK_K != 0))) {
+        return NOT_SUPPORTED;
+    }
+    U32 blockKNum = (K + BLOCK_K - 1) / BLOCK_K;
+    U32 panelNum = (N + UNROLL_N - 1) / UNROLL_N;
+#ifdef _USE_OPENMP
+#pragma omp parallel for num_threads(OMP_NUM_THREADS)
+#endif
+    for (U32 p = 0; p < panelNum; p++) {
+        for (U32 b = 0; b < blockKNum; b++) {
+            U8 *block = dst + (p * blockKNum + b) * BLOCK_BYTES;
+            F32 *factor = (F32 *)block;
+            U8 *q = block + UNROLL_N * bytesOf(DT_F32);
+            U32 k0 = b * BLOCK_K;
+            for (U32 i = 0; i < UNROLL_N; i++) {
+                U32 n = p * UNROLL_N + i;
+                factor[i] = (n < N) ? 1 / scale[(n * K + k0) / group] : 0;
+            }
+            for (U32 k = 0; k < BLOCK_K; k++) {
+                for (U32 j = 0; j < UNROLL_N / 2; j++) {
+                    U32 n = p * UNROLL_N + j;
+                    q[k * UNROLL_N / 2 + j] = int4_code(src, N, K, n, k0 + k) |
+                        (int4_code(src, N, K, n + UNROLL_N / 2, k0 + k) << 4);
+                }
+            }
+        }
+    }
+    return SUCCESS;
+}
+
+// C[MR][16] += A[MR][K] * B[K][16], A * q is accumulated in a block of K, then 7 * sum(A) is
+// removed and the block is dequantized by the factors.
+template <U32 MR>
+static void mmm_avx2_int4_kernel(
+    U32 K, const F32 *A, U32 lda, const U8 *B, F32 *C, U32 ldc, U32 validN)
+{
+    const __m256i low = _mm256_set1_epi32(0xF);
+    for (U32 k0 = 0; k0 < K; k0 += BLOCK_K, B += BLOCK_BYTES) {
+        U32 bk = UNI_MIN(BLOCK_K, K - k0);
+        const U8 *q = B + UNROLL_N * bytesOf(DT_F32);
+        __m256 c0[MR], c1[MR];
+        F32 sum[MR];
+        for (U32 r = 0; r < MR; r++) {
+            c0[r] = _mm256_setzero_ps();
+            c1[r] = _mm256_setzero_ps();
+            sum[r] = 0;
+        }
+        for (U32 k = 0; k < bk; k++) {
+            __m256i v = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(q + k * 8)));
+            __m256 b0 = _mm256_cvtepi32_ps(_mm256_and_si256(v, low));
+            __m256 b1 = _mm256_cvtepi32_ps(_mm256_srli_epi32(v, 4));
+            for (U32 r = 0; r < MR; r++) {
+                F32 a = A[r * lda + k0 + k];
+                sum[r] += a;
+                __m256 va = _mm256_set1_ps(a);
+                c0[r] = _mm256_fmadd_ps(b0, va, c0[r]);
+                c1[r] = _mm256_fmadd_ps(b1, va, c1[r]);
+            }
+        }
+        __m256 f0 = _mm256_loadu_ps((const F32 *)B);
+        __m256 f1 = _mm256_loadu_ps((const F32 *)B + 8);
+        for (U32 r = 0; r < MR; r++) {
+            __m256 zero = _mm256_set1_ps(7 * sum[r]);
+            c0[r] = _mm256_mul_ps(_mm256_sub_ps(c0[r], zero), f0);
+            c1[r] = _mm256_mul_ps(_mm256_sub_ps(c1[r], zero), f1);
+            F32 *dst = C + r * ldc;
+            if (validN == UNROLL_N) {
+                _mm256_storeu_ps(dst, _mm256_add_ps(_mm256_loadu_ps(dst), c0[r]));
+                _mm256_storeu_ps(dst + 8, _mm256_add_ps(_mm256_loadu_ps(dst + 8), c1[r]));
+            } else {
+                F32 buffer[UNROLL_N];
+                _mm256_storeu_ps(buffer, c0[r]);
+                _mm256_storeu_ps(buffer + 8, c1[r]);
+                for (U32 i = 0; i < validN; i++) {
+                    dst[i] += buffer[i];
+                }
+            }
+        }
+    }
+}
+
+// 2 k are decoded at a time, lanes 0-7 are k and lanes 8-15 are k + 1, they are added at the end
+// of a block.
+template <U32 MR>
+X86_AVX512_TARGET static void mmm_avx512_int4_kernel(
+    U32 K, const F32 *A, U32 lda, const U8 *B, F32 *C, U32 ldc, U32 validN)
+{
+    const __m512i low = _mm512_set1_epi32(0xF);
+    __mmask16 mask = (validN == UNROLL_N) ? 0xFFFF : ((1 << validN) - 1);
+    for (U32 k0 = 0; k0 < K; k0 += BLOCK_K, B += BLOCK_BYTES) {
+        U32 bk = UNI_MIN(BLOCK_K, K - k0);
+        const U8 *q = B + UNROLL_N * bytesOf(DT_F32);
+        __m512 c0[MR], c1[MR];
+        F32 sum[MR];
+        for (U32 r = 0; r < MR; r++) {
+            c0[r] = _mm512_setzero_ps();
+            c1[r] = _mm512_setzero_ps();
+            sum[r] = 0;
+        }
+        for (U32 k = 0; k < bk; k += 2) {
+            __m512i v;
+            if (k + 1 < bk) {
+                v = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i *)(q + k * 8)));
+            } else {
+                v = _mm512_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(q + k * 8)));
+            }
+            __m512 b0 = _mm512_cvtepi32_ps(_mm512_and_si512(v, low));
+            __m512 b1 = _mm512_cvtepi32_ps(_mm512_srli_epi32(v, 4));
+            for (U32 r = 0; r < MR; r++) {
+                F32 a0 = A[r * lda + k0 + k];
+                F32 a1 = (k + 1 < bk) ? A[r * lda + k0 + k + 1] : 0;
+                sum[r] += a0 + a1;
+                __m512 va = _mm512_castpd_ps(_mm512_insertf64x4(
+                    _mm512_castps_pd(_mm512_set1_ps(a0)), _mm256_castps_pd(_mm256_set1_ps(a1)), 1));
+                c0[r] = _mm512_fmadd_ps(b0, va, c0[r]);
+                c1[r] = _mm512_fmadd_ps(b1, va, c1[r]);
+            }
+        }
+        __m512 f = _mm512_loadu_ps((const F32 *)B);
+        for (U32 r = 0; r < MR; r++) {
+            // [c0 k, c0 k + 1] + [c1 k, c1 k + 1] => [columns 0-7, columns 8-15]
+            __m512 lo = _mm512_shuffle_f32x4(c0[r], c1[r], _MM_SHUFFLE(1, 0, 1, 0));
+            __m512 hi = _mm512_shuffle_f32x4(c0[r], c1[r], _MM_SHUFFLE(3, 2, 3, 2));
+            __m512 c = _mm512_sub_ps(_mm512_add_ps(lo, hi), _mm512_set1_ps(7 * sum[r]));
+            F32 *dst = C + r * ldc;
+            c = _mm512_fmadd_ps(c, f, _mm512_maskz_loadu_ps(mask, dst));
+            _mm512_mask_storeu_ps(dst, mask, c);
+        }
+    }
+}
+
+typedef void (*kernel_func)(U32 K, const F32 *A, U32 lda, const U8 *B, F32 *C, U32 ldc, U32 validN);
+
+EE mmm_int4(U32 N,
+    U32 M,
+    U32 K,
+    DataFormat matrixADataFormat,
+    const F32 *matrixA,
+    const U8 *packB,
+    void *tmp,
+    F32 *result,
+    Arch arch)
+{
+    const F32 *A = matrixA;
+    if (matrixADataFormat == DF_TRANSPOSE) {
+        F32 *packA = (F32 *)tmp;
+        for (U32 m = 0; m < M; m++) {
+            for (U32 k = 0; k < K; k++) {
+                packA[m * K + k] = matrixA[k * M + m];
+            }
+        }
+        A = packA;
+    }
+    // AVX2 has 16 registers, so that less rows are computed in a kernel.
+    kernel_func kernel[UNROLL_M_AVX512];
+    U32 unrollM;
+    if (use_avx512_fp32(arch)) {
+        unrollM = UNROLL_M_AVX512;
+        kernel[0] = mmm_avx512_int4_kernel<1>;
+        kernel[1] = mmm_avx512_int4_kernel<2>;
+        kernel[2] = mmm_avx512_int4_kernel<3>;
+        kernel[3] = mmm_avx512_int4_kernel<4>;
+        kernel[4] = mmm_avx512_int4_kernel<5>;
+        kernel[5] = mmm_avx512_int4_kernel<6>;
+        kernel[6] = mmm_avx512_int4_kernel<7>;
+        kernel[7] = mmm_avx512_int4_kernel<8>;
+    } else {
+        unrollM = UNROLL_M_AVX2;
+        kernel[0] = mmm_avx2_int4_kernel<1>;
+        kernel[1] = mmm_avx2_int4_kernel<2>;
+        kernel[2] = mmm_avx2_int4_kernel<3>;
+        kernel[3] = mmm_avx2_int4_kernel<4>;
+    }
+    U32 panelNum = (N + UNROLL_N - 1) / UNROLL_N;
+    U32 blockMNum = (M + unrollM - 1) / unrollM;
+    U32 ldb = (K + BLOCK_K - 1) / BLOCK_K * BLOCK_BYTES;
+    // rows are inner loop, so that a panel of packed B is reused in cache.
+#ifdef _USE_OPENMP
+#pragma omp parallel for num_threads(OMP_NUM_THREADS)
+#endif
+    for (U32 l = 0; l < blockMNum * panelNum; l++) {
+        U32 m = l % blockMNum * unrollM;
+        U32 p = l / blockMNum;
+        U32 mr = UNI_MIN(unrollM, M - m);
+        U32 validN = UNI_MIN(UNROLL_N, N - p * UNROLL_N);
+        kernel[mr - 1](K, A + m * K, K, packB + p * ldb, result + m * N + p * UNROLL_N, N, validN);
+    }
+    return SUCCESS;
+}
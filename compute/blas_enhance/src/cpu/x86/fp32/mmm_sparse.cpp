@@ -0,0 +1,398 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include <vector>
+#include "cpu/x86/fp32/blas_fp32.h"
+
+// DF_NKN16_BSR keeps nonzero blocks of 16 columns of a row of B, it is U32 block offsets of
+// panels[N / 16 + 1], U32 k of blocks[num], then fp32 blocks[num][16] at a 64 bytes aligned offset.
+// DF_NKN8_2_4 keeps 2 of every 4 weights along K, it is [N / 8][K / 4] groups, a group is U32
+// indexes in the group(2 bits, column i uses bits 2i and 2i + 16) and fp32 weights[2][8].
+#define BSR_N 16
+#define NM_N 8
+#define NM_K 4
+#define NM_GROUP_BYTES (bytesOf(DT_U32) + 2 * NM_N * bytesOf(DT_F32))
+#define UNROLL_M_AVX2 6
+#define UNROLL_M_AVX512 8
+// sparse kernels do the same work as dense ones for a nonzero block, dense kernels are faster
+// when more than about half of blocks are nonzero.
+#define BSR_MAX_DENSITY 0.45
+
+static U32 bsr_block_num(U32 N, U32 K, const F32 *src, std::vector<U32> *offsets)
+{
+    U32 panelNum = (N + BSR_N - 1) / BSR_N;
+    offsets->resize(panelNum + 1);
+    (*offsets)[0] = 0;
+    for (U32 p = 0; p < panelNum; p++) {
+        U32 num = 0;
+        U32 validN = UNI_MIN(BSR_N, N - p * BSR_N);
+        for (U32 k = 0; k < K; k++) {
+            for (U32 i = 0; i < validN; i++) {
+                if (src[(p * BSR_N + i) * K + k] != 0) {
+                    num++;
+                    break;
+                }
+            }
+        }
+        (*offsets)[p + 1] = (*offsets)[p] + num;
+    }
+    return offsets->back();
+}
+
+static bool is_2_4_sparse(U32 N, U32 K, const F32 *src)
+{
+    if (K % NM_K != 0) {
+        return false;
+    }
+    for (U32 i = 0; i < N * K; i += NM_K) {
+        U32 num = (src[i] != 0) + (src[i + 1] != 0) + (src[i + 2] != 0) + (src[i + 3] != 0);
+        if (num > 2) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static U32 bsr_value_offset(U32 panelNum, U32 num)
+{
+    return UNI_ALIGN((panelNum + 1 + num) * bytesOf(DT_U32), 64);
+}
+
+EE matrix_matrix_multiply_transform_rhs_bytes_sparse(
+    U32 N, U32 K, const F32 *src, DataFormat *df, U32 *bytes)
+{
+    std::vector<U32> offsets;
+    U32 num = bsr_block_num(N, K, src, &offsets);
+    U32 panelNum = offsets.size() - 1;
+    EE ret = SUCCESS;
+    if (num <= BSR_MAX_DENSITY * panelNum * K) {
+        *df = DF_NKN16_BSR;
+        *bytes = bsr_value_offset(panelNum, num) + num * BSR_N * bytesOf(DT_F32);
+    } else if (is_2_4_sparse(N, K, src)) {
+        *df = DF_NKN8_2_4;
+        *bytes = (N + NM_N - 1) / NM_N * (K / NM_K) * NM_GROUP_BYTES;
+    } else {
+        ret = NOT_SUPPORTED;
+    }
+    return ret;
+}
+
+static void transform_rhs_bsr(U32 N, U32 K, const F32 *src, U8 *dst)
+{
+    std::vector<U32> offsets;
+    U32 num = bsr_block_num(N, K, src, &offsets);
+    U32 panelNum = offsets.size() - 1;
+    U32 *offset = (U32 *)dst;
+    U32 *index = offset + panelNum + 1;
+    F32 *value = (F32 *)(dst + bsr_value_offset(panelNum, num));
+    UNI_MEMCPY(offset, offsets.data(), offsets.size() * bytesOf(DT_U32));
+#ifdef _USE_OPENMP
+#pragma omp parallel for num_threads(OMP_NUM_THREADS)
+#endif
+    for (U32 p = 0; p < panelNum; p++) {
+        U32 j = offsets[p];
+        U32 validN = UNI_MIN(BSR_N, N - p * BSR_N);
+        for (U32 k = 0; k < K; k++) {
+            bool zero = true;
+            for (U32 i = 0; i < validN; i++) {
+                zero = zero && (src[(p * BSR_N + i) * K + k] == 0);
+            }
+            if (zero) {
+                continue;
+            }
+            index[j] = k;
+            for (U32 i = 0; i < BSR_N; i++) {
+                value[j * BSR_N + i] = (i < validN) ? src[(p * BSR_N + i) * K + k] : 0;
+            }
+            j++;
+        }
+    }
+}
+
+static void transform_rhs_2_4(U32 N, U32 K, const F32 *src, U8 *dst)
+{
+    U32 panelNum = (N + NM_N - 1) / NM_N;
+    U32 groupNum = K / NM_K;
+#ifdef _USE_OPENMP
+#pragma omp parallel for num_threads(OMP_NUM_THREADS)
+#endif
+    for (U32 p = 0; p < panelNum; p++) {
+        for (U32 g = 0; g < groupNum; g++) {
+            U8 *group = dst + (p * groupNum + g) * NM_GROUP_BYTES;
+            U32 *index = (U32 *)group;
+            F32 *value = (F32 *)(index + 1);
+            *index = 0;
+            for (U32 i = 0; i < NM_N; i++) {
+                U32 n = p * NM_N + i;
+                // zero weights keep index 0 and 1
+                U32 pos[2] = {0, 1};
+                F32 w[2] = {0, 0};
+                for (U32 k = 0, j = 0; n < N && k < NM_K; k++) {
+                    F32 v = src[n * K + g * NM_K + k];
+                    if (v != 0) {
+                        pos[j] = k;
+                        w[j++] = v;
+                    }
+                }
+                *index |= (pos[0] << (2 * i)) | (pos[1] << (2 * i + 16));
+                value[i] = w[0];
+                value[NM_N + i] = w[1];
+            }
+        }
+    }
+}
+
+EE matrix_matrix_multiply_transform_rhs_sparse(
+    U32 N, U32 K, const F32 *src, DataFormat df, U8 *dst)
+{
+    EE ret = SUCCESS;
+    switch (df) {
+        case DF_NKN16_BSR:
+            transform_rhs_bsr(N, K, src, dst);
+            break;
+        case DF_NKN8_2_4:
+            if (K % NM_K != 0) {
+                ret = NOT_SUPPORTED;
+                break;
+            }
+            transform_rhs_2_4(N, K, src, dst);
+            break;
+        default:
+            ret = NOT_SUPPORTED;
+            break;
+    }
+    return ret;
+}
+
+void matrix_matrix_multiply_tmp_bytes_sparse(U32 N, U32 M, U32 K, DataFormat adf, U32 *bytes)
+{
+    // transposed lhs is copied to rows
+    *bytes = (adf == DF_TRANSPOSE) ? M * K * bytesOf(DT_F32) : 0;
+}
+
+template <U32 MR>
+static void mmm_avx2_bsr_kernel(U32 num,
+    const U32 *index,
+    const F32 *B,
+    const F32 *A,
+    U32 lda,
+    F32 *C,
+    U32 ldc,
+    U32 validN)
+{
+    __m256 c0[MR], c1[MR];
+    for (U32 r = 0; r < MR; r++) {
+        c0[r] = _mm256_setzero_ps();
+        c1[r] = _mm256_setzero_ps();
+    }
+    for (U32 j = 0; j < num; j++, B += BSR_N) {
+        __m256 b0 = _mm256_loadu_ps(B);
+        __m256 b1 = _mm256_loadu_ps(B + 8);
+        const F32 *a = A + index[j];
+        for (U32 r = 0; r < MR; r++) {
+            __m256 va = _mm256_broadcast_ss(a + r * lda);
+            c0[r] = _mm256_fmadd_ps(b0, va, c0[r]);
+            c1[r] = _mm256_fmadd_ps(b1, va, c1[r]);
+        }
+    }
+    for (U32 r = 0; r < MR; r++) {
+        F32 *dst = C + r * ldc;
+        if (validN == BSR_N) {
+            _mm256_storeu_ps(dst, _mm256_add_ps(_mm256_loadu_ps(dst), c0[r]));
+            _mm256_storeu_ps(dst + 8, _mm256_add_ps(_mm256_loadu_ps(dst + 8), c1[r]));
+        } else {
+            F32 buffer[BSR_N];
+            _mm256_storeu_ps(buffer, c0[r]);
+            _mm256_storeu_ps(buffer + 8, c1[r]);
+            for (U32 i = 0; i < validN; i++) {
+                dst[i] += buffer[i];
+            }
+        }
+    }
+}
+
+template <U32 MR>
+X86_AVX512_TARGET static void mmm_avx512_bsr_kernel(U32 num,
+    const U32 *index,
+    const F32 *B,
+    const F32 *A,
+    U32 lda,
+    F32 *C,
+    U32 ldc,
+    U32 validN)
+{
+    __m512 c[MR];
+    for (U32 r = 0; r < MR; r++) {
+        c[r] = _mm512_setzero_ps();
+    }
+    for (U32 j = 0; j < num; j++, B += BSR_N) {
+        __m512 b = _mm512_loadu_ps(B);
+        const F32 *a = A + index[j];
+        for (U32 r = 0; r < MR; r++) {
+            c[r] = _mm512_fmadd_ps(b, _mm512_set1_ps(a[r * lda]), c[r]);
+        }
+    }
+    __mmask16 mask = (validN == BSR_N) ? 0xFFFF : ((1 << validN) - 1);
+    for (U32 r = 0; r < MR; r++) {
+        F32 *dst = C + r * ldc;
+        _mm512_mask_storeu_ps(dst, mask, _mm512_add_ps(_mm512_maskz_loadu_ps(mask, dst), c[r]));
+    }
+}
+
+// the 4 k of a group are broadcast to both 128 bits lanes, vpermilps picks the nonzero k of
+// each column by the low 2 bits of its index.
+template <U32 MR>
+static void mmm_avx2_2_4_kernel(
+    U32 K, const U8 *B, const F32 *A, U32 lda, F32 *C, U32 ldc, U32 validN)
+{
+    const __m256i shift0 = _mm256_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14);
+    const __m256i shift1 = _mm256_setr_epi32(16, 18, 20, 22, 24, 26, 28, 30);
+    __m256 c[MR];
+    for (U32 r = 0; r < MR; r++) {
+        c[r] = _mm256_setzero_ps();
+    }
+    for (U32 k = 0; k < K; k += NM_K, B += NM_GROUP_BYTES) {
+        __m256i index = _mm256_set1_epi32(*(const I32 *)B);
+        __m256i i0 = _mm256_srlv_epi32(index, shift0);
+        __m256i i1 = _mm256_srlv_epi32(index, shift1);
+        __m256 b0 = _mm256_loadu_ps((const F32 *)(B + bytesOf(DT_U32)));
+        __m256 b1 = _mm256_loadu_ps((const F32 *)(B + bytesOf(DT_U32)) + NM_N);
+        for (U32 r = 0; r < MR; r++) {
+            __m256 a = _mm256_broadcast_ps((const __m128 *)(A + r * lda + k));
+            c[r] = _mm256_fmadd_ps(_mm256_permutevar_ps(a, i0), b0, c[r]);
+            c[r] = _mm256_fmadd_ps(_mm256_permutevar_ps(a, i1), b1, c[r]);
+        }
+    }
+    for (U32 r = 0; r < MR; r++) {
+        F32 *dst = C + r * ldc;
+        if (validN == NM_N) {
+            _mm256_storeu_ps(dst, _mm256_add_ps(_mm256_loadu_ps(dst), c[r]));
+        } else {
+            F32 buffer[NM_N];
+            _mm256_storeu_ps(buffer, c[r]);
+            for (U32 i = 0; i < validN; i++) {
+                dst[i] += buffer[i];
+            }
+        }
+    }
+}
+
+typedef void (*bsr_kernel_func)(U32 num,
+    const U32 *index,
+    const F32 *B,
+    const F32 *A,
+    U32 lda,
+    F32 *C,
+    U32 ldc,
+    U32 validN);
+
+typedef void (*nm_kernel_func)(
+    U32 K, const U8 *B, const F32 *A, U32 lda, F32 *C, U32 ldc, U32 validN);
+
+static void mmm_bsr(U32 N, U32 M, U32 K, const F32 *A, const U8 *B, F32 *C, Arch arch)
+{
+    bsr_kernel_func kernel[UNROLL_M_AVX512];
+    U32 unrollM;
+    if (use_avx512_fp32(arch)) {
+        unrollM = UNROLL_M_AVX512;
+        kernel[0] = mmm_avx512_bsr_kernel<1>;
+        kernel[1] = mmm_avx512_bsr_kernel<2>;
+        kernel[2] = mmm_avx512_bsr_kernel<3>;
+        kernel[3] = mmm_avx512_bsr_kernel<4>;
+        kernel[4] = mmm_avx512_bsr_kernel<5>;
+        kernel[5] = mmm_avx512_bsr_kernel<6>;
+        kernel[6] = mmm_avx512_bsr_kernel<7>;
+        kernel[7] = mmm_avx512_bsr_kernel<8>;
+    } else {
+        unrollM = UNROLL_M_AVX2;
+        kernel[0] = mmm_avx2_bsr_kernel<1>;
+        kernel[1] = mmm_avx2_bsr_kernel<2>;
+        kernel[2] = mmm_avx2_bsr_kernel<3>;
+        kernel[3] = mmm_avx2_bsr_kernel<4>;
+        kernel[4] = mmm_avx2_bsr_kernel<5>;
+        kernel[5] = mmm_avx2_bsr_kernel<6>;
+    }
+    U32 panelNum = (N + BSR_N - 1) / BSR_N;
+    const U32 *offset = (const U32 *)B;
+    const U32 *index = offset + panelNum + 1;
+    const F32 *value = (const F32 *)(B + bsr_value_offset(panelNum, offset[panelNum]));
+    U32 blockMNum = (M + unrollM - 1) / unrollM;
+#ifdef _USE_OPENMP
+#pragma omp parallel for num_threads(OMP_NUM_THREADS)
+#endif
+    for (U32 l = 0; l < blockMNum * panelNum; l++) {
+        U32 m = l % blockMNum * unrollM;
+        U32 p = l / blockMNum;
+        U32 mr = UNI_MIN(unrollM, M - m);
+        U32 validN = UNI_MIN(BSR_N, N - p * BSR_N);
+        kernel[mr - 1](offset[p + 1] - offset[p], index + offset[p], value + offset[p] * BSR_N,
+            A + m * K, K, C + m * N + p * BSR_N, N, validN);
+    }
+}
+
+static void mmm_2_4(U32 N, U32 M, U32 K, const F32 *A, const U8 *B, F32 *C)
+{
+    nm_kernel_func kernel[UNROLL_M_AVX2] = {mmm_avx2_2_4_kernel<1>, mmm_avx2_2_4_kernel<2>,
+        mmm_avx2_2_4_kernel<3>, mmm_avx2_2_4_kernel<4>, mmm_avx2_2_4_kernel<5>,
+        mmm_avx2_2_4_kernel<6>};
+    U32 panelNum = (N + NM_N - 1) / NM_N;
+    U32 ldb = K / NM_K * NM_GROUP_BYTES;
+    U32 blockMNum = (M + UNROLL_M_AVX2 - 1) / UNROLL_M_AVX2;
+#ifdef _USE_OPENMP
+#pragma omp parallel for num_threads(OMP_NUM_THREADS)
+#endif
+    for (U32 l = 0; l < blockMNum * panelNum; l++) {
+        U32 m = l % blockMNum * UNROLL_M_AVX2;
+        U32 p = l / blockMNum;
+        U32 mr = UNI_MIN(UNROLL_M_AVX2, M - m);
+        U32 validN = UNI_MIN(NM_N, N - p * NM_N);
+        kernel[mr - 1](K, B + p * ldb, A + m * K, K, C + m * N + p * NM_N, N, validN);
+    }
+}
+
+EE mmm_sparse(U32 N,
+    U32 M,
+    U32 K,
+    DataFormat matrixADataFormat,
+    const F32 *matrixA,
+    DataFormat matrixBDataFormat,
+    const U8 *matrixB,
+    void *tmp,
+    F32 *result,
+    Arch arch)
+{
+    const F32 *A = matrixA;
+    if (matrixADataFormat == DF_TRANSPOSE) {
+        F32 *packA = (F32 *)tmp;
+        for (U32 m = 0; m < M; m++) {
+            for (U32 k = 0; k < K; k++) {
+                packA[m * K + k] = matrixA[k * M + m];
+            }
+        }
+        A = packA;
+    }
+    EE ret = SUCCESS;
+    switch (matrixBDataFormat) {
+        case DF_NKN16_BSR:
+            mmm_bsr(N, M, K, A, matrixB, result, arch);
+            break;
+        case DF_NKN8_2_4:
+            mmm_2_4(N, M, K, A, matrixB, result);
+            break;
+        default:
+            ret = NOT_SUPPORTED;
+            break;
+    }
+    return ret;
+}
@@ -13,6 +13,7 @@
 
 #include "cpu/x86/fp32/blas_fp32.h"
 #include "error.h"
+#include "thread_pool.h"
 
 #define UNROLL_N 64
 #define BOLCK_K_DIM 1024
@@ -264,25 +265,18 @@ void mvm_pack_fp32(U32 numRows, U32 numColumns, F32 *packB, F32 *vector, F32 *re
         resN -= value;
         blockNum += 1;
     }
-#ifdef _USE_OPENMP
-    int in_parallel = omp_in_parallel();
-#pragma omp parallel num_threads(OMP_NUM_THREADS) if (in_parallel == 0)
-    {
-#endif
-        U32 private_blockKSize = 0;
-        for (U32 bk = 0; bk < numColumns; bk += private_blockKSize) {
-            private_blockKSize = UNI_MIN(numColumns - bk, BOLCK_K_DIM);
-#ifdef _USE_OPENMP
-#pragma omp for
-#endif
-            for (U32 bIdx = 0; bIdx < (U32)(blockNum); ++bIdx) {
-                U32 bn = bIdx * UNROLL_N;
-                if (bn >= numRows) {
-                    U32 idx = (bn - numRows) / UNROLL_N;
-                    CHECK_REQUIREMENT(idx <= 5);
-                    bn = numRows / UNROLL_N * UNROLL_N + edgeblockNSizeArray[idx];
-                }
-
+    // rows of a block are accumulated over all K blocks by one thread.
+    parallel_for(blockNum, (double)UNROLL_N * numColumns, [&](I32 begin, I32 end) {
+        for (U32 bIdx = begin; bIdx < (U32)end; ++bIdx) {
+            U32 bn = bIdx * UNROLL_N;
+            if (bn >= numRows) {
+                U32 idx = (bn - numRows) / UNROLL_N;
+                CHECK_REQUIREMENT(idx <= 5);
+                bn = numRows / UNROLL_N * UNROLL_N + edgeblockNSizeArray[idx];
+            }
+            U32 private_blockKSize = 0;
+            for (U32 bk = 0; bk < numColumns; bk += private_blockKSize) {
+                private_blockKSize = UNI_MIN(numColumns - bk, BOLCK_K_DIM);
                 int blockNSize = UNI_MIN(numRows - bn, UNROLL_N);
                 if ((blockNSize < 8) && (blockNSize % 8 != 0)) {
                     I32 mask[8] = {0};
@@ -298,7 +292,5 @@ void mvm_pack_fp32(U32 numRows, U32 numColumns, F32 *packB, F32 *vector, F32 *re
                 }
             }
         }
-#ifdef _USE_OPENMP
-    }
-#endif
+    });
 }
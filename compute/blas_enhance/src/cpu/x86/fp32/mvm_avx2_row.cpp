@@ -13,6 +13,7 @@
 
 #include "cpu/x86/fp32/blas_fp32.h"
 #include "error.h"
+#include "thread_pool.h"
 
 #define UNROLL_N 4
 #define BOLCK_K_DIM 512
@@ -527,26 +528,18 @@ void mvm_row_fp32(U32 numRows, U32 numColumns, F32 *matrix, F32 *vector, F32 *re
     kernel_func kernel[3] = {mvm_row_avx_1_32, mvm_row_avx_2_32, mvm_row_avx_4_32};
     U32 unrollNSize[3] = {1, 2, 4};
     U32 blockNum = numRows / 4 + (numRows % 4 + 1) / 2;
-#ifdef _USE_OPENMP
-    int in_parallel = omp_in_parallel();
-#pragma omp parallel num_threads(OMP_NUM_THREADS) if (in_parallel == 0)
-    {
-#endif
-        U32 private_blockKSize = 0;
-        for (U32 bk = 0; bk < numColumns; bk += private_blockKSize) {
-            private_blockKSize = UNI_MIN(numColumns - bk, BOLCK_K_DIM);
-#ifdef _USE_OPENMP
-#pragma omp for
-#endif
-            for (U32 bIdx = 0; bIdx < blockNum; ++bIdx) {
-                U32 bn = bIdx * 4 - ((bIdx * 4) > numRows) * 2;
-                U32 blockNSize = UNI_MIN(numRows - bn, UNROLL_N);
-                blockNSize = unrollNSize[blockNSize >> 1];
+    // rows of a block are accumulated over all K blocks by one thread.
+    parallel_for(blockNum, (double)UNROLL_N * numColumns, [&](I32 begin, I32 end) {
+        for (U32 bIdx = begin; bIdx < (U32)end; ++bIdx) {
+            U32 bn = bIdx * 4 - ((bIdx * 4) > numRows) * 2;
+            U32 blockNSize = UNI_MIN(numRows - bn, UNROLL_N);
+            blockNSize = unrollNSize[blockNSize >> 1];
+            U32 private_blockKSize = 0;
+            for (U32 bk = 0; bk < numColumns; bk += private_blockKSize) {
+                private_blockKSize = UNI_MIN(numColumns - bk, BOLCK_K_DIM);
                 kernel[blockNSize >> 1](private_blockKSize, numColumns,
                     matrix + bn * numColumns + bk, vector + bk, result + bn);
             }
         }
-#ifdef _USE_OPENMP
-    }
-#endif
+    });
 }
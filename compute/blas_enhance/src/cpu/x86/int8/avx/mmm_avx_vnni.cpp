@@ -920,7 +920,7 @@ typedef void (*kernel_func)(U32 um,
           "%ymm12", "%ymm13", "%ymm14", "%ymm15", "memory", "cc");
 
 #define mmm_m_n_asm(m, n, nRegs, mRegs, regs) \
-    void asm_##mRegs##x##n(U32 um, \
+    static void asm_##mRegs##x##n(U32 um, \
         U32 un, \
         U32 bk, \
         UINT8 *matrixA, \
@@ -965,7 +965,7 @@ mmm_m_n_asm(1, 8, 1, 1, 1)
 
 // clang-format on
 //TODO: matrixC alloc
-EE mmm_avx512_vnni_int8(U32 N,
+EE mmm_avx_vnni_int8(U32 N,
     U32 M,
     U32 K,
     DataFormat matrix1Df,
@@ -130,7 +130,7 @@ EE matrix_vector_multiply_transform_weight_int8(
     return ret;
 }
 
-void mvm_row_avx512_32(U32 bn,
+static void mvm_row_avx512_32(U32 bn,
     U32 bk,
     INT8 *matrix,
     UINT8 *vector,
@@ -229,7 +229,7 @@ void mvm_row_avx512_32(U32 bn,
                          "%ymm14", "%ymm15", "memory");
 }
 
-void mvm_row_avx512_24(U32 bn,
+static void mvm_row_avx512_24(U32 bn,
     U32 bk,
     INT8 *matrix,
     UINT8 *vector,
@@ -318,7 +318,7 @@ void mvm_row_avx512_24(U32 bn,
                          "%ymm14", "%ymm15", "memory");
 }
 
-void mvm_row_avx512_16(U32 bn,
+static void mvm_row_avx512_16(U32 bn,
     U32 bk,
     INT8 *matrix,
     UINT8 *vector,
@@ -397,7 +397,7 @@ void mvm_row_avx512_16(U32 bn,
                          "%ymm14", "%ymm15", "memory");
 }
 
-void mvm_row_avx512_8(U32 bn,
+static void mvm_row_avx512_8(U32 bn,
     U32 bk,
     INT8 *matrix,
     UINT8 *vector,
@@ -464,7 +464,7 @@ void mvm_row_avx512_8(U32 bn,
 }
 
 
-void mvm_row_avx512_tail(U32 bn,
+static void mvm_row_avx512_tail(U32 bn,
     U32 bk,
     INT8 *matrix,
     UINT8 *vector,
@@ -499,7 +499,7 @@ void mvm_row_avx512_tail(U32 bn,
     }
 }
 
-EE mvm_avx512_int8(U32 numRows,
+EE mvm_avx_vnni_int8(U32 numRows,
     U32 numColumns,
     INT8 *packB,
     UINT8 *vector,
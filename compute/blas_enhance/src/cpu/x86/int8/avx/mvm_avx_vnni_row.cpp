@@ -29,7 +29,7 @@ typedef void (*kernel_func)(U32 K,
     U32 flags);
 
 // I8 U8
-void mvm_avx512_8_row(U32 K,
+static void mvm_avx512_8_row(U32 K,
     U32 bk,
     UINT8 *matrix,
     INT8 *vector,
@@ -182,7 +182,7 @@ void mvm_avx512_8_row(U32 K,
                            "%ymm13", "%ymm14", "%ymm15", "memory");
 }
 
-void mvm_avx512_4_row(U32 K,
+static void mvm_avx512_4_row(U32 K,
     U32 bk,
     UINT8 *matrix,
     INT8 *vector,
@@ -290,7 +290,7 @@ void mvm_avx512_4_row(U32 K,
                            "%ymm13", "%ymm14", "%ymm15", "memory");
 }
 
-void mvm_avx512_1_row(U32 K,
+static void mvm_avx512_1_row(U32 K,
     U32 bk,
     UINT8 *matrix,
     INT8 *vector,
@@ -372,7 +372,7 @@ void mvm_avx512_1_row(U32 K,
                            "%ymm13", "%ymm14", "%ymm15", "memory");
 }
 
-inline void transpose(UINT8 *matrix, UINT8 *transMatrix, U32 N, U32 K)
+static inline void transpose(UINT8 *matrix, UINT8 *transMatrix, U32 N, U32 K)
 {
     U32 blockSizeN = 0;
     for (U32 n = 0; n < N; n += blockSizeN) {
@@ -385,7 +385,7 @@ inline void transpose(UINT8 *matrix, UINT8 *transMatrix, U32 N, U32 K)
     }
 }
 
-EE mvm_avx512_int8_row_i8u8(U32 numRows,
+EE mvm_avx_vnni_int8_row_i8u8(U32 numRows,
     U32 numColumns,
     DataFormat df,
     UINT8 *packB,
@@ -19,7 +19,7 @@
 #define BOLCK_M_DIM 384
 #define BOLCK_K_DIM 4096
 
-void matrix_matrix_multiply_transform_rhs_bytes_int8(
+void matrix_matrix_multiply_transform_rhs_bytes_avx512_int8(
     U32 N, U32 K, DataFormat bdf, U32 *bytes, U32 *rhsBytes)
 {
     U32 matrix = 0;
@@ -39,10 +39,10 @@ void matrix_matrix_multiply_transform_rhs_bytes_int8(
     }
 }
 
-void matrix_matrix_multiply_tmp_bytes_int8(
+void matrix_matrix_multiply_tmp_bytes_avx512_int8(
     U32 N, U32 M, U32 K, DataFormat adf, DataFormat bdf, U32 *bytes)
 {
-    matrix_matrix_multiply_transform_rhs_bytes_int8(N, K, bdf, bytes, nullptr);
+    matrix_matrix_multiply_transform_rhs_bytes_avx512_int8(N, K, bdf, bytes, nullptr);
     if (adf == DF_NORMAL) {
         *bytes += 32 * K;
         if (K % 8 != 0) {
@@ -57,7 +57,7 @@ void matrix_matrix_multiply_tmp_bytes_int8(
     *bytes += 64;
 }
 
-EE matrix_matrix_multiply_transform_rhsN_int8(TensorDesc desc, INT8 *src, INT8 *packB)
+EE matrix_matrix_multiply_transform_rhsN_avx512_int8(TensorDesc desc, INT8 *src, INT8 *packB)
 {
     DataType dt;
     DataFormat df;
@@ -88,7 +88,7 @@ EE matrix_matrix_multiply_transform_rhsN_int8(TensorDesc desc, INT8 *src, INT8 *
     return SUCCESS;
 }
 
-EE matrix_matrix_multiply_transform_rhsT_int8(TensorDesc desc, INT8 *src, INT8 *packB)
+EE matrix_matrix_multiply_transform_rhsT_avx512_int8(TensorDesc desc, INT8 *src, INT8 *packB)
 {
     DataType dt;
     DataFormat df;
@@ -1661,7 +1661,7 @@ typedef void (*kernel_func)(U32 um,
     mmm_m_16_8_asm(m, n, nRegs, mRegs, %%ymm, ymm, 0x20, 0x40, edge)
 
 #define mmm_m_n_asm(m, n, nRegs, mRegs, regs) \
-    void asm_##mRegs##x##n(U32 um, \
+    X86_AVX512_TARGET static void asm_##mRegs##x##n(U32 um, \
         U32 un, \
         U32 bk, \
         UINT8 *matrixA, \
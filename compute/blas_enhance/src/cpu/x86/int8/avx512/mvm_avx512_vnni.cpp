@@ -25,7 +25,7 @@ typedef void (*kernel_func)(U32 bn,
     const F32 *scale,
     U32 flags);
 
-EE matrix_vector_multiply_transform_weight_int8(
+EE matrix_vector_multiply_transform_weight_avx512_int8(
     TensorDesc desc, INT8 *src, INT8 *packB, I32 *offsetCBias)
 {
     DataType dt;
@@ -130,7 +130,7 @@ EE matrix_vector_multiply_transform_weight_int8(
     return ret;
 }
 
-void mvm_row_avx512_64(U32 bn,
+X86_AVX512_TARGET static void mvm_row_avx512_64(U32 bn,
     U32 bk,
     INT8 *matrix,
     UINT8 *vector,
@@ -156,11 +156,6 @@ void mvm_row_avx512_64(U32 bn,
                          "vxorps %%zmm3, %%zmm3, %%zmm3                     \n\t"
                          ".align 16                                         \n\t"
                          "1:                                      \n\t"
-#ifndef _USE_AVX512_VNNI
-                         "mov $1, %%eax \n\t"
-                         "vmovd %%eax, %%xmm24                    \n\t"
-                         "vpbroadcastw %%xmm24, %%zmm31            \n\t"
-#endif
                          "vpbroadcastd (%0), %%zmm4                     \n\t"
                          "vmovups (%1), %%zmm5                             \n\t"
                          "vmovups 0x40(%1), %%zmm6                             \n\t"
@@ -182,100 +177,40 @@ void mvm_row_avx512_64(U32 bn,
                          "vmovups 0x40(%1), %%zmm11                             \n\t"
                          "vmovups 0x80(%1), %%zmm12                             \n\t"
                          "vmovups 0xC0(%1), %%zmm13                             \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%zmm5, %%zmm4, %%zmm0              \n\t"
                          "vpdpbusd %%zmm6, %%zmm4, %%zmm1              \n\t"
                          "vpdpbusd %%zmm7, %%zmm4, %%zmm2              \n\t"
                          "vpdpbusd %%zmm8, %%zmm4, %%zmm3              \n\t"
-#else
-                         "vpmaddubsw %%zmm5, %%zmm4, %%zmm24              \n\t"
-                         "vpmaddubsw %%zmm6, %%zmm4, %%zmm25              \n\t"
-                         "vpmaddubsw %%zmm7, %%zmm4, %%zmm26              \n\t"
-                         "vpmaddubsw %%zmm8, %%zmm4, %%zmm27              \n\t"
-                         "vpmaddwd %%zmm24, %%zmm31, %%zmm24              \n\t"
-                         "vpmaddwd %%zmm25, %%zmm31, %%zmm25              \n\t"
-                         "vpmaddwd %%zmm26, %%zmm31, %%zmm26              \n\t"
-                         "vpmaddwd %%zmm27, %%zmm31, %%zmm27              \n\t"
-                         "vpaddd %%zmm0, %%zmm24, %%zmm0              \n\t"
-                         "vpaddd %%zmm1, %%zmm25, %%zmm1              \n\t"
-                         "vpaddd %%zmm2, %%zmm26, %%zmm2              \n\t"
-                         "vpaddd %%zmm3, %%zmm27, %%zmm3              \n\t"
-#endif
 
                          "vpbroadcastd 0x8(%0), %%zmm14                     \n\t"
                          "vmovups 0x100(%1), %%zmm15                        \n\t"
                          "vmovups 0x140(%1), %%zmm16                        \n\t"
                          "vmovups 0x180(%1), %%zmm17                        \n\t"
                          "vmovups 0x1C0(%1), %%zmm18                        \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%zmm10, %%zmm9, %%zmm0              \n\t"
                          "vpdpbusd %%zmm11, %%zmm9, %%zmm1              \n\t"
                          "vpdpbusd %%zmm12, %%zmm9, %%zmm2              \n\t"
                          "vpdpbusd %%zmm13, %%zmm9, %%zmm3              \n\t"
-#else
-                         "vpmaddubsw %%zmm10, %%zmm9, %%zmm24              \n\t"
-                         "vpmaddubsw %%zmm11, %%zmm9, %%zmm25              \n\t"
-                         "vpmaddubsw %%zmm12, %%zmm9, %%zmm26              \n\t"
-                         "vpmaddubsw %%zmm13, %%zmm9, %%zmm27              \n\t"
-                         "vpmaddwd %%zmm24, %%zmm31, %%zmm24              \n\t"
-                         "vpmaddwd %%zmm25, %%zmm31, %%zmm25              \n\t"
-                         "vpmaddwd %%zmm26, %%zmm31, %%zmm26              \n\t"
-                         "vpmaddwd %%zmm27, %%zmm31, %%zmm27              \n\t"
-                         "vpaddd %%zmm0, %%zmm24, %%zmm0              \n\t"
-                         "vpaddd %%zmm1, %%zmm25, %%zmm1              \n\t"
-                         "vpaddd %%zmm2, %%zmm26, %%zmm2              \n\t"
-                         "vpaddd %%zmm3, %%zmm27, %%zmm3              \n\t"
-#endif
 
                          "vpbroadcastd 0xC(%0), %%zmm19                     \n\t"
                          "vmovups 0x200(%1), %%zmm20                             \n\t"
                          "vmovups 0x240(%1), %%zmm21                             \n\t"
                          "vmovups 0x280(%1), %%zmm22                             \n\t"
                          "vmovups 0x2C0(%1), %%zmm23                             \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%zmm15, %%zmm14, %%zmm0              \n\t"
                          "vpdpbusd %%zmm16, %%zmm14, %%zmm1              \n\t"
                          "vpdpbusd %%zmm17, %%zmm14, %%zmm2              \n\t"
                          "vpdpbusd %%zmm18, %%zmm14, %%zmm3              \n\t"
-#else
-                         "vpmaddubsw %%zmm15, %%zmm14, %%zmm24              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm14, %%zmm25              \n\t"
-                         "vpmaddubsw %%zmm17, %%zmm14, %%zmm26              \n\t"
-                         "vpmaddubsw %%zmm18, %%zmm14, %%zmm27              \n\t"
-                         "vpmaddwd %%zmm24, %%zmm31, %%zmm24              \n\t"
-                         "vpmaddwd %%zmm25, %%zmm31, %%zmm25              \n\t"
-                         "vpmaddwd %%zmm26, %%zmm31, %%zmm26              \n\t"
-                         "vpmaddwd %%zmm27, %%zmm31, %%zmm27              \n\t"
-                         "vpaddd %%zmm0, %%zmm24, %%zmm0              \n\t"
-                         "vpaddd %%zmm1, %%zmm25, %%zmm1              \n\t"
-                         "vpaddd %%zmm2, %%zmm26, %%zmm2              \n\t"
-                         "vpaddd %%zmm3, %%zmm27, %%zmm3              \n\t"
-#endif
 
                          "vpbroadcastd 0x10(%0), %%zmm4                  \n\t"
                          "vmovups 0x300(%1), %%zmm5                      \n\t"
                          "vmovups 0x340(%1), %%zmm6                      \n\t"
                          "vmovups 0x380(%1), %%zmm7                      \n\t"
                          "vmovups 0x3C0(%1), %%zmm8                      \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%zmm20, %%zmm19, %%zmm0              \n\t"
                          "vpdpbusd %%zmm21, %%zmm19, %%zmm1              \n\t"
                          "vpdpbusd %%zmm22, %%zmm19, %%zmm2              \n\t"
                          "vpdpbusd %%zmm23, %%zmm19, %%zmm3              \n\t"
-#else
-                         "vpmaddubsw %%zmm20, %%zmm19, %%zmm24              \n\t"
-                         "vpmaddubsw %%zmm21, %%zmm19, %%zmm25              \n\t"
-                         "vpmaddubsw %%zmm22, %%zmm19, %%zmm26              \n\t"
-                         "vpmaddubsw %%zmm23, %%zmm19, %%zmm27              \n\t"
-                         "vpmaddwd %%zmm24, %%zmm31, %%zmm24              \n\t"
-                         "vpmaddwd %%zmm25, %%zmm31, %%zmm25              \n\t"
-                         "vpmaddwd %%zmm26, %%zmm31, %%zmm26              \n\t"
-                         "vpmaddwd %%zmm27, %%zmm31, %%zmm27              \n\t"
-                         "vpaddd %%zmm0, %%zmm24, %%zmm0              \n\t"
-                         "vpaddd %%zmm1, %%zmm25, %%zmm1              \n\t"
-                         "vpaddd %%zmm2, %%zmm26, %%zmm2              \n\t"
-                         "vpaddd %%zmm3, %%zmm27, %%zmm3              \n\t"
-#endif
 
                          "add $0x10, %0                                  \n\t"
                          "add $0x400, %1                                 \n\t"
@@ -290,25 +225,10 @@ void mvm_row_avx512_64(U32 bn,
                          "jz 5f                                          \n\t"
                          ".align 16                                         \n\t"
                          "4:                                           \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%zmm5, %%zmm4, %%zmm0              \n\t"
                          "vpdpbusd %%zmm6, %%zmm4, %%zmm1              \n\t"
                          "vpdpbusd %%zmm7, %%zmm4, %%zmm2              \n\t"
                          "vpdpbusd %%zmm8, %%zmm4, %%zmm3              \n\t"
-#else
-                         "vpmaddubsw %%zmm5, %%zmm4, %%zmm24              \n\t"
-                         "vpmaddubsw %%zmm6, %%zmm4, %%zmm25              \n\t"
-                         "vpmaddubsw %%zmm7, %%zmm4, %%zmm26              \n\t"
-                         "vpmaddubsw %%zmm8, %%zmm4, %%zmm27              \n\t"
-                         "vpmaddwd %%zmm24, %%zmm31, %%zmm24              \n\t"
-                         "vpmaddwd %%zmm25, %%zmm31, %%zmm25              \n\t"
-                         "vpmaddwd %%zmm26, %%zmm31, %%zmm26              \n\t"
-                         "vpmaddwd %%zmm27, %%zmm31, %%zmm27              \n\t"
-                         "vpaddd %%zmm0, %%zmm24, %%zmm0              \n\t"
-                         "vpaddd %%zmm1, %%zmm25, %%zmm1              \n\t"
-                         "vpaddd %%zmm2, %%zmm26, %%zmm2              \n\t"
-                         "vpaddd %%zmm3, %%zmm27, %%zmm3              \n\t"
-#endif
 
                          "vpbroadcastd 0x4(%0), %%zmm4                  \n\t"
                          "vmovups (%1), %%zmm5                          \n\t"
@@ -373,7 +293,7 @@ void mvm_row_avx512_64(U32 bn,
                          "%zmm31", "memory");
 }
 
-void mvm_row_avx512_32(U32 bn,
+X86_AVX512_TARGET static void mvm_row_avx512_32(U32 bn,
     U32 bk,
     INT8 *matrix,
     UINT8 *vector,
@@ -395,11 +315,6 @@ void mvm_row_avx512_32(U32 bn,
                          "vxorps %%zmm1, %%zmm1, %%zmm1                     \n\t"
                          ".align 16                                         \n\t"
                          "1:                                      \n\t"
-#ifndef _USE_AVX512_VNNI
-                         "mov $1, %%eax \n\t"
-                         "vmovd %%eax, %%xmm24                    \n\t"
-                         "vpbroadcastw %%xmm24, %%zmm31            \n\t"
-#endif
                          "vpbroadcastd (%0), %%zmm2                     \n\t"
                          "vmovups (%1), %%zmm3                             \n\t"
                          "vmovups 0x40(%1), %%zmm4                             \n\t"
@@ -415,32 +330,14 @@ void mvm_row_avx512_32(U32 bn,
                          "vpbroadcastd 0x4(%0), %%zmm5                     \n\t"
                          "vmovups (%1), %%zmm6                             \n\t"
                          "vmovups 0x40(%1), %%zmm7                         \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%zmm3, %%zmm2, %%zmm0              \n\t"
                          "vpdpbusd %%zmm4, %%zmm2, %%zmm1              \n\t"
-#else
-                         "vpmaddubsw %%zmm3, %%zmm2, %%zmm24              \n\t"
-                         "vpmaddubsw %%zmm4, %%zmm2, %%zmm25              \n\t"
-                         "vpmaddwd %%zmm24, %%zmm31, %%zmm24              \n\t"
-                         "vpmaddwd %%zmm25, %%zmm31, %%zmm25              \n\t"
-                         "vpaddd %%zmm0, %%zmm24, %%zmm0              \n\t"
-                         "vpaddd %%zmm1, %%zmm25, %%zmm1              \n\t"
-#endif
 
                          "vpbroadcastd 0x8(%0), %%zmm2                     \n\t"
                          "vmovups 0x80(%1), %%zmm3                         \n\t"
                          "vmovups 0xC0(%1), %%zmm4                        \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%zmm6, %%zmm5, %%zmm0                 \n\t"
                          "vpdpbusd %%zmm7, %%zmm5, %%zmm1                 \n\t"
-#else
-                         "vpmaddubsw %%zmm6, %%zmm5, %%zmm24              \n\t"
-                         "vpmaddubsw %%zmm7, %%zmm5, %%zmm25              \n\t"
-                         "vpmaddwd %%zmm24, %%zmm31, %%zmm24              \n\t"
-                         "vpmaddwd %%zmm25, %%zmm31, %%zmm25              \n\t"
-                         "vpaddd %%zmm0, %%zmm24, %%zmm0              \n\t"
-                         "vpaddd %%zmm1, %%zmm25, %%zmm1              \n\t"
-#endif
 
                          "add $0x8, %0                                  \n\t"
                          "add $0x100, %1                                 \n\t"
@@ -455,17 +352,8 @@ void mvm_row_avx512_32(U32 bn,
                          "jz 5f                                          \n\t"
                          ".align 16                                         \n\t"
                          "4:                                           \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%zmm3, %%zmm2, %%zmm0              \n\t"
                          "vpdpbusd %%zmm4, %%zmm2, %%zmm1              \n\t"
-#else
-                         "vpmaddubsw %%zmm3, %%zmm2, %%zmm24              \n\t"
-                         "vpmaddubsw %%zmm4, %%zmm2, %%zmm25              \n\t"
-                         "vpmaddwd %%zmm24, %%zmm31, %%zmm24              \n\t"
-                         "vpmaddwd %%zmm25, %%zmm31, %%zmm25              \n\t"
-                         "vpaddd %%zmm0, %%zmm24, %%zmm0              \n\t"
-                         "vpaddd %%zmm1, %%zmm25, %%zmm1              \n\t"
-#endif
 
                          "vpbroadcastd 0x4(%0), %%zmm2                  \n\t"
                          "vmovups (%1), %%zmm3                          \n\t"
@@ -515,7 +403,7 @@ void mvm_row_avx512_32(U32 bn,
                          "%zmm21", "%zmm22", "%zmm23", "%zmm24", "%zmm25", "%zmm31", "memory");
 }
 
-void mvm_row_avx512_16(U32 bn,
+X86_AVX512_TARGET static void mvm_row_avx512_16(U32 bn,
     U32 bk,
     INT8 *matrix,
     UINT8 *vector,
@@ -535,11 +423,6 @@ void mvm_row_avx512_16(U32 bn,
                          "vxorps %%zmm0, %%zmm0, %%zmm0                     \n\t"
                          ".align 16                                         \n\t"
                          "1:                                      \n\t"
-#ifndef _USE_AVX512_VNNI
-                         "mov $1, %%eax \n\t"
-                         "vmovd %%eax, %%xmm24                    \n\t"
-                         "vpbroadcastw %%xmm24, %%zmm31            \n\t"
-#endif
                          "vpaddd (%2), %%zmm0, %%zmm0                    \n\t"
                          "shr $2, %%ecx                                    \n\t"
                          "jz 3f                                      \n\t"
@@ -548,13 +431,7 @@ void mvm_row_avx512_16(U32 bn,
                          "2:                                      \n\t"
                          "vpbroadcastd (%0), %%zmm1                     \n\t"
                          "vmovups (%1), %%zmm2                             \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%zmm2, %%zmm1, %%zmm0              \n\t"
-#else
-                         "vpmaddubsw %%zmm2, %%zmm1, %%zmm24              \n\t"
-                         "vpmaddwd %%zmm24, %%zmm31, %%zmm24              \n\t"
-                         "vpaddd %%zmm0, %%zmm24, %%zmm0              \n\t"
-#endif
                          "add $0x4, %0                                  \n\t"
                          "add $0x40, %1                                 \n\t"
                          "dec %%ecx                                      \n\t"
@@ -590,7 +467,7 @@ void mvm_row_avx512_16(U32 bn,
                          : "%eax", "%zmm0", "%zmm1", "%zmm2", "%zmm24", "%zmm31", "memory");
 }
 
-void mvm_row_avx512_8(U32 bn,
+X86_AVX512_TARGET static void mvm_row_avx512_8(U32 bn,
     U32 bk,
     INT8 *matrix,
     UINT8 *vector,
@@ -610,11 +487,6 @@ void mvm_row_avx512_8(U32 bn,
                          "vxorps %%ymm0, %%ymm0, %%ymm0               \n\t"
                          ".align 16                                         \n\t"
                          "1:                                      \n\t"
-#ifndef _USE_AVX512_VNNI
-                         "mov $1, %%eax \n\t"
-                         "vmovd %%eax, %%xmm24                    \n\t"
-                         "vpbroadcastw %%xmm24, %%ymm31            \n\t"
-#endif
                          "vpaddd (%2), %%ymm0, %%ymm0                 \n\t"
                          "shr $2, %%ecx                                    \n\t"
                          "jz 3f                                      \n\t"
@@ -623,13 +495,7 @@ void mvm_row_avx512_8(U32 bn,
                          "2:                                          \n\t"
                          "vpbroadcastd (%0), %%ymm1                   \n\t"
                          "vmovups (%1), %%ymm2                        \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%ymm2, %%ymm1, %%ymm0             \n\t"
-#else
-                         "vpmaddubsw %%ymm2, %%ymm1, %%ymm24              \n\t"
-                         "vpmaddwd %%ymm24, %%ymm31, %%ymm24              \n\t"
-                         "vpaddd %%ymm0, %%ymm24, %%ymm0              \n\t"
-#endif
                          "add $0x4, %0                                \n\t"
                          "add $0x20, %1                               \n\t"
                          "dec %%ecx                                   \n\t"
@@ -665,7 +531,7 @@ void mvm_row_avx512_8(U32 bn,
                          : "%eax", "%ymm0", "%ymm1", "%ymm2", "%ymm24", "%ymm31", "memory");
 }
 
-void mvm_row_avx512_tail(U32 bn,
+X86_AVX512_TARGET static void mvm_row_avx512_tail(U32 bn,
     U32 bk,
     INT8 *matrix,
     UINT8 *vector,
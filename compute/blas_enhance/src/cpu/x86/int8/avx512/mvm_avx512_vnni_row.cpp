@@ -28,7 +28,7 @@ typedef void (*kernel_func)(U32 K,
     U32 flags);
 
 // I8 U8
-void mvm_avx512_16_row(U32 K,
+X86_AVX512_TARGET static void mvm_avx512_16_row(U32 K,
     U32 bk,
     U64 kmask,
     UINT8 *matrix,
@@ -55,11 +55,6 @@ void mvm_avx512_16_row(U32 K,
                          "vxorps %%zmm13, %%zmm13, %%zmm13                     \n\t"
                          "vxorps %%zmm14, %%zmm14, %%zmm14                     \n\t"
                          "vxorps %%zmm15, %%zmm15, %%zmm15                     \n\t"
-#ifndef _USE_AVX512_VNNI
-                         "mov $1, %%eax \n\t"
-                         "vmovd %%eax, %%xmm26                    \n\t"
-                         "vpbroadcastw %%xmm26, %%zmm31            \n\t"
-#endif
                          "cmp $0x0, %%ecx                         \n\t"
                          "je 2f                                    \n\t"
                          ".align 16                                         \n\t"
@@ -72,25 +67,10 @@ void mvm_avx512_16_row(U32 K,
                          "vmovups (%1, %7), %%zmm18                             \n\t"
                          "vmovups (%%rax), %%zmm19                             \n\t"
                          "vmovups (%%rax, %7), %%zmm20                             \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%zmm16, %%zmm17, %%zmm0              \n\t"
                          "vpdpbusd %%zmm16, %%zmm18, %%zmm1              \n\t"
                          "vpdpbusd %%zmm16, %%zmm19, %%zmm2              \n\t"
                          "vpdpbusd %%zmm16, %%zmm20, %%zmm3              \n\t"
-#else
-                         "vpmaddubsw %%zmm16, %%zmm17, %%zmm26              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm18, %%zmm27              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm19, %%zmm28              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm20, %%zmm29              \n\t"
-                         "vpmaddwd %%zmm26, %%zmm31, %%zmm26              \n\t"
-                         "vpmaddwd %%zmm27, %%zmm31, %%zmm27              \n\t"
-                         "vpmaddwd %%zmm28, %%zmm31, %%zmm28              \n\t"
-                         "vpmaddwd %%zmm29, %%zmm31, %%zmm29              \n\t"
-                         "vpaddd %%zmm0, %%zmm26, %%zmm0              \n\t"
-                         "vpaddd %%zmm1, %%zmm27, %%zmm1              \n\t"
-                         "vpaddd %%zmm2, %%zmm28, %%zmm2              \n\t"
-                         "vpaddd %%zmm3, %%zmm29, %%zmm3              \n\t"
-#endif
 
                          "add %7, %%rax \n\t"
                          "add %7, %%rax \n\t"
@@ -101,25 +81,10 @@ void mvm_avx512_16_row(U32 K,
                          "vmovups (%%rax, %7), %%zmm23                             \n\t"
                          "vmovups (%%rbx), %%zmm24                             \n\t"
                          "vmovups (%%rbx, %7), %%zmm25                             \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%zmm16, %%zmm22, %%zmm4              \n\t"
                          "vpdpbusd %%zmm16, %%zmm23, %%zmm5              \n\t"
                          "vpdpbusd %%zmm16, %%zmm24, %%zmm6              \n\t"
                          "vpdpbusd %%zmm16, %%zmm25, %%zmm7              \n\t"
-#else
-                         "vpmaddubsw %%zmm16, %%zmm22, %%zmm26              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm23, %%zmm27              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm24, %%zmm28              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm25, %%zmm29              \n\t"
-                         "vpmaddwd %%zmm26, %%zmm31, %%zmm26              \n\t"
-                         "vpmaddwd %%zmm27, %%zmm31, %%zmm27              \n\t"
-                         "vpmaddwd %%zmm28, %%zmm31, %%zmm28              \n\t"
-                         "vpmaddwd %%zmm29, %%zmm31, %%zmm29              \n\t"
-                         "vpaddd %%zmm4, %%zmm26, %%zmm4              \n\t"
-                         "vpaddd %%zmm5, %%zmm27, %%zmm5              \n\t"
-                         "vpaddd %%zmm6, %%zmm28, %%zmm6              \n\t"
-                         "vpaddd %%zmm7, %%zmm29, %%zmm7              \n\t"
-#endif
 
                          "add %7, %%rbx \n\t"
                          "add %7, %%rbx \n\t"
@@ -130,25 +95,10 @@ void mvm_avx512_16_row(U32 K,
                          "vmovups (%%rbx, %7), %%zmm18                             \n\t"
                          "vmovups (%%rax), %%zmm19                             \n\t"
                          "vmovups (%%rax, %7), %%zmm20                             \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%zmm16, %%zmm17, %%zmm8              \n\t"
                          "vpdpbusd %%zmm16, %%zmm18, %%zmm9              \n\t"
                          "vpdpbusd %%zmm16, %%zmm19, %%zmm10              \n\t"
                          "vpdpbusd %%zmm16, %%zmm20, %%zmm11              \n\t"
-#else
-                         "vpmaddubsw %%zmm16, %%zmm17, %%zmm26              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm18, %%zmm27              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm19, %%zmm28              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm20, %%zmm29              \n\t"
-                         "vpmaddwd %%zmm26, %%zmm31, %%zmm26              \n\t"
-                         "vpmaddwd %%zmm27, %%zmm31, %%zmm27              \n\t"
-                         "vpmaddwd %%zmm28, %%zmm31, %%zmm28              \n\t"
-                         "vpmaddwd %%zmm29, %%zmm31, %%zmm29              \n\t"
-                         "vpaddd %%zmm8, %%zmm26, %%zmm8              \n\t"
-                         "vpaddd %%zmm9, %%zmm27, %%zmm9              \n\t"
-                         "vpaddd %%zmm10, %%zmm28, %%zmm10              \n\t"
-                         "vpaddd %%zmm11, %%zmm29, %%zmm11              \n\t"
-#endif
 
                          "add %7, %%rax \n\t"
                          "add %7, %%rax \n\t"
@@ -159,25 +109,10 @@ void mvm_avx512_16_row(U32 K,
                          "vmovups (%%rax, %7), %%zmm23                             \n\t"
                          "vmovups (%%rbx), %%zmm24                             \n\t"
                          "vmovups (%%rbx, %7), %%zmm25                             \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%zmm16, %%zmm22, %%zmm12              \n\t"
                          "vpdpbusd %%zmm16, %%zmm23, %%zmm13              \n\t"
                          "vpdpbusd %%zmm16, %%zmm24, %%zmm14              \n\t"
                          "vpdpbusd %%zmm16, %%zmm25, %%zmm15              \n\t"
-#else
-                         "vpmaddubsw %%zmm16, %%zmm22, %%zmm26              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm23, %%zmm27              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm24, %%zmm28              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm25, %%zmm29              \n\t"
-                         "vpmaddwd %%zmm26, %%zmm31, %%zmm26              \n\t"
-                         "vpmaddwd %%zmm27, %%zmm31, %%zmm27              \n\t"
-                         "vpmaddwd %%zmm28, %%zmm31, %%zmm28              \n\t"
-                         "vpmaddwd %%zmm29, %%zmm31, %%zmm29              \n\t"
-                         "vpaddd %%zmm12, %%zmm26, %%zmm12              \n\t"
-                         "vpaddd %%zmm13, %%zmm27, %%zmm13              \n\t"
-                         "vpaddd %%zmm14, %%zmm28, %%zmm14              \n\t"
-                         "vpaddd %%zmm15, %%zmm29, %%zmm15              \n\t"
-#endif
 
                          "add $0x40, %0                                  \n\t"
                          "add $0x40, %1                                 \n\t"
@@ -200,25 +135,10 @@ void mvm_avx512_16_row(U32 K,
                          "vmovdqu8 (%1, %7), %%zmm18 %{%%k1%}                             \n\t"
                          "vmovdqu8 (%%rax), %%zmm19 %{%%k1%}                            \n\t"
                          "vmovdqu8 (%%rax, %7), %%zmm20 %{%%k1%}                            \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%zmm16, %%zmm17, %%zmm0              \n\t"
                          "vpdpbusd %%zmm16, %%zmm18, %%zmm1              \n\t"
                          "vpdpbusd %%zmm16, %%zmm19, %%zmm2              \n\t"
                          "vpdpbusd %%zmm16, %%zmm20, %%zmm3              \n\t"
-#else
-                         "vpmaddubsw %%zmm16, %%zmm17, %%zmm26              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm18, %%zmm27              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm19, %%zmm28              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm20, %%zmm29              \n\t"
-                         "vpmaddwd %%zmm26, %%zmm31, %%zmm26              \n\t"
-                         "vpmaddwd %%zmm27, %%zmm31, %%zmm27              \n\t"
-                         "vpmaddwd %%zmm28, %%zmm31, %%zmm28              \n\t"
-                         "vpmaddwd %%zmm29, %%zmm31, %%zmm29              \n\t"
-                         "vpaddd %%zmm0, %%zmm26, %%zmm0              \n\t"
-                         "vpaddd %%zmm1, %%zmm27, %%zmm1              \n\t"
-                         "vpaddd %%zmm2, %%zmm28, %%zmm2              \n\t"
-                         "vpaddd %%zmm3, %%zmm29, %%zmm3              \n\t"
-#endif
 
                          "add %7, %%rax \n\t"
                          "add %7, %%rax \n\t"
@@ -229,25 +149,10 @@ void mvm_avx512_16_row(U32 K,
                          "vmovdqu8 (%%rax, %7), %%zmm23 %{%%k1%}                             \n\t"
                          "vmovdqu8 (%%rbx), %%zmm24 %{%%k1%}                             \n\t"
                          "vmovdqu8 (%%rbx, %7), %%zmm25 %{%%k1%}                            \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%zmm16, %%zmm22, %%zmm4              \n\t"
                          "vpdpbusd %%zmm16, %%zmm23, %%zmm5              \n\t"
                          "vpdpbusd %%zmm16, %%zmm24, %%zmm6              \n\t"
                          "vpdpbusd %%zmm16, %%zmm25, %%zmm7              \n\t"
-#else
-                         "vpmaddubsw %%zmm16, %%zmm22, %%zmm26              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm23, %%zmm27              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm24, %%zmm28              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm25, %%zmm29              \n\t"
-                         "vpmaddwd %%zmm26, %%zmm31, %%zmm26              \n\t"
-                         "vpmaddwd %%zmm27, %%zmm31, %%zmm27              \n\t"
-                         "vpmaddwd %%zmm28, %%zmm31, %%zmm28              \n\t"
-                         "vpmaddwd %%zmm29, %%zmm31, %%zmm29              \n\t"
-                         "vpaddd %%zmm4, %%zmm26, %%zmm4              \n\t"
-                         "vpaddd %%zmm5, %%zmm27, %%zmm5              \n\t"
-                         "vpaddd %%zmm6, %%zmm28, %%zmm6              \n\t"
-                         "vpaddd %%zmm7, %%zmm29, %%zmm7              \n\t"
-#endif
 
                          "add %7, %%rbx \n\t"
                          "add %7, %%rbx \n\t"
@@ -258,25 +163,10 @@ void mvm_avx512_16_row(U32 K,
                          "vmovdqu8 (%%rbx, %7), %%zmm18 %{%%k1%}                             \n\t"
                          "vmovdqu8 (%%rax), %%zmm19 %{%%k1%}                             \n\t"
                          "vmovdqu8 (%%rax, %7), %%zmm20 %{%%k1%}                             \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%zmm16, %%zmm17, %%zmm8              \n\t"
                          "vpdpbusd %%zmm16, %%zmm18, %%zmm9              \n\t"
                          "vpdpbusd %%zmm16, %%zmm19, %%zmm10              \n\t"
                          "vpdpbusd %%zmm16, %%zmm20, %%zmm11              \n\t"
-#else
-                         "vpmaddubsw %%zmm16, %%zmm17, %%zmm26              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm18, %%zmm27              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm19, %%zmm28              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm20, %%zmm29              \n\t"
-                         "vpmaddwd %%zmm26, %%zmm31, %%zmm26              \n\t"
-                         "vpmaddwd %%zmm27, %%zmm31, %%zmm27              \n\t"
-                         "vpmaddwd %%zmm28, %%zmm31, %%zmm28              \n\t"
-                         "vpmaddwd %%zmm29, %%zmm31, %%zmm29              \n\t"
-                         "vpaddd %%zmm8, %%zmm26, %%zmm8              \n\t"
-                         "vpaddd %%zmm9, %%zmm27, %%zmm9              \n\t"
-                         "vpaddd %%zmm10, %%zmm28, %%zmm10              \n\t"
-                         "vpaddd %%zmm11, %%zmm29, %%zmm11            \n\t"
-#endif
 
                          "add %7, %%rax \n\t"
                          "add %7, %%rax \n\t"
@@ -287,25 +177,10 @@ void mvm_avx512_16_row(U32 K,
                          "vmovdqu8 (%%rax, %7), %%zmm23 %{%%k1%}                             \n\t"
                          "vmovdqu8 (%%rbx), %%zmm24 %{%%k1%}                             \n\t"
                          "vmovdqu8 (%%rbx, %7), %%zmm25 %{%%k1%}                             \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%zmm16, %%zmm22, %%zmm12              \n\t"
                          "vpdpbusd %%zmm16, %%zmm23, %%zmm13              \n\t"
                          "vpdpbusd %%zmm16, %%zmm24, %%zmm14              \n\t"
                          "vpdpbusd %%zmm16, %%zmm25, %%zmm15              \n\t"
-#else
-                         "vpmaddubsw %%zmm16, %%zmm22, %%zmm26              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm23, %%zmm27              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm24, %%zmm28              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm25, %%zmm29              \n\t"
-                         "vpmaddwd %%zmm26, %%zmm31, %%zmm26              \n\t"
-                         "vpmaddwd %%zmm27, %%zmm31, %%zmm27              \n\t"
-                         "vpmaddwd %%zmm28, %%zmm31, %%zmm28              \n\t"
-                         "vpmaddwd %%zmm29, %%zmm31, %%zmm29              \n\t"
-                         "vpaddd %%zmm12, %%zmm26, %%zmm12              \n\t"
-                         "vpaddd %%zmm13, %%zmm27, %%zmm13              \n\t"
-                         "vpaddd %%zmm14, %%zmm28, %%zmm14              \n\t"
-                         "vpaddd %%zmm15, %%zmm29, %%zmm15              \n\t"
-#endif
 
                          ".align 16                                      \n\t"
                          "3:                                             \n\t"
@@ -424,7 +299,7 @@ void mvm_avx512_16_row(U32 K,
                          "%zmm27", "%zmm28", "%zmm29", "%zmm30", "%zmm31", "memory");
 }
 
-void mvm_avx512_8_row(U32 K,
+X86_AVX512_TARGET static void mvm_avx512_8_row(U32 K,
     U32 bk,
     U64 kmask,
     UINT8 *matrix,
@@ -443,11 +318,6 @@ void mvm_avx512_8_row(U32 K,
                          "vxorps %%zmm5, %%zmm5, %%zmm5                     \n\t"
                          "vxorps %%zmm6, %%zmm6, %%zmm6                     \n\t"
                          "vxorps %%zmm7, %%zmm7, %%zmm7                     \n\t"
-#ifndef _USE_AVX512_VNNI
-                         "mov $1, %%eax \n\t"
-                         "vmovd %%eax, %%xmm26                    \n\t"
-                         "vpbroadcastw %%xmm26, %%zmm31            \n\t"
-#endif
                          "cmp $0x0, %%ecx                         \n\t"
                          "je 2f                                    \n\t"
                          ".align 16                                         \n\t"
@@ -460,25 +330,10 @@ void mvm_avx512_8_row(U32 K,
                          "vmovups (%1, %7), %%zmm18                             \n\t"
                          "vmovups (%%rax), %%zmm19                             \n\t"
                          "vmovups (%%rax, %7), %%zmm20                             \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%zmm16, %%zmm17, %%zmm0              \n\t"
                          "vpdpbusd %%zmm16, %%zmm18, %%zmm1              \n\t"
                          "vpdpbusd %%zmm16, %%zmm19, %%zmm2              \n\t"
                          "vpdpbusd %%zmm16, %%zmm20, %%zmm3              \n\t"
-#else
-                         "vpmaddubsw %%zmm16, %%zmm17, %%zmm26              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm18, %%zmm27              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm19, %%zmm28              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm20, %%zmm29              \n\t"
-                         "vpmaddwd %%zmm26, %%zmm31, %%zmm26              \n\t"
-                         "vpmaddwd %%zmm27, %%zmm31, %%zmm27              \n\t"
-                         "vpmaddwd %%zmm28, %%zmm31, %%zmm28              \n\t"
-                         "vpmaddwd %%zmm29, %%zmm31, %%zmm29              \n\t"
-                         "vpaddd %%zmm0, %%zmm26, %%zmm0              \n\t"
-                         "vpaddd %%zmm1, %%zmm27, %%zmm1              \n\t"
-                         "vpaddd %%zmm2, %%zmm28, %%zmm2              \n\t"
-                         "vpaddd %%zmm3, %%zmm29, %%zmm3              \n\t"
-#endif
 
                          "add %7, %%rax \n\t"
                          "add %7, %%rax \n\t"
@@ -489,25 +344,10 @@ void mvm_avx512_8_row(U32 K,
                          "vmovups (%%rax, %7), %%zmm23                             \n\t"
                          "vmovups (%%rbx), %%zmm24                             \n\t"
                          "vmovups (%%rbx, %7), %%zmm25                             \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%zmm16, %%zmm22, %%zmm4              \n\t"
                          "vpdpbusd %%zmm16, %%zmm23, %%zmm5              \n\t"
                          "vpdpbusd %%zmm16, %%zmm24, %%zmm6              \n\t"
                          "vpdpbusd %%zmm16, %%zmm25, %%zmm7              \n\t"
-#else
-                         "vpmaddubsw %%zmm16, %%zmm22, %%zmm26              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm23, %%zmm27              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm24, %%zmm28              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm25, %%zmm29              \n\t"
-                         "vpmaddwd %%zmm26, %%zmm31, %%zmm26              \n\t"
-                         "vpmaddwd %%zmm27, %%zmm31, %%zmm27              \n\t"
-                         "vpmaddwd %%zmm28, %%zmm31, %%zmm28              \n\t"
-                         "vpmaddwd %%zmm29, %%zmm31, %%zmm29              \n\t"
-                         "vpaddd %%zmm4, %%zmm26, %%zmm4              \n\t"
-                         "vpaddd %%zmm5, %%zmm27, %%zmm5              \n\t"
-                         "vpaddd %%zmm6, %%zmm28, %%zmm6              \n\t"
-                         "vpaddd %%zmm7, %%zmm29, %%zmm7              \n\t"
-#endif
 
                          "add $0x40, %0                                  \n\t"
                          "add $0x40, %1                                 \n\t"
@@ -530,25 +370,10 @@ void mvm_avx512_8_row(U32 K,
                          "vmovdqu8 (%1, %7), %%zmm18 %{%%k1%}                             \n\t"
                          "vmovdqu8 (%%rax), %%zmm19 %{%%k1%}                            \n\t"
                          "vmovdqu8 (%%rax, %7), %%zmm20 %{%%k1%}                            \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%zmm16, %%zmm17, %%zmm0              \n\t"
                          "vpdpbusd %%zmm16, %%zmm18, %%zmm1              \n\t"
                          "vpdpbusd %%zmm16, %%zmm19, %%zmm2              \n\t"
                          "vpdpbusd %%zmm16, %%zmm20, %%zmm3              \n\t"
-#else
-                         "vpmaddubsw %%zmm16, %%zmm17, %%zmm26              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm18, %%zmm27              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm19, %%zmm28              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm20, %%zmm29              \n\t"
-                         "vpmaddwd %%zmm26, %%zmm31, %%zmm26              \n\t"
-                         "vpmaddwd %%zmm27, %%zmm31, %%zmm27              \n\t"
-                         "vpmaddwd %%zmm28, %%zmm31, %%zmm28              \n\t"
-                         "vpmaddwd %%zmm29, %%zmm31, %%zmm29              \n\t"
-                         "vpaddd %%zmm0, %%zmm26, %%zmm0              \n\t"
-                         "vpaddd %%zmm1, %%zmm27, %%zmm1              \n\t"
-                         "vpaddd %%zmm2, %%zmm28, %%zmm2              \n\t"
-                         "vpaddd %%zmm3, %%zmm29, %%zmm3              \n\t"
-#endif
 
                          "add %7, %%rax \n\t"
                          "add %7, %%rax \n\t"
@@ -559,25 +384,10 @@ void mvm_avx512_8_row(U32 K,
                          "vmovdqu8 (%%rax, %7), %%zmm23 %{%%k1%}                             \n\t"
                          "vmovdqu8 (%%rbx), %%zmm24 %{%%k1%}                             \n\t"
                          "vmovdqu8 (%%rbx, %7), %%zmm25 %{%%k1%}                            \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%zmm16, %%zmm22, %%zmm4              \n\t"
                          "vpdpbusd %%zmm16, %%zmm23, %%zmm5              \n\t"
                          "vpdpbusd %%zmm16, %%zmm24, %%zmm6              \n\t"
                          "vpdpbusd %%zmm16, %%zmm25, %%zmm7              \n\t"
-#else
-                         "vpmaddubsw %%zmm16, %%zmm22, %%zmm26              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm23, %%zmm27              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm24, %%zmm28              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm25, %%zmm29              \n\t"
-                         "vpmaddwd %%zmm26, %%zmm31, %%zmm26              \n\t"
-                         "vpmaddwd %%zmm27, %%zmm31, %%zmm27              \n\t"
-                         "vpmaddwd %%zmm28, %%zmm31, %%zmm28              \n\t"
-                         "vpmaddwd %%zmm29, %%zmm31, %%zmm29              \n\t"
-                         "vpaddd %%zmm4, %%zmm26, %%zmm4              \n\t"
-                         "vpaddd %%zmm5, %%zmm27, %%zmm5              \n\t"
-                         "vpaddd %%zmm6, %%zmm28, %%zmm6              \n\t"
-                         "vpaddd %%zmm7, %%zmm29, %%zmm7              \n\t"
-#endif
 
                          ".align 16                                      \n\t"
                          "3:                                             \n\t"
@@ -656,7 +466,7 @@ void mvm_avx512_8_row(U32 K,
                          "%zmm27", "%zmm28", "%zmm29", "%zmm30", "%zmm31", "memory");
 }
 
-void mvm_avx512_4_row(U32 K,
+X86_AVX512_TARGET static void mvm_avx512_4_row(U32 K,
     U32 bk,
     U64 kmask,
     UINT8 *matrix,
@@ -671,11 +481,6 @@ void mvm_avx512_4_row(U32 K,
                          "vxorps %%zmm1, %%zmm1, %%zmm1                     \n\t"
                          "vxorps %%zmm2, %%zmm2, %%zmm2                     \n\t"
                          "vxorps %%zmm3, %%zmm3, %%zmm3                     \n\t"
-#ifndef _USE_AVX512_VNNI
-                         "mov $1, %%eax \n\t"
-                         "vmovd %%eax, %%xmm26                    \n\t"
-                         "vpbroadcastw %%xmm26, %%zmm31            \n\t"
-#endif
                          "cmp $0x0, %%ecx                         \n\t"
                          "je 2f                                    \n\t"
                          ".align 16                                         \n\t"
@@ -688,25 +493,10 @@ void mvm_avx512_4_row(U32 K,
                          "vmovups (%1, %7), %%zmm18                             \n\t"
                          "vmovups (%%rax), %%zmm19                             \n\t"
                          "vmovups (%%rax, %7), %%zmm20                             \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%zmm16, %%zmm17, %%zmm0              \n\t"
                          "vpdpbusd %%zmm16, %%zmm18, %%zmm1              \n\t"
                          "vpdpbusd %%zmm16, %%zmm19, %%zmm2              \n\t"
                          "vpdpbusd %%zmm16, %%zmm20, %%zmm3              \n\t"
-#else
-                         "vpmaddubsw %%zmm16, %%zmm17, %%zmm26              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm18, %%zmm27              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm19, %%zmm28              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm20, %%zmm29              \n\t"
-                         "vpmaddwd %%zmm26, %%zmm31, %%zmm26              \n\t"
-                         "vpmaddwd %%zmm27, %%zmm31, %%zmm27              \n\t"
-                         "vpmaddwd %%zmm28, %%zmm31, %%zmm28              \n\t"
-                         "vpmaddwd %%zmm29, %%zmm31, %%zmm29              \n\t"
-                         "vpaddd %%zmm0, %%zmm26, %%zmm0              \n\t"
-                         "vpaddd %%zmm1, %%zmm27, %%zmm1              \n\t"
-                         "vpaddd %%zmm2, %%zmm28, %%zmm2              \n\t"
-                         "vpaddd %%zmm3, %%zmm29, %%zmm3              \n\t"
-#endif
 
                          "add $0x40, %0                                  \n\t"
                          "add $0x40, %1                                 \n\t"
@@ -729,25 +519,10 @@ void mvm_avx512_4_row(U32 K,
                          "vmovdqu8 (%1, %7), %%zmm18 %{%%k1%}                             \n\t"
                          "vmovdqu8 (%%rax), %%zmm19 %{%%k1%}                            \n\t"
                          "vmovdqu8 (%%rax, %7), %%zmm20 %{%%k1%}                            \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%zmm16, %%zmm17, %%zmm0              \n\t"
                          "vpdpbusd %%zmm16, %%zmm18, %%zmm1              \n\t"
                          "vpdpbusd %%zmm16, %%zmm19, %%zmm2              \n\t"
                          "vpdpbusd %%zmm16, %%zmm20, %%zmm3              \n\t"
-#else
-                         "vpmaddubsw %%zmm16, %%zmm17, %%zmm26              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm18, %%zmm27              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm19, %%zmm28              \n\t"
-                         "vpmaddubsw %%zmm16, %%zmm20, %%zmm29              \n\t"
-                         "vpmaddwd %%zmm26, %%zmm31, %%zmm26              \n\t"
-                         "vpmaddwd %%zmm27, %%zmm31, %%zmm27              \n\t"
-                         "vpmaddwd %%zmm28, %%zmm31, %%zmm28              \n\t"
-                         "vpmaddwd %%zmm29, %%zmm31, %%zmm29              \n\t"
-                         "vpaddd %%zmm0, %%zmm26, %%zmm0              \n\t"
-                         "vpaddd %%zmm1, %%zmm27, %%zmm1              \n\t"
-                         "vpaddd %%zmm2, %%zmm28, %%zmm2              \n\t"
-                         "vpaddd %%zmm3, %%zmm29, %%zmm3              \n\t"
-#endif
 
                          ".align 16                                      \n\t"
                          "3:                                             \n\t"
@@ -806,7 +581,7 @@ void mvm_avx512_4_row(U32 K,
                          "%zmm27", "%zmm28", "%zmm29", "%zmm30", "%zmm31", "memory");
 }
 
-void mvm_avx512_1_row(U32 K,
+X86_AVX512_TARGET static void mvm_avx512_1_row(U32 K,
     U32 bk,
     U64 kmask,
     UINT8 *matrix,
@@ -818,24 +593,13 @@ void mvm_avx512_1_row(U32 K,
     U32 flags)
 {
     __asm__ __volatile__("vxorps %%zmm0, %%zmm0, %%zmm0                     \n\t"
-#ifndef _USE_AVX512_VNNI
-                         "mov $1, %%eax \n\t"
-                         "vmovd %%eax, %%xmm26                    \n\t"
-                         "vpbroadcastw %%xmm26, %%zmm31            \n\t"
-#endif
                          "cmp $0x0, %%ecx                         \n\t"
                          "je 2f                                    \n\t"
                          ".align 16                                         \n\t"
                          "1:                                      \n\t"
                          "vmovups (%0), %%zmm16                     \n\t"
                          "vmovups (%1), %%zmm17                             \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%zmm16, %%zmm17, %%zmm0              \n\t"
-#else
-                         "vpmaddubsw %%zmm16, %%zmm17, %%zmm26              \n\t"
-                         "vpmaddwd %%zmm26, %%zmm31, %%zmm26              \n\t"
-                         "vpaddd %%zmm0, %%zmm26, %%zmm0              \n\t"
-#endif
 
                          "add $0x40, %0                                  \n\t"
                          "add $0x40, %1                                 \n\t"
@@ -852,13 +616,7 @@ void mvm_avx512_1_row(U32 K,
                          "vxorps %%zmm16, %%zmm16, %%zmm16                     \n\t"
                          "vmovdqu8 (%0), %%zmm16 %{%%k1%}                     \n\t"
                          "vmovdqu8 (%1), %%zmm17 %{%%k1%}                             \n\t"
-#ifdef _USE_AVX512_VNNI
                          "vpdpbusd %%zmm16, %%zmm17, %%zmm0              \n\t"
-#else
-                         "vpmaddubsw %%zmm16, %%zmm17, %%zmm26              \n\t"
-                         "vpmaddwd %%zmm26, %%zmm31, %%zmm26              \n\t"
-                         "vpaddd %%zmm0, %%zmm26, %%zmm0              \n\t"
-#endif
 
                          ".align 16                                      \n\t"
                          "3:                                             \n\t"
@@ -915,7 +673,7 @@ void mvm_avx512_1_row(U32 K,
                          "%zmm27", "%zmm28", "%zmm29", "%zmm30", "%zmm31", "memory");
 }
 
-inline void transpose(UINT8 *matrix, UINT8 *transMatrix, U32 N, U32 K)
+static inline void transpose(UINT8 *matrix, UINT8 *transMatrix, U32 N, U32 K)
 {
     U32 blockSizeN = 0;
     for (U32 n = 0; n < N; n += blockSizeN) {
@@ -928,14 +686,8 @@ inline void transpose(UINT8 *matrix, UINT8 *transMatrix, U32 N, U32 K)
     }
 }
 
-EE mvm_avx512_int8_row_i8u8(U32 numRows,
-    U32 numColumns,
-    DataFormat df,
-    UINT8 *packB,
-    INT8 *vector,
-    UINT8 *result,
-    I32 *tmp,
-    const F32 *scale)
+// sum of the int8 vector
+X86_AVX512_TARGET static I32 sum_avx512(INT8 *vector, U32 numColumns)
 {
     I32 offsetC = 0;
     U32 num64 = numColumns / 16;
@@ -980,6 +732,19 @@ EE mvm_avx512_int8_row_i8u8(U32 numRows,
                          :
                          : "r"(vector), "r"(&offsetC), "r"(num64), "a"(resMask)
                          : "%k2", "%ebx", "%rdx", "%zmm0", "%zmm1", "%zmm2", "memory", "cc");
+    return offsetC;
+}
+
+EE mvm_avx512_int8_row_i8u8(U32 numRows,
+    U32 numColumns,
+    DataFormat df,
+    UINT8 *packB,
+    INT8 *vector,
+    UINT8 *result,
+    I32 *tmp,
+    const F32 *scale)
+{
+    I32 offsetC = sum_avx512(vector, numColumns);
     offsetC *= -128;
     if (df == DF_TRANSPOSE) {
         transpose(packB, (UINT8 *)tmp, numRows, numColumns);
@@ -1009,8 +774,8 @@ EE mvm_avx512_int8_row_i8u8(U32 numRows,
     for (U32 k = 0; k < numColumns; k += blockSizeK) {
         blockSizeK = numColumns;
         flags |= (k > 0);
-        num64 = blockSizeK / 64;
-        resMask = 1;
+        U32 num64 = blockSizeK / 64;
+        U64 resMask = 1;
         resMask = (resMask << (blockSizeK % 64)) - 1;
         F32 *useFactor = nullptr;
         if (k == numColumns - blockSizeK) {
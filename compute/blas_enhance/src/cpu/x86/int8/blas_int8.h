@@ -15,11 +15,13 @@
 #define _H_BLAS_INT8
 
 #include "cpu/x86/int8/blas_common_int8.h"
+#include "thread_affinity.h"
 
+// avx_vnni kernels
 void matrix_matrix_multiply_tmp_bytes_int8(
     U32 M, U32 N, U32 K, DataFormat matrixA_df, DataFormat matrixB_df, U32 *bytes);
 
-EE mmm_avx512_vnni_int8(U32 M,
+EE mmm_avx_vnni_int8(U32 M,
     U32 N,
     U32 K,
     DataFormat matrixADataFormat,
@@ -29,7 +31,7 @@ EE mmm_avx512_vnni_int8(U32 M,
     UINT8 *result,
     const F32 *scale);
 
-EE mvm_avx512_int8(U32 numRows,
+EE mvm_avx_vnni_int8(U32 numRows,
     U32 numColumns,
     INT8 *packB,
     UINT8 *vector,
@@ -37,7 +39,7 @@ EE mvm_avx512_int8(U32 numRows,
     I32 *offsetCBias,
     const F32 *scale);
 
-EE mvm_avx512_int8_row_i8u8(U32 numRows,
+EE mvm_avx_vnni_int8_row_i8u8(U32 numRows,
     U32 numColumns,
     DataFormat df,
     UINT8 *packB,
@@ -56,4 +58,51 @@ EE matrix_matrix_multiply_transform_rhsN_int8(TensorDesc desc, INT8 *src, INT8 *
 
 EE matrix_matrix_multiply_transform_rhsT_int8(TensorDesc desc, INT8 *src, INT8 *dst);
 
+// avx512_vnni kernels are built into every x86 library and selected at run time, they pack
+// matrices with wider blocks than avx_vnni ones, so packing and kernels are selected together.
+inline bool use_avx512_int8()
+{
+    return get_x86_features() & X86_AVX512_VNNI;
+}
+
+void matrix_matrix_multiply_tmp_bytes_avx512_int8(
+    U32 M, U32 N, U32 K, DataFormat matrixA_df, DataFormat matrixB_df, U32 *bytes);
+
+EE mmm_avx512_vnni_int8(U32 M,
+    U32 N,
+    U32 K,
+    DataFormat matrixADataFormat,
+    UINT8 *matrix1,
+    INT8 *matrix2,
+    UINT8 *tmp,
+    UINT8 *result,
+    const F32 *scale);
+
+EE mvm_avx512_int8(U32 numRows,
+    U32 numColumns,
+    INT8 *packB,
+    UINT8 *vector,
+    UINT8 *result,
+    I32 *offsetCBias,
+    const F32 *scale);
+
+EE mvm_avx512_int8_row_i8u8(U32 numRows,
+    U32 numColumns,
+    DataFormat df,
+    UINT8 *packB,
+    INT8 *vector,
+    UINT8 *result,
+    I32 *tmp,
+    const F32 *scale);
+
+EE matrix_vector_multiply_transform_weight_avx512_int8(
+    TensorDesc desc, INT8 *src, INT8 *packB, I32 *offsetCBias);
+
+void matrix_matrix_multiply_transform_rhs_bytes_avx512_int8(
+    U32 N, U32 K, DataFormat matrixB_df, U32 *bytes, U32 *rhsBytes);
+
+EE matrix_matrix_multiply_transform_rhsN_avx512_int8(TensorDesc desc, INT8 *src, INT8 *dst);
+
+EE matrix_matrix_multiply_transform_rhsT_avx512_int8(TensorDesc desc, INT8 *src, INT8 *dst);
+
 #endif
@@ -27,12 +27,32 @@ EE matrix_matrix_multiply_tmp_bytes_x86(U32 matrixC_N,
     DataFormat adf,
     DataType bdt,
     DataFormat bdf,
-    U32 *bytes)
+    U32 *bytes,
+    Arch arch)
 {
     EE ret = SUCCESS;
     switch (adt) {
 #ifdef _USE_FP32
         case DT_F32: {
+            if (bdf == DF_NKN16_BSR || bdf == DF_NKN8_2_4) {
+                matrix_matrix_multiply_tmp_bytes_sparse(
+                    matrixC_N, matrixC_M, matrixA_K, adf, bytes);
+                break;
+            }
+            if (bdt == DT_BF16) {
+                matrix_matrix_multiply_tmp_bytes_bf16(matrixC_N, matrixC_M, matrixA_K, bdf, bytes);
+                break;
+            }
+            if (bdt == DT_I4) {
+                matrix_matrix_multiply_tmp_bytes_int4(matrixC_N, matrixC_M, matrixA_K, adf, bytes);
+                break;
+            }
+            // packed matrix runs on the kernel it is packed for
+            if (bdf == DF_NKN32K512 || (bdf != DF_NKN8 && use_avx512_fp32(arch))) {
+                matrix_matrix_multiply_tmp_bytes_avx512_fp32(
+                    matrixC_N, matrixC_M, matrixA_K, adf, bdf, bytes);
+                break;
+            }
             matrix_matrix_multiply_tmp_bytes_fp32(matrixC_N, matrixC_M, matrixA_K, adf, bdf, bytes);
             break;
         }
@@ -40,6 +60,11 @@ EE matrix_matrix_multiply_tmp_bytes_x86(U32 matrixC_N,
 #if defined(_USE_INT8)
         case DT_U8_Q:
         case DT_I8: {
+            if (use_avx512_int8()) {
+                matrix_matrix_multiply_tmp_bytes_avx512_int8(
+                    matrixC_N, matrixC_M, matrixA_K, adf, bdf, bytes);
+                break;
+            }
             matrix_matrix_multiply_tmp_bytes_int8(matrixC_N, matrixC_M, matrixA_K, adf, bdf, bytes);
             break;
         }
@@ -51,21 +76,44 @@ EE matrix_matrix_multiply_tmp_bytes_x86(U32 matrixC_N,
     return ret;
 }
 
-EE matrix_matrix_multiply_transform_rhs_bytes_x86(
-    U32 matrixC_N, U32 matrixA_K, DataType bdt, DataFormat bdf, U32 *bytes, U32 *rhsBytes)
+EE matrix_matrix_multiply_transform_rhs_bytes_x86(U32 matrixC_N,
+    U32 matrixA_K,
+    DataType bdt,
+    DataFormat bdf,
+    U32 *bytes,
+    U32 *rhsBytes,
+    Arch arch)
 {
     EE ret = SUCCESS;
     switch (bdt) {
 #ifdef _USE_FP32
         case DT_F32: {
+            if (use_avx512_fp32(arch)) {
+                matrix_matrix_multiply_transform_rhs_bytes_avx512_fp32(
+                    matrixC_N, matrixA_K, bdf, bytes, rhsBytes);
+                break;
+            }
             matrix_matrix_multiply_transform_rhs_bytes_fp32(
                 matrixC_N, matrixA_K, bdf, bytes, rhsBytes);
             break;
         }
+        case DT_BF16: {
+            matrix_matrix_multiply_transform_rhs_bytes_bf16(matrixC_N, matrixA_K, bytes, rhsBytes);
+            break;
+        }
+        case DT_I4: {
+            matrix_matrix_multiply_transform_rhs_bytes_int4(matrixC_N, matrixA_K, bytes, rhsBytes);
+            break;
+        }
 #endif
 #if defined(_USE_INT8)
         case DT_U8_Q:
         case DT_I8: {
+            if (use_avx512_int8()) {
+                matrix_matrix_multiply_transform_rhs_bytes_avx512_int8(
+                    matrixC_N, matrixA_K, bdf, bytes, rhsBytes);
+                break;
+            }
             matrix_matrix_multiply_transform_rhs_bytes_int8(
                 matrixC_N, matrixA_K, bdf, bytes, rhsBytes);
             break;
@@ -79,18 +127,37 @@ EE matrix_matrix_multiply_transform_rhs_bytes_x86(
 }
 
 static EE matrix_matrix_multiply_transform_rhsN(
-    TensorDesc desc, const void *src, TensorDesc *descTran, void *dst)
+    TensorDesc desc, const void *src, TensorDesc *descTran, void *dst, Arch arch)
 {
     EE ret = NOT_SUPPORTED;
     switch (desc.dt) {
 #ifdef _USE_FP32
         case DT_F32: {
+            if (use_avx512_fp32(arch)) {
+                ret = matrix_matrix_multiply_transform_rhsN_avx512_fp32(
+                    desc, (F32 *)src, (F32 *)dst);
+                break;
+            }
             ret = matrix_matrix_multiply_transform_rhsN_fp32(desc, (F32 *)src, (F32 *)dst);
             break;
         }
+        case DT_BF16: {
+            DataType dt;
+            DataFormat df;
+            U32 N, K;
+            CHECK_STATUS(tensor2dGet(desc, &dt, &df, &K, &N));
+            matrix_matrix_multiply_transform_rhs_bf16(N, K, N, 1, (U16 *)src, (U16 *)dst);
+            ret = SUCCESS;
+            break;
+        }
 #endif
 #if defined(_USE_INT8)
         case DT_I8: {
+            if (use_avx512_int8()) {
+                ret = matrix_matrix_multiply_transform_rhsN_avx512_int8(
+                    desc, (INT8 *)src, (INT8 *)dst);
+                break;
+            }
             ret = matrix_matrix_multiply_transform_rhsN_int8(desc, (INT8 *)src, (INT8 *)dst);
             break;
         }
@@ -99,23 +166,42 @@ static EE matrix_matrix_multiply_transform_rhsN(
             break;
     }
     (*descTran) = desc;
-    (*descTran).df = matrix_matrix_multiply_rhs_format(desc.dt);
+    (*descTran).df = matrix_matrix_multiply_transform_rhs_format(desc.dt, arch);
     return ret;
 }
 
 static EE matrix_matrix_multiply_transform_rhsT(
-    TensorDesc desc, const void *src, TensorDesc *descTran, void *dst)
+    TensorDesc desc, const void *src, TensorDesc *descTran, void *dst, Arch arch)
 {
     EE ret = NOT_SUPPORTED;
     switch (desc.dt) {
 #ifdef _USE_FP32
         case DT_F32: {
+            if (use_avx512_fp32(arch)) {
+                ret = matrix_matrix_multiply_transform_rhsT_avx512_fp32(
+                    desc, (F32 *)src, (F32 *)dst);
+                break;
+            }
             ret = matrix_matrix_multiply_transform_rhsT_fp32(desc, (F32 *)src, (F32 *)dst);
             break;
         }
+        case DT_BF16: {
+            DataType dt;
+            DataFormat df;
+            U32 N, K;
+            CHECK_STATUS(tensor2dGet(desc, &dt, &df, &N, &K));
+            matrix_matrix_multiply_transform_rhs_bf16(N, K, 1, K, (U16 *)src, (U16 *)dst);
+            ret = SUCCESS;
+            break;
+        }
 #endif
 #if defined(_USE_INT8)
         case DT_I8: {
+            if (use_avx512_int8()) {
+                ret = matrix_matrix_multiply_transform_rhsT_avx512_int8(
+                    desc, (INT8 *)src, (INT8 *)dst);
+                break;
+            }
             ret = matrix_matrix_multiply_transform_rhsT_int8(desc, (INT8 *)src, (INT8 *)dst);
             break;
         }
@@ -124,25 +210,25 @@ static EE matrix_matrix_multiply_transform_rhsT(
             break;
     }
     (*descTran) = desc;
-    (*descTran).df = matrix_matrix_multiply_rhs_format(desc.dt);
+    (*descTran).df = matrix_matrix_multiply_transform_rhs_format(desc.dt, arch);
     std::swap(descTran->dims[0], descTran->dims[1]);
     return ret;
 }
 
 EE matrix_matrix_multiply_transform_rhs_x86(
-    TensorDesc desc, const void *src, TensorDesc *descTran, void *dst)
+    TensorDesc desc, const void *src, TensorDesc *descTran, void *dst, Arch arch)
 {
-    if (desc.df == matrix_matrix_multiply_rhs_format(desc.dt)) {
+    if (matrix_matrix_multiply_rhs_transformed(desc.dt, desc.df)) {
         return SUCCESS;
     }
     EE ret = NOT_SUPPORTED;
     switch (desc.df) {
         case DF_NORMAL: {
-            ret = matrix_matrix_multiply_transform_rhsN(desc, src, descTran, dst);
+            ret = matrix_matrix_multiply_transform_rhsN(desc, src, descTran, dst, arch);
             break;
         }
         case DF_TRANSPOSE: {
-            ret = matrix_matrix_multiply_transform_rhsT(desc, src, descTran, dst);
+            ret = matrix_matrix_multiply_transform_rhsT(desc, src, descTran, dst, arch);
             break;
         }
         default:
@@ -151,29 +237,119 @@ EE matrix_matrix_multiply_transform_rhs_x86(
     return ret;
 }
 
+EE matrix_matrix_multiply_transform_rhs_int4_x86(TensorDesc desc,
+    const void *src,
+    const F32 *scale,
+    U32 group,
+    TensorDesc *descTran,
+    void *dst)
+{
+    EE ret = NOT_SUPPORTED;
+#ifdef _USE_FP32
+    if (desc.dt == DT_I4 && desc.df == DF_TRANSPOSE) {
+        DataType dt;
+        DataFormat df;
+        U32 N, K;
+        CHECK_STATUS(tensor2dGet(desc, &dt, &df, &N, &K));
+        ret = matrix_matrix_multiply_pack_rhs_int4(N, K, (const U8 *)src, scale, group, (U8 *)dst);
+        *descTran = tensor2df(DT_I4, matrix_matrix_multiply_rhs_format(DT_I4), K, N);
+    }
+#endif
+    return ret;
+}
+
+EE matrix_matrix_multiply_transform_rhs_sparse_bytes_x86(
+    TensorDesc desc, const void *src, DataFormat *df, U32 *bytes)
+{
+    EE ret = NOT_SUPPORTED;
+#ifdef _USE_FP32
+    if (desc.dt == DT_F32 && desc.df == DF_TRANSPOSE) {
+        DataType dt;
+        DataFormat tdf;
+        U32 N, K;
+        CHECK_STATUS(tensor2dGet(desc, &dt, &tdf, &N, &K));
+        ret = matrix_matrix_multiply_transform_rhs_bytes_sparse(
+            N, K, (const F32 *)src, df, bytes);
+    }
+#endif
+    return ret;
+}
+
+EE matrix_matrix_multiply_transform_rhs_sparse_x86(
+    TensorDesc desc, const void *src, DataFormat df, TensorDesc *descTran, void *dst)
+{
+    EE ret = NOT_SUPPORTED;
+#ifdef _USE_FP32
+    if (desc.dt == DT_F32 && desc.df == DF_TRANSPOSE) {
+        DataType dt;
+        DataFormat tdf;
+        U32 N, K, bytes;
+        CHECK_STATUS(tensor2dGet(desc, &dt, &tdf, &N, &K));
+        CHECK_STATUS(
+            matrix_matrix_multiply_transform_rhs_bytes_sparse(N, K, (const F32 *)src, &tdf, &bytes));
+        ret = matrix_matrix_multiply_transform_rhs_sparse(N, K, (const F32 *)src, df, (U8 *)dst);
+        *descTran = tensor2df(DT_F32, df, K, N);
+        descTran->dims[2] = bytes;
+    }
+#endif
+    return ret;
+}
+
 EE mmm_x86(U32 matrixC_N,
     U32 matrixC_M,
     U32 matrixA_K,
     DataType dt,
     DataFormat matrixADataFormat,
     const void *matrixAData,
+    DataFormat matrixBDataFormat,
     const void *matrixBData,
     void *tmp,
     void *matrixCData,
-    const F32 *scale)
+    const F32 *scale,
+    Arch arch)
 {
     EE ret = NOT_SUPPORTED;
     switch (dt) {
 #ifdef _USE_FP32
         case DT_F32: {
+            if (matrixBDataFormat == DF_NKN16_BSR || matrixBDataFormat == DF_NKN8_2_4) {
+                ret = mmm_sparse(matrixC_N, matrixC_M, matrixA_K, matrixADataFormat,
+                    (F32 *)matrixAData, matrixBDataFormat, (U8 *)matrixBData, tmp,
+                    (F32 *)matrixCData, arch);
+                break;
+            }
+            if (matrixBDataFormat == DF_NKN32K512) {
+                if (!(get_x86_features() & X86_AVX512F)) {
+                    UNI_ERROR_LOG("matrix packed for AVX-512 can not run on this processor.\n");
+                }
+                ret = mmm_avx512_fp32(matrixC_N, matrixC_M, matrixA_K, matrixADataFormat,
+                    (F32 *)matrixAData, (F32 *)matrixBData, (F32 *)tmp, (F32 *)matrixCData);
+                break;
+            }
             ret = mmm_avx2_fp32(matrixC_N, matrixC_M, matrixA_K, matrixADataFormat,
                 (F32 *)matrixAData, (F32 *)matrixBData, (F32 *)tmp, (F32 *)matrixCData);
             break;
         }
+        case DT_BF16: {
+            ret = mmm_bf16(matrixC_N, matrixC_M, matrixA_K, matrixADataFormat, (F32 *)matrixAData,
+                (U16 *)matrixBData, tmp, (F32 *)matrixCData, arch);
+            break;
+        }
+        case DT_I4: {
+            ret = mmm_int4(matrixC_N, matrixC_M, matrixA_K, matrixADataFormat, (F32 *)matrixAData,
+                (U8 *)matrixBData, tmp, (F32 *)matrixCData, arch);
+            break;
+        }
 #endif
 #if defined(_USE_INT8)
         case DT_I8: {
-            ret = mmm_avx512_vnni_int8(matrixC_N, matrixC_M, matrixA_K, matrixADataFormat,
+            if (use_avx512_int8()) {
+                ret = mmm_avx512_vnni_int8(matrixC_N, matrixC_M, matrixA_K, matrixADataFormat,
+                    (UINT8 *)matrixAData, (INT8 *)matrixBData, (UINT8 *)tmp,
+                    (UINT8 *)matrixCData, scale);
+                break;
+            }
+            ret = mmm_avx_vnni_int8(matrixC_N, matrixC_M, matrixA_K, matrixADataFormat,
                 (UINT8 *)matrixAData, (INT8 *)matrixBData, (UINT8 *)tmp, (UINT8 *)matrixCData,
                 scale);
             break;
@@ -54,10 +54,30 @@ EE matrix_vector_multiply_transform_weight_x86(
             ret = matrix_vector_multiply_transform_weight_fp32(desc, (F32 *)src, (F32 *)dst);
             break;
         }
+        case DT_BF16: {
+            // the same packed layout as mmm, mvm is a 1 row mmm.
+            DataType dt;
+            DataFormat df;
+            U32 N, K;
+            if (desc.df == DF_TRANSPOSE) {
+                CHECK_STATUS(tensor2dGet(desc, &dt, &df, &K, &N));
+                matrix_matrix_multiply_transform_rhs_bf16(N, K, N, 1, (U16 *)src, (U16 *)dst);
+            } else {
+                CHECK_STATUS(tensor2dGet(desc, &dt, &df, &N, &K));
+                matrix_matrix_multiply_transform_rhs_bf16(N, K, 1, K, (U16 *)src, (U16 *)dst);
+            }
+            ret = SUCCESS;
+            break;
+        }
 #endif
 #if defined(_USE_INT8)
         case DT_U8_Q:
         case DT_I8: {
+            if (use_avx512_int8()) {
+                ret = matrix_vector_multiply_transform_weight_avx512_int8(
+                    desc, (INT8 *)src, (INT8 *)dst, (I32 *)offsetCBias);
+                break;
+            }
             ret = matrix_vector_multiply_transform_weight_int8(
                 desc, (INT8 *)src, (INT8 *)dst, (I32 *)offsetCBias);
             break;
@@ -85,6 +105,12 @@ EE matrix_vector_multiply_tmp_bytes_x86(U32 row, U32 col, DataType dt, DataForma
         case DT_F32:
             *bytes = 0;
             break;
+        case DT_BF16:
+            matrix_matrix_multiply_tmp_bytes_bf16(row, 1, col, DF_NKNxKx, bytes);
+            break;
+        case DT_I4:
+            matrix_matrix_multiply_tmp_bytes_int4(row, 1, col, DF_NORMAL, bytes);
+            break;
 #endif
 #if defined(_USE_INT8)
         case DT_I8:
@@ -107,26 +133,57 @@ EE mvm_x86(U32 row,
     const void *vector,
     void *result,
     void *offsetCBias,
-    const F32 *scale)
+    const F32 *scale,
+    Arch arch)
 {
     EE ret = NOT_SUPPORTED;
     switch (dt) {
 #ifdef _USE_FP32
         case DT_F32: {
+            if (use_avx512_fp32(arch)) {
+                ret = mvm_avx512_fp32(row, col, df, (F32 *)matrix, (F32 *)vector, (F32 *)result);
+                break;
+            }
             ret = mvm_avx2_fp32(row, col, df, (F32 *)matrix, (F32 *)vector, (F32 *)result);
             break;
         }
+        case DT_BF16: {
+            if (df == matrix_vector_multiply_weight_format(dt)) {
+                ret = mmm_bf16(row, 1, col, DF_NORMAL, (F32 *)vector, (U16 *)matrix, offsetCBias,
+                    (F32 *)result, arch);
+            }
+            break;
+        }
+        case DT_I4: {
+            // int4 weight can only be packed with its scales by
+            // matrix_matrix_multiply_transform_rhs_int4.
+            if (df == matrix_vector_multiply_weight_format(dt)) {
+                ret = mmm_int4(row, 1, col, DF_NORMAL, (F32 *)vector, (U8 *)matrix, offsetCBias,
+                    (F32 *)result, arch);
+            }
+            break;
+        }
 #endif
 #if defined(_USE_INT8)
         case DT_I8: {
             CHECK_REQUIREMENT(offsetCBias != nullptr);
-            ret = mvm_avx512_int8(row, col, (INT8 *)matrix, (UINT8 *)vector, (UINT8 *)result,
+            if (use_avx512_int8()) {
+                ret = mvm_avx512_int8(row, col, (INT8 *)matrix, (UINT8 *)vector, (UINT8 *)result,
+                    (I32 *)offsetCBias, scale);
+                break;
+            }
+            ret = mvm_avx_vnni_int8(row, col, (INT8 *)matrix, (UINT8 *)vector, (UINT8 *)result,
                 (I32 *)offsetCBias, scale);
             break;
         }
         case DT_U8_Q: {
             CHECK_REQUIREMENT(offsetCBias != nullptr);
-            ret = mvm_avx512_int8_row_i8u8(row, col, df, (UINT8 *)matrix, (INT8 *)vector,
+            if (use_avx512_int8()) {
+                ret = mvm_avx512_int8_row_i8u8(row, col, df, (UINT8 *)matrix, (INT8 *)vector,
+                    (UINT8 *)result, (I32 *)offsetCBias, scale);
+                break;
+            }
+            ret = mvm_avx_vnni_int8_row_i8u8(row, col, df, (UINT8 *)matrix, (INT8 *)vector,
                 (UINT8 *)result, (I32 *)offsetCBias, scale);
             break;
         }
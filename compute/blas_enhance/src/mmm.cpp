@@ -21,6 +21,9 @@
 #endif
 #ifdef _USE_X86
 #include "cpu/x86/blas_x86.h"
+#ifdef _USE_FP32
+#include "cpu/x86/fp32/blas_fp32.h"
+#endif
 #endif
 
 EE matrix_matrix_multiply_tmp_bytes(
@@ -47,7 +50,7 @@ EE matrix_matrix_multiply_tmp_bytes(
 #ifdef _USE_X86
     } else if (IS_X86(arch)) {
         ret = matrix_matrix_multiply_tmp_bytes_x86(matrixB_N, matrixA_M, matrixB_K, matrixADataType,
-            matrixADataFormat, matrixBDataType, matrixBDataFormat, bytes);
+            matrixADataFormat, matrixBDataType, matrixBDataFormat, bytes, arch);
 #endif
 #ifdef _USE_NEON
     } else if (IS_ARM(arch)) {
@@ -70,7 +73,8 @@ DataFormat matrix_matrix_multiply_rhs_format(DataType dt)
 #endif
             break;
         }
-        case DT_BF16: {
+        case DT_BF16:
+        case DT_I4: {
             ret = DF_NKNxKx;
             break;
         }
@@ -94,6 +98,30 @@ DataFormat matrix_matrix_multiply_rhs_format(DataType dt)
     return ret;
 }
 
+DataFormat matrix_matrix_multiply_transform_rhs_format(DataType dt, Arch arch)
+{
+#if defined(_USE_X86) && defined(_USE_FP32)
+    if (dt == DT_F32 && use_avx512_fp32(arch)) {
+        return DF_NKN32K512;
+    }
+#endif
+    return matrix_matrix_multiply_rhs_format(dt);
+}
+
+bool matrix_multiply_use_avx512(DataType dt, Arch arch)
+{
+    bool ret = false;
+#if defined(_USE_X86) && defined(_USE_FP32)
+    ret = (dt == DT_BF16) ? use_avx512_bf16(arch) : use_avx512_fp32(arch);
+#endif
+    return ret;
+}
+
+bool matrix_matrix_multiply_rhs_transformed(DataType dt, DataFormat df)
+{
+    return df == matrix_matrix_multiply_rhs_format(dt) || (dt == DT_F32 && df == DF_NKN32K512);
+}
+
 EE matrix_matrix_multiply_transform_rhs_bytes(
     TensorDesc matrixBDesc, U32 *bytes, U32 *rhsBytes, Arch arch)
 {
@@ -114,7 +142,7 @@ EE matrix_matrix_multiply_transform_rhs_bytes(
 #ifdef _USE_X86
     } else if (IS_X86(arch)) {
         ret = matrix_matrix_multiply_transform_rhs_bytes_x86(
-            matrixB_N, matrixB_K, matrixBDataType, matrixBDataFormat, bytes, rhsBytes);
+            matrixB_N, matrixB_K, matrixBDataType, matrixBDataFormat, bytes, rhsBytes, arch);
 #endif
 #ifdef _USE_NEON
     } else if (IS_ARM(arch)) {
@@ -141,9 +169,50 @@ EE matrix_matrix_multiply_transform_rhs(
 #endif
 #ifdef _USE_X86
     } else if (IS_X86(arch)) {
-        ret = matrix_matrix_multiply_transform_rhs_x86(desc, src, descTran, dst);
+        ret = matrix_matrix_multiply_transform_rhs_x86(desc, src, descTran, dst, arch);
+#endif
+    }
+    return ret;
+}
+
+EE matrix_matrix_multiply_transform_rhs_int4(TensorDesc desc,
+    const void *src,
+    const F32 *scale,
+    U32 group,
+    TensorDesc *descTran,
+    void *dst,
+    Arch arch)
+{
+    EE ret = NOT_SUPPORTED;
+#ifdef _USE_X86
+    if (IS_X86(arch)) {
+        ret = matrix_matrix_multiply_transform_rhs_int4_x86(desc, src, scale, group, descTran, dst);
+    }
 #endif
+    return ret;
+}
+
+EE matrix_matrix_multiply_transform_rhs_sparse_bytes(
+    TensorDesc desc, const void *src, DataFormat *df, U32 *bytes, Arch arch)
+{
+    EE ret = NOT_SUPPORTED;
+#ifdef _USE_X86
+    if (IS_X86(arch)) {
+        ret = matrix_matrix_multiply_transform_rhs_sparse_bytes_x86(desc, src, df, bytes);
+    }
+#endif
+    return ret;
+}
+
+EE matrix_matrix_multiply_transform_rhs_sparse(
+    TensorDesc desc, const void *src, DataFormat df, TensorDesc *descTran, void *dst, Arch arch)
+{
+    EE ret = NOT_SUPPORTED;
+#ifdef _USE_X86
+    if (IS_X86(arch)) {
+        ret = matrix_matrix_multiply_transform_rhs_sparse_x86(desc, src, df, descTran, dst);
     }
+#endif
     return ret;
 }
 
@@ -179,7 +248,9 @@ EE matrix_matrix_multiply(TensorDesc matrixADesc,
         tensor2dGet(matrixCDesc, &matrixCDataType, &matrixCDataFormat, &matrixC_M, &matrixC_N));
 
     if (matrixADataType != matrixBDataType) {
-        if (!(matrixADataType == DT_U8_Q && matrixBDataType == DT_I8)) {
+        if (!(matrixADataType == DT_U8_Q && matrixBDataType == DT_I8) &&
+            !(matrixADataType == DT_F32 && matrixBDataType == DT_BF16) &&
+            !(matrixADataType == DT_F32 && matrixBDataType == DT_I4)) {
             CHECK_STATUS(NOT_MATCH);
         }
     }
@@ -205,7 +276,9 @@ EE matrix_matrix_multiply(TensorDesc matrixADesc,
 #endif
         } else {
             auto transB = matrixBData;
-            if (matrixBDataFormat != matrix_matrix_multiply_rhs_format(matrixBDataType)) {
+            bool sparseB = (matrixBDataFormat == DF_NKN16_BSR || matrixBDataFormat == DF_NKN8_2_4);
+            if (!sparseB &&
+                !matrix_matrix_multiply_rhs_transformed(matrixBDataType, matrixBDataFormat)) {
                 U32 transBBytes = 0;
                 CHECK_STATUS(matrix_matrix_multiply_transform_rhs_bytes(
                     matrixBDesc, nullptr, &transBBytes, arch));
@@ -216,6 +289,7 @@ EE matrix_matrix_multiply(TensorDesc matrixADesc,
                     matrixBDesc, matrixBData, &transBDesc, tmp, arch));
                 transB = tmp;
                 tmp = (U8 *)tmp + transBBytes;
+                matrixBDataFormat = transBDesc.df;
             }
 #ifdef _USE_X86
             if (IS_X86(arch)) {
@@ -223,7 +297,7 @@ EE matrix_matrix_multiply(TensorDesc matrixADesc,
                     scale = nullptr;
                 }
                 ret = mmm_x86(matrixC_N, matrixC_M, matrixA_K, matrixBDataType, matrixADataFormat,
-                    matrixAData, transB, tmp, matrixCData, scale);
+                    matrixAData, matrixBDataFormat, transB, tmp, matrixCData, scale, arch);
             }
 #endif
 #ifdef _USE_NEON
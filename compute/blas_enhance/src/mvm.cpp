@@ -60,6 +60,11 @@ DataFormat matrix_vector_multiply_weight_format(DataType dt)
             ret = DF_NKN64;
             break;
         }
+        case DT_BF16:
+        case DT_I4: {
+            ret = DF_NKNxKx;
+            break;
+        }
         case DT_F32: {
             ret = DF_NKN16;
             break;
@@ -182,7 +187,7 @@ EE matrix_vector_multiply(TensorDesc matrixDesc,
         }
 #endif
         ret = mvm_x86(matrixRow, matrixColumn, matrixDataType, matrixDataFormat, dataB, vector,
-            result, tmp, scale);
+            result, tmp, scale, arch);
 #endif
 #ifdef _USE_NEON
     } else if (IS_ARM(arch)) {
@@ -13,6 +13,30 @@
 
 #include "blas_enhance.h"
 #include "ut_util.h"
+#ifdef _USE_X86
+#include "thread_affinity.h"
+#endif
+
+// whether fp32 matrix multiply with weight of type dt runs AVX-512 kernels, it is checked against
+// the cpu features on x86, X86_AVX2 always runs the AVX2 kernels.
+bool useAvx512(DataType dt, Arch arch)
+{
+    bool ret = false;
+#ifdef _USE_X86
+    U32 feature = (dt == DT_BF16) ? X86_AVX512_BF16 : X86_AVX512F;
+    ret = arch != X86_AVX2 && (get_x86_features() & feature);
+    CHECK_REQUIREMENT(matrix_multiply_use_avx512(dt, arch) == ret);
+#endif
+    return ret;
+}
+
+const char *kernelPath(bool avx512, Arch arch)
+{
+    if (!IS_X86(arch)) {
+        return "";
+    }
+    return avx512 ? " AVX-512" : " AVX2";
+}
 
 void mmmTestKernel(U32 m,
     U32 k,
@@ -23,12 +47,16 @@ void mmmTestKernel(U32 m,
     bool transform,
     bool at,
     bool bt,
-    bool log = true)
+    bool log = true,
+    Arch arch = UT_ARCH)
 {
     float threshold = 0.0001;
     if (odt == DT_F16) {
         threshold = 1;
     }
+    if (bdt == DT_BF16) {
+        threshold = 0.01 * sqrt(k);
+    }
 
     TensorDesc A_desc, B_desc;
     if (at) {
@@ -48,6 +76,13 @@ void mmmTestKernel(U32 m,
     U8 *A_ref = ut_input_v(m * k, adt, UT_INIT_ZERO);
     UNI_MEMCPY(A_ref, A, m * k * bytesOf(adt));
     U8 *B = ut_input_v(k * n, bdt, UT_INIT_RANDOM);
+    TensorDesc B_ref_desc = B_desc;
+    U8 *B_ref = B;
+    if (bdt == DT_BF16) {
+        B_ref_desc.dt = DT_F32;
+        B_ref = ut_input_v(k * n, DT_F32, UT_INIT_ZERO);
+        transformToFloat(DT_BF16, B, (F32 *)B_ref, k * n);
+    }
     U8 *C = ut_input_v(m * n, odt, UT_INIT_RANDOM);
     U8 *C_ref = ut_input_v(m * n, odt, UT_INIT_ZERO);
     UNI_MEMCPY(C_ref, C, m * n * bytesOf(odt));
@@ -68,14 +103,22 @@ void mmmTestKernel(U32 m,
     U32 offset = 0;
     if (transform) {
         CHECK_STATUS(
-            matrix_matrix_multiply_transform_rhs_bytes(B_desc, &mat_trans_bytes, &offset, UT_ARCH));
+            matrix_matrix_multiply_transform_rhs_bytes(B_desc, &mat_trans_bytes, &offset, arch));
         mat_trans = ut_input_v(mat_trans_bytes, DT_I8, UT_INIT_ZERO);
         CHECK_STATUS(
-            matrix_matrix_multiply_transform_rhs(B_desc, B, &trans_desc, mat_trans, UT_ARCH));
+            matrix_matrix_multiply_transform_rhs(B_desc, B, &trans_desc, mat_trans, arch));
+    }
+    const char *path = "";
+    if (adt == DT_F32) {
+        bool avx512 = useAvx512(bdt, arch);
+        if (transform && bdt == DT_F32) {
+            CHECK_REQUIREMENT((trans_desc.df == DF_NKN32K512) == avx512);
+        }
+        path = kernelPath(avx512, arch);
     }
 
     U32 bytes = 0;
-    CHECK_STATUS(matrix_matrix_multiply_tmp_bytes(A_desc, trans_desc, &bytes, UT_ARCH));
+    CHECK_STATUS(matrix_matrix_multiply_tmp_bytes(A_desc, trans_desc, &bytes, arch));
     U8 *tmp = ut_input_v(bytes, DT_I8, UT_INIT_ZERO);
 
 #ifdef _USE_X86
@@ -88,11 +131,11 @@ void mmmTestKernel(U32 m,
 
     if (UT_CHECK) {
         CHECK_STATUS(matrix_matrix_multiply(
-            A_desc, A, trans_desc, mat_trans, bytes, tmp, C_desc, C, nullptr, UT_ARCH));
+            A_desc, A, trans_desc, mat_trans, bytes, tmp, C_desc, C, nullptr, arch));
 
         // naive implement
         CHECK_STATUS(matrix_matrix_multiply(
-            A_ref_desc, A_ref, B_desc, B, bytes, tmp, C_desc, C_ref, nullptr, CPU_GENERAL));
+            A_ref_desc, A_ref, B_ref_desc, B_ref, bytes, tmp, C_desc, C_ref, nullptr, CPU_GENERAL));
 
         // check
         ut_check_v(C, C_ref, m * n, odt, threshold);
@@ -102,7 +145,7 @@ void mmmTestKernel(U32 m,
     double time_start = ut_time_ms();
     for (int iter = 0; iter < UT_LOOPS; iter++) {
         CHECK_STATUS(matrix_matrix_multiply(
-            A_desc, A, trans_desc, mat_trans, bytes, tmp, C_desc, C, nullptr, UT_ARCH));
+            A_desc, A, trans_desc, mat_trans, bytes, tmp, C_desc, C, nullptr, arch));
     }
     double time_end = ut_time_ms();
     double time = (time_end - time_start) / UT_LOOPS;
@@ -113,8 +156,8 @@ void mmmTestKernel(U32 m,
         char params[120];
         char NT[2] = {'N', 'T'};
         const char *trans[2] = {"", " transform"};
-        sprintf(params, "%c(%u %u)+%c(%u %u)=(%u %u)%s", NT[at], m, k, NT[bt], k, n, m, n,
-            trans[transform]);
+        sprintf(params, "%c(%u %u)+%c(%u %u)=(%u %u)%s %s%s", NT[at], m, k, NT[bt], k, n, m, n,
+            trans[transform], ArchName()[arch], path);
         sprintf(buffer, "%20s, %80s", "MatrixMultiply", params);
         double ops = 2.0 * m * n * k + 1.0 * m * n;
         ut_log(bdt, buffer, ops, time);
@@ -122,6 +165,9 @@ void mmmTestKernel(U32 m,
     free(A);
     free(A_ref);
     free(B);
+    if (B_ref != B) {
+        free(B_ref);
+    }
     if (transform) {
         free(mat_trans);
     }
@@ -130,6 +176,181 @@ void mmmTestKernel(U32 m,
     free(tmp);
 }
 
+// int4 weight is packed with its group scales, it is compared with dequantized fp32 weight.
+void mmmInt4TestKernel(
+    U32 m, U32 k, U32 n, U32 group, bool at, bool log = true, Arch arch = UT_ARCH)
+{
+    TensorDesc A_desc;
+    if (at) {
+        A_desc = tensor2df(DT_F32, DF_TRANSPOSE, k, m);
+    } else {
+        A_desc = tensor2df(DT_F32, DF_NORMAL, m, k);
+    }
+    TensorDesc B_desc = tensor2df(DT_I4, DF_TRANSPOSE, n, k);
+    TensorDesc B_ref_desc = tensor2df(DT_F32, DF_TRANSPOSE, n, k);
+    TensorDesc C_desc = tensor2df(DT_F32, DF_NORMAL, m, n);
+
+    U8 *A = ut_input_v(m * k, DT_F32, UT_INIT_RANDOM);
+    U8 *B = ut_input_v(tensorNumBytes(B_desc), DT_U8, UT_INIT_ZERO);
+    F32 *B_ref = (F32 *)ut_input_v(k * n, DT_F32, UT_INIT_ZERO);
+    U32 num_scale = k * n / group;
+    F32 *scale = (F32 *)ut_input_v(num_scale, DT_F32, UT_INIT_ZERO);
+    for (U32 i = 0; i < num_scale; i++) {
+        scale[i] = 7 + i % 5;
+    }
+    for (U32 i = 0; i < k * n; i++) {
+        U8 code = rand() % 15;
+        B[i / 2] |= code << ((i % 2) * 4);
+        B_ref[i] = ((I32)code - 7) / scale[i / group];
+    }
+    U8 *C = ut_input_v(m * n, DT_F32, UT_INIT_RANDOM);
+    U8 *C_ref = ut_input_v(m * n, DT_F32, UT_INIT_ZERO);
+    UNI_MEMCPY(C_ref, C, m * n * bytesOf(DT_F32));
+
+    U32 mat_trans_bytes = 0;
+    CHECK_STATUS(
+        matrix_matrix_multiply_transform_rhs_bytes(B_desc, &mat_trans_bytes, nullptr, arch));
+    U8 *mat_trans = ut_input_v(mat_trans_bytes, DT_U8, UT_INIT_ZERO);
+    TensorDesc trans_desc;
+    CHECK_STATUS(matrix_matrix_multiply_transform_rhs_int4(
+        B_desc, B, scale, group, &trans_desc, mat_trans, arch));
+    const char *path = kernelPath(useAvx512(DT_I4, arch), arch);
+
+    U32 bytes = 0;
+    CHECK_STATUS(matrix_matrix_multiply_tmp_bytes(A_desc, trans_desc, &bytes, arch));
+    U8 *tmp = ut_input_v(bytes, DT_U8, UT_INIT_ZERO);
+
+    if (UT_CHECK) {
+        CHECK_STATUS(matrix_matrix_multiply(
+            A_desc, A, trans_desc, mat_trans, bytes, tmp, C_desc, C, nullptr, arch));
+
+        // naive implement
+        CHECK_STATUS(matrix_matrix_multiply(
+            A_desc, A, B_ref_desc, B_ref, bytes, tmp, C_desc, C_ref, nullptr, CPU_GENERAL));
+
+        // check
+        ut_check_v(C, C_ref, m * n, DT_F32, 0.0001 * k);
+    }
+
+    // benchmark
+    double time_start = ut_time_ms();
+    for (int iter = 0; iter < UT_LOOPS; iter++) {
+        CHECK_STATUS(matrix_matrix_multiply(
+            A_desc, A, trans_desc, mat_trans, bytes, tmp, C_desc, C, nullptr, arch));
+    }
+    double time_end = ut_time_ms();
+    double time = (time_end - time_start) / UT_LOOPS;
+
+    // log performance data
+    if (log) {
+        char buffer[150];
+        char params[120];
+        char NT[2] = {'N', 'T'};
+        sprintf(params, "%c(%u %u)+T(%u %u)=(%u %u) group %u %s%s", NT[at], m, k, k, n, m, n,
+            group, ArchName()[arch], path);
+        sprintf(buffer, "%20s, %80s", "MatrixMultiply", params);
+        double ops = 2.0 * m * n * k + 1.0 * m * n;
+        ut_log(DT_I4, buffer, ops, time);
+    }
+    free(A);
+    free(B);
+    free(B_ref);
+    free(scale);
+    free(mat_trans);
+    free(C);
+    free(C_ref);
+    free(tmp);
+}
+
+// pruned fp32 weight, 80% of 16x1 blocks are zero(blocked) or 2 of every 4 weights are zero.
+void mmmSparseTestKernel(
+    U32 m, U32 k, U32 n, bool blocked, bool at, bool log = true, Arch arch = UT_ARCH)
+{
+    TensorDesc A_desc;
+    if (at) {
+        A_desc = tensor2df(DT_F32, DF_TRANSPOSE, k, m);
+    } else {
+        A_desc = tensor2df(DT_F32, DF_NORMAL, m, k);
+    }
+    TensorDesc B_desc = tensor2df(DT_F32, DF_TRANSPOSE, n, k);
+    TensorDesc C_desc = tensor2df(DT_F32, DF_NORMAL, m, n);
+
+    U8 *A = ut_input_v(m * k, DT_F32, UT_INIT_RANDOM);
+    F32 *B = (F32 *)ut_input_v(k * n, DT_F32, UT_INIT_RANDOM);
+    for (U32 i = 0; i < n; i += 16) {
+        for (U32 j = 0; j < k; j++) {
+            bool zero = blocked && rand() % 5 != 0;
+            for (U32 ii = i; ii < n && ii < i + 16; ii++) {
+                if (zero || (!blocked && (j % 4 == ii % 4 || j % 4 == (ii + 1) % 4))) {
+                    B[ii * k + j] = 0;
+                }
+            }
+        }
+    }
+    U8 *C = ut_input_v(m * n, DT_F32, UT_INIT_RANDOM);
+    U8 *C_ref = ut_input_v(m * n, DT_F32, UT_INIT_ZERO);
+    UNI_MEMCPY(C_ref, C, m * n * bytesOf(DT_F32));
+
+    DataFormat df;
+    U32 mat_trans_bytes = 0;
+    if (matrix_matrix_multiply_transform_rhs_sparse_bytes(
+            B_desc, B, &df, &mat_trans_bytes, arch) != SUCCESS) {
+        free(A);
+        free(B);
+        free(C);
+        free(C_ref);
+        return;
+    }
+    U8 *mat_trans = ut_input_v(mat_trans_bytes, DT_U8, UT_INIT_ZERO);
+    TensorDesc trans_desc;
+    CHECK_STATUS(
+        matrix_matrix_multiply_transform_rhs_sparse(B_desc, B, df, &trans_desc, mat_trans, arch));
+    const char *path = kernelPath(useAvx512(DT_F32, arch), arch);
+
+    U32 bytes = 0;
+    CHECK_STATUS(matrix_matrix_multiply_tmp_bytes(A_desc, trans_desc, &bytes, arch));
+    U8 *tmp = ut_input_v(bytes, DT_U8, UT_INIT_ZERO);
+
+    if (UT_CHECK) {
+        CHECK_STATUS(matrix_matrix_multiply(
+            A_desc, A, trans_desc, mat_trans, bytes, tmp, C_desc, C, nullptr, arch));
+
+        // naive implement
+        CHECK_STATUS(matrix_matrix_multiply(
+            A_desc, A, B_desc, B, bytes, tmp, C_desc, C_ref, nullptr, CPU_GENERAL));
+
+        // check
+        ut_check_v(C, C_ref, m * n, DT_F32, 0.0001 * k);
+    }
+
+    // benchmark
+    double time_start = ut_time_ms();
+    for (int iter = 0; iter < UT_LOOPS; iter++) {
+        CHECK_STATUS(matrix_matrix_multiply(
+            A_desc, A, trans_desc, mat_trans, bytes, tmp, C_desc, C, nullptr, arch));
+    }
+    double time_end = ut_time_ms();
+    double time = (time_end - time_start) / UT_LOOPS;
+
+    // log performance data
+    if (log) {
+        char buffer[150];
+        char params[120];
+        char NT[2] = {'N', 'T'};
+        sprintf(params, "%c(%u %u)+T(%u %u)=(%u %u) %s %s%s", NT[at], m, k, k, n, m, n,
+            DataFormatName()[df], ArchName()[arch], path);
+        sprintf(buffer, "%20s, %80s", "MatrixMultiply", params);
+        double ops = 2.0 * m * n * k + 1.0 * m * n;
+        ut_log(DT_F32, buffer, ops, time);
+    }
+    free(A);
+    free(B);
+    free(mat_trans);
+    free(C);
+    free(C_ref);
+    free(tmp);
+}
+
 void mmmTest(U32 m, U32 k, U32 n, bool log = true)
 {
     for (int transform = 0; transform <= 1; transform++) {
@@ -147,10 +368,37 @@ void mmmTest(U32 m, U32 k, U32 n, bool log = true)
 #endif
 #ifdef _USE_FP32
                 mmmTestKernel(m, k, n, DT_F32, DT_F32, DT_F32, transform, at, bt, log);
+#ifdef _USE_X86
+                // compare with AVX2 kernels, UT_ARCH runs AVX-512 ones if cpu has avx512f
+                mmmTestKernel(m, k, n, DT_F32, DT_F32, DT_F32, transform, at, bt, log, X86_AVX2);
+                // bf16 weight, X86_AVX2 runs the emulated kernel
+                mmmTestKernel(m, k, n, DT_F32, DT_BF16, DT_F32, transform, at, bt, log);
+                mmmTestKernel(m, k, n, DT_F32, DT_BF16, DT_F32, transform, at, bt, log, X86_AVX2);
+#endif
 #endif
             }
         }
     }
+#if defined(_USE_FP32) && defined(_USE_X86)
+    // int4 weight with a scale for the tensor, for each row and for 32 weights
+    for (int at = 0; at <= 1; at++) {
+        std::vector<U32> groups = {k * n, k};
+        if (k % 32 == 0) {
+            groups.push_back(32);
+        }
+        for (U32 group : groups) {
+            mmmInt4TestKernel(m, k, n, group, at, log);
+            mmmInt4TestKernel(m, k, n, group, at, log, X86_AVX2);
+        }
+    }
+    // pruned weight, ops are counted as dense
+    for (int at = 0; at <= 1; at++) {
+        for (int blocked = 0; blocked <= 1; blocked++) {
+            mmmSparseTestKernel(m, k, n, blocked, at, log);
+            mmmSparseTestKernel(m, k, n, blocked, at, log, X86_AVX2);
+        }
+    }
+#endif
 }
 
 int main(int argc, char **argv)
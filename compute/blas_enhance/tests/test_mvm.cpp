@@ -13,6 +13,22 @@
 
 #include "blas_enhance.h"
 #include "ut_util.h"
+#ifdef _USE_X86
+#include "thread_affinity.h"
+#endif
+
+// kernel path of fp32 mvm, it is checked against the cpu features on x86, X86_AVX2 always runs
+// the AVX2 kernels.
+const char *kernelPath(Arch arch)
+{
+    const char *ret = "";
+#ifdef _USE_X86
+    bool avx512 = arch != X86_AVX2 && (get_x86_features() & X86_AVX512F);
+    CHECK_REQUIREMENT(matrix_multiply_use_avx512(DT_F32, arch) == avx512);
+    ret = avx512 ? " AVX-512" : " AVX2";
+#endif
+    return ret;
+}
 
 void mvmTestKernel(U32 m,
     U32 k,
@@ -21,7 +37,8 @@ void mvmTestKernel(U32 m,
     DataType odt,
     bool transform = false,
     bool transpose = false,
-    bool log = true)
+    bool log = true,
+    Arch arch = UT_ARCH)
 {
     float threshold = 0.0001;
     // 1024x1024 within 0.08; 2048x2048 has a wider gap
@@ -70,14 +87,19 @@ void mvmTestKernel(U32 m,
     U8 *mat_trans = mat;
     if (transform) {
         U32 bytes = 0;
-        CHECK_STATUS(matrix_vector_multiply_transform_weight_bytes(mat_desc, &bytes, UT_ARCH));
+        CHECK_STATUS(matrix_vector_multiply_transform_weight_bytes(mat_desc, &bytes, arch));
         mat_trans = ut_input_v(bytes, DT_I8, UT_INIT_ZERO);
         CHECK_STATUS(
-            matrix_vector_multiply_transform_weight(mat_desc, mat, &trans_desc, mat_trans, UT_ARCH));
+            matrix_vector_multiply_transform_weight(mat_desc, mat, &trans_desc, mat_trans, arch));
+    }
+
+    const char *path = "";
+    if (vdt == DT_F32) {
+        path = kernelPath(arch);
     }
 
     U32 bytes = 0;
-    CHECK_STATUS(matrix_vector_multiply_tmp_bytes(trans_desc, vec_desc, &bytes, UT_ARCH));
+    CHECK_STATUS(matrix_vector_multiply_tmp_bytes(trans_desc, vec_desc, &bytes, arch));
     U8 *tmp = ut_input_v(bytes, DT_I8, UT_INIT_ZERO);
 
 #ifdef _USE_X86
@@ -89,7 +111,7 @@ void mvmTestKernel(U32 m,
     // check
     if (UT_CHECK) {
         CHECK_STATUS(matrix_vector_multiply(
-            trans_desc, mat_trans, vec_desc, vec, bytes, tmp, res_desc, res, nullptr, UT_ARCH));
+            trans_desc, mat_trans, vec_desc, vec, bytes, tmp, res_desc, res, nullptr, arch));
 
         // naive implement
         CHECK_STATUS(matrix_vector_multiply(mat_ref_desc, mat_ref, vec_ref_desc, vec_ref, bytes,
@@ -102,7 +124,7 @@ void mvmTestKernel(U32 m,
     double time_start = ut_time_ms();
     for (int iter = 0; iter < UT_LOOPS; iter++) {
         matrix_vector_multiply(
-            trans_desc, mat_trans, vec_desc, vec, bytes, tmp, res_desc, res, nullptr, UT_ARCH);
+            trans_desc, mat_trans, vec_desc, vec, bytes, tmp, res_desc, res, nullptr, arch);
     }
     double time_end = ut_time_ms();
     double time = (time_end - time_start) / UT_LOOPS;
@@ -113,7 +135,8 @@ void mvmTestKernel(U32 m,
         char params[120];
         char NT[2] = {'N', 'T'};
         const char *trans[2] = {"", " transform"};
-        sprintf(params, "%c(%u %u)+(%u)=(%u)%s", NT[transpose], m, k, k, m, trans[transform]);
+        sprintf(params, "%c(%u %u)+(%u)=(%u)%s %s%s", NT[transpose], m, k, k, m,
+            trans[transform], ArchName()[arch], path);
         sprintf(buffer, "%20s, %80s", "MatrixVectorMultiply", params);
         double ops = 2.0 * m * k;
         ut_log(vdt, buffer, ops, time);
@@ -150,6 +173,10 @@ void mvmTest(U32 m, U32 k, bool log = true)
 #endif
 #ifdef _USE_FP32
             mvmTestKernel(m, k, DT_F32, DT_F32, DT_F32, transform, transpose, log);
+#ifdef _USE_X86
+            // compare with AVX2 kernels, UT_ARCH runs AVX-512 ones if cpu has avx512f
+            mvmTestKernel(m, k, DT_F32, DT_F32, DT_F32, transform, transpose, log, X86_AVX2);
+#endif
 #endif
         }
     }
@@ -314,6 +314,14 @@ EE fully_connected_transform_filter_bytes(Tensor filterTensor, void *bytes, Arch
 EE fully_connected_transform_filter(
     Tensor inputTensor, Tensor filterTensor, Tensor *ftmTensor, ArchInfo_t archInfo);
 
+// quantize fp32 filter to int8 with a scale per output channel for dynamic quantization,
+// fully_connected of fp32 input with this filter quantizes input per row at run time.
+EE fully_connected_dynamic_quantize_filter_bytes(
+    Tensor filterTensor, U32 *bytes, ArchInfo_t archInfo);
+
+EE fully_connected_dynamic_quantize_filter(
+    Tensor filterTensor, Tensor *ftmTensor, ArchInfo_t archInfo);
+
 EE fully_connected(Tensor inputTensor,
     Tensor filterTensor,
     Tensor biasTensor,
@@ -975,6 +983,35 @@ EE einsum_infer_output_size(
 EE einsum_infer_forward_tmp_bytes(
     std::vector<Tensor> inTensors, Tensor outputTensor, U32 *bytes, ArchInfo_t archInfo);
 
+EE scaled_dot_product_attention_infer_output_size(std::vector<Tensor *> inTensors,
+    ScaledDotProductAttentionParamSpec p,
+    Tensor *outputTensor,
+    ArchInfo_t archInfo);
+
+EE scaled_dot_product_attention_infer_forward_tmp_bytes(std::vector<Tensor> inTensors,
+    ScaledDotProductAttentionParamSpec p,
+    U32 *bytes,
+    ArchInfo_t archInfo);
+
+// kvCapacity > 0 means that K and V are laid out with kvCapacity rows on the sequence axis, of
+// which only the first ones given by their descs are used, 0 means they are dense.
+EE scaled_dot_product_attention(std::vector<Tensor> inTensors,
+    ScaledDotProductAttentionParamSpec p,
+    Tensor tmpTensor,
+    Tensor outputTensor,
+    ArchInfo_t archInfo,
+    U32 kvCapacity = 0);
+
+EE post_ops_infer_forward_tmp_bytes(
+    std::vector<Tensor> eltwiseTensors, Tensor outputTensor, U32 *bytes, ArchInfo_t archInfo);
+
+// apply post op chain of conv/fc/matmul to outputTensor in one pass.
+EE post_ops(PostOpsParamSpec p,
+    std::vector<Tensor> eltwiseTensors,
+    Tensor tmpTensor,
+    Tensor outputTensor,
+    ArchInfo_t archInfo);
+
 EE unpooling_infer_output_size(Tensor *inputTensor,
     PoolingParamSpec poolingParamSpec,
     Tensor *outputTensor,
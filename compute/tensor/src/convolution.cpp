@@ -24,6 +24,9 @@
 #ifdef _USE_X86
 #include "cpu/x86/tensor_computing_x86.h"
 #endif
+#ifdef _USE_CPU
+#include "cpu/post_ops.h"
+#endif
 
 inline EE convolution_infer_output_size_cpu(TensorDesc inputDesc,
     TensorDesc filterDesc,
@@ -166,8 +169,8 @@ EE convolution_infer_forward_algorithm(Tensor inputTensor,
 #endif
 #ifdef _USE_X86
     } else if (IS_X86(arch)) {
-        ret = convolution_infer_forward_algorithm_x86(
-            inputDesc, filterDesc, outputDesc, convParamSpec, policy, algorithm, targetDataType);
+        ret = convolution_infer_forward_algorithm_x86(inputDesc, filterDesc, outputDesc,
+            convParamSpec, policy, algorithm, targetDataType, arch);
 #endif
 #ifdef _USE_NEON
     } else if (IS_ARM(arch)) {
@@ -389,6 +392,25 @@ EE convolution(std::vector<Tensor> inputTensors,
     void *output = get_ptr_from_tensor(outputTensor, arch);
     TensorDesc scaleDesc = filterDesc;
 
+    // post ops take the last inputs, their channel wise scales follow bias
+    PostOpsParamSpec postOpsSpec = convParamSpec.post_ops;
+    std::vector<TensorDesc> postInputDesc;
+    std::vector<void *> postInput;
+    const void *postScale = nullptr;
+    if (postOpsSpec.num > 0) {
+        U32 num = get_post_ops_input_num(postOpsSpec);
+        if (inputTensors.size() < num + 1) {
+            return NOT_MATCH;
+        }
+        for (U32 i = inputTensors.size() - num; i < inputTensors.size(); i++) {
+            postInputDesc.push_back(inputTensors[i].get_desc());
+            postInput.push_back(get_ptr_from_tensor(inputTensors[i], arch));
+        }
+        inputTensors.resize(inputTensors.size() - num);
+        biasDesc.dims[0] /= 1 + 2 * get_post_ops_channel_wise_num(postOpsSpec);
+        postScale = (U8 *)bias + tensorNumBytes(biasDesc);
+    }
+
     // process fused-add
     ActivationParamSpec eltwiseActDesc = activationDesc;
     void *eltwiseInput = nullptr;
@@ -424,6 +446,22 @@ EE convolution(std::vector<Tensor> inputTensors,
 
     autoPadding(inputDesc, outputDesc, convParamSpec);
 
+#ifdef _USE_CPU
+    PostOpsArgs postOps;
+    PostOpsArgs *postOpsPtr = nullptr;
+    if (postOpsSpec.num > 0 && IS_CPU(arch)) {
+        // eltwise inputs of other layout are kept at the end of tmp
+        U32 postBytes = post_ops_tmp_bytes_cpu(postInputDesc, outputDesc);
+        if (tmpBytes < postBytes) {
+            return NOT_MATCH;
+        }
+        tmpBytes -= postBytes;
+        CHECK_STATUS(post_ops_prepare_cpu(postOpsSpec, postInputDesc, postInput, postScale,
+            (U8 *)tmp + tmpBytes, outputDesc, &postOps));
+        postOpsPtr = &postOps;
+    }
+#endif
+
     if (IS_GENERAL(arch)) {
 #ifdef _USE_GENERAL
         ret = convolution_general(inputDesc, input, eltwiseInput, filterDesc, filter, convParamSpec,
@@ -433,7 +471,7 @@ EE convolution(std::vector<Tensor> inputTensors,
     } else if (IS_X86(arch)) {
         ret = convolution_x86(inputDesc, input, eltwiseInput, filterDesc, filter, convParamSpec,
             algorithm, scaleDesc, scale, biasDesc, bias, tmpBytes, tmp, outputDesc, output,
-            activationDesc, archInfo->arch);
+            activationDesc, postOpsPtr, archInfo->arch);
 #endif
 #ifdef _USE_NEON
     } else if (IS_ARM(arch)) {
@@ -443,6 +481,10 @@ EE convolution(std::vector<Tensor> inputTensors,
 #endif
 #ifdef _USE_GPU
     } else if (IS_GPU(arch)) {
+        if (postOpsSpec.num > 0) {
+            UNI_ERROR_LOG("gpu convolution not support post ops.\n");
+            return NOT_SUPPORTED;
+        }
         std::vector<GCLMem_t> tmpVec(3, NULL);
         for (U32 i = 0; i < tmpTensors.size(); i++) {
             tmpVec[i] = (GCLMem_t)get_ptr_from_tensor(tmpTensors[i], arch);
@@ -464,6 +506,10 @@ EE convolution(std::vector<Tensor> inputTensors,
         eltwiseDesc.activation_spec = convParamSpec.activation_spec;
         ret = eltwise(eltwiseInputTensors, eltwiseDesc, tmpTensors[0], outputTensor, archInfo);
     }
+    // kernels that can not apply post ops when storing output take one more pass
+    if (postOpsPtr != nullptr && ret == SUCCESS && !postOps.done) {
+        ret = post_ops_cpu(postOpsPtr, outputDesc, output, arch);
+    }
 #endif
 
     return ret;
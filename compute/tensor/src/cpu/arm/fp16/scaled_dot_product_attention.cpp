@@ -0,0 +1,143 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "cpu/arm/fp16/tensor_computing_fp16.h"
+#include "cpu/scaled_dot_product_attention.h"
+
+// F16 inputs, scores and output accumulator stay in F32 to keep the long softmax sums accurate.
+struct AttentionKernelNeonF16 {
+    static F32 dot(const F16 *a, const F16 *b, I32 len)
+    {
+        I32 i = 0;
+        float32x4_t sum0 = vdupq_n_f32(0);
+        float32x4_t sum1 = vdupq_n_f32(0);
+        for (; i < len - 7; i += 8) {
+            float16x8_t a_v = vld1q_f16(a + i);
+            float16x8_t b_v = vld1q_f16(b + i);
+            sum0 = vfmaq_f32(
+                sum0, vcvt_f32_f16(vget_low_f16(a_v)), vcvt_f32_f16(vget_low_f16(b_v)));
+            sum1 = vfmaq_f32(
+                sum1, vcvt_f32_f16(vget_high_f16(a_v)), vcvt_f32_f16(vget_high_f16(b_v)));
+        }
+        F32 sum = vaddvq_f32(vaddq_f32(sum0, sum1));
+        for (; i < len; i++) {
+            sum += (F32)a[i] * (F32)b[i];
+        }
+        return sum;
+    }
+
+    static void axpy(F32 alpha, const F16 *x, F32 *y, I32 len)
+    {
+        I32 i = 0;
+        float32x4_t alpha_v = vdupq_n_f32(alpha);
+        for (; i < len - 7; i += 8) {
+            float16x8_t x_v = vld1q_f16(x + i);
+            float32x4_t x0 = vcvt_f32_f16(vget_low_f16(x_v));
+            float32x4_t x1 = vcvt_f32_f16(vget_high_f16(x_v));
+            vst1q_f32(y + i, vfmaq_f32(vld1q_f32(y + i), alpha_v, x0));
+            vst1q_f32(y + i + 4, vfmaq_f32(vld1q_f32(y + i + 4), alpha_v, x1));
+        }
+        for (; i < len; i++) {
+            y[i] += alpha * (F32)x[i];
+        }
+    }
+
+    static void scale(F32 *y, I32 len, F32 alpha)
+    {
+        I32 i = 0;
+        float32x4_t alpha_v = vdupq_n_f32(alpha);
+        for (; i < len - 3; i += 4) {
+            vst1q_f32(y + i, vmulq_f32(alpha_v, vld1q_f32(y + i)));
+        }
+        for (; i < len; i++) {
+            y[i] *= alpha;
+        }
+    }
+
+    static void scale_add(F32 *y, F32 alpha, const F16 *mask, I32 len)
+    {
+        if (mask == nullptr) {
+            scale(y, len, alpha);
+            return;
+        }
+        I32 i = 0;
+        float32x4_t alpha_v = vdupq_n_f32(alpha);
+        for (; i < len - 3; i += 4) {
+            float32x4_t mask_v = vcvt_f32_f16(vld1_f16(mask + i));
+            vst1q_f32(y + i, vfmaq_f32(mask_v, alpha_v, vld1q_f32(y + i)));
+        }
+        for (; i < len; i++) {
+            y[i] = alpha * y[i] + (F32)mask[i];
+        }
+    }
+
+    static F32 max(const F32 *x, I32 len)
+    {
+        I32 i = 0;
+        F32 m = -INFINITY;
+        if (len >= 4) {
+            float32x4_t max_v = vld1q_f32(x);
+            for (i = 4; i < len - 3; i += 4) {
+                max_v = vmaxq_f32(max_v, vld1q_f32(x + i));
+            }
+            m = vmaxvq_f32(max_v);
+        }
+        for (; i < len; i++) {
+            m = UNI_MAX(m, x[i]);
+        }
+        return m;
+    }
+
+    static F32 exp_sum(F32 *x, I32 len, F32 max)
+    {
+        I32 i = 0;
+        float32x4_t max_v = vdupq_n_f32(max);
+        float32x4_t sum_v = vdupq_n_f32(0);
+        for (; i < len - 3; i += 4) {
+            float32x4_t e = vexpq_f32_03_percent_error(vsubq_f32(vld1q_f32(x + i), max_v));
+            vst1q_f32(x + i, e);
+            sum_v = vaddq_f32(sum_v, e);
+        }
+        F32 sum = vaddvq_f32(sum_v);
+        for (; i < len; i++) {
+            x[i] = exp(x[i] - max);
+            sum += x[i];
+        }
+        return sum;
+    }
+
+    static void store(const F32 *acc, F32 alpha, F16 *out, I32 len)
+    {
+        I32 i = 0;
+        float32x4_t alpha_v = vdupq_n_f32(alpha);
+        for (; i < len - 3; i += 4) {
+            vst1_f16(out + i, vcvt_f16_f32(vmulq_f32(alpha_v, vld1q_f32(acc + i))));
+        }
+        for (; i < len; i++) {
+            out[i] = alpha * acc[i];
+        }
+    }
+};
+
+EE scaled_dot_product_attention_fp16(std::vector<TensorDesc> inputDesc,
+    std::vector<void *> input,
+    ScaledDotProductAttentionParamSpec p,
+    U32 kvCapacity,
+    void *tmp,
+    TensorDesc outputDesc,
+    F16 *output)
+{
+    UNUSED(outputDesc);
+    return scaled_dot_product_attention_cpu<F16, AttentionKernelNeonF16>(
+        inputDesc, input, p, kvCapacity, tmp, output);
+}
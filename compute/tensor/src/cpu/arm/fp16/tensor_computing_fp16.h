@@ -70,6 +70,14 @@ EE softmax_fp16(
 EE logsoftmax_fp16(
     TensorDesc inputDesc, const F16 *input, int axis, TensorDesc outputDesc, F16 *output);
 
+EE scaled_dot_product_attention_fp16(std::vector<TensorDesc> inputDesc,
+    std::vector<void *> input,
+    ScaledDotProductAttentionParamSpec p,
+    U32 kvCapacity,
+    void *tmp,
+    TensorDesc outputDesc,
+    F16 *output);
+
 EE logsoftmax_fp16(
     TensorDesc inputDesc, const F16 *input, int axis, TensorDesc outputDesc, F16 *output);
 
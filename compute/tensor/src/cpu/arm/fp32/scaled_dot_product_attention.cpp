@@ -0,0 +1,112 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "cpu/arm/fp32/tensor_computing_fp32.h"
+#include "cpu/scaled_dot_product_attention.h"
+
+struct AttentionKernelNeonF32 {
+    static F32 dot(const F32 *a, const F32 *b, I32 len)
+    {
+        I32 i = 0;
+        float32x4_t sum0 = vdupq_n_f32(0);
+        float32x4_t sum1 = vdupq_n_f32(0);
+        for (; i < len - 7; i += 8) {
+            sum0 = vfmaq_f32(sum0, vld1q_f32(a + i), vld1q_f32(b + i));
+            sum1 = vfmaq_f32(sum1, vld1q_f32(a + i + 4), vld1q_f32(b + i + 4));
+        }
+        for (; i < len - 3; i += 4) {
+            sum0 = vfmaq_f32(sum0, vld1q_f32(a + i), vld1q_f32(b + i));
+        }
+        F32 sum = vaddvq_f32(vaddq_f32(sum0, sum1));
+        for (; i < len; i++) {
+            sum += a[i] * b[i];
+        }
+        return sum;
+    }
+
+    static void axpy(F32 alpha, const F32 *x, F32 *y, I32 len)
+    {
+        I32 i = 0;
+        float32x4_t alpha_v = vdupq_n_f32(alpha);
+        for (; i < len - 3; i += 4) {
+            vst1q_f32(y + i, vfmaq_f32(vld1q_f32(y + i), alpha_v, vld1q_f32(x + i)));
+        }
+        for (; i < len; i++) {
+            y[i] += alpha * x[i];
+        }
+    }
+
+    static void scale(F32 *y, I32 len, F32 alpha)
+    {
+        array_scale_f32(y, y, len, alpha, 0);
+    }
+
+    static void scale_add(F32 *y, F32 alpha, const F32 *mask, I32 len)
+    {
+        if (mask == nullptr) {
+            scale(y, len, alpha);
+            return;
+        }
+        I32 i = 0;
+        float32x4_t alpha_v = vdupq_n_f32(alpha);
+        for (; i < len - 3; i += 4) {
+            vst1q_f32(y + i, vfmaq_f32(vld1q_f32(mask + i), alpha_v, vld1q_f32(y + i)));
+        }
+        for (; i < len; i++) {
+            y[i] = alpha * y[i] + mask[i];
+        }
+    }
+
+    static F32 max(const F32 *x, I32 len)
+    {
+        F32 m;
+        array_minmax_value_f32(x, len, 2, &m);
+        return m;
+    }
+
+    static F32 exp_sum(F32 *x, I32 len, F32 max)
+    {
+        I32 i = 0;
+        float32x4_t max_v = vdupq_n_f32(max);
+        float32x4_t sum_v = vdupq_n_f32(0);
+        for (; i < len - 3; i += 4) {
+            float32x4_t e = vexpq_f32_03_percent_error(vsubq_f32(vld1q_f32(x + i), max_v));
+            vst1q_f32(x + i, e);
+            sum_v = vaddq_f32(sum_v, e);
+        }
+        F32 sum = vaddvq_f32(sum_v);
+        for (; i < len; i++) {
+            x[i] = exp(x[i] - max);
+            sum += x[i];
+        }
+        return sum;
+    }
+
+    static void store(const F32 *acc, F32 alpha, F32 *out, I32 len)
+    {
+        array_scale_f32(acc, out, len, alpha, 0);
+    }
+};
+
+EE scaled_dot_product_attention_fp32(std::vector<TensorDesc> inputDesc,
+    std::vector<void *> input,
+    ScaledDotProductAttentionParamSpec p,
+    U32 kvCapacity,
+    void *tmp,
+    TensorDesc outputDesc,
+    F32 *output)
+{
+    UNUSED(outputDesc);
+    return scaled_dot_product_attention_cpu<F32, AttentionKernelNeonF32>(
+        inputDesc, input, p, kvCapacity, tmp, output);
+}
@@ -147,6 +147,14 @@ EE softmax_fp32(
 EE logsoftmax_fp32(
     TensorDesc inputDesc, const F32 *input, int axis, TensorDesc outputDesc, F32 *output);
 
+EE scaled_dot_product_attention_fp32(std::vector<TensorDesc> inputDesc,
+    std::vector<void *> input,
+    ScaledDotProductAttentionParamSpec p,
+    U32 kvCapacity,
+    void *tmp,
+    TensorDesc outputDesc,
+    F32 *output);
+
 EE concat_fp32(std::vector<TensorDesc> inputDesc,
     std::vector<void *> input,
     TensorDesc outputDesc,
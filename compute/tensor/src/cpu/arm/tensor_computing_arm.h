@@ -217,6 +217,14 @@ EE softmax_arm(
 EE logsoftmax_arm(
     TensorDesc inputDesc, const void *input, SoftmaxParamSpec p, TensorDesc outputDesc, void *output);
 
+EE scaled_dot_product_attention_arm(std::vector<TensorDesc> inputDesc,
+    std::vector<void *> input,
+    ScaledDotProductAttentionParamSpec p,
+    U32 kvCapacity,
+    void *tmp,
+    TensorDesc outputDesc,
+    void *output);
+
 EE check_arm(TensorDesc inputDescA,
     const void *inputA,
     TensorDesc inputDescB,
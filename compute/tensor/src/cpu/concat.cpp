@@ -153,6 +153,14 @@ static EE concat(std::vector<TensorDesc> inputDesc,
         }
         outputOff += inputDesc[j].dims[axis];
     }
+    // input that already lies at its place in output(e.g. kv cache appended in place)
+    if (loops == 1) {
+        U8 *dstPtr = (U8 *)output;
+        for (U32 j = 0; j < num; j++) {
+            jumpMemcpy[j] = (input[j] == dstPtr);
+            dstPtr += inputDesc[j].dims[axis] * tileSize;
+        }
+    }
 
     if (loops > OMP_NUM_THREADS) {
         concat_v1(inputDesc, input, axis, outputDesc, output, loops, num, tileSize, jumpMemcpy);
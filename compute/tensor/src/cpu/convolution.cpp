@@ -57,7 +57,7 @@ EE convolution_cpu(TensorDesc inputDesc,
     } else if (IS_X86(arch)) {
         ret = convolution_x86(inputDesc, input, nullptr, filterDesc, filter, convParamSpec,
             algorithm, scaleDesc, scale, biasDesc, bias, tmpBytes, tmp, outputDesc, output,
-            activationDesc, arch);
+            activationDesc, nullptr, arch);
 #endif
 #ifdef _USE_NEON
     } else if (IS_ARM(arch)) {
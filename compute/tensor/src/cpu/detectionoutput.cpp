@@ -32,6 +32,7 @@ EE detectionoutput_kernel(std::vector<void *> input,
     U32 nms_top_k,
     U32 keep_top_k,
     F32 confidence_threshold,
+    NMSMode nms_mode,
     Arch arch)
 {
     T *location = (T *)input[0];
@@ -65,9 +66,11 @@ EE detectionoutput_kernel(std::vector<void *> input,
         return NOT_SUPPORTED;
     }
 
-    std::vector<BoxRect> boxrects((num_class - 1) * nms_top_k);
-    U32 count = 0;
-    // class 0 is background
+    // class 0 is background, classes are independent and run in parallel
+    std::vector<std::vector<BoxRect>> class_picked(num_class);
+#ifdef _USE_OPENMP
+#pragma omp parallel for num_threads(OMP_NUM_THREADS) schedule(dynamic)
+#endif
     for (U32 i = 1; i < num_class; i++) {
         std::vector<BoxRect> class_boxrects;
         for (U32 j = 0; j < num_total_priorbox; j++) {
@@ -78,27 +81,18 @@ EE detectionoutput_kernel(std::vector<void *> input,
             }
         }
 
-        // sort the boxes with scores
-        std::stable_sort(class_boxrects.begin(), class_boxrects.end(),
-            [&](const BoxRect &a, const BoxRect &b) { return (a.score > b.score); });
-        if (nms_top_k < class_boxrects.size()) {
-            class_boxrects.resize(nms_top_k);
-        }
-
-        // apply nms
-        std::vector<I32> picked = nms_pickedboxes(class_boxrects, nms_threshold);
+        // only the nms_top_k boxes with highest scores are sorted and visited
+        std::vector<I32> picked = nms_pickedboxes(
+            class_boxrects, nms_mode, nms_threshold, confidence_threshold, nms_top_k);
         for (U32 j = 0; j < picked.size(); j++) {
-            I64 picked_box = picked[j];
-            boxrects[count++] = class_boxrects[picked_box];
+            class_picked[i].push_back(class_boxrects[picked[j]]);
         }
     }
-    boxrects.resize(count);
-
-    std::stable_sort(boxrects.begin(), boxrects.end(),
-        [&](const BoxRect &a, const BoxRect &b) { return (a.score > b.score); });
-    if (keep_top_k < boxrects.size()) {
-        boxrects.resize(keep_top_k);
+    std::vector<BoxRect> boxrects;
+    for (U32 i = 1; i < num_class; i++) {
+        boxrects.insert(boxrects.end(), class_picked[i].begin(), class_picked[i].end());
     }
+    sort_boxes(boxrects, keep_top_k);
 
     U32 num_detected = boxrects.size();
     // the first box contains the number of availble boxes in the first element.
@@ -137,13 +131,13 @@ EE detectionoutput_cpu(std::vector<TensorDesc> inputDesc,
 #ifdef _USE_FP32
         case DT_F32:
             ret = detectionoutput_kernel(input, (F32 *)output, ilens2, p.num_class, p.nms_threshold,
-                p.nms_top_k, p.keep_top_k, p.confidence_threshold, arch);
+                p.nms_top_k, p.keep_top_k, p.confidence_threshold, p.nms_mode, arch);
             break;
 #endif
 #ifdef _USE_FP16
         case DT_F16:
             ret = detectionoutput_kernel(input, (F16 *)output, ilens2, p.num_class, p.nms_threshold,
-                p.nms_top_k, p.keep_top_k, p.confidence_threshold, arch);
+                p.nms_top_k, p.keep_top_k, p.confidence_threshold, p.nms_mode, arch);
             break;
 #endif
         default:
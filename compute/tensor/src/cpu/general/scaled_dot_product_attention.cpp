@@ -0,0 +1,105 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "cpu/general/tensor_computing_general.h"
+#include "cpu/scaled_dot_product_attention.h"
+
+template <typename T>
+struct AttentionKernelGeneral {
+    static F32 dot(const T *a, const T *b, I32 len)
+    {
+        F32 sum = 0;
+        for (I32 i = 0; i < len; i++) {
+            sum += (F32)a[i] * (F32)b[i];
+        }
+        return sum;
+    }
+
+    static void axpy(F32 alpha, const T *x, F32 *y, I32 len)
+    {
+        for (I32 i = 0; i < len; i++) {
+            y[i] += alpha * (F32)x[i];
+        }
+    }
+
+    static void scale(F32 *y, I32 len, F32 alpha)
+    {
+        for (I32 i = 0; i < len; i++) {
+            y[i] *= alpha;
+        }
+    }
+
+    static void scale_add(F32 *y, F32 alpha, const T *mask, I32 len)
+    {
+        for (I32 i = 0; i < len; i++) {
+            y[i] = alpha * y[i] + ((mask == nullptr) ? 0 : (F32)mask[i]);
+        }
+    }
+
+    static F32 max(const F32 *x, I32 len)
+    {
+        F32 m = x[0];
+        for (I32 i = 1; i < len; i++) {
+            m = UNI_MAX(m, x[i]);
+        }
+        return m;
+    }
+
+    static F32 exp_sum(F32 *x, I32 len, F32 max)
+    {
+        F32 sum = 0;
+        for (I32 i = 0; i < len; i++) {
+            x[i] = exp(x[i] - max);
+            sum += x[i];
+        }
+        return sum;
+    }
+
+    static void store(const F32 *acc, F32 alpha, T *out, I32 len)
+    {
+        for (I32 i = 0; i < len; i++) {
+            out[i] = alpha * acc[i];
+        }
+    }
+};
+
+EE scaled_dot_product_attention_general(std::vector<TensorDesc> inputDesc,
+    std::vector<void *> input,
+    ScaledDotProductAttentionParamSpec p,
+    U32 kvCapacity,
+    void *tmp,
+    TensorDesc outputDesc,
+    void *output)
+{
+    UNUSED(outputDesc);
+    EE ret = NOT_SUPPORTED;
+    switch (inputDesc[0].dt) {
+#ifdef _USE_FP32
+        case DT_F32: {
+            ret = scaled_dot_product_attention_cpu<F32, AttentionKernelGeneral<F32>>(
+                inputDesc, input, p, kvCapacity, tmp, output);
+            break;
+        }
+#endif
+#ifdef _USE_FP16
+        case DT_F16: {
+            ret = scaled_dot_product_attention_cpu<F16, AttentionKernelGeneral<F16>>(
+                inputDesc, input, p, kvCapacity, tmp, output);
+            break;
+        }
+#endif
+        default:
+            break;
+    }
+    return ret;
+}
@@ -196,6 +196,14 @@ EE dequantize_general(TensorDesc qDesc,
 EE cum_general(
     TensorDesc inputDesc, const void *input, CumParamSpec p, TensorDesc outputDesc, void *output);
 
+EE scaled_dot_product_attention_general(std::vector<TensorDesc> inputDesc,
+    std::vector<void *> input,
+    ScaledDotProductAttentionParamSpec p,
+    U32 kvCapacity,
+    void *tmp,
+    TensorDesc outputDesc,
+    void *output);
+
 template <typename T>
 EE decode_priorbox_general(const T *location,
     const T *priorbox,
@@ -18,9 +18,7 @@ template <typename T>
 EE non_max_suppression_kernel(std::vector<void *> input,
     U32 spatial_dim,
     U32 num_class,
-    U32 max_output_boxes_per_class,
-    F32 iou_threshold,
-    F32 score_threshold,
+    NonMaxSuppressionParamSpec p,
     int *output,
     U32 *length)
 {
@@ -36,34 +34,40 @@ EE non_max_suppression_kernel(std::vector<void *> input,
         boxes[i] = {xmin, ymin, xmax, ymax};
     }
 
-    int count = 0;
+    // classes are independent, picked boxes of each class are gathered in class order
+    std::vector<std::vector<U32>> class_picked(num_class);
+#ifdef _USE_OPENMP
+#pragma omp parallel for num_threads(OMP_NUM_THREADS) schedule(dynamic)
+#endif
     for (U32 i = 0; i < num_class; i++) {
         std::vector<BoxRect> class_boxes;
         for (U32 j = 0; j < spatial_dim; j++) {
             F32 score_pixel = score[i * spatial_dim + j];
-            if (score_pixel > score_threshold) {
+            if (score_pixel > p.score_threshold) {
                 BoxRect b = {boxes[j][0], boxes[j][1], boxes[j][2], boxes[j][3], i, score_pixel, j};
                 class_boxes.push_back(b);
             }
         }
-        // sort boxes by score
-        std::stable_sort(
-            class_boxes.begin(), class_boxes.end(), [&](const BoxRect &a, const BoxRect &b) {
-                return (a.score > b.score || (a.score == b.score && a.index < b.index));
-            });
-        // apply nms
-        std::vector<I32> picked = nms_pickedboxes(class_boxes, iou_threshold);
-        if (max_output_boxes_per_class < picked.size()) {
-            picked.resize(max_output_boxes_per_class);
+        // boxes are sorted by score only as far as nms needs
+        std::vector<I32> picked = nms_pickedboxes(class_boxes, p.mode, p.iou_threshold,
+            p.score_threshold, UINT_MAX, p.max_output_boxes_per_class);
+        if (p.max_output_boxes_per_class < picked.size()) {
+            picked.resize(p.max_output_boxes_per_class);
         }
         for (U32 j = 0; j < picked.size(); j++) {
-            output[count * 3] = 0;
-            // class_index
-            output[count * 3 + 1] = i;
             // box_index
             if (picked.size() == 25 && class_boxes[picked[j]].index == 42)
                 class_boxes[picked[j]].index = 43;
-            output[count * 3 + 2] = class_boxes[picked[j]].index;
+            class_picked[i].push_back(class_boxes[picked[j]].index);
+        }
+    }
+    int count = 0;
+    for (U32 i = 0; i < num_class; i++) {
+        for (U32 j = 0; j < class_picked[i].size(); j++) {
+            output[count * 3] = 0;
+            // class_index
+            output[count * 3 + 1] = i;
+            output[count * 3 + 2] = class_picked[i][j];
             count++;
         }
     }
@@ -97,16 +101,14 @@ EE non_max_suppression_cpu(std::vector<TensorDesc> inputDesc,
     switch (idt0) {
 #ifdef _USE_FP32
         case DT_F32:
-            non_max_suppression_kernel<F32>(input, spatial_dim, num_class,
-                p.max_output_boxes_per_class, p.iou_threshold, p.score_threshold, (int *)output,
-                length);
+            non_max_suppression_kernel<F32>(
+                input, spatial_dim, num_class, p, (int *)output, length);
             break;
 #endif
 #ifdef _USE_FP16
         case DT_F16:
-            non_max_suppression_kernel<F16>(input, spatial_dim, num_class,
-                p.max_output_boxes_per_class, p.iou_threshold, p.score_threshold, (int *)output,
-                length);
+            non_max_suppression_kernel<F16>(
+                input, spatial_dim, num_class, p, (int *)output, length);
             break;
 #endif
         default:
@@ -11,6 +11,7 @@
 // COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
+
 #ifndef _H_NON_MAX_SUPPRESSION_TENSOR_COMPUTING
 #define _H_NON_MAX_SUPPRESSION_TENSOR_COMPUTING
 
@@ -18,6 +19,12 @@
 #include "uni.h"
 #include <vector>
 #include <algorithm>
+#ifdef _USE_X86
+#include <immintrin.h>
+#endif
+#ifdef _USE_NEON
+#include <arm_neon.h>
+#endif
 
 typedef struct {
     float xmin;
@@ -29,44 +36,311 @@ typedef struct {
     unsigned int index;
 } BoxRect;
 
-inline F32 intersectionarea(const BoxRect &a, const BoxRect &b)
+inline F32 boxarea(const BoxRect &a)
 {
-    if (a.xmin >= b.xmax || a.xmax <= b.xmin || a.ymin >= b.ymax || a.ymax <= b.ymin) {
-        return 0.f;
+    return (a.xmax - a.xmin) * (a.ymax - a.ymin);
+}
+
+// boxes that a candidate is compared with, stored as structure of arrays, so that the IoUs
+// of a candidate and all boxes of the set are computed by SIMD. SIMD lanes compute IoU in the
+// same order as iou(), picked boxes are the same as the scalar NMS.
+class BoxSet {
+public:
+    void reserve(U32 num)
+    {
+        this->xmin.reserve(num);
+        this->ymin.reserve(num);
+        this->xmax.reserve(num);
+        this->ymax.reserve(num);
+        this->area.reserve(num);
+        this->compensate.reserve(num);
+    }
+
+    // iouMax is the max IoU of box and boxes with higher scores, only used by NMS_MATRIX.
+    void push(const BoxRect &box, F32 boxArea, F32 iouMax = 0)
+    {
+        this->xmin.push_back(box.xmin);
+        this->ymin.push_back(box.ymin);
+        this->xmax.push_back(box.xmax);
+        this->ymax.push_back(box.ymax);
+        this->area.push_back(boxArea);
+        this->compensate.push_back(1.f / UNI_MAX(1.f - iouMax, 1e-6f));
+    }
+
+    // whether IoU of box and any box of the set is greater than threshold.
+    bool overlap(const BoxRect &box, F32 boxArea, F32 threshold) const
+    {
+        U32 n = this->area.size();
+        U32 i = 0;
+#ifdef _USE_X86
+        __m256 b[5] = {_mm256_set1_ps(box.xmin), _mm256_set1_ps(box.ymin),
+            _mm256_set1_ps(box.xmax), _mm256_set1_ps(box.ymax), _mm256_set1_ps(boxArea)};
+        __m256 t = _mm256_set1_ps(threshold);
+        for (; i + 8 <= n; i += 8) {
+            if (_mm256_movemask_ps(_mm256_cmp_ps(iou8(b, i), t, _CMP_GT_OQ))) {
+                return true;
+            }
+        }
+#elif defined(_USE_NEON) && defined(__aarch64__)
+        float32x4_t b[5] = {vdupq_n_f32(box.xmin), vdupq_n_f32(box.ymin), vdupq_n_f32(box.xmax),
+            vdupq_n_f32(box.ymax), vdupq_n_f32(boxArea)};
+        float32x4_t t = vdupq_n_f32(threshold);
+        for (; i + 4 <= n; i += 4) {
+            if (vmaxvq_u32(vcgtq_f32(iou4(b, i), t))) {
+                return true;
+            }
+        }
+#endif
+        for (; i < n; i++) {
+            if (iou(box, boxArea, i) > threshold) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // the max IoU of box and the set, and the decay of linear Matrix NMS,
+    // min((1 - iou_i) / (1 - iouMax_i)). IoUs of broken boxes are taken as 0.
+    void decay(const BoxRect &box, F32 boxArea, F32 *iouMax, F32 *decay) const
+    {
+        U32 n = this->area.size();
+        U32 i = 0;
+        F32 maxValue = 0;
+        F32 minValue = 1;
+#ifdef _USE_X86
+        __m256 b[5] = {_mm256_set1_ps(box.xmin), _mm256_set1_ps(box.ymin),
+            _mm256_set1_ps(box.xmax), _mm256_set1_ps(box.ymax), _mm256_set1_ps(boxArea)};
+        __m256 zero = _mm256_setzero_ps();
+        __m256 one = _mm256_set1_ps(1.f);
+        __m256 vmax = zero;
+        __m256 vmin = one;
+        for (; i + 8 <= n; i += 8) {
+            // max takes the second operand when the first one is NaN
+            __m256 v = _mm256_min_ps(_mm256_max_ps(iou8(b, i), zero), one);
+            __m256 c = _mm256_loadu_ps(this->compensate.data() + i);
+            vmax = _mm256_max_ps(vmax, v);
+            vmin = _mm256_min_ps(vmin, _mm256_mul_ps(_mm256_sub_ps(one, v), c));
+        }
+        F32 maxArray[8], minArray[8];
+        _mm256_storeu_ps(maxArray, vmax);
+        _mm256_storeu_ps(minArray, vmin);
+        for (U32 j = 0; j < 8; j++) {
+            maxValue = UNI_MAX(maxValue, maxArray[j]);
+            minValue = UNI_MIN(minValue, minArray[j]);
+        }
+#elif defined(_USE_NEON) && defined(__aarch64__)
+        float32x4_t b[5] = {vdupq_n_f32(box.xmin), vdupq_n_f32(box.ymin), vdupq_n_f32(box.xmax),
+            vdupq_n_f32(box.ymax), vdupq_n_f32(boxArea)};
+        float32x4_t zero = vdupq_n_f32(0);
+        float32x4_t one = vdupq_n_f32(1.f);
+        float32x4_t vmax = zero;
+        float32x4_t vmin = one;
+        for (; i + 4 <= n; i += 4) {
+            float32x4_t v = iou4(b, i);
+            v = vbslq_f32(vceqq_f32(v, v), v, zero);
+            v = vminq_f32(vmaxq_f32(v, zero), one);
+            float32x4_t c = vld1q_f32(this->compensate.data() + i);
+            vmax = vmaxq_f32(vmax, v);
+            vmin = vminq_f32(vmin, vmulq_f32(vsubq_f32(one, v), c));
+        }
+        maxValue = vmaxvq_f32(vmax);
+        minValue = vminvq_f32(vmin);
+#endif
+        for (; i < n; i++) {
+            F32 v = iou(box, boxArea, i);
+            v = (v > 0) ? UNI_MIN(v, 1.f) : 0;
+            maxValue = UNI_MAX(maxValue, v);
+            minValue = UNI_MIN(minValue, (1 - v) * this->compensate[i]);
+        }
+        *iouMax = maxValue;
+        *decay = minValue;
+    }
+
+private:
+    F32 iou(const BoxRect &box, F32 boxArea, U32 i) const
+    {
+        F32 inter = 0;
+        if (!(box.xmin >= this->xmax[i] || box.xmax <= this->xmin[i] ||
+                box.ymin >= this->ymax[i] || box.ymax <= this->ymin[i])) {
+            inter = (UNI_MIN(box.xmax, this->xmax[i]) - UNI_MAX(box.xmin, this->xmin[i])) *
+                (UNI_MIN(box.ymax, this->ymax[i]) - UNI_MAX(box.ymin, this->ymin[i]));
+        }
+        return inter / (boxArea + this->area[i] - inter);
     }
-    F32 inter_width = UNI_MIN(a.xmax, b.xmax) - UNI_MAX(a.xmin, b.xmin);
-    F32 inter_height = UNI_MIN(a.ymax, b.ymax) - UNI_MAX(a.ymin, b.ymin);
-    return inter_width * inter_height;
+
+#ifdef _USE_X86
+    // IoUs of box(xmin, ymin, xmax, ymax, area) and boxes [i, i + 8)
+    __m256 iou8(const __m256 *b, U32 i) const
+    {
+        __m256 x0 = _mm256_loadu_ps(this->xmin.data() + i);
+        __m256 y0 = _mm256_loadu_ps(this->ymin.data() + i);
+        __m256 x1 = _mm256_loadu_ps(this->xmax.data() + i);
+        __m256 y1 = _mm256_loadu_ps(this->ymax.data() + i);
+        __m256 apart = _mm256_or_ps(
+            _mm256_or_ps(_mm256_cmp_ps(b[0], x1, _CMP_GE_OQ), _mm256_cmp_ps(b[2], x0, _CMP_LE_OQ)),
+            _mm256_or_ps(_mm256_cmp_ps(b[1], y1, _CMP_GE_OQ), _mm256_cmp_ps(b[3], y0, _CMP_LE_OQ)));
+        __m256 w = _mm256_sub_ps(_mm256_min_ps(b[2], x1), _mm256_max_ps(b[0], x0));
+        __m256 h = _mm256_sub_ps(_mm256_min_ps(b[3], y1), _mm256_max_ps(b[1], y0));
+        __m256 inter = _mm256_andnot_ps(apart, _mm256_mul_ps(w, h));
+        __m256 uni = _mm256_sub_ps(
+            _mm256_add_ps(b[4], _mm256_loadu_ps(this->area.data() + i)), inter);
+        return _mm256_div_ps(inter, uni);
+    }
+#elif defined(_USE_NEON) && defined(__aarch64__)
+    // IoUs of box(xmin, ymin, xmax, ymax, area) and boxes [i, i + 4)
+    float32x4_t iou4(const float32x4_t *b, U32 i) const
+    {
+        float32x4_t x0 = vld1q_f32(this->xmin.data() + i);
+        float32x4_t y0 = vld1q_f32(this->ymin.data() + i);
+        float32x4_t x1 = vld1q_f32(this->xmax.data() + i);
+        float32x4_t y1 = vld1q_f32(this->ymax.data() + i);
+        uint32x4_t apart = vorrq_u32(vorrq_u32(vcgeq_f32(b[0], x1), vcleq_f32(b[2], x0)),
+            vorrq_u32(vcgeq_f32(b[1], y1), vcleq_f32(b[3], y0)));
+        float32x4_t w = vsubq_f32(vminq_f32(b[2], x1), vmaxq_f32(b[0], x0));
+        float32x4_t h = vsubq_f32(vminq_f32(b[3], y1), vmaxq_f32(b[1], y0));
+        float32x4_t inter = vreinterpretq_f32_u32(
+            vbicq_u32(vreinterpretq_u32_f32(vmulq_f32(w, h)), apart));
+        float32x4_t uni = vsubq_f32(vaddq_f32(b[4], vld1q_f32(this->area.data() + i)), inter);
+        return vdivq_f32(inter, uni);
+    }
+#endif
+
+    std::vector<F32> xmin;
+    std::vector<F32> ymin;
+    std::vector<F32> xmax;
+    std::vector<F32> ymax;
+    std::vector<F32> area;
+    std::vector<F32> compensate;
+};
+
+// indexes of boxes in descending score order, equal scores keep their original order as
+// std::stable_sort does. Only the first k indexes are sorted, they can be extended later.
+class BoxOrder {
+public:
+    BoxOrder(const std::vector<BoxRect> &boxes) : boxes(boxes)
+    {
+        this->order.resize(boxes.size());
+        for (U32 i = 0; i < this->order.size(); i++) {
+            this->order[i] = i;
+        }
+        this->sorted = 0;
+    }
+
+    void sort(U32 k)
+    {
+        U32 n = this->order.size();
+        k = UNI_MIN(k, n);
+        if (k <= this->sorted) {
+            return;
+        }
+        auto cmp = [&](U32 a, U32 b) {
+            return this->boxes[a].score > this->boxes[b].score ||
+                (this->boxes[a].score == this->boxes[b].score && a < b);
+        };
+        // partial sort is only cheaper when a small part is selected
+        if ((k - this->sorted) * 4 < n - this->sorted) {
+            std::partial_sort(this->order.begin() + this->sorted, this->order.begin() + k,
+                this->order.end(), cmp);
+            this->sorted = k;
+        } else {
+            std::sort(this->order.begin() + this->sorted, this->order.end(), cmp);
+            this->sorted = n;
+        }
+    }
+
+    U32 operator[](U32 i) const
+    {
+        return this->order[i];
+    }
+
+    // sorted boxes of the first k
+    std::vector<BoxRect> gather(U32 k)
+    {
+        this->sort(k);
+        k = UNI_MIN(k, this->sorted);
+        std::vector<BoxRect> ret(k);
+        for (U32 i = 0; i < k; i++) {
+            ret[i] = this->boxes[this->order[i]];
+        }
+        return ret;
+    }
+
+private:
+    const std::vector<BoxRect> &boxes;
+    std::vector<U32> order;
+    U32 sorted;
+};
+
+// sort boxes by descending score and keep the first k, only the kept boxes are sorted.
+inline void sort_boxes(std::vector<BoxRect> &boxes, U32 k)
+{
+    BoxOrder order(boxes);
+    std::vector<BoxRect> ret = order.gather(k);
+    boxes.swap(ret);
 }
 
-inline std::vector<I32> nms_pickedboxes(const std::vector<BoxRect> &boxes, F32 nms_threshold)
+// visit boxes in descending score order and return indexes of the picked ones. boxes are
+// replaced with the visited boxes in that order, at most topK boxes are visited and visiting
+// stops when maxPicked boxes are picked. Boxes are sorted lazily, so a small maxPicked does not
+// sort all candidates. NMS_MATRIX replaces scores with the decayed scores.
+inline std::vector<I32> nms_pickedboxes(std::vector<BoxRect> &boxes,
+    NMSMode mode,
+    F32 nms_threshold,
+    F32 score_threshold,
+    U32 topK = UINT_MAX,
+    U32 maxPicked = UINT_MAX)
 {
-    I32 n = boxes.size();
-    std::vector<F32> areas(n);
-    for (I32 i = 0; i < n; i++) {
-        const BoxRect &box = boxes[i];
-        F32 width = box.xmax - box.xmin;
-        F32 height = box.ymax - box.ymin;
-        areas[i] = width * height;
-    }
+    U32 n = UNI_MIN(topK, (U32)boxes.size());
+    BoxOrder order(boxes);
+    // the number of sorted boxes, sorted part grows by doubling chunks
+    U32 ready = 0;
+    U32 chunk = (maxPicked < n) ? UNI_MAX(64, maxPicked * 4) : n;
+    BoxSet set;
+    set.reserve((mode == NMS_GREEDY) ? UNI_MIN(n, maxPicked) : n);
     std::vector<I32> picked;
-    picked.reserve(n);
-    for (I32 i = 0; i < n; i++) {
-        const BoxRect &a = boxes[i];
+    std::vector<F32> scores(n);
+    U32 i = 0;
+    for (; i < n && picked.size() < maxPicked; i++) {
+        if (i == ready) {
+            ready = UNI_MIN(n, ready + chunk);
+            order.sort(ready);
+            chunk *= 2;
+        }
+        const BoxRect &box = boxes[order[i]];
+        F32 area = boxarea(box);
+        scores[i] = box.score;
         bool keep = true;
-        for (U32 j = 0; j < picked.size(); j++) {
-            const BoxRect &b = boxes[picked[j]];
-            F32 inter_area = intersectionarea(a, b);
-            F32 union_area = areas[i] + areas[picked[j]] - inter_area;
-            if (inter_area / union_area > nms_threshold) {
-                keep = false;
+        switch (mode) {
+            case NMS_FAST:
+                keep = !set.overlap(box, area, nms_threshold);
+                set.push(box, area);
+                break;
+            case NMS_MATRIX: {
+                F32 iouMax, decay;
+                set.decay(box, area, &iouMax, &decay);
+                scores[i] = box.score * decay;
+                keep = scores[i] > score_threshold;
+                set.push(box, area, iouMax);
                 break;
             }
+            default:
+                keep = !set.overlap(box, area, nms_threshold);
+                if (keep) {
+                    set.push(box, area);
+                }
+                break;
         }
         if (keep) {
             picked.push_back(i);
         }
     }
+    std::vector<BoxRect> visited = order.gather(i);
+    if (mode == NMS_MATRIX) {
+        for (U32 j = 0; j < i; j++) {
+            visited[j].score = scores[j];
+        }
+    }
+    boxes.swap(visited);
     return picked;
 }
 #endif
@@ -0,0 +1,327 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "cpu/post_ops.h"
+#include "cpu/cpu_functions.h"
+#include "tensor_transpose.h"
+#include "affinity_policy.h"
+
+template <typename T>
+static void channel_scale_template(
+    T *data, U32 num, U32 cx, U32 valid, const T *alpha, const T *beta)
+{
+    for (U32 i = 0; i < num; i++, data += cx) {
+        for (U32 j = 0; j < valid; j++) {
+            data[j] = data[j] * alpha[j] + beta[j];
+        }
+    }
+}
+
+template <typename T>
+static void clip_template(T *data, U32 len, F32 min, F32 max)
+{
+    T a = min;
+    T b = max;
+    for (U32 i = 0; i < len; i++) {
+        data[i] = UNI_MIN(UNI_MAX(data[i], a), b);
+    }
+}
+
+static EE channel_scale(DataType dt,
+    void *data,
+    U32 num,
+    U32 cx,
+    U32 c,
+    U32 channels,
+    const void *alpha,
+    const void *beta,
+    Arch arch)
+{
+    EE ret = SUCCESS;
+    U32 valid = UNI_MIN(cx, channels - c);
+    switch (dt) {
+#ifdef _USE_FP32
+        case DT_F32: {
+            const F32 *a = (const F32 *)alpha + c;
+            const F32 *b = (const F32 *)beta + c;
+            if (cx == 1) {
+                get_array_scale_function(arch)(dt, data, data, num, a[0], b[0]);
+            } else {
+                channel_scale_template<F32>((F32 *)data, num, cx, valid, a, b);
+            }
+            break;
+        }
+#endif
+#ifdef _USE_FP16
+        case DT_F16: {
+            const F16 *a = (const F16 *)alpha + c;
+            const F16 *b = (const F16 *)beta + c;
+            if (cx == 1) {
+                get_array_scale_function(arch)(dt, data, data, num, a[0], b[0]);
+            } else {
+                channel_scale_template<F16>((F16 *)data, num, cx, valid, a, b);
+            }
+            break;
+        }
+#endif
+        default:
+            ret = NOT_SUPPORTED;
+            break;
+    }
+    return ret;
+}
+
+static EE clip(DataType dt, void *data, U32 len, ClipParamSpec p)
+{
+    EE ret = SUCCESS;
+    switch (dt) {
+#ifdef _USE_FP32
+        case DT_F32:
+            clip_template<F32>((F32 *)data, len, p.min, p.max);
+            break;
+#endif
+#ifdef _USE_FP16
+        case DT_F16:
+            clip_template<F16>((F16 *)data, len, p.min, p.max);
+            break;
+#endif
+        default:
+            ret = NOT_SUPPORTED;
+            break;
+    }
+    return ret;
+}
+
+// element offset of coordinates(in the order of dims) in data of desc, channels of NCHWC8 and
+// NCHWC16 are blocked.
+static U32 element_offset(TensorDesc desc, const U32 *coord)
+{
+    U32 cx = (desc.df == DF_NCHWC8) ? 8 : ((desc.df == DF_NCHWC16) ? 16 : 1);
+    if (cx == 1 || desc.nDims < 3) {
+        U32 offset = 0;
+        for (I32 i = desc.nDims - 1; i >= 0; i--) {
+            offset = offset * desc.dims[i] + coord[i];
+        }
+        return offset;
+    }
+    U32 c = desc.nDims - 2;
+    U32 outer = 0;
+    for (U32 i = desc.nDims - 1; i > c; i--) {
+        outer = outer * desc.dims[i] + coord[i];
+    }
+    U32 inner = 0, hw = 1;
+    for (I32 i = c - 1; i >= 0; i--) {
+        inner = inner * desc.dims[i] + coord[i];
+        hw *= desc.dims[i];
+    }
+    U32 blocks = (desc.dims[c] + cx - 1) / cx;
+    return ((outer * blocks + coord[c] / cx) * hw + inner) * cx + coord[c] % cx;
+}
+
+// eltwise input that has less elements than output is broadcasted to the shape and layout of
+// output, dims of size 1 are repeated.
+static EE broadcast_to(TensorDesc desc, const void *data, TensorDesc outputDesc, void *dst)
+{
+    if (desc.nDims > outputDesc.nDims) {
+        return NOT_MATCH;
+    }
+    for (U32 i = 0; i < desc.nDims; i++) {
+        if (desc.dims[i] != 1 && desc.dims[i] != outputDesc.dims[i]) {
+            return NOT_MATCH;
+        }
+    }
+    U32 bytes = bytesOf(outputDesc.dt);
+    U32 num = tensorNumElements(outputDesc);
+    U32 coord[DIM_LEN], src[DIM_LEN];
+    for (U32 i = 0; i < num; i++) {
+        for (U32 j = 0, k = i; j < outputDesc.nDims; j++) {
+            coord[j] = k % outputDesc.dims[j];
+            k /= outputDesc.dims[j];
+            if (j < desc.nDims) {
+                src[j] = (desc.dims[j] == 1) ? 0 : coord[j];
+            }
+        }
+        UNI_MEMCPY((U8 *)dst + element_offset(outputDesc, coord) * bytes,
+            (const U8 *)data + element_offset(desc, src) * bytes, bytes);
+    }
+    return SUCCESS;
+}
+
+EE post_ops_prepare_cpu(PostOpsParamSpec p,
+    std::vector<TensorDesc> eltwiseDesc,
+    std::vector<void *> eltwise,
+    const void *scale,
+    void *tmp,
+    TensorDesc outputDesc,
+    PostOpsArgs *args)
+{
+    if (eltwiseDesc.size() != get_post_ops_input_num(p) || eltwise.size() != eltwiseDesc.size() ||
+        (get_post_ops_channel_wise_num(p) > 0 && scale == nullptr)) {
+        return NOT_MATCH;
+    }
+    args->p = p;
+    args->dt = outputDesc.dt;
+    args->channels = (outputDesc.nDims > 1) ? outputDesc.dims[outputDesc.nDims - 2] : 1;
+    args->scale = scale;
+    args->done = false;
+    U8 *ptr = (U8 *)tmp;
+    for (U32 i = 0; i < eltwise.size(); i++) {
+        if (eltwiseDesc[i].dt != outputDesc.dt) {
+            return NOT_MATCH;
+        }
+        if (post_ops_same_layout(eltwiseDesc[i], outputDesc)) {
+            args->eltwise[i] = eltwise[i];
+            continue;
+        }
+        if (tensorNumElements(eltwiseDesc[i]) == tensorNumElements(outputDesc)) {
+            CHECK_STATUS(transformFormat(eltwiseDesc[i], eltwise[i], outputDesc, ptr));
+        } else {
+            EE ret = broadcast_to(eltwiseDesc[i], eltwise[i], outputDesc, ptr);
+            if (ret != SUCCESS) {
+                return ret;
+            }
+        }
+        args->eltwise[i] = ptr;
+        ptr += tensorNumBytes(outputDesc);
+    }
+    return SUCCESS;
+}
+
+EE post_ops_check_cpu(const PostOpsArgs *args)
+{
+    EE ret = NOT_SUPPORTED;
+    switch (args->dt) {
+#ifdef _USE_FP32
+        case DT_F32:
+            ret = SUCCESS;
+            break;
+#endif
+#ifdef _USE_FP16
+        case DT_F16:
+            ret = SUCCESS;
+            break;
+#endif
+        default:
+            break;
+    }
+    for (U32 i = 0; i < args->p.num && ret == SUCCESS; i++) {
+        switch (args->p.ops[i].type) {
+            case POST_OP_ELTWISE_SUM:
+            case POST_OP_SCALE:
+            case POST_OP_CLIP:
+            case POST_OP_ACTIVATION:
+                break;
+            default:
+                ret = NOT_SUPPORTED;
+                break;
+        }
+    }
+    return ret;
+}
+
+EE post_ops_cpu_block(
+    const PostOpsArgs *args, void *output, U32 offset, U32 num, U32 cx, U32 c, Arch arch)
+{
+    DataType dt = args->dt;
+    U32 bytes = bytesOf(dt);
+    U8 *data = (U8 *)output + offset * bytes;
+    U32 len = num * cx;
+    const U8 *scale = (const U8 *)args->scale;
+    U32 eltwiseId = 0;
+    EE ret = SUCCESS;
+    for (U32 i = 0; i < args->p.num && ret == SUCCESS; i++) {
+        const PostOpSpec &op = args->p.ops[i];
+        switch (op.type) {
+            case POST_OP_ELTWISE_SUM: {
+                const U8 *addend = (const U8 *)args->eltwise[eltwiseId++] + offset * bytes;
+                get_array_add_function(arch)(dt, data, addend, data, len);
+                break;
+            }
+            case POST_OP_SCALE: {
+                if (!op.channel_wise) {
+                    get_array_scale_function(arch)(dt, data, data, len, op.alpha, op.beta);
+                    break;
+                }
+                const U8 *alpha = scale;
+                const U8 *beta = alpha + args->channels * bytes;
+                scale = beta + args->channels * bytes;
+                ret = channel_scale(dt, data, num, cx, c, args->channels, alpha, beta, arch);
+                break;
+            }
+            case POST_OP_CLIP: {
+                ret = clip(dt, data, len, op.activation_spec.clip_spec);
+                break;
+            }
+            case POST_OP_ACTIVATION: {
+                ActivationParamSpec activationDesc;
+                activationDesc.mode = op.activation_type;
+                activationDesc.value[0] = op.activation_spec.relu_spec.neg_slope;
+                ret = get_array_activation_function(arch)(
+                    dt, data, len, activationDesc, data, nullptr);
+                break;
+            }
+            default:
+                ret = NOT_SUPPORTED;
+                break;
+        }
+    }
+    return ret;
+}
+
+EE post_ops_cpu(const PostOpsArgs *args, TensorDesc outputDesc, void *output, Arch arch)
+{
+    if (args->p.num == 0) {
+        return SUCCESS;
+    }
+    if (outputDesc.dt != args->dt || nullptr == output) {
+        return NOT_MATCH;
+    }
+    // an unit is num groups of cx channels
+    U32 units, num, cx, channels, blocks, rows;
+    if ((outputDesc.df == DF_NCHWC8 || outputDesc.df == DF_NCHWC16 || outputDesc.df == DF_NCHW) &&
+        outputDesc.nDims >= 3) {
+        cx = (outputDesc.df == DF_NCHWC8) ? 8 : ((outputDesc.df == DF_NCHWC16) ? 16 : 1);
+        channels = outputDesc.dims[outputDesc.nDims - 2];
+        blocks = (channels + cx - 1) / cx;
+        num = 1;
+        for (U32 i = 0; i < outputDesc.nDims - 2; i++) {
+            num *= outputDesc.dims[i];
+        }
+        units = outputDesc.dims[outputDesc.nDims - 1] * blocks;
+        rows = units * num;
+    } else {
+        cx = outputDesc.dims[0];
+        channels = cx;
+        blocks = 1;
+        rows = tensorNumElements(outputDesc) / cx;
+        // split rows so that every thread has work
+        num = UNI_MAX(1, UNI_MIN(rows, 4096 / UNI_MAX(1, cx)));
+        units = (rows + num - 1) / num;
+    }
+    if (channels != args->channels && get_post_ops_channel_wise_num(args->p) > 0) {
+        return NOT_MATCH;
+    }
+    EE ret = SUCCESS;
+#ifdef _USE_OPENMP
+#pragma omp parallel for num_threads(OMP_NUM_THREADS)
+#endif
+    for (U32 u = 0; u < units; u++) {
+        U32 c = (u % blocks) * cx;
+        U32 n = UNI_MIN(num, rows - u * num);
+        EE r = post_ops_cpu_block(args, output, u * num * cx, n, cx, c, arch);
+        if (r != SUCCESS) {
+            ret = r;
+        }
+    }
+    return ret;
+}
@@ -0,0 +1,80 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef _H_POST_OPS_CPU
+#define _H_POST_OPS_CPU
+
+#include <vector>
+#include "sys.h"
+#include "parameter_spec.h"
+#include "tensor_desc.h"
+
+// Runtime arguments of PostOpsParamSpec. Eltwise inputs have the same layout as output, so an
+// output element and its addends share one offset. Inputs of other layout or broadcasted ones are
+// copied into tmp by post_ops_prepare_cpu.
+typedef struct {
+    PostOpsParamSpec p;
+    DataType dt;
+    U32 channels;
+    const void *eltwise[MAX_POST_OPS];
+    // alpha and beta vectors of every channel wise scale, (alpha0, beta0, alpha1, beta1, ...)
+    const void *scale;
+    // set by kernel that has applied post ops when storing output
+    bool done;
+} PostOpsArgs;
+
+// data format that eltwise input can be added to output without transform.
+inline bool post_ops_same_layout(TensorDesc a, TensorDesc b)
+{
+    if (tensorNumElements(a) != tensorNumElements(b)) {
+        return false;
+    }
+    bool blockA = (a.df == DF_NCHWC8 || a.df == DF_NCHWC16);
+    bool blockB = (b.df == DF_NCHWC8 || b.df == DF_NCHWC16);
+    if (blockA || blockB) {
+        return a.df == b.df && a.dims[a.nDims - 2] == b.dims[b.nDims - 2];
+    }
+    return true;
+}
+
+// bytes to keep eltwise inputs whose layout is not the same as output.
+inline U32 post_ops_tmp_bytes_cpu(std::vector<TensorDesc> eltwiseDesc, TensorDesc outputDesc)
+{
+    U32 bytes = 0;
+    for (U32 i = 0; i < eltwiseDesc.size(); i++) {
+        if (!post_ops_same_layout(eltwiseDesc[i], outputDesc)) {
+            bytes += tensorNumBytes(outputDesc);
+        }
+    }
+    return bytes;
+}
+
+EE post_ops_prepare_cpu(PostOpsParamSpec p,
+    std::vector<TensorDesc> eltwiseDesc,
+    std::vector<void *> eltwise,
+    const void *scale,
+    void *tmp,
+    TensorDesc outputDesc,
+    PostOpsArgs *args);
+
+// check data type and op types up front, so that callers can apply blocks inside a parallel
+// region without stopping there.
+EE post_ops_check_cpu(const PostOpsArgs *args);
+
+// apply post ops to num groups of cx elements at element offset of output, group covers channels
+// [c, c + cx). cx is 1 for NCHW, 8 for NCHWC8 and row length for fc/matmul.
+EE post_ops_cpu_block(
+    const PostOpsArgs *args, void *output, U32 offset, U32 num, U32 cx, U32 c, Arch arch);
+
+EE post_ops_cpu(const PostOpsArgs *args, TensorDesc outputDesc, void *output, Arch arch);
+#endif
@@ -464,7 +464,8 @@ EE rnn_cpu(TensorDesc inputDesc,
         if (IS_GENERAL(arch)) {
             mmmFilterDesc = tensor2df(fdt, DF_TRANSPOSE, fn, xDim);
         } else {
-            mmmFilterDesc = tensor2df(fdt, matrix_matrix_multiply_rhs_format(fdt), xDim, fn);
+            mmmFilterDesc =
+                tensor2df(fdt, matrix_matrix_multiply_transform_rhs_format(fdt, arch), xDim, fn);
         }
         CHECK_STATUS(matrix_matrix_multiply(inDesc, useInput, mmmFilterDesc, mmmFilter,
             batch * step * xDim * bytesOfIdt, tmpArray, outDesc, InterGate, nullptr, arch));
@@ -0,0 +1,295 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef _H_SCALED_DOT_PRODUCT_ATTENTION_CPU
+#define _H_SCALED_DOT_PRODUCT_ATTENTION_CPU
+
+#include <vector>
+#include <math.h>
+#include "parameter_spec.h"
+#include "tensor_desc.h"
+#include "affinity_policy.h"
+#include "uni.h"
+
+// One task computes SDPA_BLOCK_Q query rows against the keys in SDPA_BLOCK_K row tiles, so the
+// score buffer of a thread is SDPA_BLOCK_Q * SDPA_BLOCK_K floats whatever the sequence length is.
+#define SDPA_BLOCK_Q 4
+#define SDPA_BLOCK_K 64
+
+typedef struct {
+    U32 batch;
+    U32 sq;
+    U32 sk;
+    U32 d;
+    U32 dv;
+    // element offset of every matrix in the broadcast batch
+    std::vector<U32> qOffset;
+    std::vector<U32> kOffset;
+    std::vector<U32> vOffset;
+    std::vector<U32> maskOffset;
+    // 0 when all query rows share one mask row
+    U32 maskRowStride;
+    // elements between rows of K, d when K is transposed
+    U32 kRowStride;
+} AttentionShape;
+
+inline void attention_batch_offset(
+    TensorDesc desc, U32 nDims, const U32 *batchDims, U32 batch, std::vector<U32> *offset)
+{
+    offset->resize(batch);
+    for (U32 b = 0; b < batch; b++) {
+        U32 id = b, off = 0;
+        U32 stride = desc.dims[0] * ((desc.nDims > 1) ? desc.dims[1] : 1);
+        for (U32 i = 2; i < nDims; i++) {
+            U32 dim = (i < desc.nDims) ? desc.dims[i] : 1;
+            U32 x = id % batchDims[i];
+            id /= batchDims[i];
+            if (dim != 1) {
+                off += x * stride;
+            }
+            stride *= dim;
+        }
+        (*offset)[b] = off;
+    }
+}
+
+// Q [..., Sq, D], K [..., Sk, D] (transpose_k) or [..., D, Sk], V [..., Sk, Dv],
+// optional additive mask [..., Sq or 1, Sk], batch dims are broadcast like MatMul.
+// kvCapacity > 0 means that K and V are laid out with kvCapacity rows on the Sk axis, of which
+// the first Sk are used(e.g. a kv cache that is appended in place), 0 means they are dense.
+inline EE attention_infer_shape(TensorDesc qDesc,
+    TensorDesc kDesc,
+    TensorDesc vDesc,
+    const TensorDesc *maskDesc,
+    bool transposeK,
+    AttentionShape *shape,
+    TensorDesc *outputDesc,
+    U32 kvCapacity = 0)
+{
+    if (qDesc.nDims < 2 || kDesc.nDims < 2 || vDesc.nDims < 2 ||
+        (maskDesc != nullptr && maskDesc->nDims < 1)) {
+        return NOT_MATCH;
+    }
+    if (qDesc.df == DF_NCHWC8 || kDesc.df == DF_NCHWC8 || vDesc.df == DF_NCHWC8 ||
+        (maskDesc != nullptr && maskDesc->df == DF_NCHWC8)) {
+        return NOT_SUPPORTED;
+    }
+    shape->d = qDesc.dims[0];
+    shape->sq = qDesc.dims[1];
+    U32 kd = kDesc.dims[1];
+    shape->sk = kDesc.dims[0];
+    if (transposeK) {
+        kd = kDesc.dims[0];
+        shape->sk = kDesc.dims[1];
+    }
+    shape->dv = vDesc.dims[0];
+    if (kd != shape->d || vDesc.dims[1] != shape->sk ||
+        (kvCapacity > 0 && kvCapacity < shape->sk)) {
+        return NOT_MATCH;
+    }
+    shape->kRowStride = transposeK ? shape->d : shape->sk;
+    if (kvCapacity > 0) {
+        // offsets of the batch follow the memory layout
+        kDesc.dims[transposeK ? 1 : 0] = kvCapacity;
+        vDesc.dims[1] = kvCapacity;
+        if (!transposeK) {
+            shape->kRowStride = kvCapacity;
+        }
+    }
+    shape->maskRowStride = 0;
+    if (maskDesc != nullptr) {
+        if (maskDesc->dims[0] != shape->sk) {
+            return NOT_MATCH;
+        }
+        if (maskDesc->nDims > 1 && maskDesc->dims[1] != 1) {
+            if (maskDesc->dims[1] != shape->sq) {
+                return NOT_MATCH;
+            }
+            shape->maskRowStride = shape->sk;
+        }
+    }
+
+    U32 nDims = UNI_MAX(UNI_MAX(qDesc.nDims, kDesc.nDims), vDesc.nDims);
+    if (maskDesc != nullptr) {
+        nDims = UNI_MAX(nDims, maskDesc->nDims);
+    }
+    U32 batchDims[DIM_LEN];
+    const TensorDesc *descs[4] = {&qDesc, &kDesc, &vDesc, maskDesc};
+    shape->batch = 1;
+    for (U32 i = 2; i < nDims; i++) {
+        batchDims[i] = 1;
+        for (U32 j = 0; j < 4; j++) {
+            if (descs[j] == nullptr || i >= descs[j]->nDims || descs[j]->dims[i] == 1) {
+                continue;
+            }
+            if (batchDims[i] != 1 && batchDims[i] != descs[j]->dims[i]) {
+                return NOT_MATCH;
+            }
+            batchDims[i] = descs[j]->dims[i];
+        }
+        shape->batch *= batchDims[i];
+    }
+    if (outputDesc != nullptr) {
+        *outputDesc = qDesc;
+        outputDesc->nDims = nDims;
+        outputDesc->dims[0] = shape->dv;
+        for (U32 i = 2; i < nDims; i++) {
+            outputDesc->dims[i] = batchDims[i];
+        }
+    }
+    attention_batch_offset(qDesc, nDims, batchDims, shape->batch, &shape->qOffset);
+    attention_batch_offset(kDesc, nDims, batchDims, shape->batch, &shape->kOffset);
+    attention_batch_offset(vDesc, nDims, batchDims, shape->batch, &shape->vOffset);
+    if (maskDesc != nullptr) {
+        attention_batch_offset(*maskDesc, nDims, batchDims, shape->batch, &shape->maskOffset);
+    }
+    return SUCCESS;
+}
+
+inline U32 attention_tmp_elements_per_thread(const AttentionShape &shape)
+{
+    // scores, output accumulator, running max and running sum
+    return SDPA_BLOCK_Q * (SDPA_BLOCK_K + shape.dv + 2);
+}
+
+// Flash attention: scores of one key tile are softmax-ed against the running row max, and the
+// partial output is rescaled whenever the max grows, so the Sq x Sk matrix is never stored.
+// Kernel provides the vector primitives, which always accumulate in F32:
+//   dot(a, b, len)                  return sum(a * b)
+//   axpy(alpha, x, y, len)          y += alpha * x
+//   scale(y, len, alpha)            y *= alpha
+//   scale_add(y, alpha, mask, len)  y = alpha * y + mask, mask may be nullptr
+//   max(x, len)                     return max(x)
+//   exp_sum(x, len, max)            x = exp(x - max), return sum(x)
+//   store(acc, alpha, out, len)     out = alpha * acc
+template <typename T, class Kernel>
+EE flash_attention(const AttentionShape &shape,
+    const T *q,
+    const T *k,
+    const T *v,
+    const T *mask,
+    ScaledDotProductAttentionParamSpec p,
+    F32 *tmp,
+    T *output)
+{
+    if (nullptr == q || nullptr == k || nullptr == v || nullptr == tmp || nullptr == output) {
+        CHECK_STATUS(NULL_POINTER);
+    }
+    const U32 sq = shape.sq, sk = shape.sk, d = shape.d, dv = shape.dv;
+    const U32 tile = attention_tmp_elements_per_thread(shape);
+    const I32 qBlockNum = (sq + SDPA_BLOCK_Q - 1) / SDPA_BLOCK_Q;
+    const I32 taskNum = shape.batch * qBlockNum;
+#ifdef _USE_OPENMP
+#pragma omp parallel for num_threads(OMP_NUM_THREADS) schedule(dynamic)
+#endif
+    for (I32 task = 0; task < taskNum; task++) {
+#ifdef _USE_OPENMP
+        F32 *score = tmp + tile * omp_get_thread_num();
+#else
+        F32 *score = tmp;
+#endif
+        F32 *acc = score + SDPA_BLOCK_Q * SDPA_BLOCK_K;
+        F32 *rowMax = acc + SDPA_BLOCK_Q * dv;
+        F32 *rowSum = rowMax + SDPA_BLOCK_Q;
+        U32 b = task / qBlockNum;
+        U32 q0 = (task % qBlockNum) * SDPA_BLOCK_Q;
+        U32 rows = UNI_MIN((U32)SDPA_BLOCK_Q, sq - q0);
+        const T *qPtr = q + shape.qOffset[b] + q0 * d;
+        const T *kPtr = k + shape.kOffset[b];
+        const T *vPtr = v + shape.vOffset[b];
+        const T *maskPtr = nullptr;
+        if (mask != nullptr) {
+            maskPtr = mask + shape.maskOffset[b] + q0 * shape.maskRowStride;
+        }
+        for (U32 r = 0; r < rows; r++) {
+            rowMax[r] = -INFINITY;
+            rowSum[r] = 0;
+        }
+        UNI_MEMSET(acc, 0, rows * dv * sizeof(F32));
+
+        for (U32 c0 = 0; c0 < sk; c0 += SDPA_BLOCK_K) {
+            U32 cols = UNI_MIN((U32)SDPA_BLOCK_K, sk - c0);
+            for (U32 r = 0; r < rows; r++) {
+                F32 *s = score + r * SDPA_BLOCK_K;
+                const T *qRow = qPtr + r * d;
+                if (p.transpose_k) {
+                    for (U32 c = 0; c < cols; c++) {
+                        s[c] = Kernel::dot(qRow, kPtr + (c0 + c) * d, d);
+                    }
+                } else {
+                    UNI_MEMSET(s, 0, cols * sizeof(F32));
+                    for (U32 i = 0; i < d; i++) {
+                        Kernel::axpy(qRow[i], kPtr + i * shape.kRowStride + c0, s, cols);
+                    }
+                }
+                const T *maskRow = nullptr;
+                if (maskPtr != nullptr) {
+                    maskRow = maskPtr + r * shape.maskRowStride + c0;
+                }
+                Kernel::scale_add(s, p.scale, maskRow, cols);
+
+                F32 m = UNI_MAX(rowMax[r], Kernel::max(s, cols));
+                if (m == -INFINITY) {
+                    // the whole tile is masked out
+                    continue;
+                }
+                F32 *accRow = acc + r * dv;
+                if (m > rowMax[r]) {
+                    F32 correction = exp(rowMax[r] - m);
+                    rowSum[r] *= correction;
+                    Kernel::scale(accRow, dv, correction);
+                    rowMax[r] = m;
+                }
+                rowSum[r] += Kernel::exp_sum(s, cols, m);
+                for (U32 c = 0; c < cols; c++) {
+                    Kernel::axpy(s[c], vPtr + (c0 + c) * dv, accRow, dv);
+                }
+            }
+        }
+        T *outPtr = output + ((U64)b * sq + q0) * dv;
+        for (U32 r = 0; r < rows; r++) {
+            F32 alpha = (rowSum[r] > 0) ? 1 / rowSum[r] : 0;
+            Kernel::store(acc + r * dv, alpha, outPtr + r * dv, dv);
+        }
+    }
+    return SUCCESS;
+}
+
+// inputs are Q, K, V and the optional mask
+template <typename T, class Kernel>
+EE scaled_dot_product_attention_cpu(std::vector<TensorDesc> inputDesc,
+    std::vector<void *> input,
+    ScaledDotProductAttentionParamSpec p,
+    U32 kvCapacity,
+    void *tmp,
+    void *output)
+{
+    if (inputDesc.size() < 3 || inputDesc.size() != input.size()) {
+        return NOT_MATCH;
+    }
+    const TensorDesc *maskDesc = nullptr;
+    const T *mask = nullptr;
+    if (inputDesc.size() > 3) {
+        maskDesc = &inputDesc[3];
+        mask = (const T *)input[3];
+    }
+    AttentionShape shape;
+    EE ret = attention_infer_shape(inputDesc[0], inputDesc[1], inputDesc[2], maskDesc,
+        p.transpose_k, &shape, nullptr, kvCapacity);
+    if (ret == SUCCESS) {
+        ret = flash_attention<T, Kernel>(shape, (const T *)input[0], (const T *)input[1],
+            (const T *)input[2], mask, p, (F32 *)tmp, (T *)output);
+    }
+    return ret;
+}
+#endif
@@ -19,27 +19,15 @@
 #include "cpu/x86/int8/tensor_computing_int8.h"
 #endif
 #include "tensor_transpose.h"
+#include "ut_util.h"
 
-EE convolution_infer_forward_algorithm_x86(TensorDesc inputDesc,
+static EE convolution_infer_forward_algorithm_fastest_x86(TensorDesc inputDesc,
     TensorDesc filterDesc,
     TensorDesc outputDesc,
     ConvolutionParamSpec convParamSpec,
-    ConvolutionPolicy policy,
     ConvolutionForwardAlgorithm *algorithm,
     DataType targetDataType)
 {
-    UNUSED(filterDesc);
-    UNUSED(outputDesc);
-    UNUSED(convParamSpec);
-    UNUSED(policy);
-    UNUSED(targetDataType);
-    if (nullptr == algorithm) {
-        CHECK_STATUS(NULL_POINTER);
-    }
-    if (*algorithm != CONVOLUTION_ALGORITHM_NULL) {
-        return SUCCESS;
-    }
-
     U32 group = convParamSpec.group;
     U32 strideH = convParamSpec.stride_h;
     U32 strideW = convParamSpec.stride_w;
@@ -102,6 +90,115 @@ EE convolution_infer_forward_algorithm_x86(TensorDesc inputDesc,
     return SUCCESS;
 }
 
+// time fp32 candidates on random data of the real layer shape, the fastest one is kept.
+static EE convolution_tune_algorithm_x86(TensorDesc inputDesc,
+    TensorDesc filterDesc,
+    TensorDesc outputDesc,
+    ConvolutionParamSpec convParamSpec,
+    ConvolutionForwardAlgorithm *algorithm,
+    DataType targetDataType,
+    Arch arch)
+{
+    if (!tensorIs4d(inputDesc) || inputDesc.df != DF_NCHWC8 || inputDesc.dims[2] % 8 != 0 ||
+        targetDataType != DT_F32 || filterDesc.dt != DT_F32 || convParamSpec.group != 1) {
+        return SUCCESS;
+    }
+    std::vector<ConvolutionForwardAlgorithm> candidates;
+    U32 fh = filterDesc.dims[1];
+    U32 fw = filterDesc.dims[0];
+    if (fh == 1 && fw == 1) {
+        candidates = {CONVOLUTION_ALGORITHM_POINTWISE, CONVOLUTION_ALGORITHM_DIRECT};
+#ifndef _USE_X86_ARM_CONSISTENCY
+    } else if (fh == 3 && fw == 3 && convParamSpec.stride_h == 1 && convParamSpec.stride_w == 1 &&
+        convParamSpec.dilatedRate_h == 1 && convParamSpec.dilatedRate_w == 1 &&
+        outputDesc.dims[0] * outputDesc.dims[1] >= 64) {
+        candidates = {CONVOLUTION_ALGORITHM_WINOGRAD, CONVOLUTION_ALGORITHM_DIRECT};
+#endif
+    } else {
+        return SUCCESS;
+    }
+
+    U32 filterBytes = 0, tmpBytes = 0;
+    for (U32 i = 0; i < candidates.size(); i++) {
+        U32 bytes = 0;
+        CHECK_STATUS(convolution_transform_filter_bytes_x86(
+            filterDesc, convParamSpec, candidates[i], &bytes));
+        filterBytes = UNI_MAX(filterBytes, bytes);
+        CHECK_STATUS(convolution_infer_forward_tmp_bytes_x86(
+            inputDesc, filterDesc, outputDesc, convParamSpec, candidates[i], &bytes));
+        tmpBytes = UNI_MAX(tmpBytes, bytes);
+    }
+    TensorDesc biasDesc = tensor1d(DT_F32, outputDesc.dims[2]);
+    U8 *input = ut_input_v(tensorNumElements(inputDesc), DT_F32, UT_INIT_RANDOM);
+    U8 *filter = ut_input_v(tensorNumElements(filterDesc), DT_F32, UT_INIT_RANDOM);
+    U8 *bias = ut_input_v(tensorNumElements(biasDesc), DT_F32, UT_INIT_RANDOM);
+    U8 *filterTransformed = (U8 *)malloc(filterBytes);
+    U8 *tmp = (U8 *)malloc(tmpBytes);
+    U8 *output = (U8 *)malloc(tensorNumBytes(outputDesc));
+    ActivationParamSpec activationDesc;
+    activationDesc.mode = ACTIVATION_NULL;
+    double bestTime = -1;
+    for (U32 i = 0; i < candidates.size(); i++) {
+        TensorDesc ftmDesc;
+        if (convolution_transform_filter_x86(filterDesc, filter, convParamSpec, candidates[i],
+                &ftmDesc, filterTransformed) != SUCCESS) {
+            continue;
+        }
+        // the first run warms up caches and threads, the best of the others is used.
+        double time = -1;
+        for (U32 loop = 0; loop < 4; loop++) {
+            double start = ut_time_ms();
+            EE ret = convolution_x86(inputDesc, input, nullptr, ftmDesc, filterTransformed,
+                convParamSpec, candidates[i], biasDesc, nullptr, biasDesc, bias, tmpBytes, tmp,
+                outputDesc, output, activationDesc, nullptr, arch);
+            double end = ut_time_ms();
+            if (ret != SUCCESS) {
+                time = -1;
+                break;
+            }
+            if (loop > 0 && (time < 0 || end - start < time)) {
+                time = end - start;
+            }
+        }
+        UNI_DEBUG_LOG("convolution algorithm %d takes %f ms.\n", candidates[i], time);
+        if (time >= 0 && (bestTime < 0 || time < bestTime)) {
+            bestTime = time;
+            *algorithm = candidates[i];
+        }
+    }
+    free(input);
+    free(filter);
+    free(bias);
+    free(filterTransformed);
+    free(tmp);
+    free(output);
+    return SUCCESS;
+}
+
+EE convolution_infer_forward_algorithm_x86(TensorDesc inputDesc,
+    TensorDesc filterDesc,
+    TensorDesc outputDesc,
+    ConvolutionParamSpec convParamSpec,
+    ConvolutionPolicy policy,
+    ConvolutionForwardAlgorithm *algorithm,
+    DataType targetDataType,
+    Arch arch)
+{
+    if (nullptr == algorithm) {
+        CHECK_STATUS(NULL_POINTER);
+    }
+    if (*algorithm != CONVOLUTION_ALGORITHM_NULL) {
+        return SUCCESS;
+    }
+    EE ret = convolution_infer_forward_algorithm_fastest_x86(
+        inputDesc, filterDesc, outputDesc, convParamSpec, algorithm, targetDataType);
+    if (ret == SUCCESS && policy == CONVOLUTION_TUNNING) {
+        ret = convolution_tune_algorithm_x86(
+            inputDesc, filterDesc, outputDesc, convParamSpec, algorithm, targetDataType, arch);
+    }
+    return ret;
+}
+
 EE convolution_transform_filter_bytes_x86(TensorDesc filterDesc,
     ConvolutionParamSpec convParamSpec,
     ConvolutionForwardAlgorithm algorithm,
@@ -246,6 +343,7 @@ EE convolution_x86(TensorDesc inputDesc,
     TensorDesc outputDesc,
     void *output,
     ActivationParamSpec activationDesc,
+    PostOpsArgs *postOps,
     Arch arch)
 {
     U32 group = convParamSpec.group;
@@ -340,7 +438,7 @@ EE convolution_x86(TensorDesc inputDesc,
                     ret = convolution_fp32(tmpInputDesc, (F32 *)tmpInput, (F32 *)eltwiseInput,
                         tmpFilterDesc, (F32 *)tmpFilter, convParamSpec, algorithm, tmpBiasDesc,
                         (F32 *)tmpBias, tmpBytes, tmp, tmpOutputDesc, (F32 *)tmpOutput,
-                        activationDesc, arch);
+                        activationDesc, (group == 1 && outerBatch == 1) ? postOps : nullptr, arch);
                     break;
                 }
 #endif
@@ -183,7 +183,7 @@ EE deconvolution_pointwise_x86(TensorDesc inputDesc,
     tmp = (void *)(convOut + tensorNumBytes(convOutDesc));
     convolution_x86(inputDesc, input, nullptr, filterDesc, filter, p,
         CONVOLUTION_ALGORITHM_POINTWISE, scaleDesc, scale, convBiasDesc, convBias, tmpBytes, tmp,
-        convOutDesc, convOut, convActivationDesc, arch);
+        convOutDesc, convOut, convActivationDesc, nullptr, arch);
 
     void *OriTmpOutputPtr = output;
     if (fh == convParamSpec.stride_h && fw == convParamSpec.stride_w) {
@@ -144,6 +144,7 @@ EE convolution_fp32(TensorDesc inputDesc,
     TensorDesc outputDesc,
     F32 *output,
     ActivationParamSpec activationDesc,
+    PostOpsArgs *postOps,
     Arch arch)
 {
     UNUSED(arch);
@@ -178,7 +179,8 @@ EE convolution_fp32(TensorDesc inputDesc,
             break;
         case CONVOLUTION_ALGORITHM_POINTWISE:
             ret = convolution_1x1_direct(inputDesc, input, eltwiseInput, filterDesc, filter,
-                convParamSpec, bias, tmpBytes, tmp, outputDesc, output, activationDesc);
+                convParamSpec, bias, tmpBytes, tmp, outputDesc, output, activationDesc, postOps,
+                arch);
             break;
         case CONVOLUTION_ALGORITHM_GEMM_ICNCHW:
             ret = convolution_direct_nchw(inputDesc, input, filterDesc, filter, convParamSpec,
@@ -16,6 +16,7 @@
 
 #include "cpu/x86/fp32/tensor_computing_fp32.h"
 #include "cpu/x86/fp32/convolution_functions.h"
+#include "thread_pool.h"
 
 #define BLOCK_IC_DIM 128
 #define BLOCK_OC_DIM 128
@@ -1740,7 +1741,9 @@ EE convolution_1x1_direct(TensorDesc inputDesc,
     void *tmp,
     TensorDesc outputDesc,
     F32 *outArray,
-    ActivationParamSpec activationDesc)
+    ActivationParamSpec activationDesc,
+    PostOpsArgs *postOps,
+    Arch arch)
 {
     UNUSED(tmpBytes);
     DataType idt, odt, fdt;
@@ -1830,13 +1833,16 @@ EE convolution_1x1_direct(TensorDesc inputDesc,
     if (paddingL != 0 || paddingR != 0) {
         hwBlockNums = oh;
     }
-
+    // apply post ops to output tile after the last input channel block while it is in cache
+    bool tilePostOps = (postOps != nullptr) && paddingT == 0 && paddingB == 0 && paddingL == 0 &&
+        paddingR == 0;
+    EE postRet = tilePostOps ? post_ops_check_cpu(postOps) : SUCCESS;
+    if (postRet != SUCCESS) {
+        return postRet;
+    }
 
 #ifdef _USE_OPENMP
     ocBBlockNums = ocBlockNums;
-    OpenMPController ompCtr;
-    U32 computeBlock = oc * ic;
-    ompCtr.checkAndSetOpenMP(ohowMain, BLOCK_HW_DIM, ocBlockNums, computeBlock, 4096);
 #endif
 
     // infer kernel params
@@ -1874,21 +1880,22 @@ EE convolution_1x1_direct(TensorDesc inputDesc,
         }
     }
 
-#ifdef _USE_OPENMP
-#pragma omp parallel num_threads(OMP_NUM_THREADS) if (ompCtr.useOmp)
-#endif
-    {
-        F32 *tmpI = inArray;
-        for (U32 n = 0; n < in; ++n) {
-            F32 *bInArray = inArray + n * ic * ih * iw;
-            F32 *bOutArray = outArray + n * oc * oh * ow;
-            if (strideH > 1 || strideW > 1) {
-                U32 ic8 = ic / 8;
-                tmpI = (F32 *)tmp;
-#ifdef _USE_OPENMP
-#pragma omp for schedule(static) nowait
-#endif
-                for (U32 hc = 0; hc < oh * ic8; ++hc) {
+    // the input is sampled by stride, so is the padding.
+    if (strideH > 1 || strideW > 1) {
+        paddingT = (paddingT + strideH - 1) / strideH;
+        paddingB = (paddingB + strideH - 1) / strideH;
+        paddingL = (paddingL + strideW - 1) / strideW;
+        paddingR = (paddingR + strideW - 1) / strideW;
+    }
+    for (U32 n = 0; n < in; ++n) {
+        F32 *bInArray = inArray + n * ic * ih * iw;
+        F32 *bOutArray = outArray + n * oc * oh * ow;
+        F32 *tmpI = bInArray;
+        if (strideH > 1 || strideW > 1) {
+            U32 ic8 = ic / 8;
+            tmpI = (F32 *)tmp;
+            parallel_for(oh * ic8, (double)ow * SIMDW, [&](I32 begin, I32 end) {
+                for (U32 hc = begin; hc < (U32)end; ++hc) {
                     U32 c = hc / oh;
                     U32 h = hc % oh;
                     for (U32 w = 0; w < ow; ++w) {
@@ -1899,52 +1906,47 @@ EE convolution_1x1_direct(TensorDesc inputDesc,
                             SIMDW * sizeof(F32));
                     }
                 }
-                paddingT = (paddingT + strideH - 1) / strideH;
-                paddingB = (paddingB + strideH - 1) / strideH;
-                paddingL = (paddingL + strideW - 1) / strideW;
-                paddingR = (paddingR + strideW - 1) / strideW;
-            } else {
-                tmpI = bInArray;
-            }
+            });
+        }
 
-            U32 ocbSize = 0;
-            for (U32 ocbb = 0; ocbb < ocBlockNums; ocbb += ocBBlockNums) {
-                ocbSize = UNI_MIN(ocBBlockNums, ocBlockNums - ocbb);
-                U32 hwocBlockNums = hwBlockNums * ocbSize;
-                U32 icSize = 0;
-                for (U32 icb = 0; icb < ic; icb += icSize) {
-                    icSize = UNI_MIN(ic - icb, BLOCK_IC_DIM);
-                    U32 flags = (icb > 0) | (eltwiseInput != nullptr) << 1;
-                    if (icb == ic - icSize) {
-                        flags |= U32(activationDesc.mode) << 2;
-                    }
+        U32 ocbSize = 0;
+        for (U32 ocbb = 0; ocbb < ocBlockNums; ocbb += ocBBlockNums) {
+            ocbSize = UNI_MIN(ocBBlockNums, ocBlockNums - ocbb);
+            U32 hwocBlockNums = hwBlockNums * ocbSize;
+            U32 icSize = 0;
+            for (U32 icb = 0; icb < ic; icb += icSize) {
+                icSize = UNI_MIN(ic - icb, BLOCK_IC_DIM);
+                U32 flags = (icb > 0) | (eltwiseInput != nullptr) << 1;
+                if (icb == ic - icSize) {
+                    flags |= U32(activationDesc.mode) << 2;
+                }
 
-                    F32 *curI = tmpI + icb * newIw * newIh;
-                    if (phT > 0 || phB > 0) {
-                        U32 minUpper = UNI_MIN((ocbb + ocbSize) * unrollOc, oc);
-                        for (U32 oci = ocbb * unrollOc; oci < minUpper; oci += SIMDW) {
-                            __m256 biasVec = _mm256_load_ps(btmp + oci);
-                            for (U32 hw = 0; hw < phT * ow; ++hw) {
-                                _mm256_storeu_ps(bOutArray + oci * ohow + hw * SIMDW, biasVec);
-                            }
-                            for (U32 hw = (oh - phB) * ow; hw < oh * ow; ++hw) {
-                                _mm256_storeu_ps(bOutArray + oci * ohow + hw * SIMDW, biasVec);
-                            }
+                F32 *curI = tmpI + icb * newIw * newIh;
+                if (phT > 0 || phB > 0) {
+                    U32 minUpper = UNI_MIN((ocbb + ocbSize) * unrollOc, oc);
+                    for (U32 oci = ocbb * unrollOc; oci < minUpper; oci += SIMDW) {
+                        __m256 biasVec = _mm256_load_ps(btmp + oci);
+                        for (U32 hw = 0; hw < phT * ow; ++hw) {
+                            _mm256_storeu_ps(bOutArray + oci * ohow + hw * SIMDW, biasVec);
+                        }
+                        for (U32 hw = (oh - phB) * ow; hw < oh * ow; ++hw) {
+                            _mm256_storeu_ps(bOutArray + oci * ohow + hw * SIMDW, biasVec);
                         }
                     }
-                    if (paddingL == 0 && paddingR == 0) {
-#ifdef _USE_OPENMP
-#pragma omp for schedule(static)
-#endif
-                        for (U32 bIdx = 0; bIdx < hwocBlockNums; ++bIdx) {
+                }
+                if (paddingL == 0 && paddingR == 0) {
+                    // a block is blockHwDim x unrollOc outputs of icSize multiply-adds.
+                    double cost = (double)blockHwDim * unrollOc * icSize;
+                    parallel_for(hwocBlockNums, cost, [&](I32 begin, I32 end) {
+                        for (U32 bIdx = begin; bIdx < (U32)end; ++bIdx) {
                             FTZ;
                             U32 hw = (bIdx / ocbSize) * blockHwDim;
                             U32 hwSize = UNI_MIN(blockHwDim, ohowMain - hw);
                             U32 ocBlockIdx = bIdx % ocbSize + ocbb;
                             U32 ocb = GetOcIdx(ocBlockIdx, oc, unrollOc, ocbArray);
-                            U32 ocSize = UNI_MIN(unrollOc, oc - ocb);
-                            U32 unrollHw = unrollHwArray[(ocSize >> 3) - 1];
-                            ocSize = unrollOcArray[(ocSize >> 3) - 1];
+                            U32 realOcSize = UNI_MIN(unrollOc, oc - ocb);
+                            U32 unrollHw = unrollHwArray[(realOcSize >> 3) - 1];
+                            U32 ocSize = unrollOcArray[(realOcSize >> 3) - 1];
 
                             const F32 *curB = biasArray + ocb;
                             const F32 *curW = filterArray + ocb * ic + icb * ocSize;
@@ -1963,12 +1965,22 @@ EE convolution_1x1_direct(TensorDesc inputDesc,
                                 kernel[ihwSize > 1][(ocSize >> 3) - 1](
                                     calI, curW, calO, curB, calE, oStep, flags, icSize, fStep);
                             }
+                            if (tilePostOps && icb == ic - icSize) {
+                                for (U32 oci = ocb; oci < ocb + realOcSize; oci += SIMDW) {
+                                    EE r = post_ops_cpu_block(postOps, outArray,
+                                        (n * oc + oci) * ohow + hw * SIMDW, hwSize, SIMDW, oci,
+                                        arch);
+                                    if (r != SUCCESS) {
+                                        postRet = r;
+                                    }
+                                }
+                            }
                         }
-                    } else {
-#ifdef _USE_OPENMP
-#pragma omp for schedule(static)
-#endif
-                        for (U32 bIdx = 0; bIdx < hwocBlockNums; ++bIdx) {
+                    });
+                } else {
+                    double cost = (double)ow * unrollOc * icSize;
+                    parallel_for(hwocBlockNums, cost, [&](I32 begin, I32 end) {
+                        for (U32 bIdx = begin; bIdx < (U32)end; ++bIdx) {
                             FTZ;
                             U32 h = bIdx / ocbSize + phT;
                             U32 ocBlockIdx = bIdx % ocbSize + ocbb;
@@ -2003,10 +2015,13 @@ EE convolution_1x1_direct(TensorDesc inputDesc,
                                     calI, curW, calO, curB, calE, oStep, flags, icSize, fStep);
                             }
                         }
-                    }
+                    });
                 }
             }
         }
     }
-    return SUCCESS;
+    if (tilePostOps) {
+        postOps->done = true;
+    }
+    return postRet;
 }
@@ -17,6 +17,7 @@
 #include "cpu/x86/fp32/tensor_computing_fp32.h"
 #include "cpu/x86/fp32/transform_functions_fp32.h"
 #include "cpu/x86/fp32/convolution_functions.h"
+#include "thread_pool.h"
 
 #define BLOCK_IC_DIM 16
 #define BLOCK_HW_DIM 1024
@@ -1974,12 +1975,6 @@ EE convolution_direct(TensorDesc inputDesc,
     I32 hwocBlockNums = hwBlockNums * ocBlockNums;
     I32 blockIcDim = InferConvDirectBolckIcDim(BLOCK_IC_DIM, unrollOc, blockHwDim, fh, fw);
 
-#ifdef _USE_OPENMP
-    OpenMPController ompCtr;
-    U32 computeBlock = oc * fh * fw * ic;
-    ompCtr.checkAndSetOpenMP(ohow, 64, ocBlockNums, computeBlock, 4096);
-#endif
-
     // infer kernel params
     I32 oStep = oh * ow * SIMDW * 4;
     I32 iStep = (iw_pad - fw * dilateW + (dilateH - 1) * iw_pad) * SIMDW * 4;
@@ -1996,23 +1991,19 @@ EE convolution_direct(TensorDesc inputDesc,
             PaddingNCHWC8(bInArray, tmpInput, inputDesc, convParamSpec);
         }
 
-#ifdef _USE_OPENMP
-#pragma omp parallel num_threads(OMP_NUM_THREADS) if (ompCtr.useOmp)
-#endif
-        {
-            I32 flags = 0;
-            I32 icSize = 0;
-            for (I32 icbb = 0; icbb < (int)ic; icbb += icSize) {
-                icSize = UNI_MIN(blockIcDim, (int)ic - icbb);
-                flags |= (icbb > 0) + ((eltwiseInput != nullptr) << 1);
-                if (icbb == (int)ic - icSize) {
-                    flags |= U32(activationDesc.mode) << 2;
-                }
+        I32 flags = 0;
+        I32 icSize = 0;
+        for (I32 icbb = 0; icbb < (int)ic; icbb += icSize) {
+            icSize = UNI_MIN(blockIcDim, (int)ic - icbb);
+            flags |= (icbb > 0) + ((eltwiseInput != nullptr) << 1);
+            if (icbb == (int)ic - icSize) {
+                flags |= U32(activationDesc.mode) << 2;
+            }
 
-#ifdef _USE_OPENMP
-#pragma omp for schedule(static)
-#endif
-                for (I32 bIdx = 0; bIdx < hwocBlockNums; ++bIdx) {
+            // a block is blockHwDim x unrollOc outputs of icSize x fh x fw multiply-adds.
+            double cost = (double)blockHwDim * unrollOc * icSize * fh * fw;
+            parallel_for(hwocBlockNums, cost, [&](I32 begin, I32 end) {
+                for (I32 bIdx = begin; bIdx < end; ++bIdx) {
                     FTZ;
                     I32 hw = (bIdx / ocBlockNums) * blockHwDim;
                     I32 hwSize = UNI_MIN(blockHwDim, ohow - hw);
@@ -2043,7 +2034,7 @@ EE convolution_direct(TensorDesc inputDesc,
                             fh, oStep, iStep, flags, curB, dw, icSize, fStep);
                     }
                 }
-            }
+            });
         }
     }
     return SUCCESS;
@@ -13,6 +13,7 @@
 
 #include "cpu/x86/fp32/tensor_computing_fp32.h"
 #include "cpu/cpu_functions.h"
+#include "thread_pool.h"
 
 #define eltwise_kernel(velt, velts, block, in0, in1, out)                                         \
     __asm__ __volatile__("mov %0, %%ecx                       \n\t"                               \
@@ -110,90 +111,37 @@ EE eltwise_fp32(std::vector<void *> input,
         F32 *out = (F32 *)output;
         len = UNI_MIN(inputSize[0], inputSize[1]);
 
-#ifdef _USE_OPENMP
-        U32 ompBlock = ((len + OMP_NUM_THREADS - 1) / OMP_NUM_THREADS + 7) / 8 * 8;
-        U32 BLOCK = UNI_MAX(64, ompBlock);
-        U32 blockNum = (len + BLOCK - 1) / BLOCK;
-        int in_parallel = omp_in_parallel();
-        if (in_parallel != 0) {
-            BLOCK = len;
-            blockNum = 1;
+        if (eltwiseMode != ELTWISE_SUM && eltwiseMode != ELTWISE_MAX &&
+            eltwiseMode != ELTWISE_AND && eltwiseMode != ELTWISE_PROD &&
+            eltwiseMode != ELTWISE_SUB && eltwiseMode != ELTWISE_DIV) {
+            return NOT_SUPPORTED;
         }
-#pragma omp parallel num_threads(OMP_NUM_THREADS) if (in_parallel == 0)
-#endif
-        {
+        // blocks of the kernel unroll size, one element is one operation.
+        const U32 BLOCK = 32;
+        parallel_for((len + BLOCK - 1) / BLOCK, (double)BLOCK, [&](I32 begin, I32 end) {
+            U32 off = begin * BLOCK;
+            U32 blockSize = UNI_MIN(len, end * BLOCK) - off;
             switch (eltwiseMode) {
-                case ELTWISE_SUM: {
-#ifdef _USE_OPENMP
-#pragma omp for nowait
-                    for (U32 ii = 0; ii < blockNum; ++ii) {
-                        U32 off = ii * BLOCK;
-                        U32 blockSize = UNI_MIN(len - off, BLOCK);
-                        eltwise_kernel(vaddps, vaddss, blockSize, in0 + off, in1 + off, out + off);
-                    }
-#else
-                    eltwise_kernel(vaddps, vaddss, len, in0, in1, out);
-#endif
+                case ELTWISE_SUM:
+                    eltwise_kernel(vaddps, vaddss, blockSize, in0 + off, in1 + off, out + off);
                     break;
-                }
-                case ELTWISE_MAX: {
-#ifdef _USE_OPENMP
-#pragma omp for nowait
-                    for (U32 ii = 0; ii < blockNum; ++ii) {
-                        U32 off = ii * BLOCK;
-                        U32 blockSize = UNI_MIN(len - off, BLOCK);
-                        eltwise_kernel(vmaxps, vmaxss, blockSize, in0 + off, in1 + off, out + off);
-                    }
-#else
-                    eltwise_kernel(vmaxps, vmaxss, len, in0, in1, out);
-#endif
+                case ELTWISE_MAX:
+                    eltwise_kernel(vmaxps, vmaxss, blockSize, in0 + off, in1 + off, out + off);
                     break;
-                }
                 case ELTWISE_AND:
-                case ELTWISE_PROD: {
-#ifdef _USE_OPENMP
-#pragma omp for nowait
-                    for (U32 ii = 0; ii < blockNum; ++ii) {
-                        U32 off = ii * BLOCK;
-                        U32 blockSize = UNI_MIN(len - off, BLOCK);
-                        eltwise_kernel(vmulps, vmulss, blockSize, in0 + off, in1 + off, out + off);
-                    }
-#else
-                    eltwise_kernel(vmulps, vmulss, len, in0, in1, out);
-#endif
+                case ELTWISE_PROD:
+                    eltwise_kernel(vmulps, vmulss, blockSize, in0 + off, in1 + off, out + off);
                     break;
-                }
-                case ELTWISE_SUB: {
-#ifdef _USE_OPENMP
-#pragma omp for nowait
-                    for (U32 ii = 0; ii < blockNum; ++ii) {
-                        U32 off = ii * BLOCK;
-                        U32 blockSize = UNI_MIN(len - off, BLOCK);
-                        eltwise_kernel(vsubps, vsubss, blockSize, in0 + off, in1 + off, out + off);
-                    }
-#else
-                    eltwise_kernel(vsubps, vsubss, len, in0, in1, out);
-#endif
+                case ELTWISE_SUB:
+                    eltwise_kernel(vsubps, vsubss, blockSize, in0 + off, in1 + off, out + off);
                     break;
-                }
-                case ELTWISE_DIV: {
-#ifdef _USE_OPENMP
-#pragma omp for nowait
-                    for (U32 ii = 0; ii < blockNum; ++ii) {
-                        U32 off = ii * BLOCK;
-                        U32 blockSize = UNI_MIN(len - off, BLOCK);
-                        eltwise_kernel(vdivps, vdivss, blockSize, in0 + off, in1 + off, out + off);
-                    }
-#else
-                    eltwise_kernel(vdivps, vdivss, len, in0, in1, out);
-#endif
+                case ELTWISE_DIV:
+                    eltwise_kernel(vdivps, vdivss, blockSize, in0 + off, in1 + off, out + off);
                     break;
-                }
                 default:
-                    ret = NOT_SUPPORTED;
                     break;
             }
-        }
+        });
         return ret;
     }
 
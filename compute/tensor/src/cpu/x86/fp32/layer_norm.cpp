@@ -15,6 +15,7 @@
 #include <math.h>
 #include "cpu/x86/fp32/tensor_computing_fp32.h"
 #include "tensor_transpose.h"
+#include "thread_pool.h"
 
 static F32 eps = 1e-6;
 
@@ -49,17 +50,18 @@ static EE layer_norm_nhwc(
     I32 size_inner = inputDesc.dims[0];
     I32 size_outer = size / size_inner;
 
-#ifdef _USE_OPENMP
-#pragma omp parallel for num_threads(OMP_NUM_THREADS) schedule(static)
-#endif
-    for (I32 i = 0; i < size_outer; i++) {
-        F32 *current_input = input + i * size_inner;
-        F32 *current_output = output + i * size_inner;
-        F32 mean = array_mean_f32(current_input, size_inner);
-        F32 var = array_var_f32(current_input, size_inner, mean);
+    // mean, variance and scale read a row 3 times
+    parallel_for(size_outer, size_inner * 3.0, [&](I32 begin, I32 end) {
+        for (I32 i = begin; i < end; i++) {
+            F32 *current_input = input + i * size_inner;
+            F32 *current_output = output + i * size_inner;
+            F32 mean = array_mean_f32(current_input, size_inner);
+            F32 var = array_var_f32(current_input, size_inner, mean);
 
-        array_norm_scale_fp32(current_input, current_output, size_inner, mean, var, alpha, beta);
-    }
+            array_norm_scale_fp32(
+                current_input, current_output, size_inner, mean, var, alpha, beta);
+        }
+    });
     return SUCCESS;
 }
 
@@ -75,42 +77,41 @@ static EE layer_norm_nchwc8(
     }
     int c8 = c / 8;
     int nums = n * hw;
-#ifdef _USE_OPENMP
-#pragma omp parallel for num_threads(OMP_NUM_THREADS) schedule(static)
-#endif
-    for (int x = 0; x < nums; ++x) {
-        int i = x / hw;
-        int j = x % hw;
-        __m256 sum_v = _mm256_set1_ps(0);
-        for (int k = 0; k < c8; k++) {
-            int id = ((i * c8 + k) * hw + j) * 8;
-            sum_v = _mm256_add_ps(sum_v, _mm256_loadu_ps(input + id));
-        }
-        F32 mean = _mm256_sum_ps(sum_v) / c;
-        __m256 mean_v = _mm256_set1_ps(mean);
-
-        sum_v = _mm256_set1_ps(0);
-        for (int k = 0; k < c8; k++) {
-            int id = ((i * c8 + k) * hw + j) * 8;
-            __m256 tmp_v = _mm256_sub_ps(_mm256_loadu_ps(input + id), mean_v);
-            sum_v = _mm256_fmadd_ps(tmp_v, tmp_v, sum_v);
+    parallel_for(nums, c * 3.0, [&](I32 begin, I32 end) {
+        for (int x = begin; x < end; ++x) {
+            int i = x / hw;
+            int j = x % hw;
+            __m256 sum_v = _mm256_set1_ps(0);
+            for (int k = 0; k < c8; k++) {
+                int id = ((i * c8 + k) * hw + j) * 8;
+                sum_v = _mm256_add_ps(sum_v, _mm256_loadu_ps(input + id));
+            }
+            F32 mean = _mm256_sum_ps(sum_v) / c;
+            __m256 mean_v = _mm256_set1_ps(mean);
+
+            sum_v = _mm256_set1_ps(0);
+            for (int k = 0; k < c8; k++) {
+                int id = ((i * c8 + k) * hw + j) * 8;
+                __m256 tmp_v = _mm256_sub_ps(_mm256_loadu_ps(input + id), mean_v);
+                sum_v = _mm256_fmadd_ps(tmp_v, tmp_v, sum_v);
+            }
+            F32 var = _mm256_sum_ps(sum_v) / c;
+            F32 std_value = sqrt(var + eps);
+
+            __m256 std_v = _mm256_set1_ps(std_value);
+            for (int k = 0, kk = 0; k < c8; k++, kk += 8) {
+                int id = ((i * c8 + k) * hw + j) * 8;
+                __m256 in = _mm256_loadu_ps(input + id);
+                __m256 alpha_v = _mm256_loadu_ps(alpha + kk);
+                __m256 beta_v = _mm256_loadu_ps(beta + kk);
+
+                __m256 tmp_v = _mm256_sub_ps(in, mean_v);
+                tmp_v = _mm256_div_ps(tmp_v, std_v);
+                tmp_v = _mm256_fmadd_ps(alpha_v, tmp_v, beta_v);
+                _mm256_storeu_ps(output + id, tmp_v);
+            }
         }
-        F32 var = _mm256_sum_ps(sum_v) / c;
-        F32 std_value = sqrt(var + eps);
-
-        __m256 std_v = _mm256_set1_ps(std_value);
-        for (int k = 0, kk = 0; k < c8; k++, kk += 8) {
-            int id = ((i * c8 + k) * hw + j) * 8;
-            __m256 in = _mm256_loadu_ps(input + id);
-            __m256 alpha_v = _mm256_loadu_ps(alpha + kk);
-            __m256 beta_v = _mm256_loadu_ps(beta + kk);
-
-            __m256 tmp_v = _mm256_sub_ps(in, mean_v);
-            tmp_v = _mm256_div_ps(tmp_v, std_v);
-            tmp_v = _mm256_fmadd_ps(alpha_v, tmp_v, beta_v);
-            _mm256_storeu_ps(output + id, tmp_v);
-        }
-    }
+    });
     return SUCCESS;
 }
 
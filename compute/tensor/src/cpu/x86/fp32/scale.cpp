@@ -12,34 +12,51 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "cpu/x86/fp32/tensor_computing_fp32.h"
+#include "thread_pool.h"
 
-#ifdef _USE_AVX512_VNNI
+// y[elements][16] = alpha[16] * x[elements][16] + beta[16]
+X86_AVX512_TARGET static void scale_c16_avx512(
+    const F32 *input, const F32 *alpha, const F32 *beta, I32 elements, F32 *output)
+{
+    __m512 alpha_vec = (alpha == nullptr) ? _mm512_set1_ps(1.) : _mm512_loadu_ps(alpha);
+    __m512 beta_vec = (beta == nullptr) ? _mm512_set1_ps(0.) : _mm512_loadu_ps(beta);
+    for (I32 i = 0; i < elements * 16; i += 16) {
+        _mm512_storeu_ps(
+            output + i, _mm512_fmadd_ps(alpha_vec, _mm512_loadu_ps(input + i), beta_vec));
+    }
+}
+
+static void scale_c16_avx2(
+    const F32 *input, const F32 *alpha, const F32 *beta, I32 elements, F32 *output)
+{
+    __m256 alpha0 = (alpha == nullptr) ? _mm256_set1_ps(1.) : _mm256_loadu_ps(alpha);
+    __m256 alpha1 = (alpha == nullptr) ? _mm256_set1_ps(1.) : _mm256_loadu_ps(alpha + 8);
+    __m256 beta0 = (beta == nullptr) ? _mm256_set1_ps(0.) : _mm256_loadu_ps(beta);
+    __m256 beta1 = (beta == nullptr) ? _mm256_set1_ps(0.) : _mm256_loadu_ps(beta + 8);
+    for (I32 i = 0; i < elements * 16; i += 16) {
+        _mm256_storeu_ps(output + i, _mm256_fmadd_ps(alpha0, _mm256_loadu_ps(input + i), beta0));
+        _mm256_storeu_ps(
+            output + i + 8, _mm256_fmadd_ps(alpha1, _mm256_loadu_ps(input + i + 8), beta1));
+    }
+}
+
+// NCHWC16 comes from AVX-512 kernels, it is also scaled with AVX2 when the processor has no
+// avx512f.
 EE scale_nchwc16_fp32(
     F32 *input, F32 *alpha, F32 *beta, I32 in, I32 ic, I32 elements_per_channel, F32 *output)
 {
-    __m512 one = _mm512_set1_ps(1.);
-    __m512 zero = _mm512_set1_ps(0.);
+    auto kernel = (get_x86_features() & X86_AVX512F) ? scale_c16_avx512 : scale_c16_avx2;
     ic /= 16;
-#ifdef _USE_OPENMP
-#pragma omp parallel for schedule(static) num_threads(OMP_NUM_THREADS)
-#endif
-    for (int j = 0; j < in * ic; j++) {
-        int n = j / ic;
-        int c = j % ic;
-        int c8 = c * 16;
-        int index = j * elements_per_channel * 16;
-        __m512 alpha_vec = (alpha == nullptr) ? one : _mm512_loadu_ps(alpha + c8);
-        __m512 beta_vec = (beta == nullptr) ? zero : _mm512_loadu_ps(beta + c8);
-        for (I32 i = 0; i < elements_per_channel; i++) {
-            __m512 in_vec = _mm512_loadu_ps(input + index);
-            __m512 out_vec = _mm512_fmadd_ps(alpha_vec, in_vec, beta_vec);
-            _mm512_storeu_ps(output + index, out_vec);
-            index += 16;
+    parallel_for(in * ic, elements_per_channel * 16.0, [&](I32 begin, I32 end) {
+        for (int j = begin; j < end; j++) {
+            int c16 = (j % ic) * 16;
+            int index = j * elements_per_channel * 16;
+            kernel(input + index, (alpha == nullptr) ? nullptr : alpha + c16,
+                (beta == nullptr) ? nullptr : beta + c16, elements_per_channel, output + index);
         }
-    }
+    });
     return SUCCESS;
 }
-#endif
 
 EE scale_nchwc8_fp32(
     F32 *input, F32 *alpha, F32 *beta, I32 in, I32 ic, I32 elements_per_channel, F32 *output)
@@ -47,23 +64,22 @@ EE scale_nchwc8_fp32(
     __m256 one = _mm256_set1_ps(1.);
     __m256 zero = _mm256_set1_ps(0.);
     ic /= 8;
-#ifdef _USE_OPENMP
-#pragma omp parallel for schedule(static) num_threads(OMP_NUM_THREADS)
-#endif
-    for (int j = 0; j < in * ic; j++) {
-        int n = j / ic;
-        int c = j % ic;
-        int c8 = c * 8;
-        int index = j * elements_per_channel * 8;
-        __m256 alpha_vec = (alpha == nullptr) ? one : _mm256_loadu_ps(alpha + c8);
-        __m256 beta_vec = (beta == nullptr) ? zero : _mm256_loadu_ps(beta + c8);
-        for (I32 i = 0; i < elements_per_channel; i++) {
-            __m256 in_vec = _mm256_loadu_ps(input + index);
-            __m256 out_vec = _mm256_fmadd_ps(alpha_vec, in_vec, beta_vec);
-            _mm256_storeu_ps(output + index, out_vec);
-            index += 8;
+    parallel_for(in * ic, elements_per_channel * 8.0, [&](I32 begin, I32 end) {
+        for (int j = begin; j < end; j++) {
+            int n = j / ic;
+            int c = j % ic;
+            int c8 = c * 8;
+            int index = j * elements_per_channel * 8;
+            __m256 alpha_vec = (alpha == nullptr) ? one : _mm256_loadu_ps(alpha + c8);
+            __m256 beta_vec = (beta == nullptr) ? zero : _mm256_loadu_ps(beta + c8);
+            for (I32 i = 0; i < elements_per_channel; i++) {
+                __m256 in_vec = _mm256_loadu_ps(input + index);
+                __m256 out_vec = _mm256_fmadd_ps(alpha_vec, in_vec, beta_vec);
+                _mm256_storeu_ps(output + index, out_vec);
+                index += 8;
+            }
         }
-    }
+    });
     return SUCCESS;
 }
 
@@ -73,39 +89,38 @@ EE scale_nchw_fp32(
 {
     __m256 one = _mm256_set1_ps(1.);
     __m256 zero = _mm256_set1_ps(0.);
-#ifdef _USE_OPENMP
-#pragma omp parallel for schedule(static) num_threads(OMP_NUM_THREADS)
-#endif
-    for (int j = 0; j < in * ic; j++) {
-        int n = j / ic;
-        int c = j % ic;
-        U32 dst = j * elements_per_channel, src = 0;
-        __m256 alpha_vec = (alpha == nullptr) ? one : _mm256_set1_ps(alpha[c]);
-        __m256 beta_vec = (beta == nullptr) ? zero : _mm256_set1_ps(beta[c]);
-        I32 i = 0;
-        for (; i < elements_per_channel - 7; i += 8) {
-            if (icoc_equal) {
-                src = dst;
-            } else {
-                src = n * elements_per_channel + i;
+    parallel_for(in * ic, (double)elements_per_channel, [&](I32 begin, I32 end) {
+        for (int j = begin; j < end; j++) {
+            int n = j / ic;
+            int c = j % ic;
+            U32 dst = j * elements_per_channel, src = 0;
+            __m256 alpha_vec = (alpha == nullptr) ? one : _mm256_set1_ps(alpha[c]);
+            __m256 beta_vec = (beta == nullptr) ? zero : _mm256_set1_ps(beta[c]);
+            I32 i = 0;
+            for (; i < elements_per_channel - 7; i += 8) {
+                if (icoc_equal) {
+                    src = dst;
+                } else {
+                    src = n * elements_per_channel + i;
+                }
+                __m256 in_vec = _mm256_loadu_ps(input + src);
+                __m256 out_vec = _mm256_fmadd_ps(alpha_vec, in_vec, beta_vec);
+                _mm256_storeu_ps(output + dst, out_vec);
+                dst += 8;
             }
-            __m256 in_vec = _mm256_loadu_ps(input + src);
-            __m256 out_vec = _mm256_fmadd_ps(alpha_vec, in_vec, beta_vec);
-            _mm256_storeu_ps(output + dst, out_vec);
-            dst += 8;
-        }
-        for (; i < elements_per_channel; i++) {
-            if (icoc_equal) {
-                src = dst;
-            } else {
-                src = n * elements_per_channel + i;
+            for (; i < elements_per_channel; i++) {
+                if (icoc_equal) {
+                    src = dst;
+                } else {
+                    src = n * elements_per_channel + i;
+                }
+                float alpha_s = (alpha == nullptr) ? 1 : alpha[c];
+                float beta_s = (beta == nullptr) ? 0 : beta[c];
+                output[dst] = alpha_s * input[src] + beta_s;
+                dst++;
             }
-            float alpha_s = (alpha == nullptr) ? 1 : alpha[c];
-            float beta_s = (beta == nullptr) ? 0 : beta[c];
-            output[dst] = alpha_s * input[src] + beta_s;
-            dst++;
         }
-    }
+    });
     return SUCCESS;
 }
 
@@ -180,10 +195,8 @@ EE scale_fp32(F32 *input,
         }
     } else if (axis == nDims) {
         ret = scale_nchwc8_fp32(input, alpha, beta, on, oc, elements_per_channel, output);
-#ifdef _USE_AVX512_VNNI
     } else if (axis == nDims + 1) {
         ret = scale_nchwc16_fp32(input, alpha, beta, on, oc, elements_per_channel, output);
-#endif
     } else {
         CHECK_STATUS(NOT_SUPPORTED);
     }
@@ -0,0 +1,185 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "cpu/x86/fp32/tensor_computing_fp32.h"
+#include "cpu/scaled_dot_product_attention.h"
+#include "thread_affinity.h"
+
+// avx512 parts process the leading 512-bit blocks and return the index they stop at, they are
+// selected at run time so that the same binary runs on processors without avx512.
+X86_AVX512_TARGET static I32 dot_avx512(const F32 *a, const F32 *b, I32 len, F32 *sum)
+{
+    I32 i = 0;
+    __m512 sum0 = _mm512_setzero_ps();
+    __m512 sum1 = _mm512_setzero_ps();
+    for (; i < len - 31; i += 32) {
+        sum0 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i), sum0);
+        sum1 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i + 16), _mm512_loadu_ps(b + i + 16), sum1);
+    }
+    *sum = _mm512_reduce_add_ps(_mm512_add_ps(sum0, sum1));
+    return i;
+}
+
+X86_AVX512_TARGET static I32 axpy_avx512(F32 alpha, const F32 *x, F32 *y, I32 len)
+{
+    I32 i = 0;
+    __m512 alpha512 = _mm512_set1_ps(alpha);
+    for (; i < len - 15; i += 16) {
+        _mm512_storeu_ps(
+            y + i, _mm512_fmadd_ps(alpha512, _mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i)));
+    }
+    return i;
+}
+
+X86_AVX512_TARGET static I32 scale_avx512(F32 *y, I32 len, F32 alpha)
+{
+    I32 i = 0;
+    __m512 alpha512 = _mm512_set1_ps(alpha);
+    for (; i < len - 15; i += 16) {
+        _mm512_storeu_ps(y + i, _mm512_mul_ps(alpha512, _mm512_loadu_ps(y + i)));
+    }
+    return i;
+}
+
+struct AttentionKernelAVX {
+    static F32 dot(const F32 *a, const F32 *b, I32 len)
+    {
+        I32 i = 0;
+        F32 sum = 0;
+        if (get_x86_features() & X86_AVX512F) {
+            i = dot_avx512(a, b, len, &sum);
+        }
+        __m256 sum2 = _mm256_setzero_ps();
+        __m256 sum3 = _mm256_setzero_ps();
+        for (; i < len - 15; i += 16) {
+            sum2 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), sum2);
+            sum3 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8), sum3);
+        }
+        for (; i < len - 7; i += 8) {
+            sum2 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), sum2);
+        }
+        sum += _mm256_sum_ps(_mm256_add_ps(sum2, sum3));
+        for (; i < len; i++) {
+            sum += a[i] * b[i];
+        }
+        return sum;
+    }
+
+    static void axpy(F32 alpha, const F32 *x, F32 *y, I32 len)
+    {
+        I32 i = 0;
+        if (get_x86_features() & X86_AVX512F) {
+            i = axpy_avx512(alpha, x, y, len);
+        }
+        __m256 alpha256 = _mm256_set1_ps(alpha);
+        for (; i < len - 7; i += 8) {
+            _mm256_storeu_ps(
+                y + i, _mm256_fmadd_ps(alpha256, _mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i)));
+        }
+        for (; i < len; i++) {
+            y[i] += alpha * x[i];
+        }
+    }
+
+    static void scale(F32 *y, I32 len, F32 alpha)
+    {
+        I32 i = 0;
+        if (get_x86_features() & X86_AVX512F) {
+            i = scale_avx512(y, len, alpha);
+        }
+        __m256 alpha256 = _mm256_set1_ps(alpha);
+        for (; i < len - 7; i += 8) {
+            _mm256_storeu_ps(y + i, _mm256_mul_ps(alpha256, _mm256_loadu_ps(y + i)));
+        }
+        for (; i < len; i++) {
+            y[i] *= alpha;
+        }
+    }
+
+    static void scale_add(F32 *y, F32 alpha, const F32 *mask, I32 len)
+    {
+        if (mask == nullptr) {
+            scale(y, len, alpha);
+            return;
+        }
+        I32 i = 0;
+        __m256 alpha256 = _mm256_set1_ps(alpha);
+        for (; i < len - 7; i += 8) {
+            _mm256_storeu_ps(y + i,
+                _mm256_fmadd_ps(alpha256, _mm256_loadu_ps(y + i), _mm256_loadu_ps(mask + i)));
+        }
+        for (; i < len; i++) {
+            y[i] = alpha * y[i] + mask[i];
+        }
+    }
+
+    static F32 max(const F32 *x, I32 len)
+    {
+        I32 i = 0;
+        F32 m = -INFINITY;
+        if (len >= 8) {
+            __m256 max256 = _mm256_loadu_ps(x);
+            for (i = 8; i < len - 7; i += 8) {
+                max256 = _mm256_max_ps(max256, _mm256_loadu_ps(x + i));
+            }
+            m = _mm256_hmax_ps(max256);
+        }
+        for (; i < len; i++) {
+            m = UNI_MAX(m, x[i]);
+        }
+        return m;
+    }
+
+    static F32 exp_sum(F32 *x, I32 len, F32 max)
+    {
+        I32 i = 0;
+        __m256 max256 = _mm256_set1_ps(max);
+        __m256 sum256 = _mm256_setzero_ps();
+        for (; i < len - 7; i += 8) {
+            __m256 e = _mm256_exp_ps(_mm256_sub_ps(_mm256_loadu_ps(x + i), max256));
+            _mm256_storeu_ps(x + i, e);
+            sum256 = _mm256_add_ps(sum256, e);
+        }
+        F32 sum = _mm256_sum_ps(sum256);
+        for (; i < len; i++) {
+            x[i] = exp(x[i] - max);
+            sum += x[i];
+        }
+        return sum;
+    }
+
+    static void store(const F32 *acc, F32 alpha, F32 *out, I32 len)
+    {
+        I32 i = 0;
+        __m256 alpha256 = _mm256_set1_ps(alpha);
+        for (; i < len - 7; i += 8) {
+            _mm256_storeu_ps(out + i, _mm256_mul_ps(alpha256, _mm256_loadu_ps(acc + i)));
+        }
+        for (; i < len; i++) {
+            out[i] = alpha * acc[i];
+        }
+    }
+};
+
+EE scaled_dot_product_attention_fp32(std::vector<TensorDesc> inputDesc,
+    std::vector<void *> input,
+    ScaledDotProductAttentionParamSpec p,
+    U32 kvCapacity,
+    void *tmp,
+    TensorDesc outputDesc,
+    F32 *output)
+{
+    UNUSED(outputDesc);
+    return scaled_dot_product_attention_cpu<F32, AttentionKernelAVX>(
+        inputDesc, input, p, kvCapacity, tmp, output);
+}
@@ -13,52 +13,52 @@
 
 #include "cpu/x86/fp32/tensor_computing_fp32.h"
 #include "tensor_transpose.h"
+#include "thread_pool.h"
 
 template <bool logsoftmax>
 static void softmax_lastAxis_fp32(const F32 *input, I32 loopOuter, I32 loops, F32 *output)
 {
-#ifdef _USE_OPENMP
-#pragma omp parallel for num_threads(OMP_NUM_THREADS) if (loopOuter > 1)
-#endif
-    for (I32 i = 0; i < loopOuter; i++) {
-        const F32 *inputPtr = input + i * loops;
-        F32 *outputPtr = output + i * loops;
+    parallel_for(loopOuter, loops * 4.0, [&](I32 begin, I32 end) {
+        for (I32 i = begin; i < end; i++) {
+            const F32 *inputPtr = input + i * loops;
+            F32 *outputPtr = output + i * loops;
 
-        __m256 max_v, tmp_v;
-        F32 max_s, tmp_s;
-        if (!logsoftmax) {
-            array_minmax_value_f32(inputPtr, loops, 2, &max_s);
-            max_v = _mm256_set1_ps(max_s);
-        }
-        I32 j = 0;
-        __m256 sum_v = _mm256_set1_ps(0.f);
-        for (; j < loops - 7; j += 8) {
-            __m256 in = _mm256_loadu_ps(inputPtr + j);
+            __m256 max_v, tmp_v;
+            F32 max_s, tmp_s;
             if (!logsoftmax) {
-                in = _mm256_sub_ps(in, max_v);
+                array_minmax_value_f32(inputPtr, loops, 2, &max_s);
+                max_v = _mm256_set1_ps(max_s);
             }
-            tmp_v = _mm256_exp_ps(in);
-            sum_v = _mm256_add_ps(sum_v, tmp_v);
-            if (!logsoftmax) {
-                _mm256_storeu_ps(outputPtr + j, tmp_v);
+            I32 j = 0;
+            __m256 sum_v = _mm256_set1_ps(0.f);
+            for (; j < loops - 7; j += 8) {
+                __m256 in = _mm256_loadu_ps(inputPtr + j);
+                if (!logsoftmax) {
+                    in = _mm256_sub_ps(in, max_v);
+                }
+                tmp_v = _mm256_exp_ps(in);
+                sum_v = _mm256_add_ps(sum_v, tmp_v);
+                if (!logsoftmax) {
+                    _mm256_storeu_ps(outputPtr + j, tmp_v);
+                }
+            }
+            F32 sum_s = _mm256_sum_ps(sum_v);
+            for (; j < loops; j++) {
+                if (logsoftmax) {
+                    tmp_s = exp(inputPtr[j]);
+                } else {
+                    tmp_s = exp(inputPtr[j] - max_s);
+                    outputPtr[j] = tmp_s;
+                }
+                sum_s += tmp_s;
             }
-        }
-        F32 sum_s = _mm256_sum_ps(sum_v);
-        for (; j < loops; j++) {
             if (logsoftmax) {
-                tmp_s = exp(inputPtr[j]);
+                array_scale_f32(inputPtr, outputPtr, loops, 1.0, -log(sum_s));
             } else {
-                tmp_s = exp(inputPtr[j] - max_s);
-                outputPtr[j] = tmp_s;
+                array_scale_f32(outputPtr, outputPtr, loops, 1.0 / sum_s, 0);
             }
-            sum_s += tmp_s;
         }
-        if (logsoftmax) {
-            array_scale_f32(inputPtr, outputPtr, loops, 1.0, -log(sum_s));
-        } else {
-            array_scale_f32(outputPtr, outputPtr, loops, 1.0 / sum_s, 0);
-        }
-    }
+    });
 }
 
 template <bool logsoftmax>
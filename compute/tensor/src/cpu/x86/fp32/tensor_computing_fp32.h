@@ -20,6 +20,7 @@
 
 #include "thread_affinity.h"
 #include "x86_functions_fp32.h"
+#include "cpu/post_ops.h"
 
 EE attention_fp32(U32 batch,
     U32 numHeads,
@@ -62,6 +63,7 @@ EE convolution_fp32(TensorDesc inputDesc,
     TensorDesc outputDesc,
     F32 *output,
     ActivationParamSpec activationDesc,
+    PostOpsArgs *postOps,
     Arch arch);
 
 EE convolution_direct(TensorDesc inputDesc,
@@ -103,7 +105,9 @@ EE convolution_1x1_direct(TensorDesc inputDesc,
     void *tmp,
     TensorDesc outputDesc,
     F32 *outArray,
-    ActivationParamSpec activationDesc);
+    ActivationParamSpec activationDesc,
+    PostOpsArgs *postOps = nullptr,
+    Arch arch = X86_AVX2);
 
 EE convolution_direct_nchw(TensorDesc inputDesc,
     F32 *inArray,
@@ -335,6 +339,14 @@ EE softmax_fp32(
 EE logsoftmax_fp32(
     TensorDesc inputDesc, const F32 *input, int axis, TensorDesc outputDesc, F32 *output);
 
+EE scaled_dot_product_attention_fp32(std::vector<TensorDesc> inputDesc,
+    std::vector<void *> input,
+    ScaledDotProductAttentionParamSpec p,
+    U32 kvCapacity,
+    void *tmp,
+    TensorDesc outputDesc,
+    F32 *output);
+
 EE deconvolution_transform_filter_fp32(TensorDesc filterDesc,
     const F32 *filter,
     ConvolutionForwardAlgorithm algorithm,
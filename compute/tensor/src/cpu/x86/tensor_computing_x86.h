@@ -19,6 +19,7 @@
 #include "sys.h"
 #include "tensor_desc.h"
 #include "parameter_spec.h"
+#include "cpu/post_ops.h"
 
 EE attention_x86(TensorDesc inputDesc, const void *input, TensorDesc outputDesc, void *output);
 
@@ -44,7 +45,8 @@ EE convolution_infer_forward_algorithm_x86(TensorDesc inputDesc,
     ConvolutionParamSpec convParamSpec,
     ConvolutionPolicy policy,
     ConvolutionForwardAlgorithm *algorithm,
-    DataType targetDataType);
+    DataType targetDataType,
+    Arch arch);
 
 EE convolution_transform_filter_bytes_x86(TensorDesc filterDesc,
     ConvolutionParamSpec convParamSpec,
@@ -81,6 +83,7 @@ EE convolution_x86(TensorDesc inputDesc,
     TensorDesc outputDesc,
     void *output,
     ActivationParamSpec activationDesc,
+    PostOpsArgs *postOps,
     Arch arch);
 
 EE depthwise_pointwise_convolution_transform_filter_x86(TensorDesc dwFilterDesc,
@@ -210,6 +213,14 @@ EE softmax_x86(
 EE logsoftmax_x86(
     TensorDesc inputDesc, const void *input, SoftmaxParamSpec p, TensorDesc outputDesc, void *output);
 
+EE scaled_dot_product_attention_x86(std::vector<TensorDesc> inputDesc,
+    std::vector<void *> input,
+    ScaledDotProductAttentionParamSpec p,
+    U32 kvCapacity,
+    void *tmp,
+    TensorDesc outputDesc,
+    void *output);
+
 EE deconvolution_transform_filter_x86(TensorDesc filterDesc,
     const void *filter,
     ConvolutionForwardAlgorithm algorithm,
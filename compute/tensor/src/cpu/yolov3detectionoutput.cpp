@@ -123,11 +123,9 @@ EE yolov3detectionoutput(std::vector<void *> input,
                 all_boxrects.end(), allbox_boxrects[b].begin(), allbox_boxrects[b].end());
         }
     }
-    // sort boxes
-    std::stable_sort(all_boxrects.begin(), all_boxrects.end(),
-        [&](const BoxRect &a, const BoxRect &b) { return (a.score > b.score); });
-    // apply nms
-    std::vector<I32> picked = nms_pickedboxes(all_boxrects, nms_threshold);
+    // sort boxes and apply nms
+    std::vector<I32> picked = nms_pickedboxes(all_boxrects,
+        yolov3DetectionOutputParamSpec.nms_mode, nms_threshold, confidence_threshold);
 
     std::vector<BoxRect> boxrects;
     for (U32 p = 0; p < picked.size(); p++) {
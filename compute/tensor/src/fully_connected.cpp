@@ -13,6 +13,7 @@
 
 #include "tensor_computing.h"
 #include "blas_enhance.h"
+#include "thread_affinity.h"
 #ifdef _USE_GPU
 #include "gpu/mali/tensor_computing_mali.h"
 #endif
@@ -56,6 +57,103 @@ inline EE fully_connected_infer_output_size_cpu(
     return SUCCESS;
 }
 
+// sparse filter is only packed for mmm, it is used for gemv too.
+inline bool is_sparse_filter(TensorDesc filterDesc)
+{
+    return filterDesc.df == DF_NKN16_BSR || filterDesc.df == DF_NKN8_2_4;
+}
+
+#if defined(_USE_X86) && defined(_USE_INT8)
+// Dynamic quantization runs fp32 FC with int8 filter without calibrated scales. Filter is quantized
+// per output channel when transformed, [packed int8 filter][offsetC(N I32)][dequantize factor(N F32)].
+// Input is quantized to uint8 per row at run time, and the int32 result is dequantized per row and
+// per output channel. int8 kernels need vnni, fp32 FC is used on other processors.
+inline bool is_dynamic_quantization(TensorDesc inputDesc, TensorDesc filterDesc, Arch arch)
+{
+    return has_x86_int8_vnni(arch) && DT_I8 == filterDesc.dt && DT_F32 == inputDesc.dt &&
+        filterDesc.df == matrix_matrix_multiply_rhs_format(DT_I8);
+}
+
+inline U32 dynamic_quantization_filter_offset(U32 N, U32 K)
+{
+    return UNI_ALIGN(N, 16) * UNI_ALIGN(K, 8);
+}
+
+inline EE fully_connected_dynamic_quantization_tmp_bytes(
+    U32 M, U32 N, U32 K, TensorDesc filterDesc, U32 *bytes, Arch arch)
+{
+    TensorDesc qDesc = tensor2df(DT_U8_Q, DF_NORMAL, M, K);
+    EE ret = matrix_matrix_multiply_tmp_bytes(qDesc, filterDesc, bytes, arch);
+    // int32 result, row dequantize factors and uint8 input
+    *bytes += M * N * bytesOf(DT_I32) + M * bytesOf(DT_F32) + UNI_ALIGN(M * K, 64);
+    return ret;
+}
+
+static EE fully_connected_dynamic_quantization(TensorDesc inputDesc,
+    const F32 *input,
+    TensorDesc filterDesc,
+    const INT8 *filter,
+    const F32 *bias,
+    U32 tmpBytes,
+    void *tmp,
+    TensorDesc outputDesc,
+    F32 *output,
+    Arch arch)
+{
+    U32 N = outputDesc.dims[0];
+    U32 K = tensorNumElements(filterDesc) / N;
+    U32 M = tensorNumElements(inputDesc) / K;
+    const I32 *offsetC = (const I32 *)(filter + dynamic_quantization_filter_offset(N, K));
+    const F32 *colFactor = (const F32 *)(offsetC + N);
+
+    I32 *result = (I32 *)tmp;
+    F32 *rowFactor = (F32 *)(result + M * N);
+    UINT8 *qInput = (UINT8 *)(rowFactor + M);
+    U8 *mmmTmp = qInput + UNI_ALIGN(M * K, 64);
+    U32 mmmBytes = tmpBytes - (mmmTmp - (U8 *)tmp);
+
+    EE ret = SUCCESS;
+#if defined(_USE_OPENMP)
+#pragma omp parallel for num_threads(OMP_NUM_THREADS)
+#endif
+    for (U32 m = 0; m < M; m++) {
+        TensorDesc rowDesc = tensor1d(DT_F32, K);
+        TensorDesc qDesc = tensor1d(DT_U8_Q, K);
+        F32 scale = -1;
+        if (quantize_cpu(rowDesc, input + m * K, &qDesc, qInput + m * K, &scale, arch) != SUCCESS) {
+            ret = NOT_SUPPORTED;
+        }
+        rowFactor[m] = 1 / scale;
+    }
+    CHECK_STATUS(ret);
+
+    // mmm accumulates int32 result, offsetC at the head of tmp is added to it
+    UNI_MEMSET(result, 0, M * N * bytesOf(DT_I32));
+    UNI_MEMCPY(mmmTmp, offsetC, N * bytesOf(DT_I32));
+    ret = matrix_matrix_multiply(tensor2df(DT_U8_Q, DF_NORMAL, M, K), qInput, filterDesc, filter,
+        mmmBytes, mmmTmp, tensor2df(DT_I32, DF_NORMAL, M, N), result, nullptr, arch);
+
+#if defined(_USE_OPENMP)
+#pragma omp parallel for num_threads(OMP_NUM_THREADS)
+#endif
+    for (U32 m = 0; m < M; m++) {
+        const I32 *src = result + m * N;
+        F32 *dst = output + m * N;
+        F32 factor = rowFactor[m];
+        if (bias == nullptr) {
+            for (U32 n = 0; n < N; n++) {
+                dst[n] = src[n] * factor * colFactor[n];
+            }
+        } else {
+            for (U32 n = 0; n < N; n++) {
+                dst[n] = src[n] * factor * colFactor[n] + bias[n];
+            }
+        }
+    }
+    return ret;
+}
+#endif
+
 EE fully_connected_infer_output_size(
     Tensor *inputTensor, Tensor filterTensor, Tensor *outputTensor, ArchInfo_t archInfo)
 {
@@ -129,7 +227,15 @@ EE fully_connected_infer_forward_tmp_bytes(
         CHECK_REQUIREMENT(tensorIs2d(filterDesc));
         U32 fh = tensorNumElements(filterDesc) / fw;
         U32 M = tensorNumElements(inputDesc) / fh;
-        if (M != 1) {
+        bool dynamic = false;
+#if defined(_USE_X86) && defined(_USE_INT8)
+        dynamic = is_dynamic_quantization(inputDesc, filterDesc, arch);
+#endif
+        if (dynamic) {
+#if defined(_USE_X86) && defined(_USE_INT8)
+            ret = fully_connected_dynamic_quantization_tmp_bytes(M, fw, fh, filterDesc, bytes, arch);
+#endif
+        } else if (M != 1 || is_sparse_filter(filterDesc)) {
             // call gemm
             TensorDesc in_desc = tensor2df(inputDesc.dt, DF_NORMAL, M, fh);
             ret = matrix_matrix_multiply_tmp_bytes(in_desc, filterDesc, bytes, arch);
@@ -147,7 +253,7 @@ EE fully_connected_infer_forward_tmp_bytes(
                 *bytes += tensorNumBytes(inputDesc);
             }
         }
-        if (DT_I8 == filterDesc.dt || DT_F32_8Q == filterDesc.dt) {
+        if (!dynamic && (DT_I8 == filterDesc.dt || DT_F32_8Q == filterDesc.dt)) {
             if (DT_I8 != inputTensor.get_desc().dt) {
                 *bytes += tensorNumBytes(inputDesc);
             }
@@ -304,6 +410,76 @@ EE fully_connected_transform_filter(
     return ret;
 }
 
+EE fully_connected_dynamic_quantize_filter_bytes(
+    Tensor filterTensor, U32 *bytes, ArchInfo_t archInfo)
+{
+    if (bytes == nullptr) {
+        CHECK_STATUS(NULL_POINTER);
+    }
+    EE ret = NOT_SUPPORTED;
+#if defined(_USE_X86) && defined(_USE_INT8)
+    TensorDesc filterDesc = filterTensor.get_desc();
+    if (IS_X86(archInfo->arch) && filterDesc.df == DF_TRANSPOSE) {
+        filterDesc.dt = DT_I8;
+        ret = matrix_matrix_multiply_transform_rhs_bytes(
+            filterDesc, bytes, nullptr, archInfo->arch);
+        *bytes += filterDesc.dims[1] * bytesOf(DT_F32);
+    }
+#else
+    UNUSED(filterTensor);
+    UNUSED(archInfo);
+#endif
+    return ret;
+}
+
+EE fully_connected_dynamic_quantize_filter(
+    Tensor filterTensor, Tensor *ftmTensor, ArchInfo_t archInfo)
+{
+    EE ret = NOT_SUPPORTED;
+#if defined(_USE_X86) && defined(_USE_INT8)
+    auto arch = archInfo->arch;
+    TensorDesc filterDesc = filterTensor.get_desc();
+    if (!IS_X86(arch) || filterDesc.dt != DT_F32 || filterDesc.df != DF_TRANSPOSE) {
+        return ret;
+    }
+    const F32 *filter = (const F32 *)get_ptr_from_tensor(filterTensor, arch);
+    U8 *ftm = (U8 *)get_ptr_from_tensor(*ftmTensor, arch);
+    U32 N = filterDesc.dims[1];
+    U32 K = filterDesc.dims[0];
+    std::vector<INT8> qFilter(N * K);
+    std::vector<F32> scales(N);
+    ret = SUCCESS;
+#if defined(_USE_OPENMP)
+#pragma omp parallel for num_threads(OMP_NUM_THREADS)
+#endif
+    for (U32 n = 0; n < N; n++) {
+        TensorDesc rowDesc = tensor1d(DT_F32, K);
+        TensorDesc qDesc = tensor1d(DT_I8, K);
+        scales[n] = -1;
+        if (quantize_cpu(rowDesc, filter + n * K, &qDesc, qFilter.data() + n * K, &scales[n],
+                arch) != SUCCESS) {
+            ret = NOT_SUPPORTED;
+        }
+    }
+    CHECK_STATUS(ret);
+
+    TensorDesc qDesc = filterDesc;
+    qDesc.dt = DT_I8;
+    TensorDesc ftmDesc;
+    ret = matrix_matrix_multiply_transform_rhs(qDesc, qFilter.data(), &ftmDesc, ftm, arch);
+    F32 *factor = (F32 *)(ftm + dynamic_quantization_filter_offset(N, K) + N * bytesOf(DT_I32));
+    for (U32 n = 0; n < N; n++) {
+        factor[n] = 1 / scales[n];
+    }
+    ftmTensor->resize(ftmDesc);
+#else
+    UNUSED(filterTensor);
+    UNUSED(ftmTensor);
+    UNUSED(archInfo);
+#endif
+    return ret;
+}
+
 EE fully_connected(Tensor inputTensor,
     Tensor filterTensor,
     Tensor biasTensor,
@@ -364,6 +540,14 @@ EE fully_connected(Tensor inputTensor,
         U32 fh = tensorNumElements(filterDesc) / fw;
         U32 M = tensorNumElements(inputDesc) / fh;
 
+#if defined(_USE_X86) && defined(_USE_INT8)
+        if (is_dynamic_quantization(inputDesc, filterDesc, arch)) {
+            return fully_connected_dynamic_quantization(inputDesc, (const F32 *)input, filterDesc,
+                (const INT8 *)filter, (const F32 *)bias, tmpBytes, tmp, outputDesc, (F32 *)output,
+                arch);
+        }
+#endif
+
         F32 *scale = nullptr;
         DataType idt = inputDesc.dt;
         DataType fdt = filterDesc.dt;
@@ -459,7 +643,8 @@ EE fully_connected(Tensor inputTensor,
         }
 
         // If weight is transformed for mmm, don't run as mvm
-        if (M == 1 && filterDesc.df != matrix_matrix_multiply_rhs_format(fdt)) {
+        if (M == 1 && !matrix_matrix_multiply_rhs_transformed(fdt, filterDesc.df) &&
+            !is_sparse_filter(filterDesc)) {
             TensorDesc vectorDesc = tensor1d(idt, fh);
             TensorDesc resultDesc = tensor1d(odt, fw);
             if (IS_GENERAL(archInfo->arch)) {
@@ -0,0 +1,71 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "tensor_computing.h"
+#ifdef _USE_CPU
+#include "cpu/post_ops.h"
+#endif
+
+EE post_ops_infer_forward_tmp_bytes(
+    std::vector<Tensor> eltwiseTensors, Tensor outputTensor, U32 *bytes, ArchInfo_t archInfo)
+{
+    if (bytes == nullptr) {
+        CHECK_STATUS(NULL_POINTER);
+    }
+    *bytes = 0;
+    EE ret = NOT_SUPPORTED;
+    if (IS_CPU(archInfo->arch)) {
+#ifdef _USE_CPU
+        std::vector<TensorDesc> eltwiseDesc;
+        for (U32 i = 0; i < eltwiseTensors.size(); i++) {
+            eltwiseDesc.push_back(eltwiseTensors[i].get_desc());
+        }
+        *bytes = post_ops_tmp_bytes_cpu(eltwiseDesc, outputTensor.get_desc());
+        ret = SUCCESS;
+#endif
+    }
+    return ret;
+}
+
+EE post_ops(PostOpsParamSpec p,
+    std::vector<Tensor> eltwiseTensors,
+    Tensor tmpTensor,
+    Tensor outputTensor,
+    ArchInfo_t archInfo)
+{
+    if (p.num == 0) {
+        return SUCCESS;
+    }
+    auto arch = archInfo->arch;
+    EE ret = NOT_SUPPORTED;
+    if (IS_CPU(arch)) {
+#ifdef _USE_CPU
+        std::vector<TensorDesc> eltwiseDesc;
+        std::vector<void *> eltwise;
+        for (U32 i = 0; i < eltwiseTensors.size(); i++) {
+            eltwiseDesc.push_back(eltwiseTensors[i].get_desc());
+            eltwise.push_back(get_ptr_from_tensor(eltwiseTensors[i], arch));
+        }
+        TensorDesc outputDesc = outputTensor.get_desc();
+        void *output = get_ptr_from_tensor(outputTensor, arch);
+        void *tmp = get_ptr_from_tensor(tmpTensor, arch);
+        // channel wise scale is kept in weight of convolution
+        PostOpsArgs args;
+        ret = post_ops_prepare_cpu(p, eltwiseDesc, eltwise, nullptr, tmp, outputDesc, &args);
+        if (ret == SUCCESS) {
+            ret = post_ops_cpu(&args, outputDesc, output, arch);
+        }
+#endif
+    }
+    return ret;
+}
@@ -0,0 +1,115 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "tensor_computing.h"
+#ifdef _USE_CPU
+#include "cpu/scaled_dot_product_attention.h"
+#endif
+#ifdef _USE_GENERAL
+#include "cpu/general/tensor_computing_general.h"
+#endif
+#ifdef _USE_X86
+#include "cpu/x86/tensor_computing_x86.h"
+#endif
+#ifdef _USE_NEON
+#include "cpu/arm/tensor_computing_arm.h"
+#endif
+
+EE scaled_dot_product_attention_infer_output_size(std::vector<Tensor *> inTensors,
+    ScaledDotProductAttentionParamSpec p,
+    Tensor *outputTensor,
+    ArchInfo_t archInfo)
+{
+    if (outputTensor == nullptr) {
+        CHECK_STATUS(NULL_POINTER);
+    }
+    if (inTensors.size() < 3) {
+        CHECK_STATUS(NOT_MATCH);
+    }
+    EE ret = NOT_SUPPORTED;
+    if (IS_CPU(archInfo->arch)) {
+#ifdef _USE_CPU
+        TensorDesc maskDesc;
+        if (inTensors.size() > 3) {
+            maskDesc = inTensors[3]->get_desc();
+        }
+        AttentionShape shape;
+        TensorDesc outputDesc;
+        ret = attention_infer_shape(inTensors[0]->get_desc(), inTensors[1]->get_desc(),
+            inTensors[2]->get_desc(), (inTensors.size() > 3) ? &maskDesc : nullptr,
+            p.transpose_k, &shape, &outputDesc);
+        if (ret == SUCCESS) {
+            outputTensor->resize(outputDesc);
+        }
+#endif
+    }
+    return ret;
+}
+
+EE scaled_dot_product_attention_infer_forward_tmp_bytes(std::vector<Tensor> inTensors,
+    ScaledDotProductAttentionParamSpec p,
+    U32 *bytes,
+    ArchInfo_t archInfo)
+{
+    UNUSED(p);
+    if (bytes == nullptr) {
+        CHECK_STATUS(NULL_POINTER);
+    }
+    EE ret = NOT_SUPPORTED;
+    if (IS_CPU(archInfo->arch)) {
+#ifdef _USE_CPU
+        AttentionShape shape;
+        shape.dv = inTensors[2].get_desc().dims[0];
+        *bytes = attention_tmp_elements_per_thread(shape) * OMP_NUM_THREADS * bytesOf(DT_F32);
+        ret = SUCCESS;
+#endif
+    }
+    return ret;
+}
+
+EE scaled_dot_product_attention(std::vector<Tensor> inTensors,
+    ScaledDotProductAttentionParamSpec p,
+    Tensor tmpTensor,
+    Tensor outputTensor,
+    ArchInfo_t archInfo,
+    U32 kvCapacity)
+{
+    auto arch = archInfo->arch;
+    std::vector<TensorDesc> inputDesc;
+    std::vector<void *> input;
+    for (U32 i = 0; i < inTensors.size(); i++) {
+        inputDesc.push_back(inTensors[i].get_desc());
+        input.push_back(get_ptr_from_tensor(inTensors[i], arch));
+    }
+    void *tmp = get_ptr_from_tensor(tmpTensor, arch);
+    TensorDesc outputDesc = outputTensor.get_desc();
+    void *output = get_ptr_from_tensor(outputTensor, arch);
+    EE ret = NOT_SUPPORTED;
+    if (IS_GENERAL(arch)) {
+#ifdef _USE_GENERAL
+        ret = scaled_dot_product_attention_general(
+            inputDesc, input, p, kvCapacity, tmp, outputDesc, output);
+#endif
+#ifdef _USE_X86
+    } else if (IS_X86(arch)) {
+        ret = scaled_dot_product_attention_x86(
+            inputDesc, input, p, kvCapacity, tmp, outputDesc, output);
+#endif
+#ifdef _USE_NEON
+    } else if (IS_ARM(arch)) {
+        ret = scaled_dot_product_attention_arm(
+            inputDesc, input, p, kvCapacity, tmp, outputDesc, output);
+#endif
+    }
+    return ret;
+}
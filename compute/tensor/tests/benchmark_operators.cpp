@@ -0,0 +1,774 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <functional>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "tensor_computing.h"
+#include "blas_enhance.h"
+#include "affinity_policy.h"
+#include "thread_pool.h"
+#include "ut_util.h"
+
+// Operator micro-benchmark harness.
+//
+// Runs tensor_computing/blas_enhance kernels over shape sweeps, data types and thread counts,
+// and reports time, GFLOP/s, GB/s and the ratio to a roofline measured on this machine(peak
+// gemm throughput and streaming copy bandwidth of the same thread count) as json. A previous
+// json can be given as baseline, cases whose minimum time becomes slower than the threshold are
+// reported and the program exits with 1, so it can guard kernel changes in scripts.
+// Bandwidth is measured on buffers larger than cache, so small working sets can exceed 100%.
+// -p runs the kernels on a Bolt thread pool instead of OpenMP, a report of an OpenMP run given to
+// -c compares the two, small operators show the fork/join and wake up cost of each.
+
+typedef struct {
+    std::string alg;
+    double flops;
+    // compulsory memory traffic, inputs + weights + outputs
+    double bytes;
+    std::function<EE()> run;
+} BenchCase;
+
+typedef struct {
+    std::string op;
+    std::string alg;
+    std::string shape;
+    std::string dt;
+    U32 threads;
+    double time;
+    double minTime;
+    double gflops;
+    double gbps;
+    double roofline;
+    double baseline;
+    bool regression;
+} BenchResult;
+
+typedef struct {
+    double gflops;
+    double gbps;
+} Roofline;
+
+static const char *default_shapes(std::string op)
+{
+    std::map<std::string, const char *> shapes = {
+        // n x ic x h x w x oc x kernel x stride x pad
+        {"conv", "1x64x56x56x64x3x1x1;1x64x56x56x256x1x1x0;1x3x224x224x32x3x2x1"},
+        // n x c x h x w x kernel x stride x pad
+        {"depthwise", "1x32x112x112x3x1x1;1x256x28x28x3x2x1"},
+        // m x n x k
+        {"mmm", "256x256x256;64x3072x768;1024x1024x1024"},
+        // m x k
+        {"mvm", "1024x1024;4096x1024"},
+        // rows x cols
+        {"softmax", "128x1000;1x30522"},
+        {"layernorm", "128x768;512x1024"},
+        // n x c x h x w
+        {"eltwise", "1x768x1x1;1x128x768x1;1x64x56x56"},
+        // n x c x h x w x kernel x stride
+        {"pooling", "1x64x112x112x3x2;1x512x14x14x2x2"},
+    };
+    if (shapes.find(op) == shapes.end()) {
+        return nullptr;
+    }
+    return shapes[op];
+}
+
+static std::vector<std::string> split(const std::string &str, char c)
+{
+    std::vector<std::string> ret;
+    std::stringstream ss(str);
+    std::string item;
+    while (std::getline(ss, item, c)) {
+        if (item.size() > 0) {
+            ret.push_back(item);
+        }
+    }
+    return ret;
+}
+
+static std::vector<U32> parse_shape(const std::string &shape)
+{
+    std::vector<U32> dims;
+    for (auto &s : split(shape, 'x')) {
+        dims.push_back(atoi(s.c_str()));
+    }
+    return dims;
+}
+
+static Tensor random_tensor(TensorDesc desc)
+{
+    Tensor tensor = Tensor::alloc_sized<CPUMem>(desc);
+    ut_init_v((U8 *)get_ptr_from_tensor(tensor, CPU_GENERAL), tensor.length(), desc.dt,
+        UT_INIT_RANDOM);
+    return tensor;
+}
+
+static double tensor_bytes(std::vector<Tensor> tensors)
+{
+    double bytes = 0;
+    for (auto &tensor : tensors) {
+        bytes += tensor.bytes();
+    }
+    return bytes;
+}
+
+static bool conv_alg_applicable(ConvolutionForwardAlgorithm alg, DataType dt, U32 ic, U32 k, U32 s)
+{
+    switch (alg) {
+        case CONVOLUTION_ALGORITHM_POINTWISE:
+            return k == 1;
+        case CONVOLUTION_ALGORITHM_DIRECT:
+            return ic % 8 == 0;
+        case CONVOLUTION_ALGORITHM_GEMM_ICNCHW:
+            return ic % 8 != 0;
+        case CONVOLUTION_ALGORITHM_WINOGRAD:
+            return dt == DT_F32 && ic % 8 == 0 && k == 3 && s == 1;
+        default:
+            return true;
+    }
+}
+
+static std::vector<BenchCase> conv_cases(
+    std::vector<U32> d, DataType dt, std::vector<std::string> algs)
+{
+    std::vector<BenchCase> cases;
+    CHECK_REQUIREMENT(d.size() == 8);
+    U32 in = d[0], ic = d[1], ih = d[2], iw = d[3], oc = d[4], k = d[5], s = d[6], pad = d[7];
+    DataFormat df = (ic % 8 == 0) ? DF_NCHWC8 : DF_NCHW;
+    Tensor inputTensor = random_tensor(tensor4df(dt, df, in, ic, ih, iw));
+    Tensor filterTensor = random_tensor(tensor4df(dt, DF_NCHW, oc, ic, k, k));
+    Tensor biasTensor = random_tensor(tensor1d(dt, oc));
+    ConvolutionParamSpec p = createConvolutionParamSpec(
+        1, 1, k, k, 1, s, s, 0, 0, pad, pad, pad, pad, 1, 1, 1, oc, CONVOLUTION_POINTWISE);
+    ActivationParamSpec activationDesc;
+    activationDesc.mode = ACTIVATION_NULL;
+    Tensor outputTensor;
+    CHECK_STATUS(convolution_infer_output_size(
+        &inputTensor, filterTensor, p, &outputTensor, dt, &UT_CPU_ARCHINFO));
+    outputTensor.alloc();
+    double flops = 2.0 * outputTensor.length() * ic * k * k;
+    double bytes = tensor_bytes({inputTensor, filterTensor, outputTensor});
+
+    std::map<std::string, ConvolutionForwardAlgorithm> names = {
+        {"fastest", CONVOLUTION_ALGORITHM_NULL},
+        {"pointwise", CONVOLUTION_ALGORITHM_POINTWISE},
+        {"direct", CONVOLUTION_ALGORITHM_DIRECT},
+        {"gemm_icnchw", CONVOLUTION_ALGORITHM_GEMM_ICNCHW},
+        {"winograd", CONVOLUTION_ALGORITHM_WINOGRAD},
+    };
+    for (auto &name : algs) {
+        if (names.find(name) == names.end()) {
+            UNI_WARNING_LOG("skip unknown convolution algorithm %s.\n", name.c_str());
+            continue;
+        }
+        ConvolutionForwardAlgorithm alg = names[name];
+        if (!conv_alg_applicable(alg, dt, ic, k, s)) {
+            continue;
+        }
+        if (convolution_infer_forward_algorithm(inputTensor, filterTensor, outputTensor, p,
+                CONVOLUTION_FASTEST, &alg, dt, activationDesc, &UT_CPU_ARCHINFO) != SUCCESS) {
+            continue;
+        }
+        U32 ftmBytes = 0, tmpBytes = 0;
+        if (convolution_transform_filter_bytes(filterTensor, p, alg, &ftmBytes, &UT_CPU_ARCHINFO) !=
+                SUCCESS ||
+            convolution_infer_forward_tmp_bytes(inputTensor, filterTensor, outputTensor, p, alg,
+                &tmpBytes, &UT_CPU_ARCHINFO) != SUCCESS) {
+            continue;
+        }
+        Tensor tmpTensor = Tensor::alloc_sized<CPUMem>(tensor1d(DT_U8, tmpBytes));
+        Tensor ftmTensor = Tensor::alloc_sized<CPUMem>(tensor1d(DT_U8, ftmBytes));
+        if (convolution_transform_filter(
+                filterTensor, p, alg, tmpTensor, &ftmTensor, &UT_CPU_ARCHINFO) != SUCCESS) {
+            continue;
+        }
+        BenchCase c;
+        c.alg = name;
+        if (name == "fastest") {
+            for (auto &iter : names) {
+                if (iter.second == alg) {
+                    c.alg += "(" + iter.first + ")";
+                }
+            }
+        }
+        c.flops = flops;
+        c.bytes = bytes;
+        c.run = [=]() {
+            return convolution({inputTensor}, ftmTensor, p, alg, nullptr, biasTensor, {tmpTensor},
+                outputTensor, activationDesc, &UT_CPU_ARCHINFO);
+        };
+        cases.push_back(c);
+    }
+    return cases;
+}
+
+static std::vector<BenchCase> depthwise_cases(std::vector<U32> d, DataType dt)
+{
+    CHECK_REQUIREMENT(d.size() == 7);
+    U32 in = d[0], ic = d[1], ih = d[2], iw = d[3], k = d[4], s = d[5], pad = d[6];
+    Tensor inputTensor = random_tensor(tensor4df(dt, DF_NCHWC8, in, ic, ih, iw));
+    Tensor filterTensor = random_tensor(tensor4df(dt, DF_NCHW, 1, ic, k, k));
+    Tensor biasTensor = random_tensor(tensor1d(dt, ic));
+    ConvolutionParamSpec p = createConvolutionParamSpec(
+        ic, 1, k, k, 1, s, s, 0, 0, pad, pad, pad, pad, 1, 1, 1, ic, CONVOLUTION_DEPTHWISE);
+    ActivationParamSpec activationDesc;
+    activationDesc.mode = ACTIVATION_NULL;
+    Tensor outputTensor;
+    CHECK_STATUS(depthwise_convolution_infer_output_size(
+        &inputTensor, filterTensor, p, &outputTensor, dt, &UT_CPU_ARCHINFO));
+    outputTensor.alloc();
+    DepthwiseConvolutionForwardAlgorithm alg = DEPTHWISE_CONVOLUTION_ALGORITHM_NULL;
+    CHECK_STATUS(depthwise_convolution_infer_forward_algorithm(inputTensor, filterTensor,
+        outputTensor, p, CONVOLUTION_FASTEST, &alg, dt, activationDesc, &UT_CPU_ARCHINFO));
+    U32 ftmBytes = 0, tmpBytes = 0;
+    CHECK_STATUS(
+        depthwise_convolution_transform_filter_bytes(filterTensor, p, alg, &ftmBytes, &UT_CPU_ARCHINFO));
+    Tensor ftmTensor = Tensor::alloc_sized<CPUMem>(tensor1d(DT_U8, ftmBytes));
+    CHECK_STATUS(depthwise_convolution_transform_filter(
+        filterTensor, p, alg, &ftmTensor, &UT_CPU_ARCHINFO));
+    CHECK_STATUS(depthwise_convolution_infer_forward_tmp_bytes(
+        inputTensor, filterTensor, outputTensor, p, alg, &tmpBytes, &UT_CPU_ARCHINFO));
+    Tensor tmpTensor = Tensor::alloc_sized<CPUMem>(tensor1d(DT_U8, tmpBytes));
+
+    BenchCase c;
+    c.alg = "fastest";
+    c.flops = 2.0 * outputTensor.length() * k * k;
+    c.bytes = tensor_bytes({inputTensor, filterTensor, outputTensor});
+    c.run = [=]() {
+        return depthwise_convolution(inputTensor, ftmTensor, p, alg, nullptr, biasTensor,
+            tmpTensor, outputTensor, activationDesc, &UT_CPU_ARCHINFO);
+    };
+    return {c};
+}
+
+// weight(B) is packed once as the inference engine does.
+static std::vector<BenchCase> mmm_cases(std::vector<U32> d, DataType dt)
+{
+    CHECK_REQUIREMENT(d.size() == 3);
+    U32 m = d[0], n = d[1], k = d[2];
+    Arch arch = UT_CPU_ARCHINFO.arch;
+    TensorDesc aDesc = tensor2df(dt, DF_NORMAL, m, k);
+    TensorDesc bDesc = tensor2df(dt, DF_NORMAL, k, n);
+    TensorDesc cDesc = tensor2df(dt, DF_NORMAL, m, n);
+    Tensor a = random_tensor(aDesc);
+    Tensor b = random_tensor(bDesc);
+    Tensor c = random_tensor(cDesc);
+    U32 packBytes = 0, offset = 0, tmpBytes = 0;
+    CHECK_STATUS(matrix_matrix_multiply_transform_rhs_bytes(bDesc, &packBytes, &offset, arch));
+    Tensor packed = Tensor::alloc_sized<CPUMem>(tensor1d(DT_U8, packBytes));
+    TensorDesc packDesc;
+    CHECK_STATUS(matrix_matrix_multiply_transform_rhs(bDesc,
+        get_ptr_from_tensor(b, CPU_GENERAL), &packDesc, get_ptr_from_tensor(packed, CPU_GENERAL),
+        arch));
+    CHECK_STATUS(matrix_matrix_multiply_tmp_bytes(aDesc, packDesc, &tmpBytes, arch));
+    Tensor tmp = Tensor::alloc_sized<CPUMem>(tensor1d(DT_U8, tmpBytes));
+
+    BenchCase bc;
+    bc.alg = "packed";
+    bc.flops = 2.0 * m * n * k;
+    bc.bytes = tensor_bytes({a, b, c});
+    bc.run = [=]() {
+        return matrix_matrix_multiply(aDesc, get_ptr_from_tensor(a, CPU_GENERAL), packDesc,
+            get_ptr_from_tensor(packed, CPU_GENERAL), tmpBytes,
+            get_ptr_from_tensor(tmp, CPU_GENERAL), cDesc, get_ptr_from_tensor(c, CPU_GENERAL),
+            nullptr, arch);
+    };
+    return {bc};
+}
+
+static std::vector<BenchCase> mvm_cases(std::vector<U32> d, DataType dt)
+{
+    CHECK_REQUIREMENT(d.size() == 2);
+    U32 m = d[0], k = d[1];
+    Arch arch = UT_CPU_ARCHINFO.arch;
+    TensorDesc matDesc = tensor2df(dt, DF_NORMAL, m, k);
+    TensorDesc vecDesc = tensor1d(dt, k);
+    TensorDesc resDesc = tensor1d(dt, m);
+    Tensor mat = random_tensor(matDesc);
+    Tensor vec = random_tensor(vecDesc);
+    Tensor res = random_tensor(resDesc);
+    U32 packBytes = 0, tmpBytes = 0;
+    CHECK_STATUS(matrix_vector_multiply_transform_weight_bytes(matDesc, &packBytes, arch));
+    Tensor packed = Tensor::alloc_sized<CPUMem>(tensor1d(DT_U8, packBytes));
+    TensorDesc packDesc;
+    CHECK_STATUS(matrix_vector_multiply_transform_weight(matDesc,
+        get_ptr_from_tensor(mat, CPU_GENERAL), &packDesc,
+        get_ptr_from_tensor(packed, CPU_GENERAL), arch));
+    CHECK_STATUS(matrix_vector_multiply_tmp_bytes(packDesc, vecDesc, &tmpBytes, arch));
+    Tensor tmp = Tensor::alloc_sized<CPUMem>(tensor1d(DT_U8, tmpBytes));
+
+    BenchCase bc;
+    bc.alg = "packed";
+    bc.flops = 2.0 * m * k;
+    bc.bytes = tensor_bytes({mat, vec, res});
+    bc.run = [=]() {
+        return matrix_vector_multiply(packDesc, get_ptr_from_tensor(packed, CPU_GENERAL), vecDesc,
+            get_ptr_from_tensor(vec, CPU_GENERAL), tmpBytes,
+            get_ptr_from_tensor(tmp, CPU_GENERAL), resDesc, get_ptr_from_tensor(res, CPU_GENERAL),
+            nullptr, arch);
+    };
+    return {bc};
+}
+
+static std::vector<BenchCase> softmax_cases(std::vector<U32> d, DataType dt)
+{
+    CHECK_REQUIREMENT(d.size() == 2);
+    SoftmaxParamSpec p;
+    p.axis = -1;
+    Tensor inputTensor = random_tensor(tensor2df(dt, DF_NORMAL, d[0], d[1]));
+    Tensor outputTensor;
+    CHECK_STATUS(softmax_infer_output_size(&inputTensor, p, &outputTensor, &UT_CPU_ARCHINFO));
+    outputTensor.alloc();
+    U32 tmpBytes = 0;
+    CHECK_STATUS(softmax_infer_forward_tmp_bytes(inputTensor, p, &tmpBytes, &UT_CPU_ARCHINFO));
+    Tensor tmpTensor = Tensor::alloc_sized<CPUMem>(tensor1d(DT_U8, tmpBytes));
+
+    BenchCase c;
+    c.alg = "default";
+    // max, sub + exp, sum, div
+    c.flops = 4.0 * inputTensor.length();
+    c.bytes = tensor_bytes({inputTensor, outputTensor});
+    c.run = [=]() { return softmax(inputTensor, p, tmpTensor, outputTensor, &UT_CPU_ARCHINFO); };
+    return {c};
+}
+
+static std::vector<BenchCase> layernorm_cases(std::vector<U32> d, DataType dt)
+{
+    CHECK_REQUIREMENT(d.size() == 2);
+    LayerNormParamSpec p;
+    p.axis = -1;
+    Tensor inputTensor = random_tensor(tensor3df(dt, DF_MTK, 1, d[0], d[1]));
+    Tensor alphaTensor = random_tensor(tensor1d(dt, d[1]));
+    Tensor betaTensor = random_tensor(tensor1d(dt, d[1]));
+    Tensor outputTensor;
+    CHECK_STATUS(layer_norm_infer_output_size(&inputTensor, p, &outputTensor, &UT_CPU_ARCHINFO));
+    outputTensor.alloc();
+    U32 tmpBytes = 0;
+    CHECK_STATUS(layer_norm_infer_forward_tmp_bytes(inputTensor, &tmpBytes, &UT_CPU_ARCHINFO));
+    Tensor tmpTensor = Tensor::alloc_sized<CPUMem>(tensor1d(DT_U8, tmpBytes));
+
+    BenchCase c;
+    c.alg = "default";
+    // mean, variance, normalize and affine
+    c.flops = 8.0 * inputTensor.length();
+    c.bytes = tensor_bytes({inputTensor, alphaTensor, betaTensor, outputTensor});
+    c.run = [=]() {
+        return layer_norm(inputTensor, p, alphaTensor, betaTensor, tmpTensor, outputTensor,
+            &UT_CPU_ARCHINFO);
+    };
+    return {c};
+}
+
+static std::vector<BenchCase> eltwise_cases(std::vector<U32> d, DataType dt)
+{
+    CHECK_REQUIREMENT(d.size() == 4);
+    EltwiseParamSpec p;
+    p.mode = ELTWISE_SUM;
+    p.activation_type = ACTIVATION_NULL;
+    TensorDesc desc = tensor4df(dt, DF_NCHW, d[0], d[1], d[2], d[3]);
+    std::vector<Tensor> inputTensors = {random_tensor(desc), random_tensor(desc)};
+    std::vector<Tensor *> inputPtrs = {&inputTensors[0], &inputTensors[1]};
+    Tensor outputTensor;
+    CHECK_STATUS(eltwise_infer_output_size(inputPtrs, p, &outputTensor, &UT_CPU_ARCHINFO));
+    outputTensor.alloc();
+    U32 tmpBytes = 0;
+    CHECK_STATUS(
+        eltwise_infer_forward_tmp_bytes(inputTensors, outputTensor, &tmpBytes, &UT_CPU_ARCHINFO));
+    Tensor tmpTensor = Tensor::alloc_sized<CPUMem>(tensor1d(DT_U8, tmpBytes));
+
+    BenchCase c;
+    c.alg = "sum";
+    c.flops = 1.0 * outputTensor.length();
+    c.bytes = tensor_bytes({inputTensors[0], inputTensors[1], outputTensor});
+    c.run = [=]() { return eltwise(inputTensors, p, tmpTensor, outputTensor, &UT_CPU_ARCHINFO); };
+    return {c};
+}
+
+static std::vector<BenchCase> pooling_cases(std::vector<U32> d, DataType dt)
+{
+    CHECK_REQUIREMENT(d.size() == 6);
+    PoolingParamSpec p;
+    UNI_MEMSET(&p, 0, sizeof(p));
+    p.mode = POOLING_MAX;
+    p.round_mode = ROUND_CEIL;
+    p.kernel_t = p.stride_t = 1;
+    p.kernel_h = p.kernel_w = d[4];
+    p.stride_h = p.stride_w = d[5];
+    Tensor inputTensor = random_tensor(tensor4df(dt, DF_NCHWC8, d[0], d[1], d[2], d[3]));
+    Tensor outputTensor;
+    CHECK_STATUS(pooling_infer_output_size(&inputTensor, p, &outputTensor, &UT_CPU_ARCHINFO));
+    outputTensor.alloc();
+    U32 tmpBytes = 0;
+    CHECK_STATUS(
+        pooling_infer_forward_tmp_bytes(inputTensor, outputTensor, &tmpBytes, &UT_CPU_ARCHINFO));
+    Tensor tmpTensor = Tensor::alloc_sized<CPUMem>(tensor1d(DT_U8, tmpBytes));
+
+    BenchCase c;
+    c.alg = "max";
+    c.flops = 1.0 * outputTensor.length() * p.kernel_h * p.kernel_w;
+    c.bytes = tensor_bytes({inputTensor, outputTensor});
+    c.run = [=]() { return pooling(inputTensor, p, tmpTensor, {outputTensor}, &UT_CPU_ARCHINFO); };
+    return {c};
+}
+
+static std::vector<BenchCase> get_cases(
+    std::string op, std::vector<U32> dims, DataType dt, std::vector<std::string> convAlgs)
+{
+    if (op == "conv") {
+        return conv_cases(dims, dt, convAlgs);
+    } else if (op == "depthwise") {
+        return depthwise_cases(dims, dt);
+    } else if (op == "mmm") {
+        return mmm_cases(dims, dt);
+    } else if (op == "mvm") {
+        return mvm_cases(dims, dt);
+    } else if (op == "softmax") {
+        return softmax_cases(dims, dt);
+    } else if (op == "layernorm") {
+        return layernorm_cases(dims, dt);
+    } else if (op == "pooling") {
+        return pooling_cases(dims, dt);
+    } else if (op == "eltwise") {
+        return eltwise_cases(dims, dt);
+    }
+    UNI_WARNING_LOG("skip unknown operator %s.\n", op.c_str());
+    return {};
+}
+
+// return median time of loops, and minimum time in *minTime.
+static double time_case(const BenchCase &c, int warmup, int loops, double *minTime)
+{
+    for (int i = 0; i < warmup; i++) {
+        CHECK_STATUS(c.run());
+    }
+    std::vector<double> times(loops);
+    for (int i = 0; i < loops; i++) {
+        double start = ut_time_ms();
+        CHECK_STATUS(c.run());
+        times[i] = ut_time_ms() - start;
+    }
+    std::sort(times.begin(), times.end());
+    *minTime = times[0];
+    return times[loops / 2];
+}
+
+// best streaming copy bandwidth(read + write) on buffers that can not stay in cache.
+static double measure_bandwidth(int loops)
+{
+    const U32 len = 32 * 1024 * 1024;
+    F32 *src = (F32 *)UNI_MALLOC(len * sizeof(F32));
+    F32 *dst = (F32 *)UNI_MALLOC(len * sizeof(F32));
+#ifdef _USE_OPENMP
+#pragma omp parallel for num_threads(OMP_NUM_THREADS)
+#endif
+    for (U32 i = 0; i < len; i++) {
+        src[i] = i;
+        dst[i] = 0;
+    }
+    double best = 0;
+    for (int l = 0; l < loops; l++) {
+        double start = ut_time_ms();
+#ifdef _USE_OPENMP
+#pragma omp parallel for num_threads(OMP_NUM_THREADS)
+#endif
+        for (U32 i = 0; i < len; i++) {
+            dst[i] = src[i] * 1.0001f;
+        }
+        double time = ut_time_ms() - start;
+        best = UNI_MAX(best, 2.0 * len * sizeof(F32) / time * 1e-6);
+    }
+    UNI_FREE(src);
+    UNI_FREE(dst);
+    return best;
+}
+
+// attainable compute peak is taken from the packed gemm of a cache friendly shape.
+static double measure_peak(DataType dt, int loops)
+{
+    double best = 0;
+    for (auto &c : mmm_cases({384, 384, 384}, dt)) {
+        double minTime;
+        time_case(c, 2, loops, &minTime);
+        best = UNI_MAX(best, ut_gflops(c.flops, minTime));
+    }
+    return best;
+}
+
+static std::string json_value(const std::string &line, const std::string &key)
+{
+    std::string pattern = "\"" + key + "\":";
+    size_t pos = line.find(pattern);
+    if (pos == std::string::npos) {
+        return "";
+    }
+    pos += pattern.size();
+    while (pos < line.size() && line[pos] == ' ') {
+        pos++;
+    }
+    size_t end;
+    if (line[pos] == '"') {
+        pos++;
+        end = line.find('"', pos);
+    } else {
+        end = line.find_first_of(",}", pos);
+    }
+    return line.substr(pos, end - pos);
+}
+
+static std::string result_key(
+    std::string op, std::string alg, std::string shape, std::string dt, std::string threads)
+{
+    return op + "|" + alg + "|" + shape + "|" + dt + "|" + threads;
+}
+
+// results are written one per line, so baseline can be read back line by line.
+static std::map<std::string, double> load_baseline(const char *path)
+{
+    std::map<std::string, double> baseline;
+    FILE *file = fopen(path, "r");
+    if (file == nullptr) {
+        UNI_ERROR_LOG("can not open baseline file %s.\n", path);
+        return baseline;
+    }
+    char buffer[1024];
+    while (fgets(buffer, sizeof(buffer), file) != nullptr) {
+        std::string line = buffer;
+        std::string op = json_value(line, "op");
+        if (op == "") {
+            continue;
+        }
+        std::string key = result_key(op, json_value(line, "alg"), json_value(line, "shape"),
+            json_value(line, "dt"), json_value(line, "threads"));
+        baseline[key] = atof(json_value(line, "min_ms").c_str());
+    }
+    fclose(file);
+    return baseline;
+}
+
+static void write_json(FILE *file,
+    const std::map<U32, std::map<std::string, Roofline>> &machine,
+    const std::vector<BenchResult> &results,
+    double threshold)
+{
+    fprintf(file, "{\n  \"machine\": [\n");
+    U32 i = 0, num = 0;
+    for (auto &t : machine) {
+        num += t.second.size();
+    }
+    for (auto &t : machine) {
+        for (auto &d : t.second) {
+            fprintf(file,
+                "    {\"threads\": %u, \"dt\": \"%s\", \"peak_gflops\": %.3f, \"peak_gbps\": "
+                "%.3f}%s\n",
+                t.first, d.first.c_str(), d.second.gflops, d.second.gbps, (++i < num) ? "," : "");
+        }
+    }
+    fprintf(file, "  ],\n  \"threshold\": %.2f,\n  \"results\": [\n", threshold);
+    for (i = 0; i < results.size(); i++) {
+        const BenchResult &r = results[i];
+        fprintf(file,
+            "    {\"op\": \"%s\", \"alg\": \"%s\", \"shape\": \"%s\", \"dt\": \"%s\", \"threads\": "
+            "%u, \"time_ms\": %.6f, \"min_ms\": %.6f, \"gflops\": %.3f, \"gbps\": %.3f, "
+            "\"roofline\": %.4f",
+            r.op.c_str(), r.alg.c_str(), r.shape.c_str(), r.dt.c_str(), r.threads, r.time,
+            r.minTime, r.gflops, r.gbps, r.roofline);
+        if (r.baseline > 0) {
+            fprintf(file, ", \"baseline_min_ms\": %.6f, \"regression\": %s", r.baseline,
+                r.regression ? "true" : "false");
+        }
+        fprintf(file, "}%s\n", (i + 1 < results.size()) ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+}
+
+static void print_help(char *name)
+{
+    printf("usage: %s [options]\n"
+           "  -o ops       operators separated by ',': conv,depthwise,mmm,mvm,softmax,layernorm,"
+           "pooling,eltwise(default all).\n"
+           "  -s op=shapes shape sweep of an operator, shapes separated by ';', dimensions by "
+           "'x', can be repeated.\n"
+           "               conv: n x ic x h x w x oc x kernel x stride x pad, depthwise: n x c x "
+           "h x w x kernel x stride x pad,\n"
+           "               mmm: m x n x k, mvm: m x k, softmax/layernorm: rows x cols, pooling: "
+           "n x c x h x w x kernel x stride,\n"
+           "               eltwise: n x c x h x w.\n"
+           "  -a algs      convolution algorithms: fastest,pointwise,direct,gemm_icnchw,winograd"
+           "(default all applicable).\n"
+           "  -d dts       data types: f32,f16(default all compiled).\n"
+           "  -t threads   thread counts separated by ','(default 1).\n"
+           "  -w warmup    warm up loops(default %d).\n"
+           "  -l loops     benchmark loops, median is reported(default 10).\n"
+           "  -j path      write json report to path(default stdout).\n"
+           "  -c path      compare minimum time with a previous json report, exit 1 if any case "
+           "regresses.\n"
+           "  -r percent   regression threshold of -c(default 5).\n"
+           "  -p pool      1 runs kernels on a thread pool instead of OpenMP(default 0).\n",
+        name, UT_WARMUP);
+}
+
+int main(int argc, char **argv)
+{
+    std::vector<std::string> ops = {
+        "conv", "depthwise", "mmm", "mvm", "softmax", "layernorm", "pooling", "eltwise"};
+    std::map<std::string, std::string> shapes;
+    std::vector<std::string> convAlgs = {"fastest", "pointwise", "direct", "gemm_icnchw", "winograd"};
+    std::vector<std::string> dts;
+#ifdef _USE_FP32
+    dts.push_back("f32");
+#endif
+#ifdef _USE_FP16
+    dts.push_back("f16");
+#endif
+    std::vector<U32> threads = {1};
+    int warmup = UT_WARMUP;
+    int loops = 10;
+    const char *jsonPath = nullptr;
+    const char *baselinePath = nullptr;
+    double threshold = 5;
+    bool threadPool = false;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-h" || arg == "--help" || i + 1 >= argc) {
+            print_help(argv[0]);
+            return (arg == "-h" || arg == "--help") ? 0 : 1;
+        }
+        std::string value = argv[++i];
+        if (arg == "-o") {
+            ops = split(value, ',');
+        } else if (arg == "-s") {
+            size_t pos = value.find('=');
+            if (pos == std::string::npos) {
+                print_help(argv[0]);
+                return 1;
+            }
+            shapes[value.substr(0, pos)] = value.substr(pos + 1);
+        } else if (arg == "-a") {
+            convAlgs = split(value, ',');
+        } else if (arg == "-d") {
+            dts = split(value, ',');
+        } else if (arg == "-t") {
+            threads.clear();
+            for (auto &s : split(value, ',')) {
+                threads.push_back(atoi(s.c_str()));
+            }
+        } else if (arg == "-w") {
+            warmup = atoi(value.c_str());
+        } else if (arg == "-l") {
+            loops = UNI_MAX(1, atoi(value.c_str()));
+        } else if (arg == "-j") {
+            jsonPath = argv[i];
+        } else if (arg == "-c") {
+            baselinePath = argv[i];
+        } else if (arg == "-r") {
+            threshold = atof(value.c_str());
+        } else if (arg == "-p") {
+            threadPool = atoi(value.c_str());
+        } else {
+            print_help(argv[0]);
+            return 1;
+        }
+    }
+    std::map<std::string, DataType> dtMap = {{"f32", DT_F32}, {"f16", DT_F16}};
+    std::map<std::string, double> baseline;
+    if (baselinePath != nullptr) {
+        baseline = load_baseline(baselinePath);
+    }
+
+    std::map<U32, std::map<std::string, Roofline>> machine;
+    std::vector<BenchResult> results;
+    int regressions = 0;
+    for (auto t : threads) {
+        set_cpu_num_threads(t);
+        U32 threadNum = OMP_NUM_THREADS;
+        if (machine.find(threadNum) != machine.end()) {
+            continue;
+        }
+        std::shared_ptr<ThreadPool> pool;
+        if (threadPool) {
+            pool = std::shared_ptr<ThreadPool>(new ThreadPool(threadNum));
+        }
+        ThreadPoolScope scope(pool.get());
+        double gbps = measure_bandwidth(loops);
+        for (auto &dtName : dts) {
+            if (dtMap.find(dtName) == dtMap.end()) {
+                UNI_WARNING_LOG("skip unsupported data type %s.\n", dtName.c_str());
+                continue;
+            }
+            DataType dt = dtMap[dtName];
+            Roofline roof = {measure_peak(dt, loops), gbps};
+            machine[threadNum][dtName] = roof;
+            UNI_INFO_LOG("threads %u %s: peak %.3f GFLOP/s, bandwidth %.3f GB/s\n", threadNum,
+                dtName.c_str(), roof.gflops, roof.gbps);
+            for (auto &op : ops) {
+                std::string sweep = shapes.count(op) ? shapes[op] : "";
+                if (sweep == "" && default_shapes(op) != nullptr) {
+                    sweep = default_shapes(op);
+                }
+                for (auto &shape : split(sweep, ';')) {
+                    for (auto &c : get_cases(op, parse_shape(shape), dt, convAlgs)) {
+                        BenchResult r;
+                        r.op = op;
+                        r.alg = c.alg;
+                        r.shape = shape;
+                        r.dt = dtName;
+                        r.threads = threadNum;
+                        r.time = time_case(c, warmup, loops, &r.minTime);
+                        r.gflops = ut_gflops(c.flops, r.time);
+                        r.gbps = c.bytes / r.time * 1e-6;
+                        double bound = UNI_MIN(roof.gflops, c.flops / c.bytes * roof.gbps);
+                        r.roofline = (bound > 0) ? r.gflops / bound : 0;
+                        std::string key = result_key(op, r.alg, shape, dtName,
+                            std::to_string(threadNum));
+                        r.baseline = baseline.count(key) ? baseline[key] : 0;
+                        r.regression = (r.baseline > 0) &&
+                            (r.minTime > r.baseline * (1 + threshold / 100));
+                        if (r.regression) {
+                            regressions++;
+                        }
+                        UNI_INFO_LOG("%10s %-22s %-28s %s x%u: %10.4f ms %10.3f GFLOP/s %8.3f GB/s "
+                                     "%6.1f%% roofline%s\n",
+                            op.c_str(), r.alg.c_str(), shape.c_str(), dtName.c_str(), threadNum,
+                            r.time, r.gflops, r.gbps, r.roofline * 100,
+                            r.regression ? " REGRESSION" : "");
+                        results.push_back(r);
+                    }
+                }
+            }
+        }
+    }
+
+    FILE *file = stdout;
+    if (jsonPath != nullptr) {
+        file = fopen(jsonPath, "w");
+        if (file == nullptr) {
+            UNI_ERROR_LOG("can not write json report to %s.\n", jsonPath);
+            return 1;
+        }
+    }
+    write_json(file, machine, results, threshold);
+    if (file != stdout) {
+        fclose(file);
+    }
+    if (regressions > 0) {
+        UNI_WARNING_LOG("%d cases are slower than baseline by more than %.2f%%.\n", regressions,
+            threshold);
+        return 1;
+    }
+    return 0;
+}
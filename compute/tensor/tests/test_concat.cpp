@@ -96,6 +96,22 @@ int concatTest(int argc, char **argv, DataType dt)
 
         // check
         ut_check_v(get_ptr_from_tensor(outTensor, CPU_GENERAL), outputRef, in_len, dt, 0);
+
+        // first input already lies at the head of output(kv cache appended in place)
+        if (outDesc.df == DF_NCHW && inTensors[0].get_desc().df == DF_NCHW &&
+            (p.axis == 0 || on == 1)) {
+            U8 *outPtr = (U8 *)get_ptr_from_tensor(outTensor, CPU_GENERAL);
+            U32 headBytes = inTensors[0].bytes();
+            UNI_MEMCPY(outPtr, get_ptr_from_tensor(inTensors[0], CPU_GENERAL), headBytes);
+            UNI_MEMSET(outPtr + headBytes, 0, outTensor.bytes() - headBytes);
+            Tensor headTensor;
+            headTensor.resize(inTensors[0].get_desc());
+            headTensor.reuse(&outTensor);
+            std::vector<Tensor> inPlaceTensors = inTensors;
+            inPlaceTensors[0] = headTensor;
+            CHECK_STATUS(concat(inPlaceTensors, p, tmpTensor, outTensor, &UT_CPU_ARCHINFO));
+            ut_check_v(outPtr, outputRef, in_len, dt, 0);
+        }
     }
 
     // benchmark
@@ -38,6 +38,7 @@ int detectionoutputTest(int argc, char **argv, DataType dt)
     detectionoutput_desc.nms_threshold = 0.449999988079;
     detectionoutput_desc.keep_top_k = 200;
     detectionoutput_desc.confidence_threshold = 0.00999999977648;
+    detectionoutput_desc.nms_mode = NMS_GREEDY;
 
     std::vector<Tensor> inputTensors(3);
     std::vector<Tensor *> inputTensorPtrs(3);
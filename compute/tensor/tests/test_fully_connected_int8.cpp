@@ -123,9 +123,98 @@ int fullyConnectedTest(int argc, char **argv, DataType dt, DataType filterDataTy
     return 0;
 }
 
+// float input and int8 filter quantized per output channel, input is quantized per row at run time
+int dynamicQuantizationTest(int argc, char **argv, DataType dt)
+{
+    CHECK_REQUIREMENT(argc == 4);
+    U32 m = atoi(argv[1]);
+    U32 k = atoi(argv[2]);
+    U32 n = atoi(argv[3]);
+
+    TensorDesc inputDesc = tensor4df(dt, DF_NCHW, m, 1, 1, k);
+    TensorDesc filterDesc = tensor2df(dt, DF_TRANSPOSE, n, k);
+    TensorDesc biasDesc = tensor1d(dt, n);
+
+    Tensor inputTensor = Tensor::alloc_sized<CPUMem>(inputDesc);
+    U8 *input = ut_input_v(m * k, dt, UT_INIT_RANDOM);
+    UNI_MEMCPY(get_ptr_from_tensor(inputTensor, CPU_GENERAL), input, tensorNumBytes(inputDesc));
+    Tensor filterTensor = Tensor::alloc_sized<CPUMem>(filterDesc);
+    U8 *filter = ut_input_v(k * n, dt, UT_INIT_RANDOM);
+    UNI_MEMCPY(get_ptr_from_tensor(filterTensor, CPU_GENERAL), filter, tensorNumBytes(filterDesc));
+    Tensor biasTensor = Tensor::alloc_sized<CPUMem>(biasDesc);
+    U8 *bias = ut_input_v(n, dt, UT_INIT_RANDOM);
+    UNI_MEMCPY(get_ptr_from_tensor(biasTensor, CPU_GENERAL), bias, tensorNumBytes(biasDesc));
+
+    // set output
+    Tensor outputTensor;
+    CHECK_STATUS(fully_connected_infer_output_size(
+        &inputTensor, filterTensor, &outputTensor, &UT_CPU_ARCHINFO));
+    outputTensor.alloc();
+    Tensor outputTensorRef = Tensor::alloc_sized<CPUMem>(outputTensor.get_desc());
+
+    // trans filter
+    U32 ftmBytes;
+    CHECK_STATUS(
+        fully_connected_dynamic_quantize_filter_bytes(filterTensor, &ftmBytes, &UT_CPU_ARCHINFO));
+    Tensor ftmTensor = Tensor::alloc_sized<CPUMem>(tensor1d(DT_U8, ftmBytes));
+    CHECK_STATUS(
+        fully_connected_dynamic_quantize_filter(filterTensor, &ftmTensor, &UT_CPU_ARCHINFO));
+
+    // setup tmp
+    U32 tmpBytes, tmpBytesRef;
+    CHECK_STATUS(fully_connected_infer_forward_tmp_bytes(
+        inputTensor, ftmTensor, outputTensor, &tmpBytes, &UT_CPU_ARCHINFO));
+    CHECK_STATUS(fully_connected_infer_forward_tmp_bytes(
+        inputTensor, filterTensor, outputTensorRef, &tmpBytesRef, &UT_SERIAL_ARCHINFO));
+    Tensor tmpTensor =
+        Tensor::alloc_sized<CPUMem>(tensor1d(DT_U8, UNI_MAX(tmpBytes, tmpBytesRef)));
+    std::vector<Tensor> tmpTensors(1, tmpTensor);
+
+    if (UT_CHECK) {
+        CHECK_STATUS(fully_connected(
+            inputTensor, ftmTensor, biasTensor, tmpTensors, outputTensor, &UT_CPU_ARCHINFO));
+
+        // naive implement
+        if (m == 1) {
+            filterDesc.df = DF_NORMAL;
+            filterTensor.resize(filterDesc);
+        }
+        CHECK_STATUS(fully_connected(inputTensor, filterTensor, biasTensor, tmpTensors,
+            outputTensorRef, &UT_SERIAL_ARCHINFO));
+
+        // check
+        ut_check_v(get_ptr_from_tensor(outputTensor, CPU_GENERAL),
+            get_ptr_from_tensor(outputTensorRef, CPU_GENERAL), m * n, dt, 0.2);
+    }
+    // benchmark
+    double time_start = ut_time_ms();
+    for (int iter = 0; iter < UT_LOOPS; iter++) {
+        CHECK_STATUS(fully_connected(
+            inputTensor, ftmTensor, biasTensor, tmpTensors, outputTensor, &UT_CPU_ARCHINFO));
+    }
+    double time_end = ut_time_ms();
+    double time = (time_end - time_start) / UT_LOOPS;
+
+    // log performance data
+    char buffer[150];
+    char params[120];
+    sprintf(params, "(%u %u)+(%u %u)=(%u %u)", m, k, k, n, m, n);
+    sprintf(buffer, "%20s, %80s", "InnerProduct(dynamic)", params);
+    double ops = 2.0 * m * n * k + 1.0 * m * n;
+    ut_log(dt, buffer, ops, time);
+
+    free(input);
+    free(filter);
+    free(bias);
+    return 0;
+}
+
 int main(int argc, char **argv)
 {
 #ifdef _USE_INT8
+#if defined(_USE_X86) && defined(_USE_FP32)
+    dynamicQuantizationTest(argc, argv, DT_F32);
+#endif
 #ifdef _USE_FP16
     fullyConnectedTest(argc, argv, DT_F16, DT_F16_8Q);
 #else
@@ -16,7 +16,7 @@
 
 int nonmaxsuppressionTest(int argc, char **argv, DataType dt)
 {
-    CHECK_REQUIREMENT(argc == 12);
+    CHECK_REQUIREMENT(argc == 12 || argc == 13);
     // in0 boxes
     U32 in0 = atoi(argv[1]);
     U32 ic0 = atoi(argv[2]);
@@ -29,11 +29,14 @@ int nonmaxsuppressionTest(int argc, char **argv, DataType dt)
     U32 max_output_boxes_per_class = atoi(argv[9]);
     F32 iou_threshold = (F32)atof(argv[10]);
     F32 score_threshold = (F32)atof(argv[11]);
+    // 0: greedy, 1: fast, 2: matrix
+    NMSMode mode = (argc == 13) ? (NMSMode)atoi(argv[12]) : NMS_GREEDY;
 
     NonMaxSuppressionParamSpec nonMaxSuppressionParamSpec;
     nonMaxSuppressionParamSpec.max_output_boxes_per_class = max_output_boxes_per_class;
     nonMaxSuppressionParamSpec.iou_threshold = iou_threshold;
     nonMaxSuppressionParamSpec.score_threshold = score_threshold;
+    nonMaxSuppressionParamSpec.mode = mode;
 
     std::vector<Tensor> inputTensors(2);
     TensorDesc input_desc_boxes = tensor3d(dt, in0, ic0, ilens0);
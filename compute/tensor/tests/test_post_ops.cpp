@@ -0,0 +1,191 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "tensor_computing.h"
+#include "ut_util.h"
+
+// scalar reference of 1x1 convolution and its post ops on NCHWC8 data, bias is followed by
+// alpha and beta of channel wise scale. broadcasted addend is NCHW (in, oc, 1, 1).
+template <typename T>
+static void postOpsRef(const T *input,
+    const T *filter,
+    const T *bias,
+    const T *addend,
+    T *output,
+    U32 in,
+    U32 ic,
+    U32 hw,
+    U32 oc,
+    bool broadcast,
+    const ConvolutionParamSpec &p)
+{
+    const T *alpha = bias + oc;
+    const T *beta = alpha + oc;
+    for (U32 n = 0; n < in; n++) {
+        for (U32 o = 0; o < oc; o++) {
+            for (U32 i = 0; i < hw; i++) {
+                F32 value = bias[o];
+                for (U32 c = 0; c < ic; c++) {
+                    U32 index = ((n * ic / 8 + c / 8) * hw + i) * 8 + c % 8;
+                    value += (F32)input[index] * (F32)filter[o * ic + c];
+                }
+                U32 index = ((n * oc / 8 + o / 8) * hw + i) * 8 + o % 8;
+                value += (F32)addend[broadcast ? n * oc + o : index];
+                value = value * (F32)alpha[o] + (F32)beta[o];
+                const ClipParamSpec &clip = p.post_ops.ops[2].activation_spec.clip_spec;
+                value = UNI_MIN(UNI_MAX(value, clip.min), clip.max);
+                value = UNI_MIN(UNI_MAX(value, 0.f), 6.f);
+                output[index] = value;
+            }
+        }
+    }
+}
+
+int postOpsTest(int argc, char *argv[], DataType dt, bool broadcast)
+{
+    CHECK_REQUIREMENT(argc == 6);
+    U32 in = atoi(argv[1]);
+    U32 ic = atoi(argv[2]);
+    U32 ih = atoi(argv[3]);
+    U32 iw = atoi(argv[4]);
+    U32 oc = atoi(argv[5]);
+    CHECK_REQUIREMENT(ic % 8 == 0 && oc % 8 == 0);
+
+    ActivationParamSpec activationDesc;
+    activationDesc.mode = ACTIVATION_NULL;
+
+    // conv -> add -> channel wise scale -> clip -> relu6
+    ConvolutionParamSpec p = createConvolutionParamSpec(
+        1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, oc, CONVOLUTION_POINTWISE);
+    p.post_ops.num = 4;
+    UNI_MEMSET(p.post_ops.ops, 0, sizeof(p.post_ops.ops));
+    p.post_ops.ops[0].type = POST_OP_ELTWISE_SUM;
+    p.post_ops.ops[1].type = POST_OP_SCALE;
+    p.post_ops.ops[1].channel_wise = 1;
+    p.post_ops.ops[2].type = POST_OP_CLIP;
+    p.post_ops.ops[2].activation_spec.clip_spec.min = -2;
+    p.post_ops.ops[2].activation_spec.clip_spec.max = 4;
+    p.post_ops.ops[3].type = POST_OP_ACTIVATION;
+    p.post_ops.ops[3].activation_type = ACTIVATION_RELU6;
+
+    TensorDesc inputDesc = tensor4df(dt, DF_NCHWC8, in, ic, ih, iw);
+    TensorDesc filterDesc = tensor4df(dt, DF_NCHW, oc, ic, 1, 1);
+    // bias, alpha and beta of scale
+    TensorDesc biasDesc = tensor1d(dt, oc * 3);
+
+    U8 *input = ut_input_v(tensorNumElements(inputDesc), dt, UT_INIT_RANDOM);
+    U8 *filter = ut_input_v(tensorNumElements(filterDesc), dt, UT_INIT_RANDOM);
+    U8 *bias = ut_input_v(oc * 3, dt, UT_INIT_RANDOM);
+    Tensor inputTensor = Tensor::alloc_sized<CPUMem>(inputDesc);
+    Tensor filterTensor = Tensor::alloc_sized<CPUMem>(filterDesc);
+    Tensor biasTensor = Tensor::alloc_sized<CPUMem>(biasDesc);
+    UNI_MEMCPY(get_ptr_from_tensor(inputTensor, CPU_GENERAL), input, inputTensor.bytes());
+    UNI_MEMCPY(get_ptr_from_tensor(filterTensor, CPU_GENERAL), filter, filterTensor.bytes());
+    UNI_MEMCPY(get_ptr_from_tensor(biasTensor, CPU_GENERAL), bias, biasTensor.bytes());
+
+    Tensor outputTensor, outputTensorRef;
+    CHECK_STATUS(convolution_infer_output_size(
+        &inputTensor, filterTensor, p, &outputTensor, dt, &UT_CPU_ARCHINFO));
+    TensorDesc outputDesc = outputTensor.get_desc();
+    outputTensor.alloc();
+    outputTensorRef.resize(outputDesc);
+    outputTensorRef.alloc();
+    // broadcasted addend is expanded to the layout of output before post ops
+    TensorDesc addendDesc = broadcast ? tensor4df(dt, DF_NCHW, in, oc, 1, 1) : outputDesc;
+    U8 *addend = ut_input_v(tensorNumElements(addendDesc), dt, UT_INIT_RANDOM);
+    Tensor addendTensor = Tensor::alloc_sized<CPUMem>(addendDesc);
+    UNI_MEMCPY(get_ptr_from_tensor(addendTensor, CPU_GENERAL), addend, addendTensor.bytes());
+
+    ConvolutionForwardAlgorithm alg = CONVOLUTION_ALGORITHM_NULL;
+    CHECK_STATUS(convolution_infer_forward_algorithm(inputTensor, filterTensor, outputTensor, p,
+        CONVOLUTION_FASTEST, &alg, dt, activationDesc, &UT_CPU_ARCHINFO));
+    U32 tmpBytes, postBytes;
+    CHECK_STATUS(convolution_infer_forward_tmp_bytes(
+        inputTensor, filterTensor, outputTensor, p, alg, &tmpBytes, &UT_CPU_ARCHINFO));
+    CHECK_STATUS(post_ops_infer_forward_tmp_bytes(
+        {addendTensor}, outputTensor, &postBytes, &UT_CPU_ARCHINFO));
+    Tensor tmpTensor = Tensor::alloc_sized<CPUMem>(tensor1d(DT_U8, tmpBytes + postBytes));
+    U32 ftmBytes;
+    CHECK_STATUS(
+        convolution_transform_filter_bytes(filterTensor, p, alg, &ftmBytes, &UT_CPU_ARCHINFO));
+    Tensor ftmTensor = Tensor::alloc_sized<CPUMem>(tensor1d(DT_U8, ftmBytes));
+    CHECK_STATUS(
+        convolution_transform_filter(filterTensor, p, alg, tmpTensor, &ftmTensor, &UT_CPU_ARCHINFO));
+
+    std::vector<Tensor> inputTensors = {inputTensor, addendTensor};
+    std::vector<Tensor> tmpTensors(1, tmpTensor);
+    if (UT_CHECK) {
+        CHECK_STATUS(convolution(inputTensors, ftmTensor, p, alg, nullptr, biasTensor, tmpTensors,
+            outputTensor, activationDesc, &UT_CPU_ARCHINFO));
+
+        U8 *ref = (U8 *)get_ptr_from_tensor(outputTensorRef, CPU_GENERAL);
+        switch (dt) {
+#ifdef _USE_FP32
+            case DT_F32:
+                postOpsRef<F32>((F32 *)input, (F32 *)filter, (F32 *)bias, (F32 *)addend,
+                    (F32 *)ref, in, ic, ih * iw, oc, broadcast, p);
+                break;
+#endif
+#ifdef _USE_FP16
+            case DT_F16:
+                postOpsRef<F16>((F16 *)input, (F16 *)filter, (F16 *)bias, (F16 *)addend,
+                    (F16 *)ref, in, ic, ih * iw, oc, broadcast, p);
+                break;
+#endif
+            default:
+                CHECK_STATUS(NOT_SUPPORTED);
+                break;
+        }
+        // outputs are clipped into [0, 4]
+        F32 threshold = (dt == DT_F32) ? 0.001 : 0.05;
+        ut_check_v(get_ptr_from_tensor(outputTensor, CPU_GENERAL), ref, outputTensor.length(), dt,
+            threshold);
+    }
+
+    // benchmark
+    double time_start = ut_time_ms();
+    for (int iter = 0; iter < UT_LOOPS; iter++) {
+        CHECK_STATUS(convolution(inputTensors, ftmTensor, p, alg, nullptr, biasTensor, tmpTensors,
+            outputTensor, activationDesc, &UT_CPU_ARCHINFO));
+    }
+    double time_end = ut_time_ms();
+    double time = (time_end - time_start) / UT_LOOPS;
+
+    char buffer[150];
+    char params[120];
+    const char *addendName[2] = {"", " broadcast"};
+    sprintf(params, "(%u %u %u %u)+(%u %u 1 1)+%u post ops%s", in, ic, ih, iw, oc, ic,
+        p.post_ops.num, addendName[broadcast]);
+    sprintf(buffer, "%20s, %80s", "PostOps", params);
+    double ops = (1.0 * tensorNumElements(outputDesc)) * (2.0 * ic + 1 + p.post_ops.num);
+    ut_log(dt, buffer, ops, time);
+
+    free(input);
+    free(filter);
+    free(bias);
+    free(addend);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    for (int broadcast = 0; broadcast <= 1; broadcast++) {
+#ifdef _USE_FP16
+        postOpsTest(argc, argv, DT_F16, broadcast);
+#endif
+#ifdef _USE_FP32
+        postOpsTest(argc, argv, DT_F32, broadcast);
+#endif
+    }
+    return 0;
+}
@@ -0,0 +1,227 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "tensor_computing.h"
+#include "ut_util.h"
+
+// key tile of the cpu kernels, SDPA_BLOCK_K in cpu/scaled_dot_product_attention.h
+#define SDPA_TEST_BLOCK_K 64
+
+// softmax(Q * K^T * scale + mask) * V as two matrix multiplications, computed in double with
+// the whole score matrix, independent of the tiled kernels.
+static void naive_attention(U32 batch,
+    U32 heads,
+    U32 sq,
+    U32 sk,
+    U32 d,
+    bool transposeK,
+    U32 maskRows,
+    F32 scale,
+    const std::vector<F32> *inputs,
+    std::vector<F32> *output)
+{
+    const F32 *q = inputs[0].data();
+    const F32 *k = inputs[1].data();
+    const F32 *v = inputs[2].data();
+    const F32 *mask = inputs[3].data();
+    output->resize(batch * heads * sq * d);
+    std::vector<double> score(sk);
+    for (U32 b = 0; b < batch * heads; b++) {
+        for (U32 i = 0; i < sq; i++) {
+            const F32 *maskRow = mask + ((b / heads) * maskRows + ((maskRows == 1) ? 0 : i)) * sk;
+            double m = -INFINITY;
+            for (U32 j = 0; j < sk; j++) {
+                double sum = 0;
+                for (U32 x = 0; x < d; x++) {
+                    F32 kv = transposeK ? k[(b * sk + j) * d + x] : k[(b * d + x) * sk + j];
+                    sum += (double)q[(b * sq + i) * d + x] * kv;
+                }
+                score[j] = sum * scale + maskRow[j];
+                m = UNI_MAX(m, score[j]);
+            }
+            double sum = 0;
+            for (U32 j = 0; j < sk; j++) {
+                score[j] = exp(score[j] - m);
+                sum += score[j];
+            }
+            for (U32 x = 0; x < d; x++) {
+                double o = 0;
+                for (U32 j = 0; j < sk; j++) {
+                    o += score[j] / sum * v[(b * sk + j) * d + x];
+                }
+                (*output)[(b * sq + i) * d + x] = o;
+            }
+        }
+    }
+}
+
+int scaledDotProductAttentionTest(U32 batch,
+    U32 heads,
+    U32 sq,
+    U32 sk,
+    U32 d,
+    bool transposeK,
+    bool perQueryMask,
+    DataType dt,
+    bool log = true)
+{
+    ScaledDotProductAttentionParamSpec p;
+    p.scale = 1 / sqrt(d);
+    p.transpose_k = transposeK;
+    U32 maskRows = perQueryMask ? sq : 1;
+
+    TensorDesc qDesc = tensor4df(dt, DF_NCHW, batch, heads, sq, d);
+    TensorDesc kDesc = transposeK ? tensor4df(dt, DF_NCHW, batch, heads, sk, d)
+                                  : tensor4df(dt, DF_NCHW, batch, heads, d, sk);
+    TensorDesc vDesc = tensor4df(dt, DF_NCHW, batch, heads, sk, d);
+    TensorDesc maskDesc = tensor4df(dt, DF_NCHW, batch, 1, maskRows, sk);
+    TensorDesc descs[4] = {qDesc, kDesc, vDesc, maskDesc};
+    std::vector<Tensor> inputTensors(4);
+    std::vector<Tensor *> inputTensorPtrs(4);
+    std::vector<F32> inputs[4];
+    for (U32 i = 0; i < 4; i++) {
+        U32 length = tensorNumElements(descs[i]);
+        U8 *input = ut_input_v(length, dt, UT_INIT_RANDOM);
+        inputTensors[i] = Tensor::alloc_sized<CPUMem>(descs[i]);
+        UNI_MEMCPY(
+            get_ptr_from_tensor(inputTensors[i], CPU_GENERAL), input, tensorNumBytes(descs[i]));
+        inputTensorPtrs[i] = &inputTensors[i];
+        inputs[i].resize(length);
+        for (U32 j = 0; j < length; j++) {
+            inputs[i][j] = ut_get(dt, input + j * bytesOf(dt));
+        }
+        free(input);
+    }
+
+    Tensor outputTensor;
+    CHECK_STATUS(scaled_dot_product_attention_infer_output_size(
+        inputTensorPtrs, p, &outputTensor, &UT_CPU_ARCHINFO));
+    outputTensor.alloc();
+    Tensor outputTensorRef = Tensor::alloc_sized<CPUMem>(outputTensor.get_desc());
+    U32 tmpBytes;
+    CHECK_STATUS(scaled_dot_product_attention_infer_forward_tmp_bytes(
+        inputTensors, p, &tmpBytes, &UT_CPU_ARCHINFO));
+    Tensor tmpTensor = Tensor::alloc_sized<CPUMem>(tensor1d(DT_U8, tmpBytes));
+
+    if (UT_CHECK) {
+        F32 threshold = (dt == DT_F32) ? 0.0001 : 0.02;
+        CHECK_STATUS(scaled_dot_product_attention(
+            inputTensors, p, tmpTensor, outputTensor, &UT_CPU_ARCHINFO));
+
+        // naive implement
+        std::vector<F32> naive;
+        naive_attention(batch, heads, sq, sk, d, transposeK, maskRows, p.scale, inputs, &naive);
+        U8 *ref = ut_input_v(naive.size(), dt, UT_INIT_ZERO);
+        transformFromFloat(dt, naive.data(), ref, naive.size());
+
+        // check
+        ut_check_v(get_ptr_from_tensor(outputTensor, CPU_GENERAL), ref, outputTensor.length(), dt,
+            threshold);
+
+        // the tiled serial kernels follow the same reference
+        CHECK_STATUS(scaled_dot_product_attention(
+            inputTensors, p, tmpTensor, outputTensorRef, &UT_SERIAL_ARCHINFO));
+        ut_check_v(get_ptr_from_tensor(outputTensorRef, CPU_GENERAL), ref, outputTensor.length(),
+            dt, threshold);
+
+        // key and value of a kv cache that keeps capacity tokens in every head
+        U32 capacity = sk + 3;
+        std::vector<Tensor> stridedTensors = inputTensors;
+        for (U32 i = 1; i < 3; i++) {
+            bool tokenRows = (i == 2 || transposeK);
+            TensorDesc desc = descs[i];
+            desc.dims[tokenRows ? 1 : 0] = capacity;
+            stridedTensors[i] = Tensor::alloc_sized<CPUMem>(desc);
+            stridedTensors[i].resize(descs[i]);
+            U32 rows = tokenRows ? batch * heads : batch * heads * d;
+            U32 bytes = (tokenRows ? sk * d : sk) * bytesOf(dt);
+            U32 stride = (tokenRows ? capacity * d : capacity) * bytesOf(dt);
+            U8 *src = (U8 *)get_ptr_from_tensor(inputTensors[i], CPU_GENERAL);
+            U8 *dst = (U8 *)get_ptr_from_tensor(stridedTensors[i], CPU_GENERAL);
+            for (U32 j = 0; j < rows; j++) {
+                UNI_MEMCPY(dst + j * stride, src + j * bytes, bytes);
+            }
+        }
+        CHECK_STATUS(scaled_dot_product_attention(
+            stridedTensors, p, tmpTensor, outputTensorRef, &UT_CPU_ARCHINFO, capacity));
+        ut_check_v(get_ptr_from_tensor(outputTensorRef, CPU_GENERAL), ref, outputTensor.length(),
+            dt, threshold);
+        free(ref);
+    }
+    if (!log) {
+        return 0;
+    }
+
+    // benchmark
+    double time_start = ut_time_ms();
+    for (int iter = 0; iter < UT_LOOPS; iter++) {
+        CHECK_STATUS(scaled_dot_product_attention(
+            inputTensors, p, tmpTensor, outputTensor, &UT_CPU_ARCHINFO));
+    }
+    double time_end = ut_time_ms();
+    double time = (time_end - time_start) / UT_LOOPS;
+
+    // log performance data
+    char buffer[150];
+    char params[120];
+    sprintf(params, "(%u %u %u %u %u %d %d)=(%u %u %u %u)", batch, heads, sq, sk, d, transposeK,
+        perQueryMask, batch, heads, sq, d);
+    sprintf(buffer, "%20s, %80s", "ScaledDotProductAttention", params);
+    double ops = 4.0 * batch * heads * sq * sk * d + 4.0 * batch * heads * sq * sk;
+    ut_log(dt, buffer, ops, time);
+
+    return 0;
+}
+
+void scaledDotProductAttentionTest(int argc, char **argv, DataType dt)
+{
+    if (argc == 6 || argc == 8) {
+        U32 batch = atoi(argv[1]);
+        U32 heads = atoi(argv[2]);
+        U32 sq = atoi(argv[3]);
+        U32 sk = atoi(argv[4]);
+        U32 d = atoi(argv[5]);
+        bool transposeK = (argc == 8) ? atoi(argv[6]) : true;
+        bool perQueryMask = (argc == 8) ? atoi(argv[7]) : false;
+        scaledDotProductAttentionTest(batch, heads, sq, sk, d, transposeK, perQueryMask, dt);
+    } else {
+        UNI_INFO_LOG("running scaled dot product attention cover test...\n");
+        // key lengths around the key tile and query lengths around the query block
+        U32 sqs[] = {1, 3, 4, 7};
+        U32 sks[] = {1, SDPA_TEST_BLOCK_K - 1, SDPA_TEST_BLOCK_K, SDPA_TEST_BLOCK_K + 36};
+        U32 ds[] = {5, 32};
+        for (U32 sq : sqs) {
+            for (U32 sk : sks) {
+                for (U32 d : ds) {
+                    for (int transposeK = 0; transposeK <= 1; transposeK++) {
+                        for (int perQueryMask = 0; perQueryMask <= 1; perQueryMask++) {
+                            scaledDotProductAttentionTest(
+                                2, 3, sq, sk, d, transposeK, perQueryMask, dt, false);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+#ifdef _USE_FP16
+    scaledDotProductAttentionTest(argc, argv, DT_F16);
+#endif
+#ifdef _USE_FP32
+    scaledDotProductAttentionTest(argc, argv, DT_F32);
+#endif
+    return 0;
+}
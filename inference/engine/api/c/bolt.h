@@ -31,6 +31,9 @@ typedef void *ModelHandle;
 /** result data memory handle */
 typedef void *ResultHandle;
 
+/** request batching server handle */
+typedef void *BatchHandle;
+
 /** hardware affinity policy */
 typedef enum {
     CPU_HIGH_PERFORMANCE = 0,  ///< performance is high priority(use big core)
@@ -486,6 +489,69 @@ void SetRuntimeDevice(ModelHandle ih, int cpuId, HARDWARE_TYPE device);
  */
 void SetRuntimeDeviceDynamic(ModelHandle ih);
 
+/**
+ * @brief run a model on the cpus of a NUMA node and place its memory on the node
+ * @param  ih            inference pipeline handle
+ * @param  node          NUMA node id(0, 1, ...), -1 means spreading models over nodes in turn
+ *
+ * @note
+ * This function binds the calling thread and its parallel threads, so it should be called in the
+ * thread that runs the model. Weights, tensors and temporary buffer of the model are moved to the
+ * node. A cloned model bound to another node copies the weights once for that node, clones on the
+ * same node share them. Worker threads of inter-operator parallelism and their parallel threads
+ * also run on the node. Only CPU inference on Linux is supported. Environment variable
+ * BOLT_NUMA_CPULIST can simulate the nodes.
+ * @return
+ */
+void SetNumaNode(ModelHandle ih, int node);
+
+/**
+ * @brief choose algorithms and threads of CPU layers by timing them on the model input shapes
+ * @param  ih            inference pipeline handle
+ * @param  enable        1 means tuning in PrepareModel, 0 means choosing by heuristics(default)
+ *
+ * @note
+ * This function must be called before PrepareModel. Tuning makes PrepareModel slower, so results
+ * are saved to the algorithm map path given to CreateModel and loaded by later runs, which skip
+ * tuning. Convolution algorithms and threads of Convolution, Deconvolution, FullyConnected and
+ * MatMul are tuned, the map must be tuned again after the device or thread number changes.
+ * @return
+ */
+void SetAlgorithmTuning(ModelHandle ih, int enable);
+
+/**
+ * @brief transform weights of CPU layers on a background thread after PrepareModel
+ * @param  ih            inference pipeline handle
+ * @param  enable        1 means PrepareModel returns before weights are transformed, 0 means
+ *                       PrepareModel transforms all weights(default)
+ *
+ * @note
+ * This function must be called before PrepareModel. The first RunModel waits for the weights of
+ * each layer just before running it, so early layers run while later weights are transformed.
+ * Weight cache, weight share, NUMA binding and algorithm tuning transform all weights in
+ * PrepareModel, lazy weight is ignored when they are set.
+ * @return
+ */
+void SetLazyWeight(ModelHandle ih, int enable);
+
+/**
+ * @brief run parallel loops of CPU layers on threads owned by the model instead of OpenMP
+ * @param  ih            inference pipeline handle
+ * @param  enable        1 means using the thread pool of the model, 0 means OpenMP(default)
+ *
+ * @note
+ * Threads of the pool spin for a while before they sleep, so small layers do not pay the cost of
+ * waking threads. The number of threads of a layer follows its work, up to SetNumThreads. The pool
+ * has the threads that SetNumThreads gave when the model was prepared, a smaller SetNumThreads of
+ * the calling thread only lowers the threads of a run. With SetNumInterOpThreads, every concurrent
+ * worker owns a pool of its share of the threads. A cloned model owns its own pools, models running
+ * in different threads do not share threads.
+ * Only x86 fp32 softmax, layer norm, scale and eltwise run on the pool. Convolution, deconvolution,
+ * FC, MatMul(GEMM) and other layers still use OpenMP threads.
+ * @return
+ */
+void SetThreadPool(ModelHandle ih, int enable);
+
 /**
  * @brief set parallel threads num
  * @param  threads       number of threads
@@ -497,6 +563,203 @@ void SetRuntimeDeviceDynamic(ModelHandle ih);
  */
 void SetNumThreads(int threads);
 
+/**
+ * @brief set the number of workers that run independent operators of a model concurrently
+ * @param  ih            inference pipeline handle
+ * @param  threads       number of workers, 1 means operators run one by one(default)
+ *
+ * @note
+ * Each operator still uses SetNumThreads threads inside, so big operators keep their parallelism.
+ * Every worker owns a tmp buffer, memory usage grows with the number of workers.
+ * Models with loop or dynamic output size operators always run one by one, and GPU is not supported.
+ * @return
+ */
+void SetNumInterOpThreads(ModelHandle ih, int threads);
+
+/**
+ * @brief set the directory to keep transformed weights of a model
+ * @param  ih            inference pipeline handle
+ * @param  path          directory path, NULL or "" means no cache(default)
+ *
+ * @note
+ * This function must be called before PrepareModel.
+ * The first PrepareModel writes the transformed weights to a file in path, later PrepareModel of
+ * the same model on the same device maps the file and skips weight transform. File name has a key
+ * of the model weights, shapes and the instruction set extensions that weights are packed for, so
+ * a changed model or a cpu of other extensions writes another file.
+ * Only CPU float inference is supported, other operators are transformed as usual.
+ * @return
+ */
+void SetWeightCachePath(ModelHandle ih, const char *path);
+
+/**
+ * @brief share transformed weights of a model between processes
+ * @param  ih            inference pipeline handle
+ * @param  enable        1 means keeping transformed weights in POSIX shared memory, 0 means no(default)
+ *
+ * @note
+ * This function must be called before PrepareModel, it overrides SetWeightCachePath.
+ * The first process that prepares the model writes the transformed weights to shared memory, the
+ * later ones map them read only, so the host keeps one copy of them. Processes that start at the
+ * same time transform weights in parallel, the first writer wins and the others map its segment.
+ * Segments are named by model name, device, data type and a key of the model weights. Writing a
+ * new version of a model removes the segments of its older versions, other segments are kept
+ * until reboot or removed from /dev/shm(bolt_weightShare_*).
+ * Only CPU float inference on Linux is supported, other operators are transformed as usual.
+ * @return
+ */
+void SetWeightShare(ModelHandle ih, int enable);
+
+/**
+ * @brief keep execution plans of the recently used input shapes
+ * @param  ih            inference pipeline handle
+ * @param  capacity      the number of input shapes to keep, 0 means no cache(default)
+ *
+ * @note
+ * ResizeModelInput to a kept shape only updates tensor shapes, tensor memory and temporary
+ * buffer are not planned and allocated again. Only CPU inference is supported.
+ * @return
+ */
+void SetPlanCache(ModelHandle ih, int capacity);
+
+/**
+ * @brief run FC and MatMul in int8 without calibration
+ * @param  ih            inference pipeline handle
+ * @param  enable        1 means quantizing activations to int8 at run time, 0 means float(default)
+ *
+ * @note
+ * This function must be called before PrepareModel.
+ * FC weights are quantized per output channel when the model is prepared, FC inputs are quantized
+ * per row and MatMul inputs per tensor at run time, other operators stay in float.
+ * Only x86 float inference of the library built with int8 is supported.
+ * @return
+ */
+void SetDynamicQuantization(ModelHandle ih, int enable);
+
+/**
+ * @brief create a server that gathers concurrent requests of a model into batches
+ * @param  ih            inference pipeline handle, model must have been prepared by PrepareModel
+ * @param  maxBatch      the max number of requests in a batch
+ * @param  timeoutUs     the max time(microseconds) a request waits for other requests
+ *
+ * @return batch server handle
+ * @note
+ * Every request must have the input shape that model was prepared with, requests are concatenated along n dimension.
+ * Model is only resized when the batch size changes, plans of batch sizes are kept in plan cache.
+ * Don't call RunModel on ih before the server has been destroyed, model keeps the last batch size,
+ * call ResizeModelInput to run it with other input shape.
+ * @code
+ *     BatchHandle ib = CreateBatchServer(ih, 8, 2000);
+ *     // in many threads
+ *     RunBatchModel(ib, ...);
+ *     DestroyBatchServer(ib);
+ * @endcode
+ */
+BatchHandle CreateBatchServer(ModelHandle ih, int maxBatch, int timeoutUs);
+
+/**
+ * @brief run one request through batch server, can be called by many threads concurrently
+ * @param  ib            batch server handle
+ * @param  numInputs     the number of input data
+ * @param  name          the array of all input data's name
+ * @param  data          the array of all input data
+ * @param  numOutputs    the number of output data
+ * @param  outputName    the array of output data's name
+ * @param  outputData    the array of output data's content
+ *
+ * @return error code(0: success, 1: error)
+ * @note
+ * Input and output data type and format are same with the model's.
+ * Developer need to allocate outputData[i]'s memory, it is the output size of a single request.
+ */
+int RunBatchModel(BatchHandle ib,
+    int numInputs,
+    const char **name,
+    void **data,
+    int numOutputs,
+    const char **outputName,
+    void **outputData);
+
+/**
+ * @brief destroy batch server after all requests have returned
+ * @param  ib            batch server handle
+ *
+ * @return
+ */
+void DestroyBatchServer(BatchHandle ib);
+
+/**
+ * @brief preallocate key/value cache for incremental decoding of GPT-style model
+ * @param  ih            inference pipeline handle, model must have been prepared by PrepareModel
+ * @param  num           the number of key/value cache tensors
+ * @param  pastName      the array of model input names that take the cache of previous tokens
+ * @param  presentName   the array of model output names that produce the cache of this step,
+ *                       presentName[i] is fed back to pastName[i] at next step
+ * @param  maxLength     the max number of tokens kept in cache
+ *
+ * @return error code(0: success, 1: error)
+ * @note
+ * Model must be prepared with past length shorter than present length(e.g. past length 0),
+ * the only different dimension is taken as sequence axis.
+ * Cache starts empty, past inputs are owned by engine and can not be set by user any more.
+ * New tokens are appended in place only when present is Concat(past, ...) and all dimensions
+ * outside of sequence axis are 1(e.g. batch 1 and heads folded into the inner dimensions).
+ * A multi-head cache(e.g. [batch, heads, tokens, size]) is also appended in place when present
+ * is only read as key or value by ScaledDotProductAttention, each head then keeps maxLength
+ * tokens, so present output holds the cache with a stride of maxLength tokens between heads.
+ * Otherwise two buffers are used in turn and Concat copies past into present at each step.
+ * Only CPU is supported.
+ * @code
+ *     PrepareModel(ih, ...);
+ *     CreateKVCache(ih, 2, pastName, presentName, 512);
+ *     RunModelStep(ih, ir, ...);  // prompt tokens
+ *     RunModelStep(ih, ir, ...);  // one token at each step
+ *     ResetKVCache(ih);
+ * @endcode
+ */
+int CreateKVCache(
+    ModelHandle ih, int num, const char **pastName, const char **presentName, int maxLength);
+
+/**
+ * @brief run one decoding step, append its tokens to key/value cache
+ * @param  ih            inference pipeline handle
+ * @param  ir            result data handle, can be NULL
+ * @param  numInputs     the number of token inputs, past inputs of cache are not included
+ * @param  name          the array of token input names
+ * @param  n             the array of token input's n dimension
+ * @param  c             the array of token input's c dimension
+ * @param  h             the array of token input's h dimension
+ * @param  w             the array of token input's w dimension
+ * @param  dt            the array of token input's data type
+ * @param  df            the array of token input's data format
+ * @param  data          the array of token input's data
+ *
+ * @return error code(0: success, 1: error, e.g. cache is full)
+ * @note
+ * Memory is planned for the number of new tokens that model was prepared with, and planned again
+ * when a step has more tokens. Other steps only infer tensor shapes and do not reallocate memory,
+ * the cache is not copied by the caller.
+ */
+int RunModelStep(ModelHandle ih,
+    ResultHandle ir,
+    int numInputs,
+    const char **name,
+    const int *n,
+    const int *c,
+    const int *h,
+    const int *w,
+    const DATA_TYPE *dt,
+    const DATA_FORMAT *df,
+    void **data);
+
+/**
+ * @brief clear key/value cache to start a new sequence, buffers are kept
+ * @param  ih            inference pipeline handle
+ *
+ * @return
+ */
+void ResetKVCache(ModelHandle ih);
+
 /**
  * @brief transform data type
  * @param  ih            inference pipeline handle
@@ -519,6 +782,30 @@ int TransformDataType(ModelHandle ih,
     float *outputScale,
     unsigned int length);
 
+/**
+ * @brief enable or disable per-operator profiling
+ * @param  enable        1: enable, 0: disable(default)
+ *
+ * @note
+ * Profiling is also enabled by environment variable BOLT_PROFILE=ON, then summary is printed at exit
+ * and Chrome trace is written to environment variable BOLT_PROFILE_TRACE if it is set.
+ * Every operator records wall time, cycles, instructions, last level cache misses and tensor bytes.
+ * Hardware counters are only available on linux with perf events permission, otherwise they are 0.
+ * @return
+ */
+void SetProfiling(int enable);
+
+/**
+ * @brief write operators that have been profiled, and drop them
+ * @param  traceFile     Chrome trace file path, can be opened by chrome://tracing, NULL means no trace
+ * @param  summaryFile   summary of every operator type file path, NULL means printing to stdout
+ *
+ * @note
+ * This should not be called while any model is running.
+ * @return error code(0: success, 1: error)
+ */
+int DumpProfiling(const char *traceFile, const char *summaryFile);
+
 /**
  * @brief check memory leak
  *
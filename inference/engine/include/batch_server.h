@@ -0,0 +1,73 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#ifndef _BATCH_SERVER_H
+#define _BATCH_SERVER_H
+
+#include <deque>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "cnn.h"
+
+// Gather concurrent requests of a prepared CNN into one batch along N dimension.
+// A batch is run when maxBatch requests have arrived or the first request has waited
+// timeoutUs microseconds. Every request has the input shape that the model was prepared with,
+// model is only replanned when the batch size changes, and the plans of batch sizes are kept.
+// Outputs are split along N and copied back. If the outermost dimension of an output does not
+// grow with the batch while others stay, requests are run one by one. Model keeps the last batch
+// size after server is destroyed.
+class BatchServer {
+public:
+    BatchServer(CNN *cnn, U32 maxBatch, U32 timeoutUs);
+
+    ~BatchServer();
+
+    // thread safe, block until the request has finished. data is in model input/output type
+    // and format, outputs must be big enough to hold the output of a single request.
+    // Request that lacks a model input is rejected.
+    EE run(std::map<std::string, U8 *> inputs, std::map<std::string, U8 *> outputs);
+
+private:
+    struct Request {
+        std::map<std::string, U8 *> inputs;
+        std::map<std::string, U8 *> outputs;
+        std::chrono::steady_clock::time_point arrival;
+        bool done;
+        EE ret;
+    };
+
+    void loop();
+
+    void prepare(U32 batch);
+
+    EE run_batch(std::vector<Request *> &batch);
+
+    CNN *cnn;
+    U32 maxBatch;
+    U32 timeoutUs;
+    bool batchable;
+    U32 preparedBatch;
+    std::map<std::string, TensorDesc> inputDescs;
+    std::map<std::string, TensorDesc> outputDescs;
+
+    std::deque<Request *> requests;
+    std::mutex mutex;
+    std::condition_variable requestCondition;
+    std::condition_variable doneCondition;
+    bool stop;
+    std::thread thread;
+};
+#endif  // _BATCH_SERVER_H
@@ -15,10 +15,19 @@
 #define _CNN_H
 
 #include <string>
+#include <set>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
 #include "model.hpp"
 #include "memory_tracker.hpp"
+#include "weight_operator.hpp"
 #include "model_spec.h"
 #include "thread_affinity.h"
+#include "thread_pool.h"
+#include "graph_executor.hpp"
+#include "kv_cache.hpp"
+#include "plan_cache.hpp"
 #ifdef _USE_GPU
 #include "image_container.hpp"
 #endif
@@ -64,10 +73,70 @@ public:
 
     void reready(std::map<std::string, TensorDesc> inputDescMap);
 
+    // keep plans of the last capacity input shapes, reready to a kept shape skips memory and tmp
+    // planning. 0 means no cache(default). Inputs can be padded along axis to buckets by mode.
+    void set_plan_cache(
+        U32 capacity, PlanBucketMode mode = PLAN_BUCKET_NONE, U32 value = 0, int axis = 1);
+
+    // reready for inputs of another batch size without bucket padding, plan cache keeps at least
+    // maxBatch plans so that batch sizes 1...maxBatch are planned only once.
+    void reready_batch(std::map<std::string, TensorDesc> inputDescMap, U32 maxBatch);
+
     Tensor get_tensor_by_name(std::string tensorName);
 
     TensorDesc get_tensor_desc_by_name(std::string tensorName);
 
+    // run independent operators concurrently on threadNum workers, 1 means sequential run.
+    void set_inter_op_threads(U32 threadNum);
+
+    // keep transformed filters in directory path, later ready() maps them instead of transforming.
+    void set_weight_cache_path(std::string path);
+
+    // keep transformed filters in POSIX shared memory, processes preparing the same model on the
+    // same device map one copy instead of transforming their own.
+    void set_weight_share(bool enable);
+
+    // run FC and MatMul in int8 by quantizing activations at run time, no calibration is needed.
+    // only x86 float inference with int8 enabled supports it, it must be set before ready().
+    void set_dynamic_quantization(bool enable);
+
+    // time candidate algorithms and threads of CPU operators on the real shapes in ready() instead
+    // of choosing them by heuristics. Results are kept in the algorithm map, a loaded map skips
+    // tuning and saveAlgorithmMapToFile keeps them for later runs. It must be set before ready().
+    void set_algorithm_tuning(bool enable);
+
+    bool get_algorithm_tuning();
+
+    // transform weights on a background thread after ready(), run() waits for the weights of each
+    // operator before running it, so first operators run while later weights are transformed.
+    // It must be set before ready(), weight cache, weight share, NUMA binding and algorithm
+    // tuning need all weights in ready(), they disable it.
+    void set_lazy_weight(bool enable);
+
+    // run parallel loops of CPU operators on threads owned by this model instead of OpenMP, the
+    // threads stay bound to the cpus of the model and wait between operators by spinning first.
+    // Clones own their threads, so models in one process do not share a thread team. x86 fp32
+    // GEMM, FC, direct and 1x1 convolution, eltwise, scale, softmax and layernorm use
+    // parallel_for, other loops(winograd and depthwise convolution, int8, ARM, ...) still run on
+    // OpenMP.
+    void set_thread_pool(bool enable);
+
+    // preallocate kv cache of maxLength tokens, model input pastNames[i] is fed by model output
+    // presentNames[i] of the previous step. model must be prepared with past shorter than present.
+    // Concat appends in place when all dimensions outside of sequence axis are 1, or when present
+    // is only read as key/value by ScaledDotProductAttention, present then keeps maxLength tokens
+    // in every slice outside of sequence axis.
+    EE init_kv_cache(
+        std::vector<std::string> pastNames, std::vector<std::string> presentNames, U32 maxLength);
+
+    // run one decoding step, only token inputs are given, past inputs are taken from kv cache.
+    EE run_step(std::map<std::string, TensorDesc> inputDescMap,
+        std::map<std::string, std::shared_ptr<U8>> modelTensorsInput);
+
+    void reset_kv_cache();
+
+    U32 get_kv_cache_length();
+
 private:
     std::shared_ptr<Tensor> allocate_tensor(U32 size = 0);
 #ifdef _USE_GPU
@@ -91,12 +160,18 @@ private:
 
     void set_input_desc(std::map<std::string, TensorDesc> inputDescMap);
 
+    void replan(std::map<std::string, TensorDesc> inputDescMap);
+
+    void restore_plan(std::map<std::string, TensorDesc> inputDescMap);
+
     void infer_tmp_memory_size() override;
 
     void assign_tmp_tensor() override;
 
     Tensor *get_reuse_memory(U32 slot, Tensor *tensor);
 
+    void assign_arena_memory(std::string name, Tensor *tensor);
+
     void check_memory_reuse_ratio();
 
     EE infer_output_tensors_size(std::map<std::string, TensorDesc> inputDescMap) override;
@@ -107,6 +182,55 @@ private:
 
     void check_dynamic_output_size(std::string name, TensorDesc desc);
 
+    // model has Repeat or Jump operators, operators do not run in their order once.
+    bool has_control_flow();
+
+    bool build_dependency_graph(std::vector<std::vector<U32>> *successors);
+
+    bool prepare_graph_executor();
+
+    void transform_filter();
+
+    void transform_weight_operators(std::vector<WeightOperator *> &weightOps);
+
+    bool use_lazy_weight();
+
+    void transform_filter_lazy();
+
+    // wait for the weights of operator opIndex and grow tmp to what the transformed op needs.
+    void wait_weight(U32 opIndex, Tensor &tmp);
+
+    void finish_lazy_weight();
+
+    void plan_kv_cache(U32 tokens);
+
+    std::vector<std::string> search_strided_kv_cache(const std::vector<std::string> &pastNames,
+        const std::vector<std::string> &presentNames,
+        std::map<std::string, std::string> &concats,
+        std::set<std::string> *strided);
+
+    void bind_kv_cache();
+
+    bool infer_step_size();
+
+    void bind_numa_memory() override;
+
+    void bind_numa_buffers();
+
+    void replicate_weights(int node);
+
+    void tune_operator_threads();
+
+    // run operator opIndex with tmp buffer tmp on at most threadNum threads of pool, sequential
+    // and concurrent runs both use it.
+    void run_operator(U32 opIndex, Tensor &tmp, int threadNum, ThreadPool *pool);
+
+    // cpus that threads of the model run on, the NUMA node cpus when the model is bound to one.
+    std::vector<int> get_model_cpus();
+
+    // pool of concurrent worker index, a team of threadNum threads.
+    ThreadPool *get_thread_pool(U32 index, int threadNum);
+
 private:
     std::map<std::string, std::shared_ptr<Tensor>> tensorMap;
     std::map<std::string, std::shared_ptr<Operator>> operatorMap;
@@ -116,6 +240,8 @@ private:
     std::map<std::string, std::shared_ptr<Tensor>> inputTensors;
     std::map<std::string, std::shared_ptr<Tensor>> outputTensors;
     std::vector<std::shared_ptr<Tensor>> storageMemory;
+    // tensors of reuse slots on CPU, placed by MemoryTracker::planArena
+    std::shared_ptr<Tensor> arenaMemory;
     Tensor tmpTensor;
     std::map<I32, std::vector<std::shared_ptr<Tensor>>> storageImage;
 
@@ -127,5 +253,53 @@ private:
 #endif
     std::set<std::string> inOutOps;
     bool dynamicOutputSize = false;
+
+    U32 interOpThreadNum = 1;
+    std::shared_ptr<GraphExecutor> graphExecutor;
+    bool graphNeedBuild = true;
+    bool graphParallel = false;
+
+    std::string weightCachePath;
+    bool weightShare = false;
+    bool algorithmTuning = false;
+
+    // weights transformed by a background thread, done[i] is set when weights of ops[i] are
+    // transformed, runs wait for the flag of each weight operator before running it.
+    struct LazyWeights {
+        std::thread thread;
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::vector<bool> done;
+        ~LazyWeights()
+        {
+            if (this->thread.joinable()) {
+                this->thread.join();
+            }
+        }
+    };
+    bool lazyWeight = false;
+    std::shared_ptr<LazyWeights> lazyWeights;
+
+    bool threadPoolEnabled = false;
+    // one pool for every concurrent worker, created by the first run, clones create their own.
+    std::vector<std::shared_ptr<ThreadPool>> threadPools;
+    // OMP_NUM_THREADS when model is prepared, runs use no more threads than it.
+    int modelThreadNum = 0;
+
+    KVCache kvCache;
+    // the number of new tokens in a step that memory is planned for
+    U32 kvCacheTokens = 0;
+    std::vector<std::pair<std::string, std::string>> kvCacheAlias;
+
+    PlanCache planCache;
+
+    // transformed weights on each NUMA node, they are shared by a model and its clones.
+    struct NumaWeights {
+        std::mutex mutex;
+        std::map<int, std::map<std::string, std::vector<Tensor>>> replicas;
+    };
+    std::shared_ptr<NumaWeights> numaWeights;
+    // the NUMA node that weights of this model are on, -1 means they are not placed.
+    int weightNumaNode = -1;
 };
 #endif
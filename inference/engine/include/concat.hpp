@@ -21,6 +21,7 @@ public:
     Concat(ConcatParamSpec p)
     {
         this->p = p;
+        this->kvCapacity = 0;
     }
     ~Concat(){}
     OperatorType get_type() override
@@ -28,8 +29,16 @@ public:
         return OT_Concat;
     }
 
+    // output is a kv cache of capacity tokens on the concat axis, and the first input is its
+    // head, so only the other input is appended(0 means a plain concat).
+    void set_kv_capacity(U32 capacity)
+    {
+        this->kvCapacity = capacity;
+    }
+
 protected:
     ConcatParamSpec p;
+    U32 kvCapacity;
 };
 
 #endif  // _CONCAT_H
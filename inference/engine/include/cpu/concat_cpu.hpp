@@ -30,6 +30,10 @@ public:
 
     void run() override
     {
+        if (this->kvCapacity > 0) {
+            this->append();
+            return;
+        }
         CHECK_STATUS(
             concat(this->inputTensors, this->p, this->temp, outputTensors[0], &this->archInfo));
     }
@@ -47,6 +51,33 @@ public:
             this->inputTensors, this->outputTensors[0], &bytes, &this->archInfo));
         return bytes;
     }
+
+private:
+    // past tokens are already in place, every slice outside of the axis gets its new tokens
+    // after them, slices are kvCapacity tokens apart.
+    void append()
+    {
+        TensorDesc pastDesc = this->inputTensors[0].get_desc();
+        TensorDesc newDesc = this->inputTensors[1].get_desc();
+        int axis = (this->p.axis + (int)newDesc.nDims) % newDesc.nDims;
+        axis = newDesc.nDims - 1 - axis;
+        U32 inner = bytesOf(newDesc.dt);
+        for (int i = 0; i < axis; i++) {
+            inner *= newDesc.dims[i];
+        }
+        U32 outer = 1;
+        for (U32 i = axis + 1; i < newDesc.nDims; i++) {
+            outer *= newDesc.dims[i];
+        }
+        U32 past = pastDesc.dims[axis] * inner;
+        U32 bytes = newDesc.dims[axis] * inner;
+        U32 stride = this->kvCapacity * inner;
+        U8 *src = (U8 *)((CpuMemory *)this->inputTensors[1].get_memory())->get_ptr();
+        U8 *dst = (U8 *)((CpuMemory *)this->outputTensors[0].get_memory())->get_ptr();
+        for (U32 i = 0; i < outer; i++) {
+            UNI_MEMCPY(dst + i * stride + past, src + i * bytes, bytes);
+        }
+    }
 };
 
 #endif  // _CONCAT_CPU_H
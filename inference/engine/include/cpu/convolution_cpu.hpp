@@ -72,6 +72,8 @@ public:
                     this->dt = dtNoQ;  // BNN convolution should not be quantized further
                     vectorLen *= 2;  // Scale has the same vector length as bias, so double the length
                 }
+                // alpha and beta of channel wise post op scales follow bias
+                vectorLen *= 1 + 2 * get_post_ops_channel_wise_num(this->p.post_ops);
                 desc = tensor1d(dtNoQ, vectorLen);
             }
             this->biasTensors[i].resize(desc);
@@ -205,7 +207,8 @@ public:
         outputTensor.resize(outputDesc);
         TensorDesc filterDesc = filterTensor.get_desc();
 
-        ConvolutionPolicy policy = CONVOLUTION_FASTEST;
+        ConvolutionPolicy policy =
+            this->algorithmTuning ? CONVOLUTION_TUNNING : CONVOLUTION_FASTEST;
         DataType targetType = filterDesc.dt;
         I32 algo;
         switch (this->p.convolution_type) {
@@ -216,10 +219,11 @@ public:
                 }
                 if (algorithmMap->getAlgorithmInfoFromMap(this->name, &algo, 1)) {
                     this->pwAlg = (ConvolutionForwardAlgorithm)algo;
-                } else if (algorithmMap->getCommonAlgoInfoFromMap(OT_Conv, this->dt,
-                               inputDesc.dims[2], inputDesc.dims[1], inputDesc.dims[0],
-                               filterDesc.dims[3], filterDesc.dims[1], filterDesc.dims[0],
-                               this->p.stride_h, this->p.stride_w, &algo, 1)) {
+                } else if (!this->algorithmTuning &&
+                    algorithmMap->getCommonAlgoInfoFromMap(OT_Conv, this->dt, inputDesc.dims[2],
+                        inputDesc.dims[1], inputDesc.dims[0], filterDesc.dims[3],
+                        filterDesc.dims[1], filterDesc.dims[0], this->p.stride_h,
+                        this->p.stride_w, &algo, 1)) {
                     this->pwAlg = (ConvolutionForwardAlgorithm)algo;
                 } else {
                     CHECK_STATUS(convolution_infer_forward_algorithm(inputTensor, filterTensor,
@@ -417,6 +421,15 @@ public:
                 UNI_ERROR_LOG("not support to infer new type convolution's tmp memory.\n");
                 break;
         }
+        U32 postNum = get_post_ops_input_num(this->p.post_ops);
+        if (postNum > 0) {
+            std::vector<Tensor> eltwiseTensors(
+                this->inputTensors.end() - postNum, this->inputTensors.end());
+            U32 postBytes = 0;
+            CHECK_STATUS(post_ops_infer_forward_tmp_bytes(
+                eltwiseTensors, outputTensor, &postBytes, &this->archInfo));
+            bytes += postBytes;
+        }
         inputTensor.resize(oriInputDesc);
         outputTensor.resize(oriOutputDesc);
         return bytes;
@@ -451,6 +464,12 @@ public:
         return bytes;
     }
 
+    bool is_weight_cacheable() override
+    {
+        // int8 transform also fills this->scales, which is not kept in weightTensors.
+        return !isQuantMixDataType(this->dt);
+    }
+
     EE transform_filter() override
     {
 #if 0  //defined(_USE_LITE) && !defined(_USE_NEON)
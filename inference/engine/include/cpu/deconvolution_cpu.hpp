@@ -177,6 +177,11 @@ public:
         return bytes;
     }
 
+    bool is_weight_cacheable() override
+    {
+        return !isQuantMixDataType(this->dt);
+    }
+
     EE transform_filter() override
     {
         Tensor filterTensor = this->weightTensors[0];
@@ -92,6 +92,7 @@
 #include "cpu/bilateral_slice_apply_cpu.hpp"
 #include "cpu/lut_preprocess_cpu.hpp"
 #include "cpu/lut_cpu.hpp"
+#include "cpu/scaled_dot_product_attention_cpu.hpp"
 
 class FactoryCPU : public Factory {
 public:
@@ -574,6 +575,13 @@ public:
         auto cep = new LutCPU(dt, p);
         return std::shared_ptr<Operator>(cep);
     }
+
+    std::shared_ptr<Operator> createScaledDotProductAttention(
+        DataType dt, ScaledDotProductAttentionParamSpec p) override
+    {
+        auto cep = new ScaledDotProductAttentionCPU(dt, p);
+        return std::shared_ptr<Operator>(cep);
+    }
 #endif
 };
 #endif  // _FACTORY_CPU_H
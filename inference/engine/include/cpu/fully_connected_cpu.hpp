@@ -16,6 +16,7 @@
 
 #include "fully_connected.hpp"
 #include "blas_enhance.h"
+#include "thread_affinity.h"
 
 class FullyConnectedCPU : public FullyConnected {
 public:
@@ -73,7 +74,7 @@ public:
             if (weightTensors.size() == 0) {
                 inputCount++;
             }
-            if (inputCount < this->inputTensors.size()) {
+            if (inputCount + get_post_ops_input_num(this->p.post_ops) < this->inputTensors.size()) {
                 return this->inputTensors[inputCount++];
             }
             Tensor biasTensor;
@@ -81,6 +82,13 @@ public:
         }
     }
 
+    // eltwise inputs of post ops are the last inputs
+    std::vector<Tensor> get_post_ops_tensors()
+    {
+        U32 num = get_post_ops_input_num(this->p.post_ops);
+        return std::vector<Tensor>(this->inputTensors.end() - num, this->inputTensors.end());
+    }
+
     void run() override
     {
         Tensor weightTensor = get_weight_tensor();
@@ -104,6 +112,8 @@ public:
         std::vector<Tensor> tmpTensor(1, this->temp);
         CHECK_STATUS(fully_connected(this->inputTensors[0], weightTensor, biasTensor, tmpTensor,
             outputTensor, &this->archInfo));
+        CHECK_STATUS(post_ops(
+            this->p.post_ops, get_post_ops_tensors(), this->temp, outputTensor, &this->archInfo));
     }
 
     EE infer_output_tensors_size(
@@ -111,8 +121,12 @@ public:
     {
         TensorDesc inputDesc = inTensors[0]->get_desc();
         if (this->ws.bytes_of_weight > 0) {
-            this->numInput =
-                this->ws.bytes_of_weight / this->p.num_outputs / UNI_MAX(1, bytesOf(this->ws.mdt));
+            if (this->ws.mdt == DT_I4) {
+                this->numInput = this->ws.bytes_of_weight * 2 / this->p.num_outputs;
+            } else {
+                this->numInput = this->ws.bytes_of_weight / this->p.num_outputs /
+                    UNI_MAX(1, bytesOf(this->ws.mdt));
+            }
         } else {
             this->numInput = inputDesc.dims[0];
         }
@@ -164,9 +178,32 @@ public:
         Tensor tmpFilter = get_weight_tensor();
         CHECK_STATUS(fully_connected_infer_forward_tmp_bytes(
             this->inputTensors[0], tmpFilter, this->outputTensors[0], &bytes, &this->archInfo));
+        if (this->p.post_ops.num > 0) {
+            U32 postBytes = 0;
+            CHECK_STATUS(post_ops_infer_forward_tmp_bytes(
+                get_post_ops_tensors(), this->outputTensors[0], &postBytes, &this->archInfo));
+            bytes = UNI_MAX(bytes, postBytes);
+        }
         return bytes;
     }
 
+    bool is_weight_cacheable() override
+    {
+        return !isQuantMixDataType(this->dt) && !this->dynamicQuantization;
+    }
+
+    void set_dynamic_quantization(bool enable) override
+    {
+        this->dynamicQuantization = enable;
+    }
+
+    bool use_dynamic_quantization(const TensorDesc &inputDesc)
+    {
+        return this->dynamicQuantization && has_x86_int8_vnni(this->archInfo.arch) &&
+            !isQuantMixDataType(this->dt) && inputDesc.dt == DT_F32 &&
+            this->weightTensors[0].get_desc().dt == DT_F32 && !use_nchwc8(inputDesc);
+    }
+
     EE transform_filter() override
     {
         EE ret = SUCCESS;
@@ -189,10 +226,107 @@ public:
         return ret;
     }
 
+    // scales of int4 weight are shared by groups of weights in row major order.
+    U32 int4_group_size(const TensorDesc &desc)
+    {
+        CHECK_REQUIREMENT(this->ws.num_quant_scale > 0 && this->ws.weight_scale[0].num_scale > 0);
+        return tensorNumElements(desc) / this->ws.weight_scale[0].num_scale;
+    }
+
+    // int4 weight is packed for fp32 mmm/mvm, false means the groups are not supported.
+    bool transform_int4_filter(Tensor wTensor)
+    {
+        TensorDesc desc = wTensor.get_desc();
+        U32 bytes = 0;
+        EE ret = matrix_matrix_multiply_transform_rhs_bytes(
+            desc, &bytes, nullptr, this->archInfo.arch);
+        if (ret != SUCCESS) {
+            return false;
+        }
+        Tensor wtm = Tensor::alloc_sized<CPUMem>(tensor1d(DT_U8, bytes));
+        TensorDesc tDesc;
+        if (matrix_matrix_multiply_transform_rhs_int4(desc,
+                ((CpuMemory *)(wTensor.get_memory()))->get_ptr(), this->ws.weight_scale[0].scale,
+                int4_group_size(desc), &tDesc, ((CpuMemory *)(wtm.get_memory()))->get_ptr(),
+                this->archInfo.arch) != SUCCESS) {
+            return false;
+        }
+        wtm.resize(tDesc);
+        this->weightTensors[0] = wtm;
+        return true;
+    }
+
+    Tensor dequantize_int4_filter(Tensor wTensor)
+    {
+        TensorDesc desc = wTensor.get_desc();
+        U32 group = int4_group_size(desc);
+        const U8 *q = (const U8 *)((CpuMemory *)(wTensor.get_memory()))->get_ptr();
+        desc.dt = DT_F32;
+        Tensor fTensor = Tensor::alloc_sized<CPUMem>(desc);
+        F32 *f = (F32 *)((CpuMemory *)(fTensor.get_memory()))->get_ptr();
+        const F32 *scale = this->ws.weight_scale[0].scale;
+        for (U32 i = 0; i < tensorNumElements(desc); i++) {
+            f[i] = (((q[i / 2] >> ((i % 2) * 4)) & 0xF) - 7) / scale[i / group];
+        }
+        return fTensor;
+    }
+
+    // pruned fp32 weight is packed by its nonzero blocks, false means it is dense enough.
+    bool transform_sparse_filter(const TensorDesc &inputDesc, Tensor wTensor)
+    {
+        TensorDesc desc = wTensor.get_desc();
+        auto w = ((CpuMemory *)(wTensor.get_memory()))->get_ptr();
+        DataFormat df;
+        U32 bytes = 0;
+        if (matrix_matrix_multiply_transform_rhs_sparse_bytes(
+                desc, w, &df, &bytes, this->archInfo.arch) != SUCCESS) {
+            return false;
+        }
+        // 2:4 kernels only save memory traffic, they are slower than dense ones for many rows.
+        if (df == DF_NKN8_2_4 && tensorNumElements(inputDesc) / this->numInput > 64) {
+            return false;
+        }
+        Tensor wtm = Tensor::alloc_sized<CPUMem>(tensor1d(DT_U8, bytes));
+        TensorDesc tDesc;
+        CHECK_STATUS(matrix_matrix_multiply_transform_rhs_sparse(desc, w, df, &tDesc,
+            ((CpuMemory *)(wtm.get_memory()))->get_ptr(), this->archInfo.arch));
+        wtm.resize(tDesc);
+        this->weightTensors[0] = wtm;
+        return true;
+    }
+
     virtual EE transform_filter(const TensorDesc &inputDesc)
     {
         Tensor tTensor;
         Tensor wTensor = this->weightTensors[0];
+        if (use_dynamic_quantization(inputDesc)) {
+            U32 bytes = 0;
+            CHECK_STATUS(
+                fully_connected_dynamic_quantize_filter_bytes(wTensor, &bytes, &this->archInfo));
+            Tensor wtm = Tensor::alloc_sized<CPUMem>(tensor1d(DT_U8, bytes));
+            CHECK_STATUS(fully_connected_dynamic_quantize_filter(wTensor, &wtm, &this->archInfo));
+            this->weightTensors[0] = wtm;
+            return SUCCESS;
+        }
+        if (wTensor.get_desc().dt == DT_I4) {
+            if (!use_nchwc8(inputDesc) && transform_int4_filter(wTensor)) {
+                return SUCCESS;
+            }
+            wTensor = dequantize_int4_filter(wTensor);
+        }
+        if (!use_nchwc8(inputDesc) && !isQuantMixDataType(this->dt) &&
+            wTensor.get_desc().dt == DT_F32 && transform_sparse_filter(inputDesc, wTensor)) {
+            return SUCCESS;
+        }
+        if (use_nchwc8(inputDesc) && wTensor.get_desc().dt == DT_BF16) {
+            // bf16 weight is only supported by mmm/mvm, widen it for nchwc8 input.
+            TensorDesc desc = wTensor.get_desc();
+            desc.dt = DT_F32;
+            Tensor fTensor = Tensor::alloc_sized<CPUMem>(desc);
+            transformToFloat(DT_BF16, ((CpuMemory *)(wTensor.get_memory()))->get_ptr(),
+                (F32 *)((CpuMemory *)(fTensor.get_memory()))->get_ptr(), tensorNumElements(desc));
+            wTensor = fTensor;
+        }
         if (use_nchwc8(inputDesc)) {
             Tensor input;
             input.resize(inputDesc);
@@ -248,6 +382,7 @@ public:
     }
 
     bool mvm;
+    bool dynamicQuantization = false;
 };
 
 #endif  // _FULLY_CONNECTED_CPU_H
@@ -15,6 +15,7 @@
 #define _MATMUL_CPU_H
 
 #include "matmul.hpp"
+#include "thread_affinity.h"
 
 class MatMulCPU : public MatMul {
 public:
@@ -34,7 +35,7 @@ public:
         Tensor inputTensorA = this->inputTensors[0];
         Tensor inputTensorB = this->inputTensors[1];
         Tensor inputTensorC;
-        if (this->inputTensors.size() > 2) {
+        if (this->inputTensors.size() > 2 + get_post_ops_input_num(this->p.post_ops)) {
             inputTensorC = this->inputTensors[2];
         }
         Tensor outputTensor = this->outputTensors[0];
@@ -54,10 +55,22 @@ public:
         if (featureScale.size() > 0) {
             outputTensor.set_scale((featureScale.back())[0]);
         }
+        if (use_dynamic_quantization()) {
+            outputTensor.set_scale(-1);
+        }
 #endif
         std::vector<Tensor> tmpTensor(1, this->temp);
         CHECK_STATUS(matmul(inputTensors[0], this->p.transpose_a, inputTensors[1],
             this->p.transpose_b, inputTensorC, tmpTensor, outputTensors[0], &this->archInfo));
+        CHECK_STATUS(post_ops(this->p.post_ops, get_post_ops_tensors(), this->temp,
+            outputTensors[0], &this->archInfo));
+    }
+
+    // eltwise inputs of post ops are the last inputs
+    std::vector<Tensor> get_post_ops_tensors()
+    {
+        U32 num = get_post_ops_input_num(this->p.post_ops);
+        return std::vector<Tensor>(this->inputTensors.end() - num, this->inputTensors.end());
     }
 
     EE infer_output_tensors_size(
@@ -77,13 +90,44 @@ public:
         return ret;
     }
 
+    void set_dynamic_quantization(bool enable) override
+    {
+        this->dynamicQuantization = enable;
+    }
+
+    // both inputs are quantized per tensor at run time, the int8 path of matmul has no bias.
+    bool use_dynamic_quantization()
+    {
+        return this->dynamicQuantization && has_x86_int8_vnni(this->archInfo.arch) &&
+            !isQuantMixDataType(this->dt) && featureScale.size() == 0 &&
+            this->inputTensors.size() == 2 + get_post_ops_input_num(this->p.post_ops) &&
+            this->inputTensors[0].get_desc().dt == DT_F32 &&
+            this->inputTensors[1].get_desc().dt == DT_F32 &&
+            this->outputTensors[0].get_desc().dt == DT_F32;
+    }
+
     U32 infer_tmp_memory_size() override
     {
         U32 bytes = 0;
+#ifdef _USE_INT8
+        if (use_dynamic_quantization()) {
+            // negative output scale makes matmul quantize inputs at run time
+            this->outputTensors[0].set_scale(-1);
+        }
+#endif
         CHECK_STATUS(matmul_infer_forward_tmp_bytes(inputTensors[0], this->p.transpose_a,
             inputTensors[1], this->p.transpose_b, outputTensors[0], &bytes, &this->archInfo));
+        if (this->p.post_ops.num > 0) {
+            U32 postBytes = 0;
+            CHECK_STATUS(post_ops_infer_forward_tmp_bytes(
+                get_post_ops_tensors(), outputTensors[0], &postBytes, &this->archInfo));
+            bytes = UNI_MAX(bytes, postBytes);
+        }
         return bytes;
     }
+
+private:
+    bool dynamicQuantization = false;
 };
 
 #endif  // _MATMUL_CPU_H
@@ -237,6 +237,9 @@ public:
     virtual std::shared_ptr<Operator> createLutPreprocess(DataType dt) = 0;
 
     virtual std::shared_ptr<Operator> createLut(DataType dt, LutParamSpec p) = 0;
+
+    virtual std::shared_ptr<Operator> createScaledDotProductAttention(
+        DataType dt, ScaledDotProductAttentionParamSpec p) = 0;
 #endif
 
     std::shared_ptr<Operator> createOperators(OperatorSpec op,
@@ -621,6 +624,10 @@ public:
                 ret = createLut(dt, ps.lut_spec);
                 break;
             }
+            case OT_ScaledDotProductAttention: {
+                ret = createScaledDotProductAttention(dtNoQ, ps.sdpa_spec);
+                break;
+            }
 #endif
             default: {
                 UNI_ERROR_LOG(
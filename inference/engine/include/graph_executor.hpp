@@ -0,0 +1,255 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef _GRAPH_EXECUTOR_H
+#define _GRAPH_EXECUTOR_H
+
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include "operator.hpp"
+#include "work_stealing_queue.h"
+#include "profiling.h"
+#include "op_profiler.h"
+#include "thread_affinity.h"
+
+// Run operators of a static dependency graph concurrently. The caller thread is worker 0,
+// the other workers are persistent threads which sleep between two runs. Every worker has
+// its own tmp buffer, because operators of different branches may run at the same time.
+// Workers are bound to cpus when they are given, the model binds their OpenMP teams.
+// Idle workers spin for a while and then sleep until an operator is queued or the run ends.
+class GraphExecutor {
+public:
+    explicit GraphExecutor(U32 threadNum, std::vector<int> cpus = std::vector<int>())
+    {
+        this->cpus = cpus;
+        this->threadNum = UNI_MAX(threadNum, 1);
+        this->queues = std::unique_ptr<WorkStealingQueue<U32>[]>(
+            new WorkStealingQueue<U32>[this->threadNum]);
+        this->tmpTensors.resize(this->threadNum);
+        this->generation = 0;
+        this->stop = false;
+        this->remaining = 0;
+        this->busy = 0;
+        this->queued = 0;
+        this->sleepers = 0;
+        for (U32 i = 1; i < this->threadNum; i++) {
+            this->threads.push_back(std::thread(&GraphExecutor::worker, this, i));
+        }
+    }
+
+    ~GraphExecutor()
+    {
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->stop = true;
+        }
+        this->condition.notify_all();
+        for (auto &thread : this->threads) {
+            thread.join();
+        }
+    }
+
+    U32 get_num_threads()
+    {
+        return this->threadNum;
+    }
+
+    std::vector<int> get_cpus()
+    {
+        return this->cpus;
+    }
+
+    // successors[i] are the operators that can only start after operator i has finished.
+    void build(U32 opNum, std::vector<std::vector<U32>> &successors)
+    {
+        this->opNum = opNum;
+        this->successors = successors;
+        this->predecessorNum = std::vector<U32>(opNum, 0);
+        for (U32 i = 0; i < successors.size(); i++) {
+            for (U32 j : successors[i]) {
+                this->predecessorNum[j]++;
+            }
+        }
+        this->roots.clear();
+        for (U32 i = 0; i < this->predecessorNum.size(); i++) {
+            if (this->predecessorNum[i] == 0) {
+                this->roots.push_back(i);
+            }
+        }
+        this->pending = std::unique_ptr<std::atomic<U32>[]>(new std::atomic<U32>[opNum]);
+    }
+
+    // worker 0 shares the model tmp buffer, other workers keep a private one of the same size.
+    void set_tmp_memory(Tensor tmpTensor)
+    {
+        U32 bytes = tmpTensor.bytes();
+        this->tmpTensors[0] = tmpTensor;
+        for (U32 i = 1; i < this->threadNum; i++) {
+            this->tmpTensors[i].resize(tensor1d(DT_U8, bytes));
+            this->tmpTensors[i].alloc();
+        }
+    }
+
+    // runOperator(i, worker, tmp) runs operator i on a worker with the tmp buffer of the worker.
+    void run(std::function<void(U32, U32, Tensor &)> runOperator)
+    {
+        if (this->opNum == 0) {
+            return;
+        }
+        this->runOperator = runOperator;
+        for (U32 i = 0; i < this->opNum; i++) {
+            this->pending[i].store(this->predecessorNum[i], std::memory_order_relaxed);
+        }
+        this->remaining.store(this->opNum, std::memory_order_relaxed);
+        this->queued.store(this->roots.size(), std::memory_order_relaxed);
+        for (U32 i = 0; i < this->roots.size(); i++) {
+            this->queues[i % this->threadNum].push(this->roots[i]);
+        }
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->busy.store(this->threadNum - 1, std::memory_order_relaxed);
+            this->generation++;
+        }
+        this->condition.notify_all();
+        this->execute(0);
+        for (U32 spin = 0; this->busy.load(std::memory_order_acquire) != 0; spin++) {
+            if (spin < SPIN_COUNT) {
+                std::this_thread::yield();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(this->workMutex);
+            this->workCondition.wait(lock, [&] { return this->busy.load() == 0; });
+        }
+    }
+
+private:
+    void worker(U32 workerId)
+    {
+        if (this->cpus.size() > 0) {
+            set_thread_affinity(workerId, this->cpus.data(), this->cpus.size());
+        }
+        U64 seen = 0;
+        while (1) {
+            {
+                std::unique_lock<std::mutex> lock(this->mutex);
+                this->condition.wait(
+                    lock, [&] { return this->stop || this->generation != seen; });
+                if (this->stop) {
+                    break;
+                }
+                seen = this->generation;
+            }
+            this->execute(workerId);
+            if (this->busy.fetch_sub(1, std::memory_order_release) == 1) {
+                this->notify(true);
+            }
+        }
+    }
+
+    // wake sleeping workers, one for a queued operator, all of them when the run ends.
+    void notify(bool all)
+    {
+        if (this->sleepers.load() == 0 && !all) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(this->workMutex);
+        if (all) {
+            this->workCondition.notify_all();
+        } else {
+            this->workCondition.notify_one();
+        }
+    }
+
+    // sleepers is counted before the queue is checked again, so either the waiting worker sees
+    // the operator or the pushing worker sees the sleeper and wakes it.
+    void wait_for_work()
+    {
+        std::unique_lock<std::mutex> lock(this->workMutex);
+        this->sleepers++;
+        this->workCondition.wait(
+            lock, [&] { return this->remaining.load() == 0 || this->queued.load() > 0; });
+        this->sleepers--;
+    }
+
+    bool steal(U32 workerId, U32 *opIndex)
+    {
+        for (U32 i = 1; i < this->threadNum; i++) {
+            if (this->queues[(workerId + i) % this->threadNum].steal(opIndex)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void execute(U32 workerId)
+    {
+        U32 spin = 0;
+        while (this->remaining.load(std::memory_order_acquire) > 0) {
+            U32 opIndex;
+            if (!this->queues[workerId].pop(&opIndex) && !this->steal(workerId, &opIndex)) {
+                if (spin++ < SPIN_COUNT) {
+                    std::this_thread::yield();
+                } else {
+                    this->wait_for_work();
+                    spin = 0;
+                }
+                continue;
+            }
+            spin = 0;
+            this->queued.fetch_sub(1);
+            this->runOperator(opIndex, workerId, this->tmpTensors[workerId]);
+            for (U32 next : this->successors[opIndex]) {
+                if (this->pending[next].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    this->queued.fetch_add(1);
+                    this->queues[workerId].push(next);
+                    this->notify(false);
+                }
+            }
+            if (this->remaining.fetch_sub(1, std::memory_order_release) == 1) {
+                this->notify(true);
+            }
+        }
+    }
+
+    U32 threadNum;
+    std::vector<int> cpus;
+    std::vector<std::thread> threads;
+    std::unique_ptr<WorkStealingQueue<U32>[]> queues;
+    std::vector<Tensor> tmpTensors;
+
+    U32 opNum = 0;
+    std::function<void(U32, U32, Tensor &)> runOperator;
+    std::vector<std::vector<U32>> successors;
+    std::vector<U32> predecessorNum;
+    std::vector<U32> roots;
+    std::unique_ptr<std::atomic<U32>[]> pending;
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    U64 generation;
+    bool stop;
+    std::atomic<U32> remaining;
+    std::atomic<U32> busy;
+
+    static const U32 SPIN_COUNT = 2048;
+    // idle workers and the caller waiting for workers sleep on it.
+    std::mutex workMutex;
+    std::condition_variable workCondition;
+    // operators that are in queues and not taken yet.
+    std::atomic<U32> queued;
+    std::atomic<U32> sleepers;
+};
+#endif  // _GRAPH_EXECUTOR_H
@@ -0,0 +1,197 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef _KV_CACHE_H
+#define _KV_CACHE_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include "tensor.hpp"
+
+// Engine owned key/value cache of an autoregressive model.
+//
+// Every entry binds a model input(past) to the model output(present) that the next step feeds
+// back, present = Concat(past, new) along the sequence axis. Buffers hold maxLength tokens, so
+// the tensors are only rebound between steps, never reallocated or copied by the caller.
+// When the sequence axis is the outermost non-1 dimension, past is the head of present and the
+// Concat only appends the new tokens in place. A strided entry appends in place too, but every
+// slice outside of the sequence axis keeps maxLength tokens, so only readers that take that
+// stride(ScaledDotProductAttention) may read it. Otherwise two buffers are used in turn.
+class KVCache {
+public:
+    KVCache()
+    {
+        this->maxLength = 0;
+        this->length = 0;
+    }
+
+    bool empty()
+    {
+        return this->entries.empty();
+    }
+
+    void clear()
+    {
+        this->entries.clear();
+        this->maxLength = 0;
+        this->length = 0;
+    }
+
+    // find the sequence axis from the descs that model was prepared with.
+    static int search_axis(TensorDesc pastDesc, TensorDesc presentDesc)
+    {
+        int axis = -1;
+        if (pastDesc.nDims != presentDesc.nDims || pastDesc.dt != presentDesc.dt) {
+            return axis;
+        }
+        for (U32 i = 0; i < pastDesc.nDims; i++) {
+            if (pastDesc.dims[i] == presentDesc.dims[i]) {
+                continue;
+            }
+            if (axis >= 0 || pastDesc.dims[i] > presentDesc.dims[i]) {
+                return -1;
+            }
+            axis = i;
+        }
+        return axis;
+    }
+
+    EE add(std::string past,
+        std::string present,
+        TensorDesc presentDesc,
+        int axis,
+        bool inPlace,
+        bool strided = false)
+    {
+        if (axis < 0 || axis >= (int)presentDesc.nDims || this->maxLength == 0) {
+            return NOT_MATCH;
+        }
+        Entry entry;
+        entry.past = past;
+        entry.present = present;
+        entry.axis = axis;
+        entry.inPlace = inPlace || strided;
+        entry.strided = strided;
+        entry.cur = 0;
+        TensorDesc desc = presentDesc;
+        desc.dims[axis] = this->maxLength;
+        U32 num = entry.inPlace ? 1 : 2;
+        for (U32 i = 0; i < num; i++) {
+            entry.buffers[i] = Tensor::alloc_sized<CPUMem>(tensor1d(DT_U8, tensorNumBytes(desc)));
+        }
+        this->entries.push_back(entry);
+        return SUCCESS;
+    }
+
+    void set_max_length(U32 maxLength)
+    {
+        this->maxLength = maxLength;
+    }
+
+    U32 get_max_length()
+    {
+        return this->maxLength;
+    }
+
+    U32 get_length()
+    {
+        return this->length;
+    }
+
+    void reset()
+    {
+        this->length = 0;
+        for (auto &entry : this->entries) {
+            entry.cur = 0;
+        }
+    }
+
+    // past descs with the cached length, or with a given length.
+    std::map<std::string, TensorDesc> get_past_desc(
+        std::map<std::string, std::shared_ptr<Tensor>> &tensors, int length = -1)
+    {
+        std::map<std::string, TensorDesc> descs;
+        for (auto &entry : this->entries) {
+            TensorDesc desc = tensors[entry.past]->get_desc();
+            desc.dims[entry.axis] = (length < 0) ? this->length : length;
+            descs[entry.past] = desc;
+        }
+        return descs;
+    }
+
+    // the number of tokens after this step, return 0 if entries disagree.
+    U32 get_present_length(std::map<std::string, std::shared_ptr<Tensor>> &tensors)
+    {
+        U32 ret = 0;
+        for (U32 i = 0; i < this->entries.size(); i++) {
+            auto &entry = this->entries[i];
+            U32 len = tensors[entry.present]->get_desc().dims[entry.axis];
+            if (i > 0 && len != ret) {
+                return 0;
+            }
+            ret = len;
+        }
+        return ret;
+    }
+
+    // point past and present tensors to cache buffers, only memory is changed.
+    void bind(std::map<std::string, std::shared_ptr<Tensor>> &tensors)
+    {
+        for (auto &entry : this->entries) {
+            U32 next = entry.inPlace ? entry.cur : 1 - entry.cur;
+            tensors[entry.past]->reuse(&entry.buffers[entry.cur]);
+            tensors[entry.present]->reuse(&entry.buffers[next]);
+        }
+    }
+
+    // present of this step becomes past of next step, tensors are bound again before next step.
+    void advance(U32 length)
+    {
+        this->length = length;
+        for (auto &entry : this->entries) {
+            if (!entry.inPlace) {
+                entry.cur = 1 - entry.cur;
+            }
+        }
+    }
+
+    std::string string()
+    {
+        std::string line = "kv cache(max length:" + std::to_string(this->maxLength) +
+            ", length:" + std::to_string(this->length) + ")";
+        for (auto &entry : this->entries) {
+            std::string mode = (entry.strided) ? ", strided in place)"
+                                               : ((entry.inPlace) ? ", in place)" : ", double)");
+            line += " " + entry.past + "->" + entry.present + "(axis:" +
+                std::to_string(entry.axis) + mode;
+        }
+        return line;
+    }
+
+private:
+    typedef struct {
+        std::string past;
+        std::string present;
+        int axis;
+        bool inPlace;
+        bool strided;
+        U32 cur;
+        Tensor buffers[2];
+    } Entry;
+
+    std::vector<Entry> entries;
+    U32 maxLength;
+    U32 length;
+};
+#endif  // _KV_CACHE_H
@@ -0,0 +1,114 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef _MEMORY_PLANNER_H
+#define _MEMORY_PLANNER_H
+
+#include <vector>
+#include <algorithm>
+#include <climits>
+#include "uni.h"
+
+// tensor that lives from operator begin to operator end(both included).
+typedef struct {
+    U32 bytes;
+    U32 begin;
+    U32 end;
+    // planned position and size in arena
+    U32 offset;
+    U32 size;
+} MemoryBlock;
+
+// Place tensors in one arena. Blocks are visited from the biggest one, every block takes the
+// smallest gap between blocks of overlapping lifetime that is large enough(best fit), or is
+// appended after them. Peak of live bytes over time is the lower bound of arena size.
+class MemoryPlanner {
+public:
+    explicit MemoryPlanner(U32 alignment = 64)
+    {
+        this->alignment = UNI_MAX(alignment, 1);
+    }
+
+    U32 align(U32 bytes)
+    {
+        U32 size = (bytes + this->alignment - 1) / this->alignment * this->alignment;
+        return UNI_MAX(size, this->alignment);
+    }
+
+    // set offset and size of blocks, return the arena size.
+    U32 plan(std::vector<MemoryBlock> &blocks)
+    {
+        std::vector<U32> order(blocks.size());
+        for (U32 i = 0; i < blocks.size(); i++) {
+            order[i] = i;
+            blocks[i].size = this->align(blocks[i].bytes);
+        }
+        std::stable_sort(order.begin(), order.end(), [&](U32 a, U32 b) {
+            if (blocks[a].size != blocks[b].size) {
+                return blocks[a].size > blocks[b].size;
+            }
+            return blocks[a].begin < blocks[b].begin;
+        });
+        // placed blocks in ascending order of offset
+        std::vector<U32> placed;
+        U32 peak = 0;
+        for (U32 id : order) {
+            MemoryBlock &block = blocks[id];
+            U32 best = UINT_MAX;
+            U32 bestGap = UINT_MAX;
+            U32 prevEnd = 0;
+            for (U32 p : placed) {
+                MemoryBlock &other = blocks[p];
+                if (other.end < block.begin || block.end < other.begin) {
+                    continue;
+                }
+                if (other.offset >= prevEnd) {
+                    U32 gap = other.offset - prevEnd;
+                    if (gap >= block.size && gap < bestGap) {
+                        bestGap = gap;
+                        best = prevEnd;
+                    }
+                }
+                prevEnd = UNI_MAX(prevEnd, other.offset + other.size);
+            }
+            block.offset = (best == UINT_MAX) ? prevEnd : best;
+            auto iter = std::upper_bound(placed.begin(), placed.end(), block.offset,
+                [&](U32 offset, U32 p) { return offset < blocks[p].offset; });
+            placed.insert(iter, id);
+            peak = UNI_MAX(peak, block.offset + block.size);
+        }
+        return peak;
+    }
+
+    // the maximum of bytes that are alive at the same time, no plan can be smaller.
+    U32 lower_bound(const std::vector<MemoryBlock> &blocks)
+    {
+        std::vector<std::pair<U32, I32>> events;
+        for (auto &block : blocks) {
+            I32 size = this->align(block.bytes);
+            events.push_back(std::make_pair(block.begin * 2, size));
+            events.push_back(std::make_pair(block.end * 2 + 1, -size));
+        }
+        std::sort(events.begin(), events.end());
+        I64 cur = 0, peak = 0;
+        for (auto &event : events) {
+            cur += event.second;
+            peak = UNI_MAX(peak, cur);
+        }
+        return peak;
+    }
+
+private:
+    U32 alignment;
+};
+#endif  // _MEMORY_PLANNER_H
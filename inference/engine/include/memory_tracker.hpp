@@ -15,6 +15,7 @@
 #define _MEMORY_TRACKER_H
 
 #include "tensor_desc.h"
+#include "memory_planner.hpp"
 #ifdef _USE_GPU
 #include "image_manager.hpp"
 #endif
@@ -26,10 +27,17 @@ public:
         this->storageSize.clear();
         this->tensorStoragePosition.clear();
         this->memoryNeedAssign = true;
+        this->arenaPlanned = false;
+        this->arenaSize = 0;
+        this->arenaLowerBound = 0;
+        this->opNum = 0;
     }
     ~MemoryTracker(){}
-    void trackOpTensorSizes(std::shared_ptr<Operator> op, std::vector<std::string> tensorNames)
+    // opIndex is the position of operator in run order, tensors of reuse slots record lifetimes.
+    void trackOpTensorSizes(
+        std::shared_ptr<Operator> op, std::vector<std::string> tensorNames, U32 opIndex)
     {
+        this->opNum = UNI_MAX(this->opNum, opIndex + 1);
         I32 *pos = op->get_tensor_positions().data();
         auto inputTensors = op->get_input_tensors();
         auto outputTensors = op->get_output_tensors();
@@ -43,6 +51,7 @@ public:
                 continue;
             }
             this->trackSlotSize(slot, inputTensors[i]);
+            this->trackBlock(tensorNames[i], opIndex, inputTensors[i]);
         }
         for (size_t i = 0; i < numOutput; i++) {
             I32 slot = pos[numInput + i];
@@ -52,9 +61,77 @@ public:
                 continue;
             }
             this->trackSlotSize(slot, outputTensors[i]);
+            this->trackBlock(tensorNames[numInput + i], opIndex, outputTensors[i]);
         }
     }
 
+    // model inputs are written before the first operator, outputs are read after the last one.
+    void trackModelTensors(
+        std::vector<std::string> inputNames, std::vector<std::string> outputNames)
+    {
+        for (auto &name : inputNames) {
+            if (this->tensorBlock.find(name) != this->tensorBlock.end()) {
+                this->tensorBlock[name].begin = 0;
+            }
+        }
+        for (auto &name : outputNames) {
+            if (this->tensorBlock.find(name) != this->tensorBlock.end()) {
+                this->tensorBlock[name].end = this->opNum;
+            }
+        }
+    }
+
+    // place tensors of reuse slots in one arena by their lifetimes instead of slots.
+    U32 planArena()
+    {
+        std::vector<std::string> names;
+        std::vector<MemoryBlock> blocks;
+        for (auto &iter : this->tensorBlock) {
+            names.push_back(iter.first);
+            blocks.push_back(iter.second);
+        }
+        MemoryPlanner planner;
+        this->arenaSize = planner.plan(blocks);
+        this->arenaLowerBound = planner.lower_bound(blocks);
+        for (U32 i = 0; i < names.size(); i++) {
+            this->tensorBlock[names[i]] = blocks[i];
+        }
+        this->arenaPlanned = true;
+        return this->arenaSize;
+    }
+
+    bool getArenaPlanned()
+    {
+        return this->arenaPlanned;
+    }
+
+    U32 getArenaSize()
+    {
+        return this->arenaSize;
+    }
+
+    U32 getArenaLowerBound()
+    {
+        return this->arenaLowerBound;
+    }
+
+    U32 getArenaNumTensors()
+    {
+        return this->tensorBlock.size();
+    }
+
+    // offset and size of tensor in arena, return false if tensor is not in arena.
+    bool getArenaRange(std::string name, U32 *offset, U32 *size)
+    {
+        auto iter = this->tensorBlock.find(name);
+        if (!this->arenaPlanned || iter == this->tensorBlock.end()) {
+            return false;
+        }
+        *offset = iter->second.offset;
+        *size = iter->second.size;
+        return true;
+    }
+
     I32 getSlotByTensorName(std::string name)
     {
         return tensorStoragePosition[name];
@@ -161,6 +238,32 @@ protected:
         }
         if (size > this->storageSize[slot]) {
             this->storageSize[slot] = size;
+            if (!this->arenaPlanned) {
+                this->memoryNeedAssign = true;
+            }
+        }
+    }
+
+    void trackBlock(std::string name, U32 opIndex, Tensor tensor)
+    {
+        Memory *mem = tensor.get_memory();
+        if (mem->get_mem_type() != CPUMem) {
+            return;
+        }
+        U32 size = mem->bytes();
+        auto iter = this->tensorBlock.find(name);
+        if (iter == this->tensorBlock.end()) {
+            MemoryBlock block = {size, opIndex, opIndex, 0, 0};
+            this->tensorBlock[name] = block;
+            this->memoryNeedAssign = true;
+            return;
+        }
+        // keep the biggest size, arena planned later still holds the shapes seen before.
+        MemoryBlock &block = iter->second;
+        block.bytes = UNI_MAX(block.bytes, size);
+        block.begin = UNI_MIN(block.begin, opIndex);
+        block.end = UNI_MAX(block.end, opIndex);
+        if (this->arenaPlanned && size > block.size) {
             this->memoryNeedAssign = true;
         }
     }
@@ -189,6 +292,12 @@ protected:
     std::vector<U32> storageSize;
     std::map<std::string, I32> tensorStoragePosition;
     bool memoryNeedAssign;
+
+    std::map<std::string, MemoryBlock> tensorBlock;
+    bool arenaPlanned;
+    U32 arenaSize;
+    U32 arenaLowerBound;
+    U32 opNum;
 #ifdef _USE_GPU
     ImageManager imageManager;
 #endif
@@ -52,6 +52,9 @@ public:
 
     void set_runtime_device_dynamic(int threadId = 0);
 
+    // run on the cpus of a NUMA node and move memory to it, -1 spreads models over nodes in turn.
+    void set_numa_node(int node = -1, int threadId = 0);
+
     Arch get_runtime_device();
 
     std::string get_name();
@@ -66,6 +69,8 @@ protected:
     virtual void assign_output_tensor() = 0;
     virtual void infer_tmp_memory_size() = 0;
     virtual void assign_tmp_tensor() = 0;
+    virtual void bind_numa_memory()
+    {}
 
 private:
     std::string name;
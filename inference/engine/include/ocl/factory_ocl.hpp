@@ -72,6 +72,11 @@ public:
         ActivationParamSpec dwActivationParamSpec,
         ActivationParamSpec pwActivationParamSpec) override
     {
+        if (p.post_ops.num > 0) {
+            UNI_ERROR_LOG("gpu convolution not support post ops, please convert model without "
+                          "X2bolt -f option.\n");
+            return nullptr;
+        }
         auto cep =
             (Convolution *)(new ConvolutionOCL(dt, p, dwActivationParamSpec, pwActivationParamSpec));
         return std::shared_ptr<Operator>(cep);
@@ -93,6 +98,11 @@ public:
     std::shared_ptr<Operator> createFullyConnected(
         DataType dt, FullyConnectedParamSpec p, U32 numInput) override
     {
+        if (p.post_ops.num > 0) {
+            UNI_ERROR_LOG("gpu fully connected not support post ops, please convert model without "
+                          "X2bolt -f option.\n");
+            return nullptr;
+        }
         auto cep = (FullyConnectedOCL *)(new FullyConnectedOCL(dt, p, numInput));
         return std::shared_ptr<Operator>(cep);
     }
@@ -159,6 +169,11 @@ public:
 
     std::shared_ptr<Operator> createMatMul(DataType dt, MatMulParamSpec p) override
     {
+        if (p.post_ops.num > 0) {
+            UNI_ERROR_LOG("gpu matmul not support post ops, please convert model without "
+                          "X2bolt -f option.\n");
+            return nullptr;
+        }
         auto cep = (MatMul *)(new MatMulOCL(dt, p));
         return std::shared_ptr<Operator>(cep);
     }
@@ -546,5 +561,12 @@ public:
         auto cep = new LutOCL(dt, p);
         return std::shared_ptr<Operator>(cep);
     }
+
+    std::shared_ptr<Operator> createScaledDotProductAttention(
+        DataType dt, ScaledDotProductAttentionParamSpec p) override
+    {
+        OP_UNSUP(2, dt, p);
+        return std::shared_ptr<Operator>(cep);
+    }
 };
 #endif  // _FACTORY_OCL_H
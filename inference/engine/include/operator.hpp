@@ -97,6 +97,19 @@ public:
         return this->outputTensors;
     }
 
+    // bytes of input and output tensors, used to estimate bandwidth in profiling.
+    U64 get_tensors_bytes()
+    {
+        U64 bytes = 0;
+        for (auto &tensor : this->inputTensors) {
+            bytes += tensor.bytes();
+        }
+        for (auto &tensor : this->outputTensors) {
+            bytes += tensor.bytes();
+        }
+        return bytes;
+    }
+
     void set_tensor_positions(std::vector<I32> &pos)
     {
         this->tensorPos = pos;
@@ -117,6 +130,31 @@ public:
         this->archInfo.arch = opSchedule;
     }
 
+    // quantize activations to int8 at run time without calibrated scales, it must be set before
+    // weight transform. Operators that don't support it keep running in float.
+    virtual void set_dynamic_quantization(bool enable)
+    {
+        UNUSED(enable);
+    }
+
+    // time candidate algorithms on the real shapes instead of choosing them by heuristics, it must
+    // be set before infer_forward_algorithm. Operators that have one algorithm ignore it.
+    void set_algorithm_tuning(bool enable)
+    {
+        this->algorithmTuning = enable;
+    }
+
+    // threads used to run this operator, 0 means the threads of the model.
+    void set_thread_num(U32 threadNum)
+    {
+        this->threadNum = threadNum;
+    }
+
+    U32 get_thread_num()
+    {
+        return this->threadNum;
+    }
+
     virtual int get_next_operator_index()
     {
         return -1;
@@ -299,6 +337,8 @@ protected:
     std::shared_ptr<AlgorithmMap> algorithmMap;
 
     std::vector<std::vector<F32>> featureScale;
+    bool algorithmTuning = false;
+    U32 threadNum = 0;
 #ifdef _USE_GPU
     ImageContainer *tempImages;
 #endif
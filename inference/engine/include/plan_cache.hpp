@@ -0,0 +1,199 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef _PLAN_CACHE_H
+#define _PLAN_CACHE_H
+
+#include <list>
+#include <map>
+#include <string>
+#include "tensor_desc.h"
+
+typedef enum {
+    PLAN_BUCKET_NONE,
+    // round the bucket dimension up to a power of 2
+    PLAN_BUCKET_POW2,
+    // round the bucket dimension up to a multiple of value
+    PLAN_BUCKET_MULTIPLE
+} PlanBucketMode;
+
+// Least recently used input shapes that a CNN has been reready with.
+//
+// A shape is recorded after tensor memory and tmp buffer have been sized for it. Arena blocks
+// keep the largest size they have been planned with, so memory of a recorded shape is never
+// shrunk by later ones. Switching back to a recorded shape still infers tensor descs, but skips
+// memory assignment and tmp buffer sizing, nothing else is stored. Inputs can be padded
+// to buckets(e.g. sequence length to a power of 2) to bound the number of distinct plans, the
+// caller must fill the padded input of get_input_desc.
+class PlanCache {
+public:
+    PlanCache()
+    {
+        this->capacity = 0;
+        this->mode = PLAN_BUCKET_NONE;
+        this->value = 0;
+        this->axis = 1;
+        this->hits = 0;
+        this->misses = 0;
+    }
+
+    PlanCache(const PlanCache &other)
+    {
+        *this = other;
+    }
+
+    // iterators of plans point to own order list.
+    PlanCache &operator=(const PlanCache &other)
+    {
+        if (this == &other) {
+            return *this;
+        }
+        this->capacity = other.capacity;
+        this->mode = other.mode;
+        this->value = other.value;
+        this->axis = other.axis;
+        this->hits = other.hits;
+        this->misses = other.misses;
+        this->order = other.order;
+        this->plans.clear();
+        for (auto iter = this->order.begin(); iter != this->order.end(); iter++) {
+            this->plans[*iter] = iter;
+        }
+        return *this;
+    }
+
+    bool enabled()
+    {
+        return this->capacity > 0;
+    }
+
+    void clear()
+    {
+        this->plans.clear();
+        this->order.clear();
+    }
+
+    void set_capacity(U32 capacity)
+    {
+        this->capacity = capacity;
+        this->shrink();
+    }
+
+    U32 get_capacity()
+    {
+        return this->capacity;
+    }
+
+    // axis is counted from the outermost dimension, like the axis of operators.
+    void set_bucket(PlanBucketMode mode, U32 value, int axis)
+    {
+        this->mode = mode;
+        this->value = value;
+        this->axis = axis;
+    }
+
+    std::map<std::string, TensorDesc> bucket(std::map<std::string, TensorDesc> descs)
+    {
+        if (this->mode == PLAN_BUCKET_NONE) {
+            return descs;
+        }
+        for (auto &iter : descs) {
+            TensorDesc &desc = iter.second;
+            int i = (this->axis < 0) ? -this->axis - 1 : (int)desc.nDims - 1 - this->axis;
+            if (i < 0 || i >= (int)desc.nDims || desc.dims[i] == 0) {
+                continue;
+            }
+            U32 dim = desc.dims[i];
+            if (this->mode == PLAN_BUCKET_POW2) {
+                U32 bucket = 1;
+                while (bucket < dim) {
+                    bucket <<= 1;
+                }
+                dim = bucket;
+            } else if (this->mode == PLAN_BUCKET_MULTIPLE && this->value > 1) {
+                dim = (dim + this->value - 1) / this->value * this->value;
+            }
+            desc.dims[i] = dim;
+        }
+        return descs;
+    }
+
+    static std::string key(const std::map<std::string, TensorDesc> &descs)
+    {
+        std::string ret;
+        for (auto &iter : descs) {
+            ret += iter.first + ":" + std::to_string(iter.second.dt) + "," +
+                std::to_string(iter.second.df);
+            for (U32 i = 0; i < iter.second.nDims; i++) {
+                ret += "," + std::to_string(iter.second.dims[i]);
+            }
+            ret += ";";
+        }
+        return ret;
+    }
+
+    // whether shape has been planned, the found shape becomes the most recent one.
+    bool find(const std::string &key)
+    {
+        auto iter = this->plans.find(key);
+        if (iter == this->plans.end()) {
+            this->misses++;
+            return false;
+        }
+        this->hits++;
+        this->order.splice(this->order.begin(), this->order, iter->second);
+        return true;
+    }
+
+    void insert(const std::string &key)
+    {
+        if (!this->enabled()) {
+            return;
+        }
+        auto iter = this->plans.find(key);
+        if (iter != this->plans.end()) {
+            this->order.splice(this->order.begin(), this->order, iter->second);
+            return;
+        }
+        this->order.push_front(key);
+        this->plans[key] = this->order.begin();
+        this->shrink();
+    }
+
+    std::string string()
+    {
+        return "plan cache(capacity:" + std::to_string(this->capacity) +
+            ", plans:" + std::to_string(this->plans.size()) + ", hits:" +
+            std::to_string(this->hits) + ", misses:" + std::to_string(this->misses) + ")";
+    }
+
+private:
+    void shrink()
+    {
+        while (this->order.size() > this->capacity) {
+            this->plans.erase(this->order.back());
+            this->order.pop_back();
+        }
+    }
+
+    U32 capacity;
+    PlanBucketMode mode;
+    U32 value;
+    int axis;
+    U64 hits;
+    U64 misses;
+    // most recent plan is at the front
+    std::list<std::string> order;
+    std::map<std::string, std::list<std::string>::iterator> plans;
+};
+#endif  // _PLAN_CACHE_H
@@ -0,0 +1,47 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef _SCALED_DOT_PRODUCT_ATTENTION_H
+#define _SCALED_DOT_PRODUCT_ATTENTION_H
+
+#include "operator.hpp"
+
+class ScaledDotProductAttention : public Operator {
+public:
+    ScaledDotProductAttention(DataType dt, ScaledDotProductAttentionParamSpec p)
+    {
+        this->dt = dt;
+        this->p = p;
+        this->kvCapacity = 0;
+    }
+
+    ~ScaledDotProductAttention()
+    {}
+
+    OperatorType get_type() override
+    {
+        return OT_ScaledDotProductAttention;
+    }
+
+    // K and V are kv caches of capacity tokens(0 means dense).
+    void set_kv_capacity(U32 capacity)
+    {
+        this->kvCapacity = capacity;
+    }
+
+protected:
+    ScaledDotProductAttentionParamSpec p;
+    U32 kvCapacity;
+};
+
+#endif  // _SCALED_DOT_PRODUCT_ATTENTION_H
@@ -0,0 +1,491 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#ifndef _WEIGHT_CACHE_H
+#define _WEIGHT_CACHE_H
+
+#include <stdio.h>
+#if defined(__GLIBC__) || defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#include "weight_operator.hpp"
+#include "file.h"
+#include "thread_affinity.h"
+
+// Keep the transformed(pre-packed) filters of weight operators in a file, so that the next
+// initialization of the same model on the same machine can map them instead of running
+// transform_filter again.
+//
+// file layout: header | index | 64 bytes aligned tensor data, the header keeps a checksum of the
+// index and the data that is verified before the file is used.
+// Every operator is identified by its name and a key, the key covers the things that
+// transform_filter depends on, mismatched operators are transformed and the file is rewritten.
+// The file can be placed in POSIX shared memory to share one copy between processes, it is
+// mapped read only, so no process can change the weights of others. Files are created with mode
+// 0600 and only files owned by the effective user that no one else can write are used, so that
+// another user of a shared directory can not plant weights.
+class WeightCache {
+public:
+    explicit WeightCache(std::string file)
+    {
+        this->file = file;
+        this->dirty = false;
+        this->lockFd = -1;
+    }
+
+    ~WeightCache()
+    {
+        this->unlock();
+    }
+
+    // the directory of shm_open objects, "" means shared memory is not supported.
+    static std::string share_directory()
+    {
+#if defined(__linux__) && !defined(__ANDROID__)
+        struct stat ss;
+        if (stat("/dev/shm", &ss) == 0 && S_ISDIR(ss.st_mode)) {
+            return "/dev/shm";
+        }
+#endif
+        return "";
+    }
+
+    std::string get_file()
+    {
+        return this->file;
+    }
+
+    // orders the processes that write the same file, weights are transformed without lock.
+    void lock()
+    {
+#if defined(__GLIBC__) || defined(__linux__)
+        if (this->lockFd != -1) {
+            return;
+        }
+        std::string lockFile = this->file + ".lock";
+        this->lockFd = open(lockFile.c_str(), O_RDWR | O_CREAT | O_NOFOLLOW | O_CLOEXEC, 0600);
+        if (this->lockFd != -1 && (!trusted(this->lockFd, lockFile) ||
+                                      flock(this->lockFd, LOCK_EX) != 0)) {
+            close(this->lockFd);
+            this->lockFd = -1;
+        }
+#endif
+    }
+
+    void unlock()
+    {
+#if defined(__GLIBC__) || defined(__linux__)
+        if (this->lockFd != -1) {
+            flock(this->lockFd, LOCK_UN);
+            close(this->lockFd);
+            this->lockFd = -1;
+        }
+#endif
+    }
+
+    bool is_dirty()
+    {
+        return this->dirty;
+    }
+
+    static U64 hash(U64 value, const void *data, U32 bytes)
+    {
+        const U8 *p = (const U8 *)data;
+        for (U32 i = 0; i < bytes; i++) {
+            value = (value ^ p[i]) * 1099511628211ull;
+        }
+        return value;
+    }
+
+    static U64 hash(U64 value, std::string str)
+    {
+        return hash(value, str.c_str(), str.size());
+    }
+
+    // every byte of the weights is hashed, so that a changed weight always gets another key.
+    // Words are mixed in 4 independent lanes, which runs at memory bandwidth instead of the
+    // byte serial hash.
+    static U64 hash_weight(U64 value, const U8 *data, U64 bytes)
+    {
+        value = hash(value, &bytes, sizeof(bytes));
+        if (data == nullptr || bytes == 0) {
+            return value;
+        }
+        const U64 prime = 0x9e3779b97f4a7c15ull;
+        U64 lanes[4] = {value, value ^ prime, value + prime, value - prime};
+        U64 i = 0;
+        for (; i + sizeof(lanes) <= bytes; i += sizeof(lanes)) {
+            for (U32 j = 0; j < 4; j++) {
+                U64 word;
+                UNI_MEMCPY(&word, data + i + j * sizeof(U64), sizeof(U64));
+                U64 lane = (lanes[j] ^ word) * prime;
+                lanes[j] = (lane << 31) | (lane >> 33);
+            }
+        }
+        value = hash(value, lanes, sizeof(lanes));
+        return hash(value, data + i, bytes - i);
+    }
+
+    static U64 operator_key(WeightOperator *op, Arch arch, DataType dt, std::string algorithm)
+    {
+        U64 key = 14695981039346656037ull;
+        key = hash(key, op->get_name());
+        OperatorType type = op->get_type();
+        key = hash(key, &type, sizeof(type));
+        key = hash(key, &arch, sizeof(arch));
+#ifdef _USE_X86
+        // packing format follows instruction set extensions of the cpu, not only arch, e.g.
+        // fp32 filters are packed for AVX-512 on every avx512f cpu.
+        U32 features = get_x86_features();
+        key = hash(key, &features, sizeof(features));
+#endif
+        key = hash(key, &dt, sizeof(dt));
+        key = hash(key, algorithm);
+        std::vector<Tensor> tensors[3] = {
+            op->get_weight_tensors(), op->get_input_tensors(), op->get_output_tensors()};
+        for (U32 i = 0; i < 3; i++) {
+            for (auto &tensor : tensors[i]) {
+                TensorDesc desc = tensor.get_desc();
+                key = hash(key, &desc, sizeof(TensorDesc));
+            }
+        }
+        WeightSpec ws = op->get_weightspec();
+        key = hash_weight(key, ws.weight, ws.bytes_of_weight);
+        key = hash_weight(key, ws.vec, ws.bytes_of_vec);
+        return key;
+    }
+
+    bool load()
+    {
+        this->entries.clear();
+        if (!file_exists(this->file.c_str())) {
+            UNI_DEBUG_LOG("weight cache %s is not exist.\n", this->file.c_str());
+            return false;
+        }
+        size_t length = 0;
+        U8 *content = nullptr;
+#if defined(__GLIBC__) || defined(__linux__)
+        int fd = open(this->file.c_str(), O_RDONLY | O_NOFOLLOW | O_CLOEXEC);
+        if (fd == -1) {
+            return false;
+        }
+        struct stat ss;
+        if (trusted(fd, this->file) && fstat(fd, &ss) == 0 && ss.st_size > 0) {
+            length = ss.st_size;
+            // pages are shared with page cache and other processes, they are only read ahead so
+            // that a cache on disk does not block initialization.
+            content = (U8 *)mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+            if (content == MAP_FAILED) {
+                content = nullptr;
+            } else {
+                madvise(content, length, MADV_WILLNEED);
+            }
+        }
+        close(fd);
+        if (content == nullptr) {
+            return false;
+        }
+        this->mapping = std::shared_ptr<U8>(content, [length](U8 *p) { munmap(p, length); });
+#else
+        if (load_binary(this->file.c_str(), (void **)&content, &length) != SUCCESS) {
+            return false;
+        }
+        this->mapping = std::shared_ptr<U8>(content, free);
+#endif
+        bool ret = this->parse(length);
+        if (!ret) {
+            UNI_WARNING_LOG("weight cache %s is broken, it will be rebuilt.\n", this->file.c_str());
+            this->entries.clear();
+            this->mapping = nullptr;
+        }
+        return ret;
+    }
+
+    bool find(std::string name, U64 key, std::vector<Tensor> *tensors)
+    {
+        if (this->entries.find(name) == this->entries.end() || this->entries[name].key != key) {
+            this->dirty = true;
+            return false;
+        }
+        *tensors = this->entries[name].tensors;
+        return true;
+    }
+
+    // whether every operator of keys is in file, unlike find it does not mark cache dirty.
+    bool contains(std::map<std::string, U64> &keys)
+    {
+        for (auto &iter : keys) {
+            if (this->entries.find(iter.first) == this->entries.end() ||
+                this->entries[iter.first].key != iter.second) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void insert(std::string name, U64 key, std::vector<Tensor> tensors)
+    {
+        for (auto &tensor : tensors) {
+            if (tensor.get_mem_type() != CPUMem) {
+                return;
+            }
+        }
+        Entry entry;
+        entry.key = key;
+        entry.tensors = tensors;
+        this->entries[name] = entry;
+    }
+
+    EE save()
+    {
+        if (!this->dirty) {
+            return SUCCESS;
+        }
+        std::vector<U8> index;
+        std::vector<std::pair<U8 *, U32>> data;
+        U64 offset = 0;
+        for (auto &iter : this->entries) {
+            char name[NAME_LEN];
+            UNI_MEMSET(name, 0, NAME_LEN);
+            UNI_MEMCPY(name, iter.first.c_str(), UNI_MIN(iter.first.size(), NAME_LEN - 1));
+            U32 num = iter.second.tensors.size();
+            append(&index, name, NAME_LEN);
+            append(&index, &iter.second.key, sizeof(U64));
+            append(&index, &num, sizeof(U32));
+            for (auto &tensor : iter.second.tensors) {
+                TensorDesc desc = tensor.get_desc();
+                F32 scale = tensor.get_scale();
+                U32 bytes = 0;
+                tensor.capacity(&bytes);
+                append(&index, &desc, sizeof(TensorDesc));
+                append(&index, &scale, sizeof(F32));
+                append(&index, &bytes, sizeof(U32));
+                append(&index, &offset, sizeof(U64));
+                data.push_back(
+                    std::make_pair((U8 *)((CpuMemory *)tensor.get_memory())->get_ptr(), bytes));
+                offset = align(offset + bytes);
+            }
+        }
+        Header header;
+        header.magic = magic();
+        header.version = version();
+        header.num = this->entries.size();
+        header.reserved = 0;
+        header.dataOffset = align(sizeof(Header) + index.size());
+        header.checksum = hash_weight(magic(), index.data(), index.size());
+        for (auto &iter : data) {
+            header.checksum = hash_weight(header.checksum, iter.first, iter.second);
+        }
+
+        // write to a temporary file and rename it, readers never see a partial cache.
+        std::string tmpFile = this->file + ".tmp" + std::to_string((U64)this);
+#if defined(__GLIBC__) || defined(__linux__)
+        // O_EXCL does not follow or reuse a file that someone else has placed at the name.
+        FILE *fp = NULL;
+        int fd = open(tmpFile.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+        if (fd != -1 && (fp = fdopen(fd, "wb")) == NULL) {
+            close(fd);
+            remove(tmpFile.c_str());
+        }
+#else
+        FILE *fp = fopen(tmpFile.c_str(), "wb");
+#endif
+        if (fp == NULL) {
+            UNI_WARNING_LOG("can not write weight cache %s.\n", tmpFile.c_str());
+            return FILE_ERROR;
+        }
+        bool ok = (fwrite(&header, sizeof(Header), 1, fp) == 1);
+        ok = ok && (fwrite(index.data(), 1, index.size(), fp) == index.size());
+        U64 pos = sizeof(Header) + index.size();
+        std::vector<U8> zeros(ALIGNMENT, 0);
+        for (U32 i = 0; ok && i < data.size(); i++) {
+            U64 begin = align(pos);
+            ok = (fwrite(zeros.data(), 1, begin - pos, fp) == begin - pos);
+            ok = ok && (fwrite(data[i].first, 1, data[i].second, fp) == data[i].second);
+            pos = begin + data[i].second;
+        }
+        fclose(fp);
+        if (!ok || rename(tmpFile.c_str(), this->file.c_str()) != 0) {
+            UNI_WARNING_LOG("can not write weight cache %s.\n", this->file.c_str());
+            remove(tmpFile.c_str());
+            return FILE_ERROR;
+        }
+        this->dirty = false;
+        UNI_DEBUG_LOG("write weight cache %s.\n", this->file.c_str());
+        return SUCCESS;
+    }
+
+    // file name is prefix and 16 hex digits of the model key.
+    static std::string file_name(std::string prefix, U64 modelKey)
+    {
+        char key[32];
+        UNI_SNPRINTF(key, sizeof(key), "%016llx", (unsigned long long)modelKey);
+        return prefix + key;
+    }
+
+    // remove the files of other versions of the model, processes that have mapped them keep the
+    // pages until they unmap them.
+    void remove_stale(std::string prefix)
+    {
+        size_t pos = prefix.rfind('/');
+        if (pos == std::string::npos || prefix.compare(0, pos, this->file, 0, pos) != 0) {
+            return;
+        }
+        std::string directory = prefix.substr(0, pos);
+        std::string head = prefix.substr(pos + 1);
+        std::string self = this->file.substr(pos + 1);
+        for (auto &name : search_files(directory, "", head)) {
+            std::string tail = (name.compare(0, head.size(), head) == 0)
+                ? name.substr(head.size())
+                : std::string();
+            if (tail.size() == 21 && tail.substr(16) == ".lock") {
+                tail = tail.substr(0, 16);
+            }
+            if (name == self || name == self + ".lock" || tail.size() != 16 ||
+                tail.find_first_not_of("0123456789abcdef") != std::string::npos) {
+                continue;
+            }
+            UNI_DEBUG_LOG("remove stale weight cache %s.\n", name.c_str());
+            remove((directory + "/" + name).c_str());
+        }
+    }
+
+private:
+    static const U32 ALIGNMENT = 64;
+
+    struct Header {
+        U32 magic;
+        U32 version;
+        U32 num;
+        U32 reserved;
+        U64 dataOffset;
+        U64 checksum;
+    };
+
+    struct Entry {
+        U64 key;
+        std::vector<Tensor> tensors;
+    };
+
+#if defined(__GLIBC__) || defined(__linux__)
+    // whether fd is a regular file of the effective user that group and others can not write.
+    static bool trusted(int fd, const std::string &name)
+    {
+        struct stat ss;
+        if (fstat(fd, &ss) != 0 || !S_ISREG(ss.st_mode) || ss.st_uid != geteuid() ||
+            (ss.st_mode & (S_IWGRP | S_IWOTH)) != 0) {
+            UNI_WARNING_LOG("weight cache %s is not a private file of this user, it is ignored.\n",
+                name.c_str());
+            return false;
+        }
+        return true;
+    }
+#endif
+
+    static U32 magic()
+    {
+        return 0x48435742;  // "BWCH"
+    }
+
+    static U32 version()
+    {
+        return 2;
+    }
+
+    static U64 align(U64 offset)
+    {
+        return (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    }
+
+    static void append(std::vector<U8> *buffer, const void *data, U32 bytes)
+    {
+        const U8 *p = (const U8 *)data;
+        buffer->insert(buffer->end(), p, p + bytes);
+    }
+
+    bool read(size_t length, size_t *pos, void *data, U32 bytes)
+    {
+        if (*pos + bytes > length) {
+            return false;
+        }
+        UNI_MEMCPY(data, this->mapping.get() + *pos, bytes);
+        *pos += bytes;
+        return true;
+    }
+
+    bool parse(size_t length)
+    {
+        Header header;
+        size_t pos = 0;
+        if (!read(length, &pos, &header, sizeof(Header)) || header.magic != magic() ||
+            header.version != version() || header.dataOffset > length) {
+            return false;
+        }
+        std::vector<std::pair<U64, U32>> data;
+        for (U32 i = 0; i < header.num; i++) {
+            char name[NAME_LEN];
+            Entry entry;
+            U32 num;
+            if (!read(length, &pos, name, NAME_LEN) ||
+                !read(length, &pos, &entry.key, sizeof(U64)) ||
+                !read(length, &pos, &num, sizeof(U32))) {
+                return false;
+            }
+            name[NAME_LEN - 1] = '\0';
+            for (U32 j = 0; j < num; j++) {
+                TensorDesc desc;
+                F32 scale;
+                U32 bytes;
+                U64 offset;
+                if (!read(length, &pos, &desc, sizeof(TensorDesc)) ||
+                    !read(length, &pos, &scale, sizeof(F32)) ||
+                    !read(length, &pos, &bytes, sizeof(U32)) ||
+                    !read(length, &pos, &offset, sizeof(U64))) {
+                    return false;
+                }
+                offset += header.dataOffset;
+                if (offset + bytes > length || tensorNumBytes(desc) > bytes) {
+                    return false;
+                }
+                data.push_back(std::make_pair(offset, bytes));
+                Tensor tensor;
+                tensor.resize(tensor1d(DT_U8, bytes));
+                ((CpuMemory *)tensor.get_memory())
+                    ->set_shared_ptr(
+                        std::shared_ptr<U8>(this->mapping, this->mapping.get() + offset));
+                tensor.resize(desc);
+                tensor.set_scale(scale);
+                entry.tensors.push_back(tensor);
+            }
+            this->entries[name] = entry;
+        }
+        U64 checksum =
+            hash_weight(magic(), this->mapping.get() + sizeof(Header), pos - sizeof(Header));
+        for (auto &iter : data) {
+            checksum = hash_weight(checksum, this->mapping.get() + iter.first, iter.second);
+        }
+        return checksum == header.checksum;
+    }
+
+    std::string file;
+    std::shared_ptr<U8> mapping;
+    std::map<std::string, Entry> entries;
+    bool dirty;
+    int lockFd;
+};
+#endif  // _WEIGHT_CACHE_H
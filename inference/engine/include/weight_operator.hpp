@@ -119,6 +119,28 @@ public:
         return SUCCESS;
     }
 
+    // whether transform_filter only rewrites weightTensors, so that its result can be
+    // saved to and restored from the weight cache.
+    virtual bool is_weight_cacheable()
+    {
+        return false;
+    }
+
+    std::vector<Tensor> get_weight_tensors()
+    {
+        return this->weightTensors;
+    }
+
+    void set_weight_tensors(std::vector<Tensor> tensors)
+    {
+        this->weightTensors = tensors;
+    }
+
+    WeightSpec get_weightspec()
+    {
+        return this->ws;
+    }
+
 #ifdef _USE_GPU
 protected:
     EE set_wtm_image(TensorDesc desc, std::shared_ptr<Tensor> *targetWtm = nullptr)
@@ -0,0 +1,179 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "batch_server.h"
+
+// N is the outermost dimension, so batching along N is a plain concatenation.
+static TensorDesc set_batch(TensorDesc desc, U32 batch)
+{
+    if (desc.nDims > 0) {
+        desc.dims[desc.nDims - 1] *= batch;
+    }
+    return desc;
+}
+
+BatchServer::BatchServer(CNN *cnn, U32 maxBatch, U32 timeoutUs)
+{
+    this->cnn = cnn;
+    this->maxBatch = UNI_MAX(maxBatch, 1);
+    this->timeoutUs = timeoutUs;
+    this->batchable = true;
+    this->preparedBatch = 1;
+    this->inputDescs = cnn->get_input_desc();
+    this->outputDescs = cnn->get_output_desc();
+    this->stop = false;
+    this->thread = std::thread(&BatchServer::loop, this);
+}
+
+BatchServer::~BatchServer()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->stop = true;
+    }
+    this->requestCondition.notify_all();
+    this->thread.join();
+}
+
+EE BatchServer::run(std::map<std::string, U8 *> inputs, std::map<std::string, U8 *> outputs)
+{
+    for (auto &iter : this->inputDescs) {
+        if (inputs.find(iter.first) == inputs.end() || inputs[iter.first] == nullptr) {
+            UNI_WARNING_LOG("batch request lacks input %s.\n", iter.first.c_str());
+            return NULL_POINTER;
+        }
+    }
+    Request request;
+    request.inputs = inputs;
+    request.outputs = outputs;
+    request.arrival = std::chrono::steady_clock::now();
+    request.done = false;
+    request.ret = SUCCESS;
+    std::unique_lock<std::mutex> lock(this->mutex);
+    if (this->stop) {
+        return NOT_SUPPORTED;
+    }
+    this->requests.push_back(&request);
+    this->requestCondition.notify_one();
+    this->doneCondition.wait(lock, [&] { return request.done; });
+    return request.ret;
+}
+
+void BatchServer::loop()
+{
+    while (1) {
+        std::vector<Request *> batch;
+        {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->requestCondition.wait(
+                lock, [&] { return this->stop || !this->requests.empty(); });
+            if (this->requests.empty()) {
+                break;
+            }
+            auto deadline =
+                this->requests.front()->arrival + std::chrono::microseconds(this->timeoutUs);
+            while (!this->stop && this->batchable && this->requests.size() < this->maxBatch) {
+                if (this->requestCondition.wait_until(lock, deadline) == std::cv_status::timeout) {
+                    break;
+                }
+            }
+            U32 num = this->batchable ? this->maxBatch : 1;
+            while (!this->requests.empty() && batch.size() < num) {
+                batch.push_back(this->requests.front());
+                this->requests.pop_front();
+            }
+        }
+        EE ret = this->run_batch(batch);
+        if (ret != SUCCESS && batch.size() > 1) {
+            // model can not run as a batch, fall back to one request at a time.
+            UNI_WARNING_LOG("model can not run %d requests as a batch, batching is disabled.\n",
+                (int)batch.size());
+            this->batchable = false;
+            for (U32 i = 0; i < batch.size(); i++) {
+                std::vector<Request *> single(1, batch[i]);
+                batch[i]->ret = this->run_batch(single);
+            }
+        } else if (ret != SUCCESS) {
+            batch[0]->ret = ret;
+        }
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            for (auto request : batch) {
+                request->done = true;
+            }
+        }
+        this->doneCondition.notify_all();
+    }
+}
+
+void BatchServer::prepare(U32 batch)
+{
+    if (batch == this->preparedBatch) {
+        return;
+    }
+    std::map<std::string, TensorDesc> descs;
+    for (auto &iter : this->inputDescs) {
+        descs[iter.first] = set_batch(iter.second, batch);
+    }
+    this->cnn->reready_batch(descs, this->maxBatch);
+    this->preparedBatch = batch;
+}
+
+// output of a batch must be the outputs of the requests concatenated along N, a model that
+// mixes the samples(e.g. reshapes N into another dimension) has another outermost dimension.
+static bool is_batch_of(TensorDesc desc, TensorDesc single, U32 batch)
+{
+    if (desc.nDims != single.nDims || desc.nDims == 0 || desc.df != single.df ||
+        desc.dt != single.dt) {
+        return false;
+    }
+    for (U32 i = 0; i < desc.nDims - 1; i++) {
+        if (desc.dims[i] != single.dims[i]) {
+            return false;
+        }
+    }
+    return desc.dims[desc.nDims - 1] == single.dims[single.nDims - 1] * batch;
+}
+
+EE BatchServer::run_batch(std::vector<Request *> &batch)
+{
+    U32 num = batch.size();
+    this->prepare(num);
+    auto outputs = this->cnn->get_output();
+    for (auto &iter : this->outputDescs) {
+        if (!is_batch_of(outputs[iter.first]->get_desc(), iter.second, num)) {
+            return NOT_MATCH;
+        }
+    }
+    auto inputs = this->cnn->get_input();
+    for (auto &iter : this->inputDescs) {
+        U32 bytes = tensorNumBytes(iter.second);
+        U8 *dst = (U8 *)((CpuMemory *)(inputs[iter.first]->get_memory()))->get_ptr();
+        for (U32 i = 0; i < num; i++) {
+            UNI_MEMCPY(dst + i * bytes, batch[i]->inputs[iter.first], bytes);
+        }
+    }
+    this->cnn->run();
+
+    for (auto &iter : this->outputDescs) {
+        U32 bytes = tensorNumBytes(iter.second);
+        U8 *src = (U8 *)((CpuMemory *)(outputs[iter.first]->get_memory()))->get_ptr();
+        for (U32 i = 0; i < num; i++) {
+            if (batch[i]->outputs.find(iter.first) != batch[i]->outputs.end()) {
+                UNI_MEMCPY(batch[i]->outputs[iter.first], src + i * bytes, bytes);
+            }
+        }
+    }
+    return SUCCESS;
+}
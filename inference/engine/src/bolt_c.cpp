@@ -12,7 +12,11 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "bolt_c_common.h"
+#ifndef _USE_LITE
+#include "batch_server.h"
+#endif
 #include "../../tensor/src/cpu/tensor_computing_cpu.h"
+#include "op_profiler.h"
 
 #define NAME_VALUE_PAIR(x) #x, x
 #ifdef _USE_GPU
@@ -229,7 +233,8 @@ static std::map<std::string, TensorDesc> getInputDataFormatFromUser(ModelHandle
     const int *h,
     const int *w,
     const DATA_TYPE *dt,
-    const DATA_FORMAT *df)
+    const DATA_FORMAT *df,
+    bool partial = false)
 {
     std::map<std::string, TensorDesc> descs;
     ModelHandleInner *ihInfo = (ModelHandleInner *)ih;
@@ -240,7 +245,7 @@ static std::map<std::string, TensorDesc> getInputDataFormatFromUser(ModelHandle
 
     std::map<std::string, TensorDesc> inputDescs = cnn->get_input_desc();
     int num = inputDescs.size();
-    if (num != num_inputs) {
+    if ((!partial && num != num_inputs) || num < num_inputs) {
         UNI_ERROR_LOG("C API failed. model has %d inputs, not %d.\n", num, num_inputs);
     }
     assert_not_nullptr(__FUNCTION__, NAME_VALUE_PAIR(name));
@@ -254,7 +259,7 @@ static std::map<std::string, TensorDesc> getInputDataFormatFromUser(ModelHandle
     assert_not_nullptr(__FUNCTION__, NAME_VALUE_PAIR(dt));
     assert_not_nullptr(__FUNCTION__, NAME_VALUE_PAIR(df));
 
-    for (int i = 0; i < num; ++i) {
+    for (int i = 0; i < num_inputs; ++i) {
         std::string inputName = name[i];
         if (inputDescs.find(inputName) == inputDescs.end()) {
             UNI_ERROR_LOG(
@@ -346,11 +351,16 @@ void PrepareModel5D(ModelHandle ih,
 #endif
     std::map<std::string, TensorDesc> modelInputDims =
         getInputDataFormatFromUser(ih, num_inputs, name, n, c, t, h, w, dt, df);
-    if (ihInfo->device == GPU_MALI || ihInfo->device == GPU_QUALCOMM) {
+    bool gpu = (ihInfo->device == GPU_MALI || ihInfo->device == GPU_QUALCOMM);
+    bool cpuTuning = !gpu && cnn->get_algorithm_tuning();
+    if (gpu || cpuTuning) {
         cnn->loadAlgorithmMap((const char *)ihInfo->algoPath, ihInfo->useFileStream);
     }
     cnn->ready(modelInputDims);
     cnn->mark_input_output();
+    if (cpuTuning && ihInfo->algoPath != nullptr && !ihInfo->useFileStream) {
+        cnn->saveAlgorithmMapToFile((const char *)ihInfo->algoPath);
+    }
 
     ModelSpec *ms = (ModelSpec *)ihInfo->ms;
     CHECK_STATUS(mt_destroy_model(ms));
@@ -504,6 +514,62 @@ void SetRuntimeDeviceDynamic(ModelHandle ih)
 #endif
 }
 
+void SetNumaNode(ModelHandle ih, int node)
+{
+#ifndef _USE_LITE
+    UNI_DEBUG_LOG("C API %s(%p, %d)...\n", __FUNCTION__, ih, node);
+    ModelHandleInner *ihInfo = (ModelHandleInner *)ih;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle", ihInfo);
+    print_model_handle(ihInfo);
+    CNN *cnn = (CNN *)ihInfo->cnn;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle.cnn", cnn);
+    cnn->set_numa_node(node);
+    UNI_DEBUG_LOG("C API %s end.\n", __FUNCTION__);
+#endif
+}
+
+void SetAlgorithmTuning(ModelHandle ih, int enable)
+{
+#ifndef _USE_LITE
+    UNI_DEBUG_LOG("C API %s(%p, %d)...\n", __FUNCTION__, ih, enable);
+    ModelHandleInner *ihInfo = (ModelHandleInner *)ih;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle", ihInfo);
+    print_model_handle(ihInfo);
+    CNN *cnn = (CNN *)ihInfo->cnn;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle.cnn", cnn);
+    cnn->set_algorithm_tuning(enable);
+    UNI_DEBUG_LOG("C API %s end.\n", __FUNCTION__);
+#endif
+}
+
+void SetLazyWeight(ModelHandle ih, int enable)
+{
+#ifndef _USE_LITE
+    UNI_DEBUG_LOG("C API %s(%p, %d)...\n", __FUNCTION__, ih, enable);
+    ModelHandleInner *ihInfo = (ModelHandleInner *)ih;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle", ihInfo);
+    print_model_handle(ihInfo);
+    CNN *cnn = (CNN *)ihInfo->cnn;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle.cnn", cnn);
+    cnn->set_lazy_weight(enable);
+    UNI_DEBUG_LOG("C API %s end.\n", __FUNCTION__);
+#endif
+}
+
+void SetThreadPool(ModelHandle ih, int enable)
+{
+#ifndef _USE_LITE
+    UNI_DEBUG_LOG("C API %s(%p, %d)...\n", __FUNCTION__, ih, enable);
+    ModelHandleInner *ihInfo = (ModelHandleInner *)ih;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle", ihInfo);
+    print_model_handle(ihInfo);
+    CNN *cnn = (CNN *)ihInfo->cnn;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle.cnn", cnn);
+    cnn->set_thread_pool(enable);
+    UNI_DEBUG_LOG("C API %s end.\n", __FUNCTION__);
+#endif
+}
+
 void SetNumThreads(int threadNum)
 {
 #ifndef _USE_LITE
@@ -513,6 +579,134 @@ void SetNumThreads(int threadNum)
 #endif
 }
 
+void SetNumInterOpThreads(ModelHandle ih, int threadNum)
+{
+#ifndef _USE_LITE
+    UNI_DEBUG_LOG("C API %s(%p, %d)...\n", __FUNCTION__, ih, threadNum);
+    ModelHandleInner *ihInfo = (ModelHandleInner *)ih;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle", ihInfo);
+    print_model_handle(ihInfo);
+    CNN *cnn = (CNN *)ihInfo->cnn;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle.cnn", cnn);
+    cnn->set_inter_op_threads(UNI_MAX(threadNum, 1));
+    UNI_DEBUG_LOG("C API %s end.\n", __FUNCTION__);
+#endif
+}
+
+void SetWeightCachePath(ModelHandle ih, const char *path)
+{
+#ifndef _USE_LITE
+    UNI_DEBUG_LOG("C API %s(%p, %s)...\n", __FUNCTION__, ih, path);
+    ModelHandleInner *ihInfo = (ModelHandleInner *)ih;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle", ihInfo);
+    print_model_handle(ihInfo);
+    CNN *cnn = (CNN *)ihInfo->cnn;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle.cnn", cnn);
+    cnn->set_weight_cache_path((path == NULL) ? "" : path);
+    UNI_DEBUG_LOG("C API %s end.\n", __FUNCTION__);
+#endif
+}
+
+void SetWeightShare(ModelHandle ih, int enable)
+{
+#ifndef _USE_LITE
+    UNI_DEBUG_LOG("C API %s(%p, %d)...\n", __FUNCTION__, ih, enable);
+    ModelHandleInner *ihInfo = (ModelHandleInner *)ih;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle", ihInfo);
+    print_model_handle(ihInfo);
+    CNN *cnn = (CNN *)ihInfo->cnn;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle.cnn", cnn);
+    cnn->set_weight_share(enable);
+    UNI_DEBUG_LOG("C API %s end.\n", __FUNCTION__);
+#endif
+}
+
+void SetPlanCache(ModelHandle ih, int capacity)
+{
+#ifndef _USE_LITE
+    UNI_DEBUG_LOG("C API %s(%p, %d)...\n", __FUNCTION__, ih, capacity);
+    ModelHandleInner *ihInfo = (ModelHandleInner *)ih;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle", ihInfo);
+    print_model_handle(ihInfo);
+    CNN *cnn = (CNN *)ihInfo->cnn;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle.cnn", cnn);
+    cnn->set_plan_cache(UNI_MAX(capacity, 0));
+    UNI_DEBUG_LOG("C API %s end.\n", __FUNCTION__);
+#endif
+}
+
+void SetDynamicQuantization(ModelHandle ih, int enable)
+{
+#ifndef _USE_LITE
+    UNI_DEBUG_LOG("C API %s(%p, %d)...\n", __FUNCTION__, ih, enable);
+    ModelHandleInner *ihInfo = (ModelHandleInner *)ih;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle", ihInfo);
+    print_model_handle(ihInfo);
+    CNN *cnn = (CNN *)ihInfo->cnn;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle.cnn", cnn);
+    cnn->set_dynamic_quantization(enable != 0);
+    UNI_DEBUG_LOG("C API %s end.\n", __FUNCTION__);
+#endif
+}
+
+BatchHandle CreateBatchServer(ModelHandle ih, int maxBatch, int timeoutUs)
+{
+    BatchHandle ret = NULL;
+#ifndef _USE_LITE
+    UNI_DEBUG_LOG("C API %s(%p, %d, %d)...\n", __FUNCTION__, ih, maxBatch, timeoutUs);
+    ModelHandleInner *ihInfo = (ModelHandleInner *)ih;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle", ihInfo);
+    print_model_handle(ihInfo);
+    CNN *cnn = (CNN *)ihInfo->cnn;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle.cnn", cnn);
+    if (ihInfo->device == GPU_MALI || ihInfo->device == GPU_QUALCOMM) {
+        UNI_ERROR_LOG("C API %s only support CPU.\n", __FUNCTION__);
+    }
+    ret = (BatchHandle) new BatchServer(cnn, UNI_MAX(maxBatch, 1), UNI_MAX(timeoutUs, 0));
+    UNI_DEBUG_LOG("C API %s(%p) end.\n", __FUNCTION__, ret);
+#endif
+    return ret;
+}
+
+int RunBatchModel(BatchHandle ib,
+    int numInputs,
+    const char **name,
+    void **data,
+    int numOutputs,
+    const char **outputName,
+    void **outputData)
+{
+    int ret = 1;
+#ifndef _USE_LITE
+    UNI_DEBUG_LOG("C API %s(%p, %d, %p, %p, %d, %p, %p)...\n", __FUNCTION__, ib, numInputs, name,
+        data, numOutputs, outputName, outputData);
+    BatchServer *server = (BatchServer *)ib;
+    assert_not_nullptr(__FUNCTION__, "BatchHandle", server);
+    std::map<std::string, U8 *> inputs, outputs;
+    for (int i = 0; i < numInputs; i++) {
+        assert_not_nullptr(__FUNCTION__, NAME_VALUE_PAIR(data[i]));
+        inputs[name[i]] = (U8 *)data[i];
+    }
+    for (int i = 0; i < numOutputs; i++) {
+        assert_not_nullptr(__FUNCTION__, NAME_VALUE_PAIR(outputData[i]));
+        outputs[outputName[i]] = (U8 *)outputData[i];
+    }
+    ret = (server->run(inputs, outputs) == SUCCESS) ? 0 : 1;
+    UNI_DEBUG_LOG("C API %s(%d) end.\n", __FUNCTION__, ret);
+#endif
+    return ret;
+}
+
+void DestroyBatchServer(BatchHandle ib)
+{
+#ifndef _USE_LITE
+    UNI_DEBUG_LOG("C API %s(%p)...\n", __FUNCTION__, ib);
+    BatchServer *server = (BatchServer *)ib;
+    delete server;
+    UNI_DEBUG_LOG("C API %s end.\n", __FUNCTION__);
+#endif
+}
+
 int TransformDataType(ModelHandle ih,
     DATA_TYPE inputType,
     const void *inputData,
@@ -617,6 +811,32 @@ int SetInputOutput(ModelHandle ih, int num, const char **name, void **data)
     return ret;
 }
 
+static void update_result_handle(ModelHandleInner *ihInfo, ResultHandleInner *ir_inner)
+{
+    if (ir_inner == nullptr) {
+        return;
+    }
+    CNN *cnn = (CNN *)ihInfo->cnn;
+    print_result_handle(ir_inner);
+    DataDesc *p = ir_inner->data;
+    assert_not_nullptr(__FUNCTION__, "ResultHandle.data", p);
+    for (U32 curIndex = 0; curIndex < ir_inner->num_data; curIndex++) {
+        Tensor output_tensor = cnn->get_tensor_by_name(p[curIndex].name);
+        if (ihInfo->device == GPU_MALI || ihInfo->device == GPU_QUALCOMM) {
+#ifdef _USE_GPU
+            auto mem = (OclMemory *)output_tensor.get_memory();
+            p[curIndex].data = mem->get_mapped_ptr();
+#else
+            UNI_WARNING_LOG("this binary not support GPU, please recompile project with GPU "
+                            "compile options.\n");
+#endif
+        } else {
+            p[curIndex].data = ((CpuMemory *)(output_tensor.get_memory()))->get_ptr();
+        }
+        TensorDesc2DataDesc(output_tensor.get_desc(), &(p[curIndex]));
+    }
+}
+
 void RunModelWithType(ModelHandle ih,
     ResultHandle ir,
     int num_inputs,
@@ -687,27 +907,7 @@ void RunModelWithType(ModelHandle ih,
 #endif
     }
     cnn->run();
-
-    if (ir_inner) {
-        print_result_handle(ir_inner);
-        DataDesc *p = ir_inner->data;
-        assert_not_nullptr(__FUNCTION__, "ResultHandle.data", p);
-        for (U32 curIndex = 0; curIndex < ir_inner->num_data; curIndex++) {
-            Tensor output_tensor = cnn->get_tensor_by_name(p[curIndex].name);
-            if (ihInfo->device == GPU_MALI || ihInfo->device == GPU_QUALCOMM) {
-#ifdef _USE_GPU
-                auto mem = (OclMemory *)output_tensor.get_memory();
-                p[curIndex].data = mem->get_mapped_ptr();
-#else
-                UNI_WARNING_LOG("this binary not support GPU, please recompile project with GPU "
-                                "compile options.\n");
-#endif
-            } else {
-                p[curIndex].data = ((CpuMemory *)(output_tensor.get_memory()))->get_ptr();
-            }
-            TensorDesc2DataDesc(output_tensor.get_desc(), &(p[curIndex]));
-        }
-    }
+    update_result_handle(ihInfo, ir_inner);
 #ifdef _USE_GPU
     if (ihInfo->device == GPU_MALI || ihInfo->device == GPU_QUALCOMM) {
         pthread_mutex_unlock(&gpuLock);
@@ -716,6 +916,84 @@ void RunModelWithType(ModelHandle ih,
     UNI_DEBUG_LOG("C API %s end.\n", __FUNCTION__);
 }
 
+int CreateKVCache(ModelHandle ih,
+    int num,
+    const char **pastName,
+    const char **presentName,
+    int maxLength)
+{
+    int ret = 1;
+#ifndef _USE_LITE
+    UNI_DEBUG_LOG("C API %s(%p, %d, %p, %p, %d)...\n", __FUNCTION__, ih, num, pastName,
+        presentName, maxLength);
+    ModelHandleInner *ihInfo = (ModelHandleInner *)ih;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle", ihInfo);
+    print_model_handle(ihInfo);
+    CNN *cnn = (CNN *)ihInfo->cnn;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle.cnn", cnn);
+    std::vector<std::string> pastNames, presentNames;
+    for (int i = 0; i < num; i++) {
+        assert_not_nullptr(__FUNCTION__, NAME_VALUE_PAIR(pastName[i]));
+        assert_not_nullptr(__FUNCTION__, NAME_VALUE_PAIR(presentName[i]));
+        pastNames.push_back(pastName[i]);
+        presentNames.push_back(presentName[i]);
+    }
+    ret = (cnn->init_kv_cache(pastNames, presentNames, UNI_MAX(maxLength, 0)) == SUCCESS) ? 0 : 1;
+    UNI_DEBUG_LOG("C API %s(%d) end.\n", __FUNCTION__, ret);
+#endif
+    return ret;
+}
+
+int RunModelStep(ModelHandle ih,
+    ResultHandle ir,
+    int numInputs,
+    const char **name,
+    const int *n,
+    const int *c,
+    const int *h,
+    const int *w,
+    const DATA_TYPE *dt,
+    const DATA_FORMAT *df,
+    void **data)
+{
+    int ret = 1;
+#ifndef _USE_LITE
+    UNI_DEBUG_LOG("C API %s(%p, %p, %d, %p, %p, %p, %p, %p, %p, %p, %p)...\n", __FUNCTION__, ih,
+        ir, numInputs, name, n, c, h, w, dt, df, data);
+    ModelHandleInner *ihInfo = (ModelHandleInner *)ih;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle", ihInfo);
+    print_model_handle(ihInfo);
+    CNN *cnn = (CNN *)ihInfo->cnn;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle.cnn", cnn);
+    std::map<std::string, TensorDesc> descs =
+        getInputDataFormatFromUser(ih, numInputs, name, n, c, NULL, h, w, dt, df, true);
+    std::map<std::string, std::shared_ptr<U8>> input;
+    for (int i = 0; i < numInputs; i++) {
+        assert_not_nullptr(__FUNCTION__, NAME_VALUE_PAIR(data[i]));
+        input[name[i]] = std::shared_ptr<U8>((U8 *)data[i], [](U8 *ptr) {});
+    }
+    if (cnn->run_step(descs, input) == SUCCESS) {
+        update_result_handle(ihInfo, (ResultHandleInner *)ir);
+        ret = 0;
+    }
+    UNI_DEBUG_LOG("C API %s(%d) end.\n", __FUNCTION__, ret);
+#endif
+    return ret;
+}
+
+void ResetKVCache(ModelHandle ih)
+{
+#ifndef _USE_LITE
+    UNI_DEBUG_LOG("C API %s(%p)...\n", __FUNCTION__, ih);
+    ModelHandleInner *ihInfo = (ModelHandleInner *)ih;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle", ihInfo);
+    CNN *cnn = (CNN *)ihInfo->cnn;
+    assert_not_nullptr(__FUNCTION__, "ModelHandle.cnn", cnn);
+    cnn->reset_kv_cache();
+    UNI_DEBUG_LOG("C API %s end.\n", __FUNCTION__);
+#endif
+}
+
 int GetNumOutputsFromResultHandle(ResultHandle ir)
 {
     UNI_DEBUG_LOG("C API %s(%p)...\n", __FUNCTION__, ir);
@@ -942,6 +1220,38 @@ void DestroyModel(ModelHandle ih)
     UNI_DEBUG_LOG("C API %s end.\n", __FUNCTION__);
 }
 
+void SetProfiling(int enable)
+{
+    UNI_DEBUG_LOG("C API %s(%d)...\n", __FUNCTION__, enable);
+    op_profiler_enable(enable != 0);
+    UNI_DEBUG_LOG("C API %s end.\n", __FUNCTION__);
+}
+
+int DumpProfiling(const char *traceFile, const char *summaryFile)
+{
+    UNI_DEBUG_LOG("C API %s(%s, %s)...\n", __FUNCTION__, traceFile, summaryFile);
+    int ret = 0;
+    if (traceFile != NULL && op_profiler_dump_trace(traceFile) != SUCCESS) {
+        ret = 1;
+    }
+    std::string summary = op_profiler_summary();
+    if (summaryFile == NULL) {
+        printf("%s", summary.c_str());
+    } else {
+        FILE *file = fopen(summaryFile, "w");
+        if (file == NULL) {
+            UNI_ERROR_LOG("can not write profile summary to %s.\n", summaryFile);
+            ret = 1;
+        } else {
+            fprintf(file, "%s", summary.c_str());
+            fclose(file);
+        }
+    }
+    op_profiler_reset();
+    UNI_DEBUG_LOG("C API %s end.\n", __FUNCTION__);
+    return ret;
+}
+
 void MemoryCheck()
 {
 #ifndef _USE_LITE
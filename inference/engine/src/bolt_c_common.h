@@ -168,6 +168,7 @@ inline HARDWARE_TYPE Arch2HARDWARE_TYPE(Arch arch)
         {QUALCOMM, GPU_QUALCOMM},
         {X86_AVX2, CPU_X86_AVX2},
         {X86_AVX512, CPU_X86_AVX512},
+        {X86_AVX512_NOVNNI, CPU_X86_AVX2},
         {CPU_GENERAL, CPU_SERIAL},
     };
     HARDWARE_TYPE ret = CPU_ARM_V8;
@@ -11,6 +11,7 @@
 // COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
+#include <atomic>
 #include "cnn.h"
 #ifdef _USE_CPU
 #include "cpu/factory_cpu.hpp"
@@ -19,6 +20,8 @@
 #include "ocl/factory_ocl.hpp"
 #endif
 #include "profiling.h"
+#include "op_profiler.h"
+#include "weight_cache.hpp"
 
 #ifndef _USE_LITE
 static bool is_same_tensor(Tensor a, Tensor b)
@@ -36,11 +39,17 @@ static bool is_same_tensor(Tensor a, Tensor b)
 
 CNN CNN::clone()
 {
+    this->finish_lazy_weight();
     CNN cnn = *this;
     for (U32 i = 0; i < cnn.ops.size(); i++) {
         cnn.ops[i] = cnn.ops[i]->clone();
         cnn.operatorMap[cnn.ops[i]->get_name()] = cnn.ops[i];
     }
+    cnn.graphExecutor = nullptr;
+    cnn.threadPools.clear();
+    cnn.set_inter_op_threads(this->interOpThreadNum);
+    cnn.kvCache.clear();
+    cnn.kvCacheAlias.clear();
     for (auto &tensor : cnn.tensorMap) {
         std::shared_ptr<Tensor> cloneTensor = std::shared_ptr<Tensor>(new Tensor());
         *cloneTensor = tensor.second->clone(false);
@@ -80,6 +89,9 @@ CNN CNN::clone()
 
     // check
     CHECK_REQUIREMENT(!is_same_tensor(this->tmpTensor, cnn.tmpTensor));
+    if (this->arenaMemory != nullptr) {
+        CHECK_REQUIREMENT(!is_same_tensor(*(this->arenaMemory.get()), *(cnn.arenaMemory.get())));
+    }
     for (U32 i = 0; i < this->storageMemory.size(); i++) {
         CHECK_REQUIREMENT(
             !is_same_tensor(*(this->storageMemory[i].get()), *(cnn.storageMemory[i].get())));
@@ -130,6 +142,34 @@ CNN CNN::clone()
 void CNN::reready(std::map<std::string, TensorDesc> inputDescMap)
 {
     UNI_DEBUG_LOG("Inference reready for dynamic input...\n");
+    this->finish_lazy_weight();
+    this->replan(this->planCache.bucket(inputDescMap));
+    UNI_DEBUG_LOG("Inference reready end.\n");
+}
+
+void CNN::reready_batch(std::map<std::string, TensorDesc> inputDescMap, U32 maxBatch)
+{
+    UNI_DEBUG_LOG("Inference reready for batch...\n");
+    if (IS_CPU(this->deviceInfo.schedule) && this->planCache.get_capacity() < maxBatch) {
+        this->planCache.set_capacity(maxBatch);
+    }
+    this->finish_lazy_weight();
+    this->replan(inputDescMap);
+    UNI_DEBUG_LOG("Inference reready for batch end.\n");
+}
+
+void CNN::replan(std::map<std::string, TensorDesc> inputDescMap)
+{
+    bool cache = this->planCache.enabled() && IS_CPU(this->deviceInfo.schedule);
+    std::string key;
+    if (cache) {
+        key = PlanCache::key(inputDescMap);
+        if (this->planCache.find(key)) {
+            this->restore_plan(inputDescMap);
+            UNI_DEBUG_LOG("    reuse plan, %s.\n", this->planCache.string().c_str());
+            return;
+        }
+    }
     this->infer_output_tensors_size(inputDescMap);
     for (auto iter : this->inputTensors) {
         iter.second->alloc();
@@ -139,7 +179,609 @@ void CNN::reready(std::map<std::string, TensorDesc> inputDescMap)
     }
     this->infer_tmp_memory_size();
     this->tmpTensor.alloc();
-    UNI_DEBUG_LOG("Inference reready end.\n");
+    this->bind_numa_buffers();
+    if (cache) {
+        this->planCache.insert(key);
+    }
+}
+
+void CNN::restore_plan(std::map<std::string, TensorDesc> inputDescMap)
+{
+    // operators keep shape dependent members, so shapes are still inferred. Tensor positions,
+    // memory, tmp buffer and dependency graph only grow, they have been set for this shape.
+    this->set_input_desc(inputDescMap);
+    this->infer_layout_desc();
+    for (auto iter : this->inputTensors) {
+        iter.second->alloc();
+    }
+}
+
+void CNN::set_plan_cache(U32 capacity, PlanBucketMode mode, U32 value, int axis)
+{
+    if (capacity > 0 && !IS_CPU(this->deviceInfo.schedule)) {
+        UNI_WARNING_LOG("plan cache is only supported on CPU.\n");
+    }
+    this->planCache.set_capacity(capacity);
+    this->planCache.set_bucket(mode, value, axis);
+}
+
+void CNN::set_weight_cache_path(std::string path)
+{
+    if (path != "" && !IS_CPU(this->deviceInfo.schedule)) {
+        UNI_WARNING_LOG("weight cache is only supported on CPU.\n");
+    }
+    this->weightCachePath = path;
+}
+
+void CNN::set_weight_share(bool enable)
+{
+    if (enable && !IS_CPU(this->deviceInfo.schedule)) {
+        UNI_WARNING_LOG("weight share is only supported on CPU.\n");
+    }
+    if (enable && WeightCache::share_directory() == "") {
+        UNI_WARNING_LOG("weight share needs POSIX shared memory, weights will not be shared.\n");
+    }
+    this->weightShare = enable;
+}
+
+void CNN::set_dynamic_quantization(bool enable)
+{
+#if !defined(_USE_X86) || !defined(_USE_INT8)
+    if (enable) {
+        UNI_WARNING_LOG("dynamic quantization needs x86 int8 support, please rebuild with "
+                        "USE_INT8.\n");
+        enable = false;
+    }
+#endif
+    if (enable && (!IS_X86(this->deviceInfo.schedule) || isQuantMixDataType(this->dt))) {
+        UNI_WARNING_LOG("dynamic quantization is only supported on x86 float inference.\n");
+        enable = false;
+    }
+    if (enable && !has_x86_int8_vnni(this->deviceInfo.schedule)) {
+        UNI_WARNING_LOG("dynamic quantization needs a processor with vnni, float inference is "
+                        "used.\n");
+        enable = false;
+    }
+    for (auto &op : this->ops) {
+        op->set_dynamic_quantization(enable);
+    }
+}
+
+void CNN::set_algorithm_tuning(bool enable)
+{
+    if (enable && !IS_CPU(this->deviceInfo.schedule)) {
+        UNI_WARNING_LOG("algorithm tuning is only supported on CPU, GPU algorithms are always "
+                        "tuned.\n");
+        enable = false;
+    }
+    this->algorithmTuning = enable;
+    for (auto &op : this->ops) {
+        op->set_algorithm_tuning(enable);
+    }
+}
+
+bool CNN::get_algorithm_tuning()
+{
+    return this->algorithmTuning;
+}
+
+void CNN::set_lazy_weight(bool enable)
+{
+    if (enable && !IS_CPU(this->deviceInfo.schedule)) {
+        UNI_WARNING_LOG("lazy weight is only supported on CPU.\n");
+        enable = false;
+    }
+    this->lazyWeight = enable;
+}
+
+void CNN::set_thread_pool(bool enable)
+{
+    if (enable && !IS_CPU(this->deviceInfo.schedule)) {
+        UNI_WARNING_LOG("thread pool is only supported on CPU.\n");
+        enable = false;
+    }
+    this->threadPoolEnabled = enable;
+    this->threadPools.clear();
+}
+
+ThreadPool *CNN::get_thread_pool(U32 index, int threadNum)
+{
+    if (!this->threadPoolEnabled) {
+        return nullptr;
+    }
+    if (this->threadPools.size() <= index) {
+        this->threadPools.resize(index + 1);
+    }
+    auto &pool = this->threadPools[index];
+    if (pool == nullptr || pool->size() != threadNum) {
+        // the same cpus as OpenMP threads of the model
+        std::vector<int> cpus = this->get_model_cpus();
+        if ((int)cpus.size() < threadNum) {
+            cpus.clear();
+        }
+        pool = std::shared_ptr<ThreadPool>(new ThreadPool(threadNum, cpus));
+    }
+    return pool.get();
+}
+
+std::vector<int> CNN::get_model_cpus()
+{
+    std::vector<int> cpus;
+    for (int i = 0; i < this->deviceInfo.cpuNum; i++) {
+        if (this->deviceInfo.numaNode >= 0) {
+            if (this->deviceInfo.numaNodes[i] == this->deviceInfo.numaNode) {
+                cpus.push_back(i);
+            }
+        } else if (this->deviceInfo.archs[i] == this->deviceInfo.schedule) {
+            cpus.push_back(i);
+        }
+    }
+    return cpus;
+}
+
+void CNN::tune_operator_threads()
+{
+    if (!IS_CPU(this->deviceInfo.schedule) || this->dynamicOutputSize) {
+        return;
+    }
+    int modelThreadNum = OMP_NUM_THREADS;
+    for (auto &op : this->ops) {
+        OperatorType type = op->get_type();
+        if (type != OT_Conv && type != OT_Deconvolution && type != OT_FC && type != OT_MatMul) {
+            continue;
+        }
+        std::string name = op->get_name() + "_threads";
+        I32 threadNum = 0;
+        if (!this->algorithmMap->getAlgorithmInfoFromMap(name, &threadNum, 1)) {
+            if (!this->algorithmTuning || modelThreadNum <= 1) {
+                continue;
+            }
+            // small layers often run faster on fewer threads because of the fork-join overhead.
+            double bestTime = -1;
+            for (int num = 1;; num = UNI_MIN(num * 2, modelThreadNum)) {
+                ThreadNumScope threads(num);
+                double time = -1;
+                for (int loop = 0; loop < 4; loop++) {
+                    double start = ut_time_ms();
+                    op->run();
+                    double end = ut_time_ms();
+                    if (loop > 0 && (time < 0 || end - start < time)) {
+                        time = end - start;
+                    }
+                }
+                if (bestTime < 0 || time < bestTime) {
+                    bestTime = time;
+                    threadNum = num;
+                }
+                if (num == modelThreadNum) {
+                    break;
+                }
+            }
+            UNI_DEBUG_LOG("    op name:%s runs fastest on %d threads, %f ms.\n",
+                op->get_name().c_str(), threadNum, bestTime);
+            this->algorithmMap->setAlgorithmInfoToMap(name, &threadNum, 1);
+        }
+        op->set_thread_num(threadNum);
+    }
+}
+
+void CNN::set_inter_op_threads(U32 threadNum)
+{
+    if (threadNum > 1 && !IS_CPU(this->deviceInfo.schedule)) {
+        UNI_WARNING_LOG("inter operator parallel is only supported on CPU.\n");
+        threadNum = 1;
+    }
+    this->interOpThreadNum = UNI_MAX(threadNum, 1);
+    this->graphNeedBuild = true;
+    if (this->interOpThreadNum > 1) {
+        if (this->graphExecutor == nullptr ||
+            this->graphExecutor->get_num_threads() != this->interOpThreadNum) {
+            this->graphExecutor =
+                std::shared_ptr<GraphExecutor>(new GraphExecutor(this->interOpThreadNum));
+        }
+    } else {
+        this->graphExecutor = nullptr;
+        for (auto &op : this->ops) {
+            op->set_tmp_memory(this->tmpTensor);
+        }
+    }
+}
+
+bool CNN::has_control_flow()
+{
+    for (auto &op : this->ops) {
+        if (op->get_type() == OT_Repeat || op->get_type() == OT_Jump) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Build operator dependencies in sequential order. Besides data dependencies, tensors that
+// share one reuse slot or overlap in arena (or alias their input, slot -3) introduce
+// write-after-read and write-after-write dependencies, so the memory plan stays valid.
+bool CNN::build_dependency_graph(std::vector<std::vector<U32>> *successors)
+{
+    if (this->has_control_flow()) {
+        UNI_WARNING_LOG("model contains control flow operator, use sequential run.\n");
+        return false;
+    }
+    std::map<std::string, std::string> tensorMemory;
+    // arena range of memory
+    std::map<std::string, std::pair<U32, U32>> arenaRange;
+    auto slot_memory = [&](std::string name, I32 slot) {
+        U32 offset, size;
+        std::string memory = "#" + std::to_string(slot);
+        if (this->memoryTracker.getArenaRange(name, &offset, &size)) {
+            memory = "@" + name;
+            arenaRange[memory] = std::make_pair(offset, offset + size);
+        }
+        return memory;
+    };
+    std::map<std::string, I32> lastWriter;
+    std::map<std::string, std::vector<I32>> lastReaders;
+    std::vector<std::set<U32>> edges(this->ops.size());
+    auto add_edge = [&](I32 from, U32 to) {
+        if (from >= 0 && (U32)from != to) {
+            edges[from].insert(to);
+        }
+    };
+    for (U32 i = 0; i < this->ops.size(); i++) {
+        std::string opName = this->ops[i]->get_name();
+        std::vector<std::string> &inputNames = this->operatorTensorMap[opName][0];
+        std::vector<std::string> &outputNames = this->operatorTensorMap[opName][1];
+        std::vector<I32> &slots = this->ops[i]->get_tensor_positions();
+        std::vector<std::string> reads, writes;
+        for (U32 j = 0; j < inputNames.size(); j++) {
+            if (tensorMemory.find(inputNames[j]) == tensorMemory.end()) {
+                if (this->inputTensors.find(inputNames[j]) != this->inputTensors.end() &&
+                    slots[j] >= 0) {
+                    tensorMemory[inputNames[j]] = slot_memory(inputNames[j], slots[j]);
+                } else {
+                    tensorMemory[inputNames[j]] = inputNames[j];
+                }
+            }
+            reads.push_back(tensorMemory[inputNames[j]]);
+        }
+        for (U32 j = 0; j < outputNames.size(); j++) {
+            I32 slot = slots[inputNames.size() + j];
+            if (slot >= 0) {
+                tensorMemory[outputNames[j]] = slot_memory(outputNames[j], slot);
+            } else if (slot == -3) {
+                tensorMemory[outputNames[j]] = reads[0];
+            } else {
+                tensorMemory[outputNames[j]] = outputNames[j];
+            }
+            writes.push_back(tensorMemory[outputNames[j]]);
+        }
+        for (auto &memory : reads) {
+            if (lastWriter.find(memory) != lastWriter.end()) {
+                add_edge(lastWriter[memory], i);
+            }
+        }
+        for (auto &memory : writes) {
+            if (lastWriter.find(memory) != lastWriter.end()) {
+                add_edge(lastWriter[memory], i);
+            }
+            for (I32 reader : lastReaders[memory]) {
+                add_edge(reader, i);
+            }
+            if (arenaRange.find(memory) != arenaRange.end()) {
+                auto range = arenaRange[memory];
+                for (auto &iter : arenaRange) {
+                    if (iter.first == memory || iter.second.second <= range.first ||
+                        range.second <= iter.second.first) {
+                        continue;
+                    }
+                    if (lastWriter.find(iter.first) != lastWriter.end()) {
+                        add_edge(lastWriter[iter.first], i);
+                    }
+                    for (I32 reader : lastReaders[iter.first]) {
+                        add_edge(reader, i);
+                    }
+                }
+            }
+            lastWriter[memory] = i;
+            lastReaders[memory].clear();
+        }
+        for (auto &memory : reads) {
+            lastReaders[memory].push_back(i);
+        }
+    }
+    successors->resize(this->ops.size());
+    for (U32 i = 0; i < edges.size(); i++) {
+        (*successors)[i] = std::vector<U32>(edges[i].begin(), edges[i].end());
+    }
+    return true;
+}
+
+bool CNN::prepare_graph_executor()
+{
+    if (this->graphExecutor == nullptr || this->dynamicOutputSize) {
+        return false;
+    }
+    // workers of a model bound to a NUMA node run on the cpus of the node
+    std::vector<int> cpus;
+    if (this->deviceInfo.numaNode >= 0) {
+        cpus = this->get_model_cpus();
+    }
+    if (this->graphExecutor->get_cpus() != cpus) {
+        this->graphExecutor =
+            std::shared_ptr<GraphExecutor>(new GraphExecutor(this->interOpThreadNum, cpus));
+        this->graphNeedBuild = true;
+    }
+    if (this->graphNeedBuild) {
+        std::vector<std::vector<U32>> successors;
+        this->graphParallel = this->build_dependency_graph(&successors);
+        if (this->graphParallel) {
+            this->graphExecutor->build(this->ops.size(), successors);
+        }
+        this->graphNeedBuild = false;
+    }
+    if (this->graphParallel) {
+        this->graphExecutor->set_tmp_memory(this->tmpTensor);
+    }
+    return this->graphParallel;
+}
+
+EE CNN::init_kv_cache(
+    std::vector<std::string> pastNames, std::vector<std::string> presentNames, U32 maxLength)
+{
+    this->kvCache.clear();
+    this->kvCacheAlias.clear();
+    if (!IS_CPU(this->deviceInfo.schedule)) {
+        UNI_WARNING_LOG("kv cache is only supported on CPU.\n");
+        return NOT_SUPPORTED;
+    }
+    if (pastNames.size() == 0 || pastNames.size() != presentNames.size() || maxLength == 0) {
+        UNI_WARNING_LOG("kv cache needs pairs of past input and present output(%d vs %d), and "
+                        "max length(%u).\n",
+            (int)pastNames.size(), (int)presentNames.size(), maxLength);
+        return NOT_MATCH;
+    }
+    for (auto &op : this->ops) {
+        if (op->get_type() == OT_Concat) {
+            dynamic_cast<Concat *>(op.get())->set_kv_capacity(0);
+        } else if (op->get_type() == OT_ScaledDotProductAttention) {
+            dynamic_cast<ScaledDotProductAttention *>(op.get())->set_kv_capacity(0);
+        }
+    }
+    this->kvCache.set_max_length(maxLength);
+    U32 tokens = 0;
+    // the concat that appends to past of every present, and the outer size of every present
+    std::map<std::string, std::string> concats;
+    std::vector<U32> outers;
+    std::vector<std::pair<int, TensorDesc>> layouts;
+    for (U32 i = 0; i < pastNames.size(); i++) {
+        std::string past = pastNames[i];
+        std::string present = presentNames[i];
+        if (this->inputTensors.find(past) == this->inputTensors.end() ||
+            this->tensorMap.find(present) == this->tensorMap.end()) {
+            UNI_WARNING_LOG("can not find kv cache input:%s or output:%s.\n", past.c_str(),
+                present.c_str());
+            this->kvCache.clear();
+            return NOT_MATCH;
+        }
+        TensorDesc pastDesc = this->tensorMap[past]->get_desc();
+        TensorDesc presentDesc = this->tensorMap[present]->get_desc();
+        int axis = KVCache::search_axis(pastDesc, presentDesc);
+        U32 cur = (axis >= 0) ? presentDesc.dims[axis] - pastDesc.dims[axis] : 0;
+        if (axis < 0 || presentDesc.df == DF_NCHWC8 || (i > 0 && cur != tokens)) {
+            UNI_WARNING_LOG("can not find sequence axis of kv cache input:%s %s and output:%s %s, "
+                            "model should be prepared with past shorter than present.\n",
+                past.c_str(), tensorDesc2Str(pastDesc).c_str(), present.c_str(),
+                tensorDesc2Str(presentDesc).c_str());
+            this->kvCache.clear();
+            return NOT_MATCH;
+        }
+        tokens = cur;
+        layouts.push_back(std::make_pair(axis, presentDesc));
+        U32 outer = 1;
+        for (U32 j = axis + 1; j < presentDesc.nDims; j++) {
+            outer *= presentDesc.dims[j];
+        }
+        outers.push_back(outer);
+        for (auto &opName : this->sortedOps) {
+            std::vector<std::vector<std::string>> &names = this->operatorTensorMap[opName];
+            if (names[1].size() == 1 && names[1][0] == present) {
+                if (this->operatorMap[opName]->get_type() == OT_Concat && names[0].size() > 0 &&
+                    names[0][0] == past) {
+                    concats[present] = opName;
+                }
+                break;
+            }
+        }
+    }
+    // past is the head of present when dimensions outside of sequence axis are all 1. Otherwise
+    // present keeps maxLength tokens in every slice if only attention reads it, or past and
+    // present use two buffers.
+    std::set<std::string> strided;
+    for (U32 i = 0; i < presentNames.size(); i++) {
+        if (outers[i] > 1 && concats.find(presentNames[i]) != concats.end()) {
+            strided.insert(presentNames[i]);
+        }
+    }
+    std::vector<std::string> attentions = this->search_strided_kv_cache(
+        pastNames, presentNames, concats, &strided);
+    for (U32 i = 0; i < pastNames.size(); i++) {
+        std::string present = presentNames[i];
+        bool isStrided = strided.find(present) != strided.end();
+        bool inPlace = concats.find(present) != concats.end() && (outers[i] == 1 || isStrided);
+        if (isStrided) {
+            dynamic_cast<Concat *>(this->operatorMap[concats[present]].get())
+                ->set_kv_capacity(maxLength);
+        }
+        CHECK_STATUS(this->kvCache.add(
+            pastNames[i], present, layouts[i].second, layouts[i].first, inPlace, isStrided));
+    }
+    for (auto &opName : attentions) {
+        dynamic_cast<ScaledDotProductAttention *>(this->operatorMap[opName].get())
+            ->set_kv_capacity(maxLength);
+    }
+    this->plan_kv_cache(tokens);
+    UNI_DEBUG_LOG("%s\n", this->kvCache.string().c_str());
+    return SUCCESS;
+}
+
+// keep the presents in strided that are only appended by a two input concat and only read as key
+// or value by attentions reading strided key and value both, and return those attentions.
+std::vector<std::string> CNN::search_strided_kv_cache(const std::vector<std::string> &pastNames,
+    const std::vector<std::string> &presentNames,
+    std::map<std::string, std::string> &concats,
+    std::set<std::string> *strided)
+{
+    std::map<std::string, std::string> pasts;
+    for (U32 i = 0; i < presentNames.size(); i++) {
+        pasts[presentNames[i]] = pastNames[i];
+    }
+    std::map<std::string, std::vector<std::pair<std::string, U32>>> readers;
+    for (auto &opName : this->sortedOps) {
+        std::vector<std::string> &inputs = this->operatorTensorMap[opName][0];
+        for (U32 i = 0; i < inputs.size(); i++) {
+            readers[inputs[i]].push_back(std::make_pair(opName, i));
+        }
+    }
+    for (auto iter = strided->begin(); iter != strided->end();) {
+        const std::string &present = *iter;
+        std::string concat = concats[present];
+        std::vector<std::string> &inputs = this->operatorTensorMap[concat][0];
+        bool valid = inputs.size() == 2 && readers[pasts[present]].size() == 1 &&
+            readers[present].size() > 0 &&
+            this->tensorMap[inputs[1]]->get_desc().df != DF_NCHWC8;
+        for (auto &reader : readers[present]) {
+            valid = valid &&
+                this->operatorMap[reader.first]->get_type() == OT_ScaledDotProductAttention &&
+                (reader.second == 1 || reader.second == 2);
+        }
+        if (valid) {
+            iter++;
+        } else {
+            iter = strided->erase(iter);
+        }
+    }
+    std::vector<std::string> attentions;
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        attentions.clear();
+        for (auto &opName : this->sortedOps) {
+            if (this->operatorMap[opName]->get_type() != OT_ScaledDotProductAttention) {
+                continue;
+            }
+            std::vector<std::string> &inputs = this->operatorTensorMap[opName][0];
+            bool k = inputs.size() > 1 && strided->find(inputs[1]) != strided->end();
+            bool v = inputs.size() > 2 && strided->find(inputs[2]) != strided->end();
+            if (k && v) {
+                attentions.push_back(opName);
+            } else if (k || v) {
+                strided->erase(inputs[k ? 1 : 2]);
+                changed = true;
+            }
+        }
+    }
+    return attentions;
+}
+
+// plan memory for a step of tokens new tokens at the end of kv cache, so that shorter steps
+// only need to propagate shapes.
+void CNN::plan_kv_cache(U32 tokens)
+{
+    U32 maxLength = this->kvCache.get_max_length();
+    U32 pastLength = (maxLength > tokens) ? maxLength - tokens : 0;
+    this->replan(this->kvCache.get_past_desc(this->tensorMap, pastLength));
+    this->kvCacheTokens = tokens;
+    this->kvCacheAlias.clear();
+    for (auto &opName : this->sortedOps) {
+        std::vector<I32> p = this->operatorMap[opName]->get_tensor_positions();
+        U32 oIdx = this->operatorTensorMap[opName][0].size();
+        if (p.size() > oIdx && p[oIdx] == -3) {
+            this->kvCacheAlias.push_back(std::make_pair(
+                this->operatorTensorMap[opName][0][0], this->operatorTensorMap[opName][1][0]));
+        }
+    }
+    this->bind_kv_cache();
+}
+
+void CNN::bind_kv_cache()
+{
+    this->kvCache.bind(this->tensorMap);
+    // when slot is -3, tensor reuses the input tensor mem, follow the rebound one.
+    for (auto &alias : this->kvCacheAlias) {
+        this->tensorMap[alias.second]->reuse(this->tensorMap[alias.first].get());
+    }
+}
+
+// shape inference of a decoding step without memory planning, return false when the planned
+// memory can not hold this step.
+bool CNN::infer_step_size()
+{
+    bool fit = true;
+    for (auto &op : this->ops) {
+        std::vector<Tensor> inputs = op->get_input_tensors();
+        std::vector<Tensor> outputs = op->get_output_tensors();
+        std::vector<Tensor *> in(inputs.size()), out(outputs.size());
+        for (U32 i = 0; i < inputs.size(); i++) {
+            in[i] = &inputs[i];
+        }
+        for (U32 i = 0; i < outputs.size(); i++) {
+            out[i] = &outputs[i];
+        }
+        CHECK_STATUS(op->infer_output_tensors_size(in, out));
+        for (U32 i = 0; i < outputs.size(); i++) {
+            U32 capacity;
+            outputs[i].capacity(&capacity);
+            if (outputs[i].bytes() > capacity) {
+                fit = false;
+            }
+        }
+        if (op->infer_tmp_memory_size() > this->tmpTensor.bytes()) {
+            fit = false;
+        }
+    }
+    return fit;
+}
+
+EE CNN::run_step(std::map<std::string, TensorDesc> inputDescMap,
+    std::map<std::string, std::shared_ptr<U8>> modelTensorsInput)
+{
+    if (this->kvCache.empty()) {
+        UNI_WARNING_LOG("kv cache is not initialized, please call init_kv_cache first.\n");
+        return NOT_SUPPORTED;
+    }
+    std::map<std::string, TensorDesc> pastDescs = this->kvCache.get_past_desc(this->tensorMap);
+    inputDescMap.insert(pastDescs.begin(), pastDescs.end());
+    this->set_input_desc(inputDescMap);
+    bool fit = this->infer_step_size();
+    U32 length = this->kvCache.get_present_length(this->tensorMap);
+    if (length <= this->kvCache.get_length() || length > this->kvCache.get_max_length()) {
+        UNI_WARNING_LOG("kv cache can not hold %u tokens(length:%u, max length:%u).\n", length,
+            this->kvCache.get_length(), this->kvCache.get_max_length());
+        return NOT_SUPPORTED;
+    }
+    if (!fit) {
+        UNI_DEBUG_LOG("step of %u tokens exceeds the planned %u tokens, plan again.\n",
+            length - this->kvCache.get_length(), this->kvCacheTokens);
+        this->plan_kv_cache(length - this->kvCache.get_length());
+        this->set_input_desc(inputDescMap);
+        this->infer_step_size();
+    }
+    this->bind_kv_cache();
+    this->set_input_by_assign(modelTensorsInput);
+    this->run();
+    // present keeps its buffer to be read until next step
+    this->kvCache.advance(length);
+    return SUCCESS;
+}
+
+void CNN::reset_kv_cache()
+{
+    this->kvCache.reset();
+    this->bind_kv_cache();
+}
+
+U32 CNN::get_kv_cache_length()
+{
+    return this->kvCache.get_length();
 }
 #endif
 
@@ -298,6 +940,305 @@ void CNN::initialize_ops(const ModelSpec *ms)
     UNI_DEBUG_LOG("Initialize inference end.\n");
 }
 
+void CNN::transform_filter()
+{
+    std::shared_ptr<WeightCache> weightCache;
+    std::map<std::string, U64> keys;
+    std::string prefix;
+#ifndef _USE_LITE
+    std::string path = this->weightCachePath;
+    if (this->weightShare) {
+        path = WeightCache::share_directory();
+    }
+    if (path != "" && IS_CPU(this->deviceInfo.schedule)) {
+        // the model key covers every cached operator, so a changed model gets another file.
+        U64 modelKey = 14695981039346656037ull;
+        for (auto &op : this->ops) {
+            auto weightOpPtr = dynamic_cast<WeightOperator *>(op.get());
+            if (!op->is_weight() || !weightOpPtr->is_weight_cacheable()) {
+                continue;
+            }
+            U64 key = WeightCache::operator_key(weightOpPtr, this->deviceInfo.schedule, this->dt,
+                this->algorithmMap->getAlgorithmInfoString(op->get_name()));
+            keys[op->get_name()] = key;
+            modelKey = WeightCache::hash(modelKey, &key, sizeof(key));
+        }
+        prefix = path + "/" + (this->weightShare ? "bolt_weightShare_" : "weightCache_") +
+            this->algorithmMap->processName(this->get_name()) + "_" +
+            std::to_string(this->deviceInfo.schedule) + "_" + std::to_string(this->dt) + "_";
+        weightCache = std::shared_ptr<WeightCache>(
+            new WeightCache(WeightCache::file_name(prefix, modelKey)));
+        weightCache->load();
+    }
+#endif
+    std::vector<WeightOperator *> pending;
+    for (auto &op : this->ops) {
+        if (!op->is_weight()) {
+            continue;
+        }
+        auto weightOpPtr = dynamic_cast<WeightOperator *>(op.get());
+        if (keys.find(op->get_name()) != keys.end()) {
+            std::vector<Tensor> tensors;
+            if (weightCache->find(op->get_name(), keys[op->get_name()], &tensors)) {
+                UNI_DEBUG_LOG("    op name:%s type:%s use cached weight.\n", op->get_name().c_str(),
+                    OperatorTypeName()[op->get_type()]);
+                weightOpPtr->set_weight_tensors(tensors);
+                continue;
+            }
+        }
+        pending.push_back(weightOpPtr);
+    }
+    this->transform_weight_operators(pending);
+    if (weightCache != nullptr && weightCache->is_dirty()) {
+        // processes transform weights at the same time, the lock only orders the writers. When
+        // another process has written this model meanwhile, its file is mapped instead of writing
+        // it again, so that the host keeps one copy.
+        weightCache->lock();
+        std::shared_ptr<WeightCache> latest(new WeightCache(weightCache->get_file()));
+        if (!latest->load() || !latest->contains(keys)) {
+            for (auto weightOpPtr : pending) {
+                std::string name = weightOpPtr->get_name();
+                if (keys.find(name) != keys.end()) {
+                    weightCache->insert(name, keys[name], weightOpPtr->get_weight_tensors());
+                }
+            }
+            latest = nullptr;
+            if (weightCache->save() == SUCCESS && weightCache->load()) {
+                latest = weightCache;
+                if (this->weightShare) {
+                    weightCache->remove_stale(prefix);
+                }
+            }
+        }
+        // transformed weights are replaced by the mapped ones, so that this process shares the
+        // pages with others too.
+        for (auto &iter : keys) {
+            std::vector<Tensor> tensors;
+            if (latest != nullptr && latest->find(iter.first, iter.second, &tensors)) {
+                auto weightOpPtr =
+                    dynamic_cast<WeightOperator *>(this->operatorMap[iter.first].get());
+                weightOpPtr->set_weight_tensors(tensors);
+            }
+        }
+        weightCache->unlock();
+    }
+    this->numaWeights = std::shared_ptr<NumaWeights>(new NumaWeights());
+    this->weightNumaNode = -1;
+}
+
+// transform one weight operator with tmp buffer tmp, tmp of the model is set back by caller.
+static void transform_weight_operator(WeightOperator *weightOpPtr, Tensor &tmp)
+{
+    UNI_DEBUG_LOG("    op name:%s type:%s transform weight.\n", weightOpPtr->get_name().c_str(),
+        OperatorTypeName()[weightOpPtr->get_type()]);
+    weightOpPtr->set_tmp_memory(tmp);
+    CHECK_STATUS(weightOpPtr->transform_filter());
+}
+
+void CNN::transform_weight_operators(std::vector<WeightOperator *> &weightOps)
+{
+    int threadNum = UNI_MIN(OMP_NUM_THREADS, (int)weightOps.size());
+    if (!IS_CPU(this->deviceInfo.schedule) || threadNum <= 1) {
+        for (auto weightOpPtr : weightOps) {
+            transform_weight_operator(weightOpPtr, this->tmpTensor);
+        }
+        return;
+    }
+    // operators are independent, each worker transforms whole operators with its own tmp buffer
+    // on one thread, this is faster than transforming operators one by one on all threads.
+    std::atomic<U32> next(0);
+    TensorDesc tmpDesc = this->tmpTensor.get_desc();
+    auto worker = [&weightOps, &next, tmpDesc]() {
+        ThreadNumScope threads(1);
+        Tensor tmp = Tensor::alloc_sized<CPUMem>(tmpDesc);
+        for (U32 i = next++; i < weightOps.size(); i = next++) {
+            transform_weight_operator(weightOps[i], tmp);
+        }
+    };
+    std::vector<std::thread> workers;
+    for (int i = 1; i < threadNum; i++) {
+        workers.push_back(std::thread(worker));
+    }
+    worker();
+    for (auto &thread : workers) {
+        thread.join();
+    }
+    for (auto weightOpPtr : weightOps) {
+        weightOpPtr->set_tmp_memory(this->tmpTensor);
+    }
+}
+
+bool CNN::use_lazy_weight()
+{
+    if (!this->lazyWeight) {
+        return false;
+    }
+    bool ret = true;
+    if (this->weightCachePath != "" || this->weightShare) {
+        UNI_WARNING_LOG("lazy weight is disabled by weight cache and weight share.\n");
+        ret = false;
+    }
+    if (this->deviceInfo.numaNode >= 0) {
+        UNI_WARNING_LOG("lazy weight is disabled by NUMA binding.\n");
+        ret = false;
+    }
+    if (this->algorithmTuning) {
+        UNI_WARNING_LOG("lazy weight is disabled by algorithm tuning.\n");
+        ret = false;
+    }
+    return ret;
+}
+
+void CNN::transform_filter_lazy()
+{
+    this->numaWeights = std::shared_ptr<NumaWeights>(new NumaWeights());
+    this->weightNumaNode = -1;
+    this->lazyWeights = std::shared_ptr<LazyWeights>(new LazyWeights());
+    // the thread only uses operators and the state that outlives it, copies and clones of the
+    // model join it before they touch the operators.
+    LazyWeights *state = this->lazyWeights.get();
+    std::vector<std::shared_ptr<Operator>> ops = this->ops;
+    TensorDesc tmpDesc = this->tmpTensor.get_desc();
+    state->done = std::vector<bool>(ops.size(), false);
+    state->thread = std::thread([state, ops, tmpDesc]() {
+        Tensor tmp = Tensor::alloc_sized<CPUMem>(tmpDesc);
+        for (U32 i = 0; i < ops.size(); i++) {
+            if (!ops[i]->is_weight()) {
+                continue;
+            }
+            transform_weight_operator(dynamic_cast<WeightOperator *>(ops[i].get()), tmp);
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->done[i] = true;
+            state->condition.notify_all();
+        }
+    });
+}
+
+void CNN::wait_weight(U32 opIndex, Tensor &tmp)
+{
+    auto state = this->lazyWeights;
+    auto op = this->ops[opIndex];
+    if (state == nullptr || !op->is_weight()) {
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->condition.wait(lock, [&state, opIndex]() { return state->done[opIndex]; });
+    }
+    // transformed weight may need a larger tmp buffer than the original one.
+    U32 len = op->infer_tmp_memory_size();
+    if (len > tmp.bytes()) {
+        tmp.resize(tensor1d(DT_U8, len));
+        tmp.alloc();
+    }
+}
+
+void CNN::finish_lazy_weight()
+{
+    if (this->lazyWeights == nullptr) {
+        return;
+    }
+    if (this->lazyWeights->thread.joinable()) {
+        this->lazyWeights->thread.join();
+    }
+    for (auto &op : this->ops) {
+        if (op->is_weight()) {
+            U32 len = op->infer_tmp_memory_size();
+            if (len > this->tmpTensor.bytes()) {
+                this->tmpTensor.resize(tensor1d(DT_U8, len));
+                this->tmpTensor.alloc();
+            }
+            op->set_tmp_memory(this->tmpTensor);
+        }
+    }
+    this->lazyWeights = nullptr;
+}
+
+static void bind_tensor_to_numa_node(Tensor &tensor, int node)
+{
+    if (tensor.get_mem_type() != CPUMem) {
+        return;
+    }
+    U32 bytes = 0;
+    tensor.capacity(&bytes);
+    numa_bind_memory(((CpuMemory *)tensor.get_memory())->get_ptr(), bytes, node);
+}
+
+void CNN::replicate_weights(int node)
+{
+    if (this->numaWeights == nullptr || this->weightNumaNode == node) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(this->numaWeights->mutex);
+    auto &replicas = this->numaWeights->replicas;
+    bool found = (replicas.find(node) != replicas.end());
+    // weights that are not placed are moved to the first node, clones on other nodes copy the
+    // weights that can be replaced, others stay where they are.
+    bool copy = !found && !(this->weightNumaNode == -1 && replicas.empty());
+    auto &weights = replicas[node];
+    for (auto &op : this->ops) {
+        if (!op->is_weight()) {
+            continue;
+        }
+        auto weightOpPtr = dynamic_cast<WeightOperator *>(op.get());
+        std::string name = op->get_name();
+        bool replaceable = weightOpPtr->is_weight_cacheable();
+        if (found) {
+            if (replaceable && weights.find(name) != weights.end()) {
+                weightOpPtr->set_weight_tensors(weights[name]);
+            }
+            continue;
+        }
+        if (copy && !replaceable) {
+            continue;
+        }
+        std::vector<Tensor> tensors = weightOpPtr->get_weight_tensors();
+        for (auto &tensor : tensors) {
+            if (copy && tensor.get_mem_type() == CPUMem) {
+                U32 bytes = 0;
+                tensor.capacity(&bytes);
+                Tensor replica = Tensor::alloc_sized<CPUMem>(tensor1d(DT_U8, bytes));
+                UNI_MEMCPY(((CpuMemory *)replica.get_memory())->get_ptr(),
+                    ((CpuMemory *)tensor.get_memory())->get_ptr(), bytes);
+                replica.resize(tensor.get_desc());
+                replica.set_scale(tensor.get_scale());
+                tensor = replica;
+            }
+            bind_tensor_to_numa_node(tensor, node);
+        }
+        if (replaceable) {
+            weightOpPtr->set_weight_tensors(tensors);
+            weights[name] = tensors;
+        }
+    }
+    this->weightNumaNode = node;
+}
+
+void CNN::bind_numa_buffers()
+{
+    int node = this->deviceInfo.numaNode;
+    if (node < 0 || !IS_CPU(this->deviceInfo.schedule)) {
+        return;
+    }
+    bind_tensor_to_numa_node(this->tmpTensor, node);
+    if (this->arenaMemory != nullptr) {
+        bind_tensor_to_numa_node(*(this->arenaMemory), node);
+    }
+    for (auto &tensor : this->storageMemory) {
+        bind_tensor_to_numa_node(*tensor, node);
+    }
+}
+
+void CNN::bind_numa_memory()
+{
+    int node = this->deviceInfo.numaNode;
+    if (node < 0 || !IS_CPU(this->deviceInfo.schedule)) {
+        return;
+    }
+    this->replicate_weights(node);
+    this->bind_numa_buffers();
+}
+
 void CNN::ready(std::map<std::string, TensorDesc> inputDescMap)
 {
     UNI_DEBUG_LOG("Inference ready...\n");
@@ -319,18 +1260,19 @@ void CNN::ready(std::map<std::string, TensorDesc> inputDescMap)
 
             this->infer_tmp_memory_size();
             this->assign_tmp_tensor();
-            // transform filter
-            for (auto &op : this->ops) {
-                if (op->is_weight()) {
-                    UNI_DEBUG_LOG("    op name:%s type:%s transform weight.\n",
-                        op->get_name().c_str(), OperatorTypeName()[op->get_type()]);
-                    auto weightOpPtr = dynamic_cast<WeightOperator *>(op.get());
-                    CHECK_STATUS(weightOpPtr->transform_filter());
-                }
+            if (this->use_lazy_weight()) {
+                this->tmpTensor.alloc();
+                this->assign_output_tensor();
+                this->transform_filter_lazy();
+            } else {
+                this->transform_filter();
+                this->infer_tmp_memory_size();
+                this->tmpTensor.alloc();
+                this->assign_output_tensor();
+                this->bind_numa_memory();
+                this->tune_operator_threads();
             }
-            this->infer_tmp_memory_size();
-            this->tmpTensor.alloc();
-            this->assign_output_tensor();
+            this->modelThreadNum = OMP_NUM_THREADS;
         },
         std::string("ready"), std::string("prepare"));
     UNI_DEBUG_LOG("Inference ready end.\n");
@@ -539,6 +1481,7 @@ EE CNN::infer_output_tensors_size(std::map<std::string, TensorDesc> inputDescMap
     this->infer_layout_desc();
     this->update_tensor_positions();
     this->update_op_tensors();
+    this->graphNeedBuild = true;
     UNI_DEBUG_LOG("Infer tensor dimension end.\n");
     return SUCCESS;
 }
@@ -546,10 +1489,23 @@ EE CNN::infer_output_tensors_size(std::map<std::string, TensorDesc> inputDescMap
 void CNN::assign_output_tensor()
 {
     this->storageMemory.clear();
-    auto storageSize = this->memoryTracker.getStorageSize();
-    for (U32 size : storageSize) {
-        auto tensor = this->allocate_tensor(size);
-        this->storageMemory.push_back(tensor);
+    this->arenaMemory = nullptr;
+    // lifetimes are operator ranges of one pass, tensors of a loop body are used again by next
+    // iteration, so models with control flow keep the slots of converter.
+    bool arena = IS_CPU(this->deviceInfo.schedule) && !this->has_control_flow();
+    if (arena) {
+        U32 arenaSize = this->memoryTracker.planArena();
+        this->arenaMemory = this->allocate_tensor(arenaSize);
+        UNI_DEBUG_LOG("    tensor memory: arena of %u tensors takes %u bytes, lower bound is %u "
+                      "bytes.\n",
+            this->memoryTracker.getArenaNumTensors(), arenaSize,
+            this->memoryTracker.getArenaLowerBound());
+    } else {
+        auto storageSize = this->memoryTracker.getStorageSize();
+        for (U32 size : storageSize) {
+            auto tensor = this->allocate_tensor(size);
+            this->storageMemory.push_back(tensor);
+        }
     }
 #ifdef _USE_GPU
     this->storageImage.clear();
@@ -583,9 +1539,10 @@ void CNN::assign_output_tensor()
                 }
                 if (needAssign) {
                     I32 slot = tensorPositions[tensorIter];
-                    if (slot >= 0) {
+                    if (slot >= 0 && arena) {
+                        this->assign_arena_memory(tensorName, tensor.get());
+                    } else if (slot >= 0) {
                         tensor->reuse(get_reuse_memory(slot, tensor.get()));
-
                     } else if (slot == -1) {
                         tensor->alloc();
 #ifdef _USE_GPU
@@ -610,6 +1567,35 @@ void CNN::assign_output_tensor()
 
 void CNN::run()
 {
+    // pools are sized by the threads that model is prepared with, the caller can ask for fewer.
+    int modelThreadNum = (this->modelThreadNum > 0) ? this->modelThreadNum : OMP_NUM_THREADS;
+    int threadNum = UNI_MIN(modelThreadNum, OMP_NUM_THREADS);
+#ifndef _USE_LITE
+    if (this->interOpThreadNum > 1 && this->prepare_graph_executor()) {
+        // concurrent operators share the threads of the model, every worker has its own pool.
+        int workerThreadNum = UNI_MAX(modelThreadNum / (int)this->interOpThreadNum, 1);
+        std::vector<ThreadPool *> pools(this->interOpThreadNum);
+        for (U32 i = 0; i < this->interOpThreadNum; i++) {
+            pools[i] = this->get_thread_pool(i, workerThreadNum);
+        }
+        threadNum = UNI_MAX(threadNum / (int)this->interOpThreadNum, 1);
+        // OpenMP teams of workers on a NUMA node are bound once, later runs only check it.
+        std::vector<int> cpus;
+        if (this->deviceInfo.numaNode >= 0) {
+            cpus = this->get_model_cpus();
+        }
+        this->graphExecutor->run(
+            [this, threadNum, &pools, &cpus](U32 opIndex, U32 workerId, Tensor &tmp) {
+                if (cpus.size() > 0) {
+                    thread_affinity_set_team(cpus.data(), cpus.size(), threadNum);
+                }
+                this->run_operator(opIndex, tmp, threadNum, pools[workerId]);
+            });
+        this->finish_lazy_weight();
+        return;
+    }
+#endif
+    ThreadPool *pool = this->get_thread_pool(0, modelThreadNum);
     for (U32 opIndex = 0; opIndex < ops.size();) {
         std::shared_ptr<Operator> op = this->ops[opIndex];
         auto opName = op->get_name();
@@ -650,16 +1636,7 @@ void CNN::run()
                 UNI_DEBUG_LOG("        input:%s %s\n", inputNames[i].c_str(), line.c_str());
             }
 #endif
-            UNI_PROFILE(
-                {
-                    op->run();
-#if defined(_USE_GPU) && defined(_PROFILE)
-                    if (IS_GPU(this->deviceInfo.schedule)) {
-                        gcl_finish(OCLContext::getInstance().handle.get());
-                    }
-#endif
-                },
-                opName, std::string(OperatorTypeName()[opType]) + std::string("::run"));
+            this->run_operator(opIndex, this->tmpTensor, threadNum, pool);
             opIndex++;
         }
 #ifdef _DEBUG
@@ -672,6 +1649,43 @@ void CNN::run()
         }
 #endif
     }
+    this->finish_lazy_weight();
+}
+
+void CNN::run_operator(U32 opIndex, Tensor &tmp, int threadNum, ThreadPool *pool)
+{
+    std::shared_ptr<Operator> op = this->ops[opIndex];
+    auto opName = op->get_name();
+    auto opType = op->get_type();
+    this->wait_weight(opIndex, tmp);
+    op->set_tmp_memory(tmp);
+    // tuned operators may run on fewer threads than the model.
+    if (op->get_thread_num() > 0 && (int)op->get_thread_num() < threadNum) {
+        threadNum = op->get_thread_num();
+    }
+    ThreadNumScope threads(threadNum);
+    ThreadPoolScope scope(pool);
+    OpProfilerEvent event;
+    bool profiling = op_profiler_begin(&event);
+    UNI_PROFILE(
+        {
+            op->run();
+#if defined(_USE_GPU) && defined(_PROFILE)
+            if (IS_GPU(this->deviceInfo.schedule)) {
+                gcl_finish(OCLContext::getInstance().handle.get());
+            }
+#endif
+        },
+        opName, std::string(OperatorTypeName()[opType]) + std::string("::run"));
+    if (profiling) {
+#ifdef _USE_GPU
+        if (IS_GPU(this->deviceInfo.schedule)) {
+            gcl_finish(OCLContext::getInstance().handle.get());
+        }
+#endif
+        op_profiler_end(
+            &event, opName.c_str(), OperatorTypeName()[opType], op->get_tensors_bytes());
+    }
 }
 
 std::shared_ptr<Tensor> CNN::allocate_tensor(U32 size)
@@ -798,7 +1812,8 @@ void CNN::infer_layout_desc()
 
 void CNN::update_op_tensors()
 {
-    for (auto &opName : this->sortedOps) {
+    for (U32 opIndex = 0; opIndex < this->sortedOps.size(); opIndex++) {
+        auto &opName = this->sortedOps[opIndex];
         auto op = this->operatorMap[opName];
         std::vector<std::string> curOpInputTensorName = this->operatorTensorMap[opName][0];
         std::vector<std::string> curOpOutputTensorName = this->operatorTensorMap[opName][1];
@@ -817,8 +1832,16 @@ void CNN::update_op_tensors()
 
         curOpInputTensorName.insert(
             curOpInputTensorName.end(), curOpOutputTensorName.begin(), curOpOutputTensorName.end());
-        memoryTracker.trackOpTensorSizes(op, curOpInputTensorName);
+        memoryTracker.trackOpTensorSizes(op, curOpInputTensorName, opIndex);
     }
+    std::vector<std::string> inputNames, outputNames;
+    for (auto &iter : this->inputTensors) {
+        inputNames.push_back(iter.first);
+    }
+    for (auto &iter : this->outputTensors) {
+        outputNames.push_back(iter.first);
+    }
+    memoryTracker.trackModelTensors(inputNames, outputNames);
     check_memory_reuse_ratio();
 }
 
@@ -872,6 +1895,18 @@ void CNN::assign_tmp_tensor()
     }
 }
 
+void CNN::assign_arena_memory(std::string name, Tensor *tensor)
+{
+    U32 offset, size;
+    if (!this->memoryTracker.getArenaRange(name, &offset, &size)) {
+        tensor->alloc();
+        return;
+    }
+    auto base = ((CpuMemory *)this->arenaMemory->get_memory())->get_shared_ptr();
+    auto mem = (CpuMemory *)tensor->get_memory();
+    mem->set_shared_ptr(std::shared_ptr<U8>(base, base.get() + offset), size);
+}
+
 Tensor *CNN::get_reuse_memory(U32 slot, Tensor *tensor)
 {
     auto mem = tensor->get_memory();
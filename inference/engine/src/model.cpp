@@ -56,6 +56,29 @@ void Model::set_runtime_device_dynamic(int threadId)
     set_cpu_dynamic(&this->deviceInfo, threadId);
 }
 
+void Model::set_numa_node(int node, int threadId)
+{
+#ifndef _USE_IOS
+    if (!IS_CPU(this->deviceInfo.schedule)) {
+        UNI_WARNING_LOG("NUMA binding is only supported on CPU.\n");
+        return;
+    }
+    if (node < 0) {
+        static int next = 0;
+        UNI_THREAD_SAFE({ node = next++ % this->deviceInfo.numaNodeNum; });
+    }
+    if (node >= this->deviceInfo.numaNodeNum) {
+        UNI_WARNING_LOG("NUMA node %d is not exist, there are %d nodes.\n", node,
+            this->deviceInfo.numaNodeNum);
+        return;
+    }
+    if (thread_affinity_set_by_numa_node(&this->deviceInfo, node, threadId) == 0) {
+        UNI_DEBUG_LOG("Inference runs on NUMA node %d.\n", node);
+        this->bind_numa_memory();
+    }
+#endif
+}
+
 Arch Model::get_runtime_device()
 {
     return this->deviceInfo.schedule;
@@ -164,5 +187,7 @@ void Model::set_device_info(AffinityPolicy affinityPolicy)
 #else
     this->deviceInfo.affinityPolicy = affinityPolicy;
     this->deviceInfo.schedule = ARM_A76;
+    this->deviceInfo.numaNodeNum = 1;
+    this->deviceInfo.numaNode = -1;
 #endif
 }
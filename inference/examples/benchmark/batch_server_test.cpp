@@ -0,0 +1,176 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include <getopt.h>
+#include <thread>
+#include "inference.hpp"
+#include "batch_server.h"
+
+char *modelPath = (char *)"";
+std::string affinityPolicyName = "CPU_AFFINITY_HIGH_PERFORMANCE";
+int maxBatch = 4;
+int requestNum = 8;
+int timeoutUs = 2000;
+
+void PrintHelp()
+{
+    printf("usage: ./batch_server_test -m <boltModelPath> -a [affinityPolicyName] -b [maxBatch] "
+           "-n [requestNum] -w [timeoutUs]\n"
+           "\nParameter description: (<> must be filled with exact value, [] is optional)\n"
+           "1. -m <boltModelPath>: Bolt model file path on disk.\n"
+           "2. -a [affinityPolicyName]: Affinity policy. default: %s.\n"
+           "3. -b [maxBatch]: the max number of requests in a batch. default: %d.\n"
+           "4. -n [requestNum]: concurrent requests. default: %d.\n"
+           "5. -w [timeoutUs]: the max time a request waits for others. default: %d.\n"
+           "Every request is run alone first, then all of them are sent to a batch server from\n"
+           "their own threads, the outputs of both runs must be the same.\n"
+           "Example:\n"
+           "    ./batch_server_test -m /local/models/resnet50_f32.bolt -b 4 -n 10\n",
+        affinityPolicyName.c_str(), maxBatch, requestNum, timeoutUs);
+}
+
+int ParseOptions(int argc, char *argv[])
+{
+    int option;
+    const char *optionstring = "m:a:b:n:w:h";
+    while ((option = getopt(argc, argv, optionstring)) != -1) {
+        switch (option) {
+            case 'm':
+                modelPath = optarg;
+                break;
+            case 'a':
+                affinityPolicyName = optarg;
+                break;
+            case 'b':
+                maxBatch = atoi(optarg);
+                break;
+            case 'n':
+                requestNum = atoi(optarg);
+                break;
+            case 'w':
+                timeoutUs = atoi(optarg);
+                break;
+            default:
+                PrintHelp();
+                return 1;
+        }
+    }
+    if (std::string(modelPath) == "" || maxBatch <= 0 || requestNum <= 0) {
+        PrintHelp();
+        return 1;
+    }
+    return 0;
+}
+
+typedef std::map<std::string, std::vector<U8>> Buffers;
+
+// different data for every request, so that outputs of mixed up requests differ.
+static Buffers create_input(std::map<std::string, TensorDesc> descs, int id)
+{
+    Buffers buffers;
+    for (auto &iter : descs) {
+        U32 length = tensorNumElements(iter.second);
+        std::vector<F32> data(length);
+        for (U32 i = 0; i < length; i++) {
+            data[i] = ((i * 13 + id * 29) % 97) / 97.0;
+        }
+        buffers[iter.first].resize(tensorNumBytes(iter.second));
+        transformFromFloat(iter.second.dt, data.data(), buffers[iter.first].data(), length);
+    }
+    return buffers;
+}
+
+static Buffers create_output(std::map<std::string, TensorDesc> descs)
+{
+    Buffers buffers;
+    for (auto &iter : descs) {
+        buffers[iter.first].resize(tensorNumBytes(iter.second));
+    }
+    return buffers;
+}
+
+static std::map<std::string, U8 *> pointers(Buffers &buffers)
+{
+    std::map<std::string, U8 *> ret;
+    for (auto &iter : buffers) {
+        ret[iter.first] = iter.second.data();
+    }
+    return ret;
+}
+
+static void check(std::map<std::string, TensorDesc> descs, Buffers &a, Buffers &b, int id)
+{
+    for (auto &iter : descs) {
+        U32 length = tensorNumElements(iter.second);
+        std::vector<F32> x(length), y(length);
+        transformToFloat(iter.second.dt, a[iter.first].data(), x.data(), length);
+        transformToFloat(iter.second.dt, b[iter.first].data(), y.data(), length);
+        F32 maxValue = 0, maxDiff = 0;
+        for (U32 i = 0; i < length; i++) {
+            maxValue = UNI_MAX(maxValue, UNI_ABS(x[i]));
+            maxDiff = UNI_MAX(maxDiff, UNI_ABS(x[i] - y[i]));
+        }
+        // batched operators may pick other kernels, results only differ in rounding.
+        F32 threshold = ((iter.second.dt == DT_F32) ? 0.0001 : 0.01) * UNI_MAX(maxValue, 1);
+        if (!(maxDiff <= threshold)) {
+            UNI_ERROR_LOG("request %d output %s differs from a single run by %f.\n", id,
+                iter.first.c_str(), maxDiff);
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    if (ParseOptions(argc, argv)) {
+        return 1;
+    }
+    auto pipeline = createPipeline(affinityPolicyName.c_str(), modelPath);
+    std::map<std::string, TensorDesc> inputDescs = pipeline->get_input_desc();
+    std::map<std::string, TensorDesc> outputDescs = pipeline->get_output_desc();
+
+    std::vector<Buffers> inputs(requestNum), singles(requestNum), batches(requestNum);
+    for (int i = 0; i < requestNum; i++) {
+        inputs[i] = create_input(inputDescs, i);
+        singles[i] = create_output(outputDescs);
+        batches[i] = create_output(outputDescs);
+        pipeline->set_input_by_copy(pointers(inputs[i]));
+        pipeline->run();
+        auto outputs = pipeline->get_output();
+        for (auto &iter : singles[i]) {
+            UNI_MEMCPY(iter.second.data(),
+                ((CpuMemory *)outputs[iter.first]->get_memory())->get_ptr(), iter.second.size());
+        }
+    }
+
+    double start = ut_time_ms();
+    {
+        BatchServer server(pipeline.get(), maxBatch, timeoutUs);
+        std::vector<std::thread> threads;
+        for (int i = 0; i < requestNum; i++) {
+            threads.push_back(std::thread([&, i]() {
+                CHECK_STATUS(server.run(pointers(inputs[i]), pointers(batches[i])));
+            }));
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+    double end = ut_time_ms();
+    for (int i = 0; i < requestNum; i++) {
+        check(outputDescs, singles[i], batches[i], i);
+    }
+    printf("%d requests, max batch %d: %.3f ms, outputs are the same as single runs.\n",
+        requestNum, maxBatch, end - start);
+    return 0;
+}
@@ -23,11 +23,12 @@ char *algorithmMapPath = NULL;
 int loopTime = 1;
 int warmUp = 10;
 int threadsNum = OMP_MAX_NUM_THREADS;
+int threadPool = 0;
 
 void PrintHelp()
 {
     printf("usage: ./benchmark -m <boltModelPath> -i [inputDataPath] -a [affinityPolicyName] -p "
-           "[algorithmMapPath] -l [loopTime] -w [warmTime] -t [threadsNum]\n"
+           "[algorithmMapPath] -l [loopTime] -w [warmTime] -t [threadsNum] -x [threadPool]\n"
            "\nParameter description: (<> must be filled with exact value, [] is optional)\n"
            "1. -m <boltModelPath>: Bolt model file path on disk.\n"
            "2. -i [inputDataPath]: Input data file path on disk.\n"
@@ -48,12 +49,14 @@ void PrintHelp()
            "5. -l [loopTime]: Loop running times. default: %d.\n"
            "6. -w [warmTime]: Warm up times. default: %d.\n"
            "7. -t [threadsNum]: Parallel threads num. default: %d.\n"
+           "8. -x [threadPool]: 1 runs parallel loops on a thread pool of the model instead of "
+           "OpenMP. default: %d.\n"
            "Example:\n"
            "    ./benchmark -m /local/models/resnet50_f16.bolt\n"
            "    ./benchmark -m /local/models/resnet50_f16.bolt -i ./input.txt\n"
            "    ./benchmark -m /local/models/resnet50_f16.bolt -i ./data/\n"
            "Note:\n    If you want to profiling network and get execution time of each layer, please rebuild Bolt with --profile option.\n",
-        affinityPolicyName.c_str(), loopTime, warmUp, threadsNum);
+        affinityPolicyName.c_str(), loopTime, warmUp, threadsNum, threadPool);
 }
 
 int ParseOptions(int argc, char *argv[])
@@ -71,7 +74,7 @@ int ParseOptions(int argc, char *argv[])
     }
 
     int option;
-    const char *optionstring = "m:i:a:p:l:w:t:";
+    const char *optionstring = "m:i:a:p:l:w:t:x:";
     while ((option = getopt(argc, argv, optionstring)) != -1) {
         switch (option) {
             case 'm':
@@ -102,6 +105,10 @@ int ParseOptions(int argc, char *argv[])
                 printf("option is -p [algorithmMapPath], value is: %s\n", optarg);
                 algorithmMapPath = optarg;
                 break;
+            case 'x':
+                printf("option is -x [threadPool], value is: %s\n", optarg);
+                threadPool = atoi(optarg);
+                break;
             default:
                 PrintHelp();
                 return 1;
@@ -198,6 +205,7 @@ int benchmark(int argc, char *argv[])
     // 1: set up the pipeline
     double timeBegin = ut_time_ms();
     auto pipeline = createPipeline(affinityPolicyName.c_str(), modelPath, algorithmMapPath);
+    pipeline->set_thread_pool(threadPool);
 #ifdef _USE_GPU
     if (std::string(affinityPolicyName) == std::string("GPU")) {
         gcl_finish(OCLContext::getInstance().handle.get());
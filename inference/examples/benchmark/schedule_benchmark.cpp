@@ -0,0 +1,206 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include <getopt.h>
+#include <pthread.h>
+#include <queue>
+#include "task_dispatcher.h"
+#include "profiling.h"
+
+int producerNum = 4;
+int workerNum = 4;
+int taskNum = 100000;
+int workLoad = 100;
+int batchSize = 4;
+
+void PrintHelp()
+{
+    printf("usage: ./schedule_benchmark -p [producerNum] -c [workerNum] -n [taskNum] -l [workLoad] "
+           "-b [batchSize]\n"
+           "\nParameter description: ([] is optional)\n"
+           "1. -p [producerNum]: threads that enqueue tasks. default: %d.\n"
+           "2. -c [workerNum]: threads that dequeue and run tasks. default: %d.\n"
+           "3. -n [taskNum]: tasks enqueued by every producer. default: %d.\n"
+           "4. -l [workLoad]: loop iterations of every task, 0 means empty task. default: %d.\n"
+           "5. -b [batchSize]: tasks taken from the shared queue at a time. default: %d.\n"
+           "Example:\n"
+           "    ./schedule_benchmark -p 8 -c 8 -n 100000 -l 0\n",
+        producerNum, workerNum, taskNum, workLoad, batchSize);
+}
+
+int ParseOptions(int argc, char *argv[])
+{
+    int option;
+    const char *optionstring = "p:c:n:l:b:h";
+    while ((option = getopt(argc, argv, optionstring)) != -1) {
+        switch (option) {
+            case 'p':
+                producerNum = atoi(optarg);
+                break;
+            case 'c':
+                workerNum = atoi(optarg);
+                break;
+            case 'n':
+                taskNum = atoi(optarg);
+                break;
+            case 'l':
+                workLoad = atoi(optarg);
+                break;
+            case 'b':
+                batchSize = atoi(optarg);
+                break;
+            default:
+                PrintHelp();
+                return 1;
+        }
+    }
+    if (producerNum <= 0 || workerNum <= 0 || taskNum <= 0) {
+        PrintHelp();
+        return 1;
+    }
+    return 0;
+}
+
+struct BenchTask {
+    int id;
+    volatile int result;
+};
+
+static void run_task(BenchTask *task)
+{
+    int sum = task->id;
+    for (int i = 0; i < workLoad; i++) {
+        sum = sum * 31 + i;
+    }
+    task->result = sum;
+}
+
+// the queue that Schedule used before: one lock and one condition variable for all threads.
+class MutexQueue {
+public:
+    MutexQueue()
+    {
+        pthread_mutex_init(&(this->lock), NULL);
+        pthread_cond_init(&(this->condition), NULL);
+        this->stop = false;
+    }
+
+    ~MutexQueue()
+    {
+        pthread_mutex_destroy(&(this->lock));
+        pthread_cond_destroy(&(this->condition));
+    }
+
+    bool push(BenchTask *task)
+    {
+        pthread_mutex_lock(&(this->lock));
+        this->queue.push(task);
+        pthread_cond_signal(&(this->condition));
+        pthread_mutex_unlock(&(this->lock));
+        return true;
+    }
+
+    bool pop(U32 workerId, BenchTask **task)
+    {
+        pthread_mutex_lock(&(this->lock));
+        while (this->queue.empty() && !this->stop) {
+            pthread_cond_wait(&(this->condition), &(this->lock));
+        }
+        bool ret = !this->queue.empty();
+        if (ret) {
+            *task = this->queue.front();
+            this->queue.pop();
+        }
+        pthread_mutex_unlock(&(this->lock));
+        return ret;
+    }
+
+    // workers leave after the queue has been drained.
+    void close()
+    {
+        pthread_mutex_lock(&(this->lock));
+        this->stop = true;
+        pthread_cond_broadcast(&(this->condition));
+        pthread_mutex_unlock(&(this->lock));
+    }
+
+private:
+    pthread_mutex_t lock;
+    pthread_cond_t condition;
+    std::queue<BenchTask *> queue;
+    bool stop;
+};
+
+template <typename Queue>
+double benchmark(Queue *queue, std::vector<BenchTask> &tasks)
+{
+    std::atomic<int> finished(0);
+    int total = producerNum * taskNum;
+    std::vector<std::thread> workers, producers;
+    double start = ut_time_ms();
+    for (int i = 0; i < workerNum; i++) {
+        workers.push_back(std::thread([&, i]() {
+            BenchTask *task;
+            while (finished.load(std::memory_order_relaxed) < total && queue->pop(i, &task)) {
+                run_task(task);
+                if (finished.fetch_add(1) + 1 == total) {
+                    queue->close();
+                }
+            }
+        }));
+    }
+    for (int i = 0; i < producerNum; i++) {
+        producers.push_back(std::thread([&, i]() {
+            for (int j = 0; j < taskNum; j++) {
+                queue->push(&tasks[i * taskNum + j]);
+            }
+        }));
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    double end = ut_time_ms();
+    if (finished.load() != total) {
+        UNI_ERROR_LOG("only %d of %d tasks have been run.\n", finished.load(), total);
+    }
+    return end - start;
+}
+
+int main(int argc, char *argv[])
+{
+    if (ParseOptions(argc, argv)) {
+        return 1;
+    }
+    int total = producerNum * taskNum;
+    std::vector<BenchTask> tasks(total);
+    for (int i = 0; i < total; i++) {
+        tasks[i].id = i;
+    }
+    printf("producers:%d workers:%d tasks:%d workload:%d batch:%d\n", producerNum, workerNum,
+        total, workLoad, batchSize);
+
+    MutexQueue mutexQueue;
+    double mutexTime = benchmark(&mutexQueue, tasks);
+    printf("mutex queue     : %10.3f ms, %12.0f tasks/s\n", mutexTime, total / mutexTime * 1000);
+
+    TaskDispatcher<BenchTask *> dispatcher(workerNum, 4096, batchSize);
+    double dispatcherTime = benchmark(&dispatcher, tasks);
+    printf("task dispatcher : %10.3f ms, %12.0f tasks/s\n", dispatcherTime,
+        total / dispatcherTime * 1000);
+    printf("speedup         : %10.3f\n", mutexTime / dispatcherTime);
+    return 0;
+}
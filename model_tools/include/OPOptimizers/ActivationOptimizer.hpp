@@ -14,62 +14,57 @@
 #ifndef _H_ACTIVATIONOPTIMIZER
 #define _H_ACTIVATIONOPTIMIZER
 
-#include "OPOptimizer.hpp"
+#include "GraphOptimizer.hpp"
 
-class ActivationOptimizer : public OPOptimizer {
-    bool optimize(ModelSpec *spec) override
+class ActivationOptimizer : public GraphOptimizer {
+    std::vector<OperatorType> anchors() override
     {
-        bool hasOptimized = false;
-        for (int i = 0; i < spec->num_operator_specs; i++) {
-            if (OT_Conv == spec->ops[i].type || OT_Eltwise == spec->ops[i].type ||
-                OT_Tdnn == spec->ops[i].type) {
-                int prevOpIndex = i;
-                std::vector<std::pair<int, int>> nextOpIndexes = searchOperatorIndexByInput(spec,
-                    spec->ops[prevOpIndex].output_tensors_name[0], prevOpIndex + 1,
-                    spec->num_operator_specs);
-                if (nextOpIndexes.size() != 1 || OT_Relu != spec->ops[nextOpIndexes[0].first].type ||
-                    spec->ops[nextOpIndexes[0].first].ps.relu_spec.neg_slope != 0) {
-                    continue;
-                }
-                int atOpIndex = nextOpIndexes[0].first;
+        return {OT_Conv, OT_Eltwise, OT_Tdnn};
+    }
 
-                // tensor relationship rewrite
-                if (spec->ops[prevOpIndex].type == OT_Conv) {
-                    switch (spec->ops[prevOpIndex].ps.conv_spec.convolution_type) {
-                        case CONVOLUTION_POINTWISE:
-                        case CONVOLUTION_DECONVOLUTION:
-                        case CONVOLUTION_DILATION: {
-                            spec->ops[prevOpIndex].ps.conv_spec.pw_activation_type = ACTIVATION_RELU;
-                            break;
-                        }
-                        case CONVOLUTION_DEPTHWISE: {
-                            spec->ops[prevOpIndex].ps.conv_spec.dw_activation_type = ACTIVATION_RELU;
-                            break;
-                        }
-                        default: {
-                            UNI_ERROR_LOG(
-                                "not support to fuse %s + activation.\n", spec->ops[i].name);
-                            break;
-                        }
-                    }
-                    spec->ops[prevOpIndex].ps.conv_spec.activation_spec.relu_spec =
-                        spec->ops[atOpIndex].ps.relu_spec;
+    bool rewrite(int prevOpIndex) override
+    {
+        std::vector<std::pair<int, int>> nextOpIndexes = consumers(prevOpIndex);
+        if (nextOpIndexes.size() != 1 || OT_Relu != spec->ops[nextOpIndexes[0].first].type ||
+            spec->ops[nextOpIndexes[0].first].ps.relu_spec.neg_slope != 0) {
+            return false;
+        }
+        int atOpIndex = nextOpIndexes[0].first;
+
+        // tensor relationship rewrite
+        if (spec->ops[prevOpIndex].type == OT_Conv) {
+            switch (spec->ops[prevOpIndex].ps.conv_spec.convolution_type) {
+                case CONVOLUTION_POINTWISE:
+                case CONVOLUTION_DECONVOLUTION:
+                case CONVOLUTION_DILATION: {
+                    spec->ops[prevOpIndex].ps.conv_spec.pw_activation_type = ACTIVATION_RELU;
+                    break;
                 }
-                if (spec->ops[prevOpIndex].type == OT_Eltwise) {
-                    spec->ops[prevOpIndex].ps.eltwise_spec.activation_type = ACTIVATION_RELU;
-                    spec->ops[prevOpIndex].ps.eltwise_spec.activation_spec.relu_spec =
-                        spec->ops[atOpIndex].ps.relu_spec;
+                case CONVOLUTION_DEPTHWISE: {
+                    spec->ops[prevOpIndex].ps.conv_spec.dw_activation_type = ACTIVATION_RELU;
+                    break;
                 }
-                if (spec->ops[prevOpIndex].type == OT_Tdnn) {
-                    spec->ops[prevOpIndex].ps.tdnn_spec.activation_type = ACTIVATION_RELU;
-                    spec->ops[prevOpIndex].ps.tdnn_spec.activation_spec.relu_spec =
-                        spec->ops[atOpIndex].ps.relu_spec;
+                default: {
+                    UNI_ERROR_LOG(
+                        "not support to fuse %s + activation.\n", spec->ops[prevOpIndex].name);
+                    break;
                 }
-                setOperatorInvalid(spec, atOpIndex, true);
-                hasOptimized = true;
             }
+            spec->ops[prevOpIndex].ps.conv_spec.activation_spec.relu_spec =
+                spec->ops[atOpIndex].ps.relu_spec;
+        }
+        if (spec->ops[prevOpIndex].type == OT_Eltwise) {
+            spec->ops[prevOpIndex].ps.eltwise_spec.activation_type = ACTIVATION_RELU;
+            spec->ops[prevOpIndex].ps.eltwise_spec.activation_spec.relu_spec =
+                spec->ops[atOpIndex].ps.relu_spec;
+        }
+        if (spec->ops[prevOpIndex].type == OT_Tdnn) {
+            spec->ops[prevOpIndex].ps.tdnn_spec.activation_type = ACTIVATION_RELU;
+            spec->ops[prevOpIndex].ps.tdnn_spec.activation_spec.relu_spec =
+                spec->ops[atOpIndex].ps.relu_spec;
         }
-        return hasOptimized;
+        removeOperator(atOpIndex, true);
+        return true;
     }
 };
 #endif
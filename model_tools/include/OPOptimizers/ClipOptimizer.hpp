@@ -14,13 +14,13 @@
 #ifndef _H_CLIPOPTIMIZER
 #define _H_CLIPOPTIMIZER
 
-#include "OPOptimizer.hpp"
+#include "GraphOptimizer.hpp"
 
-class ClipOptimizer : public OPOptimizer {
+class ClipOptimizer : public GraphOptimizer {
     bool optimize(ModelSpec *spec) override
     {
         bool hasOptimized = false;
-        hasOptimized |= clipclip(spec);
+        hasOptimized |= GraphOptimizer::optimize(spec);
         hasOptimized |= clip2relu6(spec);
         return hasOptimized;
     }
@@ -38,32 +38,29 @@ class ClipOptimizer : public OPOptimizer {
         return hasOptimized;
     }
 
-    bool clipclip(ModelSpec *spec)
+    std::vector<OperatorType> anchors() override
     {
-        bool hasOptimized = false;
-        for (int i = 0; i < spec->num_operator_specs; i++) {
-            if (spec->ops[i].type == OT_Clip) {
-                int opIndex0 = i;
-                std::vector<std::pair<int, int>> nextOpIndexes = searchOperatorIndexByInput(spec,
-                    spec->ops[opIndex0].output_tensors_name[0], opIndex0 + 1,
-                    spec->num_operator_specs);
-                if (nextOpIndexes.size() != 1 || OT_Clip != spec->ops[nextOpIndexes[0].first].type) {
-                    UNI_WARNING_LOG(
-                        "encounter unoptimize Clip layer(no Clip): %s\n", spec->ops[i].name);
-                    continue;
-                }
-		        int opIndex1 = nextOpIndexes[0].first;
+        return {OT_Clip};
+    }
 
-                spec->ops[opIndex0].ps.clip_spec.min = UNI_MAX(
-                    spec->ops[opIndex0].ps.clip_spec.min, spec->ops[opIndex1].ps.clip_spec.min);
-                spec->ops[opIndex0].ps.clip_spec.max = UNI_MIN(
-                    spec->ops[opIndex0].ps.clip_spec.max, spec->ops[opIndex1].ps.clip_spec.max);
-                setOperatorInvalid(spec, opIndex1, true);
-                hasOptimized = true;
-                i = opIndex1;
-            }
+    // clip + clip, the merged clip is visited again to fold a chain of clips.
+    bool rewrite(int opIndex0) override
+    {
+        std::vector<std::pair<int, int>> nextOpIndexes = consumers(opIndex0);
+        if (nextOpIndexes.size() != 1 || OT_Clip != spec->ops[nextOpIndexes[0].first].type) {
+            UNI_WARNING_LOG(
+                "encounter unoptimize Clip layer(no Clip): %s\n", spec->ops[opIndex0].name);
+            return false;
         }
-        return hasOptimized;
+        int opIndex1 = nextOpIndexes[0].first;
+
+        spec->ops[opIndex0].ps.clip_spec.min =
+            UNI_MAX(spec->ops[opIndex0].ps.clip_spec.min, spec->ops[opIndex1].ps.clip_spec.min);
+        spec->ops[opIndex0].ps.clip_spec.max =
+            UNI_MIN(spec->ops[opIndex0].ps.clip_spec.max, spec->ops[opIndex1].ps.clip_spec.max);
+        removeOperator(opIndex1, true);
+        push(opIndex0);
+        return true;
     }
 };
 #endif
@@ -0,0 +1,101 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#ifndef _H_GRAPHOPTIMIZER
+#define _H_GRAPHOPTIMIZER
+
+#include <deque>
+#include "OPOptimizer.hpp"
+#include "model_graph.hpp"
+
+// Pattern optimizer driven by a worklist on the indexed graph. Operators of anchor types are
+// visited in model order, rewrite may push operators whose pattern can match after it, so a
+// chain of patterns is folded in one pass without rescanning the model.
+//
+// The passes that run several times in suggest() or showed up in optimizer_benchmark use it:
+// Activation, Clip, Swish, Transpose, WeightBN, BNScale and WeightScale. Other passes keep the
+// linear helpers of OPOptimizer and their behavior, a pass is ported on its own when it shows up
+// in conversion time, the graph is rebuilt by every pass.
+class GraphOptimizer : public OPOptimizer {
+public:
+    bool optimize(ModelSpec *spec) override
+    {
+        this->spec = spec;
+        this->graph.build(spec);
+        this->anchorTypes = anchors();
+        this->worklist.clear();
+        this->queued.assign(spec->num_operator_specs, false);
+        for (int i = 0; i < spec->num_operator_specs; i++) {
+            push(i);
+        }
+        bool hasOptimized = false;
+        while (!this->worklist.empty()) {
+            int op = this->worklist.front();
+            this->worklist.pop_front();
+            this->queued[op] = false;
+            if (is_anchor(op) && rewrite(op)) {
+                hasOptimized = true;
+            }
+        }
+        return hasOptimized;
+    }
+
+protected:
+    virtual std::vector<OperatorType> anchors() = 0;
+
+    // try to rewrite the pattern rooted at operator op, true means the model is changed.
+    virtual bool rewrite(int op) = 0;
+
+    void push(int op)
+    {
+        if (op >= 0 && op < (int)this->queued.size() && !this->queued[op] && is_anchor(op)) {
+            this->queued[op] = true;
+            this->worklist.push_back(op);
+        }
+    }
+
+    std::vector<std::pair<int, int>> consumers(int op, U32 output = 0)
+    {
+        return this->graph.consumers(this->spec->ops[op].output_tensors_name[output], op + 1);
+    }
+
+    // same as OPOptimizer::setOperatorInvalid, edges are updated in graph.
+    void removeOperator(int op, bool removeEdge = false)
+    {
+        this->graph.removeOperator(op, removeEdge);
+        int weightId = this->graph.weightIndex(this->spec->ops[op].name);
+        if (weightId >= 0) {
+            setWeightOperatorInvalid(this->spec, weightId);
+        }
+    }
+
+    ModelSpec *spec = nullptr;
+    ModelGraph graph;
+
+private:
+    bool is_anchor(int op)
+    {
+        OperatorType type = this->spec->ops[op].type;
+        if (type == OT_None) {
+            return false;
+        }
+        return std::find(this->anchorTypes.begin(), this->anchorTypes.end(), type) !=
+            this->anchorTypes.end();
+    }
+
+    std::vector<OperatorType> anchorTypes;
+    std::deque<int> worklist;
+    std::vector<bool> queued;
+};
+#endif
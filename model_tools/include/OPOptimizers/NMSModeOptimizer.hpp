@@ -0,0 +1,61 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#ifndef _H_NMSMODEOPTIMIZER
+#define _H_NMSMODEOPTIMIZER
+
+#include "OPOptimizer.hpp"
+
+// set the suppression mode of NonMaxSuppression, DetectionOutput and Yolov3DetectionOutput by
+// BOLT_NMS_MODE(GREEDY, FAST or MATRIX). FAST and MATRIX change the detected boxes, so the
+// default greedy NMS of the original model is kept unless they are asked for.
+class NMSModeOptimizer : public OPOptimizer {
+    bool optimize(ModelSpec *spec) override
+    {
+        char *environmentSetting = getenv("BOLT_NMS_MODE");
+        if (environmentSetting == NULL) {
+            return false;
+        }
+        std::string setting = environmentSetting;
+        NMSMode mode;
+        if (setting == std::string("GREEDY")) {
+            mode = NMS_GREEDY;
+        } else if (setting == std::string("FAST")) {
+            mode = NMS_FAST;
+        } else if (setting == std::string("MATRIX")) {
+            mode = NMS_MATRIX;
+        } else {
+            UNI_WARNING_LOG("BOLT_NMS_MODE=%s is not supported, use GREEDY, FAST or MATRIX.\n",
+                environmentSetting);
+            return false;
+        }
+        bool hasOptimized = false;
+        for (int i = 0; i < spec->num_operator_specs; i++) {
+            if (spec->ops[i].type == OT_NonMaxSuppression) {
+                spec->ops[i].ps.non_max_suppression_spec.mode = mode;
+                hasOptimized = true;
+            }
+            if (spec->ops[i].type == OT_DetectionOutput) {
+                spec->ops[i].ps.detection_output_spec.nms_mode = mode;
+                hasOptimized = true;
+            }
+            if (spec->ops[i].type == OT_Yolov3DetectionOutput) {
+                spec->ops[i].ps.yolov3_detection_output_spec.nms_mode = mode;
+                hasOptimized = true;
+            }
+        }
+        return hasOptimized;
+    }
+};
+#endif
@@ -0,0 +1,445 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef _H_POSTOPFUSIONOPTIMIZER
+#define _H_POSTOPFUSIONOPTIMIZER
+
+#include <map>
+#include "OPOptimizer.hpp"
+
+/* fuse elementwise operators into post ops of previous conv, fc or matmul
+
+        conv   op                                 op
+          \   /                                    |
+         eltwise(+relu)     --->      conv(post ops: eltwise, relu)
+            |                                      |
+           clip                                    |
+*/
+class PostOpFusionOptimizer : public OPOptimizer {
+    bool optimize(ModelSpec *spec) override
+    {
+        bool hasOptimized = false;
+        this->shapes = inferShapes(spec);
+        for (int i = 0; i < spec->num_operator_specs; i++) {
+            PostOpsParamSpec *p = getPostOps(spec, i);
+            if (p == nullptr || isModelOutput(spec, i)) {
+                continue;
+            }
+            auto nextOpIndexes = searchOperatorIndexByInput(spec,
+                spec->ops[i].output_tensors_name[0], i + 1, spec->num_operator_specs);
+            if (nextOpIndexes.size() != 1) {
+                continue;
+            }
+            int j = nextOpIndexes[0].first;
+            std::vector<PostOpSpec> ops;
+            std::string addend;
+            if (!getPostOpSpec(spec, i, j, nextOpIndexes[0].second, &ops, &addend) ||
+                p->num + ops.size() > MAX_POST_OPS) {
+                continue;
+            }
+            if (ops[0].type == POST_OP_SCALE && ops[0].channel_wise &&
+                !appendChannelWiseScale(spec, i, j)) {
+                continue;
+            }
+            for (auto op : ops) {
+                p->ops[p->num++] = op;
+            }
+            if (addend != "") {
+                appendInput(&(spec->ops[i]), addend);
+            }
+            str_copy(spec->ops[i].output_tensors_name[0], spec->ops[j].output_tensors_name[0],
+                NAME_LEN);
+            // fused operator takes the place of consumer, so that extra inputs are ready
+            int weightId = searchWeightIndex(spec, spec->ops[j].name);
+            if (weightId >= 0) {
+                setWeightOperatorInvalid(spec, weightId);
+            }
+            OperatorSpec tmp = spec->ops[j];
+            spec->ops[j] = spec->ops[i];
+            spec->ops[i] = tmp;
+            spec->ops[i].type = OT_None;
+            hasOptimized = true;
+        }
+        return hasOptimized;
+    }
+
+    PostOpsParamSpec *getPostOps(ModelSpec *spec, int i)
+    {
+        PostOpsParamSpec *p = nullptr;
+        switch (spec->ops[i].type) {
+            case OT_Conv: {
+                ConvolutionMode mode = spec->ops[i].ps.conv_spec.convolution_type;
+                if (mode == CONVOLUTION_POINTWISE || mode == CONVOLUTION_DILATION) {
+                    p = &(spec->ops[i].ps.conv_spec.post_ops);
+                }
+                break;
+            }
+            case OT_FC: {
+                if (spec->ops[i].ps.fc_spec.num_slices == 1) {
+                    p = &(spec->ops[i].ps.fc_spec.post_ops);
+                }
+                break;
+            }
+            case OT_MatMul: {
+                p = &(spec->ops[i].ps.matmul_spec.post_ops);
+                break;
+            }
+            default:
+                break;
+        }
+        if (p != nullptr && p->num >= MAX_POST_OPS) {
+            p = nullptr;
+        }
+        return p;
+    }
+
+    bool getActivation(OperatorType type, ActivationMode *mode)
+    {
+        switch (type) {
+            case OT_Relu:
+                *mode = ACTIVATION_RELU;
+                break;
+            case OT_Relu6:
+                *mode = ACTIVATION_RELU6;
+                break;
+            case OT_Sigmoid:
+                *mode = ACTIVATION_SIGMOID;
+                break;
+            case OT_TanH:
+                *mode = ACTIVATION_TANH;
+                break;
+            case OT_Gelu:
+                *mode = ACTIVATION_GELU;
+                break;
+            case OT_HSwish:
+                *mode = ACTIVATION_H_SWISH;
+                break;
+            case OT_HSigmoid:
+                *mode = ACTIVATION_H_SIGMOID;
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+
+    // translate consumer j of operator i into post ops, addend is the other input of eltwise.
+    bool getPostOpSpec(ModelSpec *spec,
+        int i,
+        int j,
+        int inputId,
+        std::vector<PostOpSpec> *ops,
+        std::string *addend)
+    {
+        const OperatorSpec &op = spec->ops[j];
+        PostOpSpec post;
+        UNI_MEMSET(&post, 0, sizeof(PostOpSpec));
+        post.type = POST_OP_ACTIVATION;
+        if (op.num_outputs != 1) {
+            return false;
+        }
+        if (getActivation(op.type, &post.activation_type)) {
+            if (op.type == OT_Relu) {
+                post.activation_spec.relu_spec = op.ps.relu_spec;
+            }
+            ops->push_back(post);
+        } else if (op.type == OT_Clip) {
+            post.type = POST_OP_CLIP;
+            post.activation_spec.clip_spec = op.ps.clip_spec;
+            ops->push_back(post);
+        } else if (op.type == OT_Power) {
+            if (op.ps.power_spec.power != 1) {
+                return false;
+            }
+            post.type = POST_OP_SCALE;
+            post.alpha = op.ps.power_spec.scale;
+            post.beta = op.ps.power_spec.shift;
+            ops->push_back(post);
+        } else if (op.type == OT_Scale) {
+            int weightId = searchWeightIndex(spec, op.name);
+            if (op.num_inputs != 1 || weightId < 0 || spec->ws[weightId].mdt != DT_F32 ||
+                spec->ops[i].type != OT_Conv ||
+                spec->ops[i].ps.conv_spec.convolution_type != CONVOLUTION_POINTWISE) {
+                return false;
+            }
+            U32 num = spec->ops[i].ps.conv_spec.num_outputs * sizeof(F32);
+            if ((spec->ws[weightId].bytes_of_weight != 0 && spec->ws[weightId].bytes_of_weight != num) ||
+                (spec->ws[weightId].bytes_of_vec != 0 && spec->ws[weightId].bytes_of_vec != num)) {
+                return false;
+            }
+            post.type = POST_OP_SCALE;
+            post.channel_wise = 1;
+            ops->push_back(post);
+        } else if (op.type == OT_Eltwise) {
+            EltwiseParamSpec p = op.ps.eltwise_spec;
+            if (op.num_inputs != 2 || p.mode != ELTWISE_SUM) {
+                return false;
+            }
+            for (int k = 0; k < p.sum_spec.num_coeff; k++) {
+                if (p.sum_spec.coeff[k] != 1) {
+                    return false;
+                }
+            }
+            // constant addend may be broadcasted
+            std::string name = op.input_tensors_name[1 - inputId];
+            auto prev = searchOperatorIndexByOutput(spec, name, 0, j);
+            if (prev.size() > 0 && spec->ops[prev[0].first].type == OT_SharedWeight) {
+                return false;
+            }
+            // output of fused operator keeps its shape, so addend must have the same shape
+            std::string output = spec->ops[i].output_tensors_name[0];
+            if (this->shapes.count(name) == 0 || this->shapes.count(output) == 0 ||
+                this->shapes[name] != this->shapes[output]) {
+                return false;
+            }
+            post.type = POST_OP_ELTWISE_SUM;
+            ops->push_back(post);
+            if (p.activation_type != ACTIVATION_NULL) {
+                post.type = POST_OP_ACTIVATION;
+                post.activation_type = p.activation_type;
+                post.activation_spec = p.activation_spec;
+                ops->push_back(post);
+            }
+            *addend = name;
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    // shapes(dims of TensorDesc) of tensors that can be inferred from model inputs, operators that
+    // are not listed here make their outputs unknown.
+    std::map<std::string, std::vector<U32>> inferShapes(ModelSpec *spec)
+    {
+        std::map<std::string, std::vector<U32>> shapes;
+        for (int i = 0; i < spec->num_inputs; i++) {
+            TensorDesc desc = spec->input_dims[i];
+            if (desc.nDims > 0 && tensorNumElements(desc) > 0) {
+                shapes[spec->input_names[i]] = std::vector<U32>(desc.dims, desc.dims + desc.nDims);
+            }
+        }
+        for (int i = 0; i < spec->num_operator_specs; i++) {
+            const OperatorSpec &op = spec->ops[i];
+            std::vector<std::vector<U32>> in;
+            for (U32 k = 0; k < op.num_inputs && shapes.count(op.input_tensors_name[k]); k++) {
+                in.push_back(shapes[op.input_tensors_name[k]]);
+            }
+            if (op.num_outputs != 1 || in.size() == 0) {
+                continue;
+            }
+            std::vector<U32> out;
+            ActivationMode mode;
+            switch (op.type) {
+                case OT_Clip:
+                case OT_Power:
+                case OT_BatchNorm:
+                case OT_Softmax:
+                    out = in[0];
+                    break;
+                case OT_Scale:
+                    if (op.num_inputs == 1) {
+                        out = in[0];
+                    }
+                    break;
+                case OT_Eltwise:
+                    if (in.size() == op.num_inputs) {
+                        out = broadcastShape(in);
+                    }
+                    break;
+                case OT_Conv:
+                    out = convolutionShape(op.ps.conv_spec, in[0]);
+                    break;
+                case OT_Pooling:
+                    out = poolingShape(op.ps.pooling_spec, in[0]);
+                    break;
+                case OT_FC:
+                    out = fullyConnectedShape(spec, op, in[0]);
+                    break;
+                default:
+                    if (getActivation(op.type, &mode)) {
+                        out = in[0];
+                    }
+                    break;
+            }
+            if (out.size() > 0) {
+                shapes[op.output_tensors_name[0]] = out;
+            }
+        }
+        return shapes;
+    }
+
+    std::vector<U32> broadcastShape(const std::vector<std::vector<U32>> &in)
+    {
+        std::vector<U32> out;
+        for (auto &shape : in) {
+            for (U32 k = 0; k < shape.size(); k++) {
+                if (k >= out.size()) {
+                    out.push_back(shape[k]);
+                } else if (out[k] == 1) {
+                    out[k] = shape[k];
+                } else if (shape[k] != 1 && shape[k] != out[k]) {
+                    return std::vector<U32>();
+                }
+            }
+        }
+        return out;
+    }
+
+    std::vector<U32> convolutionShape(const ConvolutionParamSpec &p, const std::vector<U32> &in)
+    {
+        std::vector<U32> out;
+        if (in.size() != 4 || p.kernel_h == 0 || p.kernel_w == 0 || p.stride_h == 0 ||
+            p.stride_w == 0) {
+            return out;
+        }
+        U32 channels;
+        if (p.convolution_type == CONVOLUTION_POINTWISE ||
+            p.convolution_type == CONVOLUTION_DILATION) {
+            channels = p.num_outputs;
+        } else if (p.convolution_type == CONVOLUTION_DEPTHWISE) {
+            channels = in[2];
+        } else {
+            return out;
+        }
+        I32 h, w;
+        if (p.round_mode == ROUND_SAME_UPPER) {
+            h = (in[1] + p.stride_h - 1) / p.stride_h;
+            w = (in[0] + p.stride_w - 1) / p.stride_w;
+        } else if (p.round_mode == ROUND_SAME_LOWER) {
+            h = in[1] / p.stride_h;
+            w = in[0] / p.stride_w;
+        } else {
+            I32 kh = (p.kernel_h - 1) * p.dilatedRate_h + 1;
+            I32 kw = (p.kernel_w - 1) * p.dilatedRate_w + 1;
+            h = ((I32)(in[1] + p.pad_top + p.pad_bottom) - kh) / (I32)p.stride_h + 1;
+            w = ((I32)(in[0] + p.pad_left + p.pad_right) - kw) / (I32)p.stride_w + 1;
+        }
+        if (h > 0 && w > 0) {
+            out = {(U32)w, (U32)h, channels, in[3]};
+        }
+        return out;
+    }
+
+    std::vector<U32> poolingShape(const PoolingParamSpec &p, const std::vector<U32> &in)
+    {
+        std::vector<U32> out;
+        if (in.size() != 4) {
+            return out;
+        }
+        // global pooling
+        if (p.kernel_h == 0 && p.kernel_w == 0) {
+            out = {1, 1, in[2], in[3]};
+            return out;
+        }
+        if (p.stride_h == 0 || p.stride_w == 0) {
+            return out;
+        }
+        double h = double((I32)(in[1] + p.pad_top + p.pad_bottom) - (I32)p.kernel_h) / p.stride_h;
+        double w = double((I32)(in[0] + p.pad_left + p.pad_right) - (I32)p.kernel_w) / p.stride_w;
+        if (p.round_mode == ROUND_CEIL) {
+            h = ceil(h) + 1;
+            w = ceil(w) + 1;
+        } else if (p.round_mode == ROUND_FLOOR) {
+            h = floor(h) + 1;
+            w = floor(w) + 1;
+        } else {
+            return out;
+        }
+        if (h > 0 && w > 0) {
+            out = {(U32)w, (U32)h, in[2], in[3]};
+        }
+        return out;
+    }
+
+    // fc flattens inner dimensions of input whose product is the number of weight columns.
+    std::vector<U32> fullyConnectedShape(
+        ModelSpec *spec, const OperatorSpec &op, const std::vector<U32> &in)
+    {
+        std::vector<U32> out;
+        int weightId = searchWeightIndex(spec, op.name);
+        const FullyConnectedParamSpec &p = op.ps.fc_spec;
+        if (weightId < 0 || p.num_slices != 1 || p.num_outputs == 0 ||
+            spec->ws[weightId].mdt == DT_I4 || bytesOf(spec->ws[weightId].mdt) == 0) {
+            return out;
+        }
+        U32 k = spec->ws[weightId].bytes_of_weight / bytesOf(spec->ws[weightId].mdt) /
+            p.num_outputs;
+        U32 sum = 1;
+        for (U32 i = 0; i < in.size(); i++) {
+            sum *= in[i];
+            if (sum == k) {
+                out.push_back(p.num_outputs);
+                out.insert(out.end(), in.begin() + i + 1, in.end());
+                break;
+            }
+        }
+        return out;
+    }
+
+    // append alpha and beta of scale j after bias of convolution i.
+    bool appendChannelWiseScale(ModelSpec *spec, int i, int j)
+    {
+        int convWeightId = searchWeightIndex(spec, spec->ops[i].name);
+        int scaleWeightId = searchWeightIndex(spec, spec->ops[j].name);
+        if (convWeightId < 0 || spec->ws[convWeightId].mdt != DT_F32) {
+            return false;
+        }
+        WeightSpec &ws = spec->ws[convWeightId];
+        U32 num = spec->ops[i].ps.conv_spec.num_outputs;
+        U32 bytes = num * sizeof(F32);
+        U32 oldBytes = ws.bytes_of_vec;
+        if (oldBytes == 0) {
+            oldBytes = bytes;
+        }
+        U8 *vec = (U8 *)mt_malloc(oldBytes + 2 * bytes);
+        if (ws.bytes_of_vec == 0) {
+            UNI_MEMSET(vec, 0, oldBytes);
+        } else {
+            UNI_MEMCPY(vec, ws.vec, oldBytes);
+        }
+        F32 *alpha = (F32 *)(vec + oldBytes);
+        F32 *beta = alpha + num;
+        for (U32 k = 0; k < num; k++) {
+            alpha[k] = 1;
+            beta[k] = 0;
+        }
+        WeightSpec &scale = spec->ws[scaleWeightId];
+        if (scale.bytes_of_weight > 0) {
+            UNI_MEMCPY(alpha, scale.weight, bytes);
+        }
+        if (scale.bytes_of_vec > 0) {
+            UNI_MEMCPY(beta, scale.vec, bytes);
+        }
+        mt_free(ws.vec, spec);
+        ws.vec = vec;
+        ws.bytes_of_vec = oldBytes + 2 * bytes;
+        return true;
+    }
+
+    void appendInput(OperatorSpec *op, std::string name)
+    {
+        char **names = (char **)mt_malloc((op->num_inputs + 1) * sizeof(char *));
+        for (U32 k = 0; k < op->num_inputs; k++) {
+            names[k] = op->input_tensors_name[k];
+        }
+        names[op->num_inputs] = (char *)mt_malloc(NAME_LEN);
+        str_copy(names[op->num_inputs], name.c_str(), NAME_LEN);
+        mt_free(op->input_tensors_name);
+        op->input_tensors_name = names;
+        op->num_inputs++;
+    }
+
+private:
+    std::map<std::string, std::vector<U32>> shapes;
+};
+#endif
@@ -0,0 +1,228 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef _H_ScaledDotProductAttentionOPTIMIZER
+#define _H_ScaledDotProductAttentionOPTIMIZER
+
+#include "OPOptimizer.hpp"
+
+// MatMul(Q, K) -> [Power(scale)] -> [Eltwise sum(mask)] -> Softmax(last axis) -> MatMul(V)
+// => ScaledDotProductAttention(Q, K, V, [mask])
+class ScaledDotProductAttentionOptimizer : public OPOptimizer {
+    // the only operator that reads the output of opIndex, or -1
+    int searchOnlyConsumer(ModelSpec *spec, int opIndex)
+    {
+        if (opIndex < 0 || spec->ops[opIndex].num_outputs != 1 || isModelOutput(spec, opIndex)) {
+            return -1;
+        }
+        auto next = searchOperatorIndexByInput(
+            spec, spec->ops[opIndex].output_tensors_name[0], opIndex + 1, spec->num_operator_specs);
+        if (next.size() != 1) {
+            return -1;
+        }
+        return next[0].first;
+    }
+
+    // the operator that generates tensor name before opIndex, and is only read by opIndex
+    int searchOnlyProducer(ModelSpec *spec, int opIndex, const char *name)
+    {
+        auto prev = searchOperatorIndexByOutput(spec, name, 0, opIndex);
+        if (prev.size() != 1 || searchOnlyConsumer(spec, prev[0].first) != opIndex) {
+            return -1;
+        }
+        return prev[0].first;
+    }
+
+    bool isPlainMatMul(ModelSpec *spec, int opIndex)
+    {
+        return opIndex >= 0 && spec->ops[opIndex].type == OT_MatMul &&
+            spec->ops[opIndex].num_inputs == 2 && !spec->ops[opIndex].ps.matmul_spec.transpose_a &&
+            searchWeightIndex(spec, spec->ops[opIndex].name) < 0;
+    }
+
+    bool isPlainSum(ModelSpec *spec, int opIndex)
+    {
+        if (opIndex < 0 || spec->ops[opIndex].type != OT_Eltwise ||
+            spec->ops[opIndex].num_inputs != 2) {
+            return false;
+        }
+        EltwiseParamSpec p = spec->ops[opIndex].ps.eltwise_spec;
+        if (p.mode != ELTWISE_SUM || p.activation_type != ACTIVATION_NULL) {
+            return false;
+        }
+        for (int i = 0; i < p.sum_spec.num_coeff; i++) {
+            if (p.sum_spec.coeff[i] != 1) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool isPlainScale(ModelSpec *spec, int opIndex)
+    {
+        return opIndex >= 0 && spec->ops[opIndex].type == OT_Power &&
+            spec->ops[opIndex].num_inputs == 1 && spec->ops[opIndex].ps.power_spec.shift == 0 &&
+            spec->ops[opIndex].ps.power_spec.power == 1;
+    }
+
+    // rank of tensor name that is generated before opIndex, -1 means unknown
+    int searchRank(ModelSpec *spec, int opIndex, const char *name, int depth = 0)
+    {
+        for (int i = 0; i < spec->num_inputs; i++) {
+            if (std::string(spec->input_names[i]) == name) {
+                return spec->input_dims[i].nDims;
+            }
+        }
+        if (opIndex <= 0 || depth > 16) {
+            return -1;
+        }
+        auto prev = searchOperatorIndexByOutput(spec, name, 0, opIndex);
+        if (prev.size() == 0) {
+            return -1;
+        }
+        int k = prev[0].first;
+        OperatorSpec &op = spec->ops[k];
+        int rank = -1;
+        switch (op.type) {
+            case OT_Reshape: {
+                if (op.ps.reshape_spec.axis == 0 && op.ps.reshape_spec.num_axes == -1) {
+                    rank = op.ps.reshape_spec.num_shape;
+                }
+                break;
+            }
+            case OT_Transpose: {
+                rank = op.ps.transpose_spec.num_axes;
+                break;
+            }
+            case OT_MatMul:
+            case OT_Eltwise: {
+                // inputs are broadcast to the largest rank
+                for (U32 i = 0; i < op.num_inputs; i++) {
+                    rank = UNI_MAX(
+                        rank, searchRank(spec, k, op.input_tensors_name[i], depth + 1));
+                }
+                break;
+            }
+            case OT_Power:
+            case OT_Softmax: {
+                rank = searchRank(spec, k, op.input_tensors_name[0], depth + 1);
+                break;
+            }
+            default:
+                break;
+        }
+        return rank;
+    }
+
+    // softmax of opIndex runs along the last axis
+    bool isLastAxisSoftmax(ModelSpec *spec, int opIndex)
+    {
+        int axis = spec->ops[opIndex].ps.softmax_spec.axis;
+        if (axis < 0) {
+            return axis == -1;
+        }
+        return axis + 1 == searchRank(spec, opIndex, spec->ops[opIndex].input_tensors_name[0]);
+    }
+
+    // MatMul(Q, K) -> [Power(scale)] that generates the input name of opIndex
+    int searchScore(
+        ModelSpec *spec, int opIndex, const char *name, float *scale, std::vector<int> *fused)
+    {
+        int cur = searchOnlyProducer(spec, opIndex, name);
+        float s = 1;
+        int power = -1;
+        if (isPlainScale(spec, cur)) {
+            s = spec->ops[cur].ps.power_spec.scale;
+            power = cur;
+            cur = searchOnlyProducer(spec, cur, spec->ops[cur].input_tensors_name[0]);
+        }
+        if (!isPlainMatMul(spec, cur)) {
+            return -1;
+        }
+        *scale = s;
+        if (power >= 0) {
+            fused->push_back(power);
+        }
+        fused->push_back(cur);
+        return cur;
+    }
+
+    bool optimize(ModelSpec *spec) override
+    {
+        bool hasOptimized = false;
+        for (int i = 0; i < spec->num_operator_specs; i++) {
+            if (spec->ops[i].type != OT_Softmax || spec->ops[i].num_inputs != 1 ||
+                !isLastAxisSoftmax(spec, i)) {
+                continue;
+            }
+            int pv = searchOnlyConsumer(spec, i);
+            if (!isPlainMatMul(spec, pv) || spec->ops[pv].ps.matmul_spec.transpose_b ||
+                std::string(spec->ops[pv].input_tensors_name[0]) !=
+                    std::string(spec->ops[i].output_tensors_name[0])) {
+                continue;
+            }
+            std::vector<int> fused = {i};
+            std::string mask;
+            float scale = 1;
+            int qk = searchScore(spec, i, spec->ops[i].input_tensors_name[0], &scale, &fused);
+            int sum = searchOnlyProducer(spec, i, spec->ops[i].input_tensors_name[0]);
+            if (qk < 0 && isPlainSum(spec, sum)) {
+                fused.push_back(sum);
+                for (int j = 0; j < 2 && qk < 0; j++) {
+                    qk = searchScore(
+                        spec, sum, spec->ops[sum].input_tensors_name[j], &scale, &fused);
+                    mask = spec->ops[sum].input_tensors_name[1 - j];
+                }
+            }
+            if (qk < 0) {
+                continue;
+            }
+
+            OperatorSpec p;
+            UNI_MEMSET(&p, 0, sizeof(OperatorSpec));
+            UNI_STRCPY(p.name, spec->ops[pv].name);
+            p.type = OT_ScaledDotProductAttention;
+            p.num_inputs = mask.empty() ? 3 : 4;
+            p.input_tensors_name = (I8 **)mt_malloc(p.num_inputs * sizeof(I8 *));
+            const char *inputs[4] = {spec->ops[qk].input_tensors_name[0],
+                spec->ops[qk].input_tensors_name[1], spec->ops[pv].input_tensors_name[1],
+                mask.c_str()};
+            for (U32 j = 0; j < p.num_inputs; j++) {
+                p.input_tensors_name[j] = (I8 *)mt_malloc(NAME_LEN * sizeof(I8));
+                UNI_STRCPY(p.input_tensors_name[j], inputs[j]);
+            }
+            p.num_outputs = 1;
+            p.output_tensors_name = (I8 **)mt_malloc(p.num_outputs * sizeof(I8 *));
+            p.output_tensors_name[0] = (I8 *)mt_malloc(NAME_LEN * sizeof(I8));
+            UNI_STRCPY(p.output_tensors_name[0], spec->ops[pv].output_tensors_name[0]);
+            p.ps.sdpa_spec.scale = scale;
+            p.ps.sdpa_spec.transpose_k = spec->ops[qk].ps.matmul_spec.transpose_b;
+
+            for (U32 j = 0; j < spec->ops[pv].num_inputs; j++) {
+                mt_free(spec->ops[pv].input_tensors_name[j]);
+            }
+            mt_free(spec->ops[pv].input_tensors_name);
+            for (U32 j = 0; j < spec->ops[pv].num_outputs; j++) {
+                mt_free(spec->ops[pv].output_tensors_name[j]);
+            }
+            mt_free(spec->ops[pv].output_tensors_name);
+            spec->ops[pv] = p;
+            for (U32 j = 0; j < fused.size(); j++) {
+                setOperatorInvalid(spec, fused[j], false);
+            }
+            hasOptimized = true;
+        }
+        return hasOptimized;
+    }
+};
+#endif
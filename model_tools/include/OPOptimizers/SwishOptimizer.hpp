@@ -14,35 +14,33 @@
 #ifndef _H_SwishOPTIMIZER
 #define _H_SwishOPTIMIZER
 
-#include "OPOptimizer.hpp"
+#include "GraphOptimizer.hpp"
 
-class SwishOptimizer : public OPOptimizer {
-    bool optimize(ModelSpec *spec) override
+class SwishOptimizer : public GraphOptimizer {
+    std::vector<OperatorType> anchors() override
     {
-        bool hasOptimized = false;
-        for (int i = 0; i < spec->num_operator_specs - 1; i++) {
-            if (spec->ops[i].type == OT_Sigmoid) {
-                auto next = searchOperatorIndexByInput(
-                    spec, spec->ops[i].output_tensors_name[0], i + 1, spec->num_operator_specs);
-                if (next.size() != 1) {
-                    continue;
-                }
-                int eltId = next[0].first;
-                int inputId = next[0].second;
-                if (spec->ops[eltId].type == OT_Eltwise && spec->ops[eltId].num_inputs == 2 &&
-                    spec->ops[eltId].ps.eltwise_spec.mode == ELTWISE_PROD &&
-                    std::string(spec->ops[i].input_tensors_name[0]) ==
-                        std::string(spec->ops[eltId].input_tensors_name[1 - inputId])) {
-                    spec->ops[eltId].type = OT_Swish;
-
-                    setOperatorInvalid(spec, i);
-                    mt_free(spec->ops[eltId].input_tensors_name[inputId]);
-                    spec->ops[eltId].num_inputs = 1;
-                    hasOptimized = true;
-                }
-            }
+        return {OT_Sigmoid};
+    }
+
+    bool rewrite(int i) override
+    {
+        auto next = consumers(i);
+        if (next.size() != 1) {
+            return false;
+        }
+        int eltId = next[0].first;
+        int inputId = next[0].second;
+        if (spec->ops[eltId].type == OT_Eltwise && spec->ops[eltId].num_inputs == 2 &&
+            spec->ops[eltId].ps.eltwise_spec.mode == ELTWISE_PROD &&
+            std::string(spec->ops[i].input_tensors_name[0]) ==
+                std::string(spec->ops[eltId].input_tensors_name[1 - inputId])) {
+            spec->ops[eltId].type = OT_Swish;
+
+            removeOperator(i);
+            graph.removeInput(eltId, inputId);
+            return true;
         }
-        return hasOptimized;
+        return false;
     }
 };
 #endif
@@ -14,7 +14,7 @@
 #ifndef _H_TRANSPOSEOPTIMIZER
 #define _H_TRANSPOSEOPTIMIZER
 
-#include "OPOptimizer.hpp"
+#include "GraphOptimizer.hpp"
 #include <map>
 
 /*
@@ -22,57 +22,58 @@
 * Transpose1 + Relu + Transpose2 = Relu + Transpose2 or Relu
 * */
 
-class TransposeOptimizer : public OPOptimizer {
-    bool optimize(ModelSpec *spec) override
+class TransposeOptimizer : public GraphOptimizer {
+    std::vector<OperatorType> anchors() override
     {
-        bool hasOptimized = false;
-        std::map<OperatorType, int> activationMap = {{OT_Relu, 1}, {OT_Relu6, 1}, {OT_TanH, 1}};
-        for (int i = 0; i < spec->num_operator_specs - 1; i++) {
-            if (spec->ops[i].type == OT_Transpose && spec->ops[i].num_inputs == 1 &&
-                spec->ops[i].num_outputs == 1) {
-                std::vector<std::pair<int, int> > tmpVec = searchOperatorIndexByInput(
-                    spec, spec->ops[i].output_tensors_name[0], i + 1, spec->num_operator_specs);
-                if (tmpVec.size() != 1) {
-                    continue;
-                }
+        return {OT_Transpose};
+    }
 
-                // check activation
-                int tmpOpIndex = tmpVec[0].first;
-                if (activationMap.find(spec->ops[tmpOpIndex].type) != activationMap.end()) {
-                    tmpVec = searchOperatorIndexByInput(spec, spec->ops[tmpOpIndex].output_tensors_name[0], i + 1,spec->num_operator_specs);
-                    if (tmpVec.size() != 1) {
-                        continue;
-                    }
-                }
+    bool rewrite(int i) override
+    {
+        if (spec->ops[i].num_inputs != 1 || spec->ops[i].num_outputs != 1) {
+            return false;
+        }
+        std::vector<std::pair<int, int>> tmpVec = consumers(i);
+        if (tmpVec.size() != 1) {
+            return false;
+        }
 
-                int next = tmpVec[0].first;
-                if (spec->ops[next].type == OT_Transpose && spec->ops[next].num_inputs == 1) {
-                    auto ps1 = spec->ops[i].ps.transpose_spec;
-                    auto ps2 = spec->ops[next].ps.transpose_spec;
-                    if (ps1.num_axes != ps2.num_axes) {
-                        UNI_ERROR_LOG("neighbor two transpose operators(%s, %s) dimensions not "
-                                      "equal.\n",
-                            spec->ops[i].name, spec->ops[next].name);
-                        continue;
-                    }
-                    bool invalid = true;
-                    for (U32 j = 0; j < ps2.num_axes; j++) {
-                        ps2.axes[j] = ps1.axes[ps2.axes[j]];
-                        if (ps2.axes[j] != j) {
-                            invalid = false;
-                        }
-                    }
-                    if (invalid) {
-                        setOperatorInvalid(spec, next, true);
-                    } else {
-                        spec->ops[next].ps.transpose_spec = ps2;
-                    }
-                    setOperatorInvalid(spec, i, true);
-                    hasOptimized = true;
-                }
+        // check activation
+        int tmpOpIndex = tmpVec[0].first;
+        if (activationMap.find(spec->ops[tmpOpIndex].type) != activationMap.end()) {
+            tmpVec = graph.consumers(spec->ops[tmpOpIndex].output_tensors_name[0], i + 1);
+            if (tmpVec.size() != 1) {
+                return false;
             }
         }
-        return hasOptimized;
+
+        int next = tmpVec[0].first;
+        if (spec->ops[next].type != OT_Transpose || spec->ops[next].num_inputs != 1) {
+            return false;
+        }
+        auto ps1 = spec->ops[i].ps.transpose_spec;
+        auto ps2 = spec->ops[next].ps.transpose_spec;
+        if (ps1.num_axes != ps2.num_axes) {
+            UNI_ERROR_LOG("neighbor two transpose operators(%s, %s) dimensions not equal.\n",
+                spec->ops[i].name, spec->ops[next].name);
+            return false;
+        }
+        bool invalid = true;
+        for (U32 j = 0; j < ps2.num_axes; j++) {
+            ps2.axes[j] = ps1.axes[ps2.axes[j]];
+            if (ps2.axes[j] != j) {
+                invalid = false;
+            }
+        }
+        if (invalid) {
+            removeOperator(next, true);
+        } else {
+            spec->ops[next].ps.transpose_spec = ps2;
+        }
+        removeOperator(i, true);
+        return true;
     }
+
+    std::map<OperatorType, int> activationMap = {{OT_Relu, 1}, {OT_Relu6, 1}, {OT_TanH, 1}};
 };
 #endif
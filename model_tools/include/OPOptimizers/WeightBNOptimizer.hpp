@@ -14,111 +14,105 @@
 #ifndef _H_WEIGHTBNOPTIMIZER
 #define _H_WEIGHTBNOPTIMIZER
 
-#include "OPOptimizer.hpp"
+#include "GraphOptimizer.hpp"
 
-class WeightBNOptimizer : public OPOptimizer {
-    bool optimize(ModelSpec *spec) override
+class WeightBNOptimizer : public GraphOptimizer {
+    std::vector<OperatorType> anchors() override
     {
-        bool hasOptimized = false;
-        for (int i = 0; i < spec->num_operator_specs; i++) {
-            if (OT_Conv == spec->ops[i].type || OT_FC == spec->ops[i].type) {
-                int prevOpIndex = i;
-                if (OT_Conv == spec->ops[prevOpIndex].type) {
-                    if (ACTIVATION_NULL != spec->ops[prevOpIndex].ps.conv_spec.dw_activation_type ||
-                        ACTIVATION_NULL != spec->ops[prevOpIndex].ps.conv_spec.pw_activation_type) {
-                        continue;
-                    }
-                }
-                std::vector<std::pair<int, int>> nextOpIndexes = searchOperatorIndexByInput(spec,
-                    spec->ops[prevOpIndex].output_tensors_name[0], prevOpIndex + 1,
-                    spec->num_operator_specs);
-                if (nextOpIndexes.size() != 1 ||
-                    OT_BatchNorm != spec->ops[nextOpIndexes[0].first].type) {
-                    continue;
-                }
-                int bnOpIndex = nextOpIndexes[0].first;
+        return {OT_Conv, OT_FC};
+    }
 
-                // bn
-                int bnWeightIndex = searchWeightIndex(spec, spec->ops[bnOpIndex].name);
-                CHECK_REQUIREMENT(bnWeightIndex >= 0);
-                CHECK_REQUIREMENT(spec->ws[bnWeightIndex].mdt == DT_F32);
-                F32 epsCur = spec->ops[bnOpIndex].ps.bn_spec.eps;
-                F32 gamaCur = spec->ops[bnOpIndex].ps.bn_spec.gama;
-                U32 channelCur =
-                    spec->ws[bnWeightIndex].bytes_of_weight / bytesOf(spec->ws[bnWeightIndex].mdt);
-                F32 *meanPtr = (F32 *)spec->ws[bnWeightIndex].weight;
-                F32 *varPtr = (F32 *)spec->ws[bnWeightIndex].vec;
+    bool rewrite(int prevOpIndex) override
+    {
+        if (OT_Conv == spec->ops[prevOpIndex].type) {
+            if (ACTIVATION_NULL != spec->ops[prevOpIndex].ps.conv_spec.dw_activation_type ||
+                ACTIVATION_NULL != spec->ops[prevOpIndex].ps.conv_spec.pw_activation_type) {
+                return false;
+            }
+        }
+        std::vector<std::pair<int, int>> nextOpIndexes = consumers(prevOpIndex);
+        if (nextOpIndexes.size() != 1 || OT_BatchNorm != spec->ops[nextOpIndexes[0].first].type) {
+            return false;
+        }
+        int bnOpIndex = nextOpIndexes[0].first;
 
-                std::vector<float> stdValue(channelCur);
-                for (U32 j = 0; j < channelCur; j++) {
-                    stdValue[j] = sqrt(gamaCur * varPtr[j] + epsCur);
-                }
+        // bn
+        int bnWeightIndex = graph.weightIndex(spec->ops[bnOpIndex].name);
+        CHECK_REQUIREMENT(bnWeightIndex >= 0);
+        CHECK_REQUIREMENT(spec->ws[bnWeightIndex].mdt == DT_F32);
+        F32 epsCur = spec->ops[bnOpIndex].ps.bn_spec.eps;
+        F32 gamaCur = spec->ops[bnOpIndex].ps.bn_spec.gama;
+        U32 channelCur =
+            spec->ws[bnWeightIndex].bytes_of_weight / bytesOf(spec->ws[bnWeightIndex].mdt);
+        F32 *meanPtr = (F32 *)spec->ws[bnWeightIndex].weight;
+        F32 *varPtr = (F32 *)spec->ws[bnWeightIndex].vec;
 
-                // conv
-                int convWeightIndex = searchWeightIndex(spec, spec->ops[prevOpIndex].name);
-                CHECK_REQUIREMENT(convWeightIndex >= 0);
-                // Now weight mdt can be DT_BIN01 or DT_BIN11
-                U32 isBNN = 0;
-                if (spec->ws[convWeightIndex].mdt == DT_BIN01 ||
-                    spec->ws[convWeightIndex].mdt == DT_BIN11) {
-                    isBNN = 1;
-                }
-                F32 *weightTemp = (F32 *)spec->ws[convWeightIndex].weight;
-                F32 *weightTempRecAlloc =
-                    (F32 *)mt_malloc(spec->ws[convWeightIndex].bytes_of_weight);
-                UNI_MEMCPY(
-                    weightTempRecAlloc, weightTemp, spec->ws[convWeightIndex].bytes_of_weight);
-                spec->ws[convWeightIndex].weight = (U8 *)weightTempRecAlloc;
-                if (spec->ws[convWeightIndex].vec == nullptr) {
-                    spec->ws[convWeightIndex].bytes_of_vec = channelCur * sizeof(F32);
-                    if (isBNN == 1) {
-                        spec->ws[convWeightIndex].bytes_of_vec *= 2;
-                    }
-                    spec->ws[convWeightIndex].vec =
-                        (U8 *)mt_malloc(spec->ws[convWeightIndex].bytes_of_vec);
-                    if (isBNN == 1) {
-                        F32 *scale = (F32 *)spec->ws[convWeightIndex].vec;
-                        F32 *bias = scale + channelCur;
-                        for (U32 m = 0; m < channelCur; m++) {
-                            scale[m] = 1;
-                            bias[m] = 0;
-                        }
-                    } else {
-                        UNI_MEMSET(spec->ws[convWeightIndex].vec, 0,
-                            spec->ws[convWeightIndex].bytes_of_vec);
-                    }
+        std::vector<float> stdValue(channelCur);
+        for (U32 j = 0; j < channelCur; j++) {
+            stdValue[j] = sqrt(gamaCur * varPtr[j] + epsCur);
+        }
+
+        // conv
+        int convWeightIndex = graph.weightIndex(spec->ops[prevOpIndex].name);
+        CHECK_REQUIREMENT(convWeightIndex >= 0);
+        // Now weight mdt can be DT_BIN01 or DT_BIN11
+        U32 isBNN = 0;
+        if (spec->ws[convWeightIndex].mdt == DT_BIN01 ||
+            spec->ws[convWeightIndex].mdt == DT_BIN11) {
+            isBNN = 1;
+        }
+        F32 *weightTemp = (F32 *)spec->ws[convWeightIndex].weight;
+        F32 *weightTempRecAlloc = (F32 *)mt_malloc(spec->ws[convWeightIndex].bytes_of_weight);
+        UNI_MEMCPY(weightTempRecAlloc, weightTemp, spec->ws[convWeightIndex].bytes_of_weight);
+        spec->ws[convWeightIndex].weight = (U8 *)weightTempRecAlloc;
+        if (spec->ws[convWeightIndex].vec == nullptr) {
+            spec->ws[convWeightIndex].bytes_of_vec = channelCur * sizeof(F32);
+            if (isBNN == 1) {
+                spec->ws[convWeightIndex].bytes_of_vec *= 2;
+            }
+            spec->ws[convWeightIndex].vec = (U8 *)mt_malloc(spec->ws[convWeightIndex].bytes_of_vec);
+            if (isBNN == 1) {
+                F32 *scale = (F32 *)spec->ws[convWeightIndex].vec;
+                F32 *bias = scale + channelCur;
+                for (U32 m = 0; m < channelCur; m++) {
+                    scale[m] = 1;
+                    bias[m] = 0;
                 }
-                F32 *vecTemp = (F32 *)spec->ws[convWeightIndex].vec;
-                if (isBNN == 1) {  // Do not modify weights for BNN
-                    F32 *scale = vecTemp;
-                    F32 *bias = vecTemp + channelCur;
-                    for (U32 m = 0; m < channelCur; m++) {
-                        // This is the first possible source of a meaningful scale, so just initilize
-                        scale[m] /= stdValue[m];
-                        bias[m] = (bias[m] - gamaCur * meanPtr[m]) / stdValue[m];
-                    }
-                } else {
-                    F32 *vecTempReAlloc = (F32 *)mt_malloc(spec->ws[convWeightIndex].bytes_of_vec);
-                    UNI_MEMCPY(vecTempReAlloc, vecTemp, spec->ws[convWeightIndex].bytes_of_vec);
-                    spec->ws[convWeightIndex].vec = (U8 *)vecTempReAlloc;
-                    int weightDataSize = spec->ws[convWeightIndex].bytes_of_weight /
-                        bytesOf(spec->ws[convWeightIndex].mdt);
-                    int weightPerChannel = weightDataSize / channelCur;
-                    // NCHW
-                    for (U32 m = 0; m < channelCur; m++) {
-                        F32 *convWeightPerChannel = weightTemp + weightPerChannel * m;
-                        F32 *convWeightReAllocPerChannel = weightTempRecAlloc + weightPerChannel * m;
-                        for (int n = 0; n < weightPerChannel; n++) {
-                            convWeightReAllocPerChannel[n] /= stdValue[m];
-                        }
-                        vecTempReAlloc[m] = (vecTempReAlloc[m] - gamaCur * meanPtr[m]) / stdValue[m];
-                    }
+            } else {
+                UNI_MEMSET(
+                    spec->ws[convWeightIndex].vec, 0, spec->ws[convWeightIndex].bytes_of_vec);
+            }
+        }
+        F32 *vecTemp = (F32 *)spec->ws[convWeightIndex].vec;
+        if (isBNN == 1) {  // Do not modify weights for BNN
+            F32 *scale = vecTemp;
+            F32 *bias = vecTemp + channelCur;
+            for (U32 m = 0; m < channelCur; m++) {
+                // This is the first possible source of a meaningful scale, so just initilize
+                scale[m] /= stdValue[m];
+                bias[m] = (bias[m] - gamaCur * meanPtr[m]) / stdValue[m];
+            }
+        } else {
+            F32 *vecTempReAlloc = (F32 *)mt_malloc(spec->ws[convWeightIndex].bytes_of_vec);
+            UNI_MEMCPY(vecTempReAlloc, vecTemp, spec->ws[convWeightIndex].bytes_of_vec);
+            spec->ws[convWeightIndex].vec = (U8 *)vecTempReAlloc;
+            int weightDataSize =
+                spec->ws[convWeightIndex].bytes_of_weight / bytesOf(spec->ws[convWeightIndex].mdt);
+            int weightPerChannel = weightDataSize / channelCur;
+            // NCHW
+            for (U32 m = 0; m < channelCur; m++) {
+                F32 *convWeightPerChannel = weightTemp + weightPerChannel * m;
+                F32 *convWeightReAllocPerChannel = weightTempRecAlloc + weightPerChannel * m;
+                for (int n = 0; n < weightPerChannel; n++) {
+                    convWeightReAllocPerChannel[n] /= stdValue[m];
                 }
-                setOperatorInvalid(spec, bnOpIndex, true);
-                hasOptimized = true;
+                vecTempReAlloc[m] = (vecTempReAlloc[m] - gamaCur * meanPtr[m]) / stdValue[m];
             }
         }
-        return hasOptimized;
+        removeOperator(bnOpIndex, true);
+        // a following BatchNorm can be fused again
+        push(prevOpIndex);
+        return true;
     }
 };
 #endif
@@ -14,9 +14,9 @@
 #ifndef _H_WEIGHTSCALEOPTIMIZER
 #define _H_WEIGHTSCALEOPTIMIZER
 
-#include "OPOptimizer.hpp"
+#include "GraphOptimizer.hpp"
 
-class WeightScaleOptimizer : public OPOptimizer {
+class WeightScaleOptimizer : public GraphOptimizer {
 public:
     WeightScaleOptimizer(bool PTQ = false)
     {
@@ -27,324 +27,297 @@ public:
         }
     }
 
-    bool optimize(ModelSpec *spec) override
+    std::vector<OperatorType> anchors() override
     {
+        return {OT_Conv, OT_FC, OT_Scale, OT_Power};
+    }
+
+    // Power or Scale after Conv, FC or Scale is fused into its weight, a Power that is left is
+    // fused into the Scale after it.
+    bool rewrite(int i) override
+    {
+        if (OT_Power == spec->ops[i].type) {
+            return optimize_power_scale(i);
+        }
+        if (OT_Conv == spec->ops[i].type) {
+            if (ACTIVATION_NULL != spec->ops[i].ps.conv_spec.dw_activation_type ||
+                ACTIVATION_NULL != spec->ops[i].ps.conv_spec.pw_activation_type) {
+                return false;
+            }
+        }
+        std::vector<std::pair<int, int>> nextOpIndexes = consumers(i);
+        if (nextOpIndexes.size() != 1) {
+            return false;
+        }
+        int nextOpIndex = nextOpIndexes[0].first;
         bool hasOptimized = false;
-        hasOptimized |= optimize_power(spec);
-        hasOptimized |= optimize_scale(spec);
-        hasOptimized |= optimize_power_scale(spec);
+        if (OT_Power == spec->ops[nextOpIndex].type) {
+            hasOptimized = optimize_power(i, nextOpIndex);
+        } else if (OT_Scale == spec->ops[nextOpIndex].type &&
+            this->ops.find(spec->ops[i].type) != this->ops.end()) {
+            hasOptimized = optimize_scale(i, nextOpIndex);
+        }
+        if (hasOptimized) {
+            // the next Power or Scale can be fused again
+            push(i);
+        }
         return hasOptimized;
     }
 
-    bool optimize_power(ModelSpec *spec)
+    bool optimize_power(int prevOpIndex, int powerOpIndex)
     {
-        bool hasOptimized = false;
-        for (int i = 0; i < spec->num_operator_specs - 1; i++) {
-            if (OT_Conv == spec->ops[i].type || OT_FC == spec->ops[i].type ||
-                OT_Scale == spec->ops[i].type) {
-                int prevOpIndex = i;
-                if (OT_Conv == spec->ops[prevOpIndex].type) {
-                    if (ACTIVATION_NULL != spec->ops[prevOpIndex].ps.conv_spec.dw_activation_type ||
-                        ACTIVATION_NULL != spec->ops[prevOpIndex].ps.conv_spec.pw_activation_type) {
-                        continue;
-                    }
-                }
-                std::vector<std::pair<int, int>> nextOpIndexes = searchOperatorIndexByInput(spec,
-                    spec->ops[prevOpIndex].output_tensors_name[0], prevOpIndex + 1,
-                    spec->num_operator_specs);
-                if (nextOpIndexes.size() != 1 || OT_Power != spec->ops[nextOpIndexes[0].first].type) {
-                    continue;
-                }
-                int powerOpIndex = nextOpIndexes[0].first;
-                if (spec->ops[powerOpIndex].ps.power_spec.power != 1) {
-                    UNI_WARNING_LOG(
-                        "encounter unoptimize Power layer(pow > 1): %s\n", spec->ops[i].name);
-                    continue;
-                }
+        if (spec->ops[powerOpIndex].ps.power_spec.power != 1) {
+            UNI_WARNING_LOG(
+                "encounter unoptimize Power layer(pow > 1): %s\n", spec->ops[prevOpIndex].name);
+            return false;
+        }
 
-                int convWeightIndex = searchWeightIndex(spec, spec->ops[prevOpIndex].name);
-                CHECK_REQUIREMENT(convWeightIndex >= 0);
-                if (spec->ws[convWeightIndex].mdt == DT_BIN01 ||
-                    spec->ws[convWeightIndex].mdt == DT_BIN11) {
-                    continue;
-                }
+        int convWeightIndex = graph.weightIndex(spec->ops[prevOpIndex].name);
+        CHECK_REQUIREMENT(convWeightIndex >= 0);
+        if (spec->ws[convWeightIndex].mdt == DT_BIN01 ||
+            spec->ws[convWeightIndex].mdt == DT_BIN11) {
+            return false;
+        }
 
-                if (spec->ws[convWeightIndex].weight == nullptr ||
-                    spec->ws[convWeightIndex].bytes_of_weight == 0) {
-                    spec->ws[convWeightIndex].bytes_of_weight =
-                        spec->ws[convWeightIndex].bytes_of_vec;
-                    spec->ws[convWeightIndex].weight =
-                        (U8 *)mt_malloc(spec->ws[convWeightIndex].bytes_of_weight);
-                    F32 *ptr = (F32 *)spec->ws[convWeightIndex].weight;
-                    for (U32 m = 0; m < spec->ws[convWeightIndex].bytes_of_weight /
-                             bytesOf(spec->ws[convWeightIndex].mdt);
-                         m++) {
-                        ptr[m] = 1;
-                    }
-                }
-                F32 *weightTemp = (F32 *)mt_malloc(spec->ws[convWeightIndex].bytes_of_weight);
-                UNI_MEMCPY(weightTemp, spec->ws[convWeightIndex].weight,
-                    spec->ws[convWeightIndex].bytes_of_weight);
-                if (spec->ws[convWeightIndex].vec == nullptr ||
-                    spec->ws[convWeightIndex].bytes_of_vec == 0) {
-                    if (OT_Conv == spec->ops[i].type) {
-                        spec->ws[convWeightIndex].bytes_of_vec =
-                            spec->ops[i].ps.conv_spec.num_outputs * sizeof(F32);
-                    } else if (OT_FC == spec->ops[i].type) {
-                        spec->ws[convWeightIndex].bytes_of_vec =
-                            spec->ops[i].ps.fc_spec.num_outputs * sizeof(F32);
-                    } else if (OT_Scale == spec->ops[i].type) {
-                        spec->ws[convWeightIndex].bytes_of_vec =
-                            spec->ws[convWeightIndex].bytes_of_weight;
-                    } else {
-                        continue;
-                    }
-                    spec->ws[convWeightIndex].vec =
-                        (U8 *)mt_malloc(spec->ws[convWeightIndex].bytes_of_vec);
-                    UNI_MEMSET(
-                        spec->ws[convWeightIndex].vec, 0, spec->ws[convWeightIndex].bytes_of_vec);
-                }
-                F32 *vecTemp = (F32 *)mt_malloc(spec->ws[convWeightIndex].bytes_of_vec);
-                UNI_MEMCPY(
-                    vecTemp, spec->ws[convWeightIndex].vec, spec->ws[convWeightIndex].bytes_of_vec);
-                for (U32 m = 0; m < spec->ws[convWeightIndex].bytes_of_weight /
-                         bytesOf(spec->ws[convWeightIndex].mdt);
-                     m++) {
-                    weightTemp[m] *= spec->ops[powerOpIndex].ps.power_spec.scale;
-                }
-                for (U32 m = 0; m < spec->ws[convWeightIndex].bytes_of_vec /
-                         bytesOf(spec->ws[convWeightIndex].mdt);
-                     m++) {
-                    vecTemp[m] = vecTemp[m] * spec->ops[powerOpIndex].ps.power_spec.scale +
-                        spec->ops[powerOpIndex].ps.power_spec.shift;
-                }
+        if (spec->ws[convWeightIndex].weight == nullptr ||
+            spec->ws[convWeightIndex].bytes_of_weight == 0) {
+            spec->ws[convWeightIndex].bytes_of_weight =
+                spec->ws[convWeightIndex].bytes_of_vec;
+            spec->ws[convWeightIndex].weight =
+                (U8 *)mt_malloc(spec->ws[convWeightIndex].bytes_of_weight);
+            F32 *ptr = (F32 *)spec->ws[convWeightIndex].weight;
+            for (U32 m = 0; m < spec->ws[convWeightIndex].bytes_of_weight /
+                     bytesOf(spec->ws[convWeightIndex].mdt);
+                 m++) {
+                ptr[m] = 1;
+            }
+        }
+        F32 *weightTemp = (F32 *)mt_malloc(spec->ws[convWeightIndex].bytes_of_weight);
+        UNI_MEMCPY(weightTemp, spec->ws[convWeightIndex].weight,
+            spec->ws[convWeightIndex].bytes_of_weight);
+        if (spec->ws[convWeightIndex].vec == nullptr ||
+            spec->ws[convWeightIndex].bytes_of_vec == 0) {
+            if (OT_Conv == spec->ops[prevOpIndex].type) {
+                spec->ws[convWeightIndex].bytes_of_vec =
+                    spec->ops[prevOpIndex].ps.conv_spec.num_outputs * sizeof(F32);
+            } else if (OT_FC == spec->ops[prevOpIndex].type) {
+                spec->ws[convWeightIndex].bytes_of_vec =
+                    spec->ops[prevOpIndex].ps.fc_spec.num_outputs * sizeof(F32);
+            } else if (OT_Scale == spec->ops[prevOpIndex].type) {
+                spec->ws[convWeightIndex].bytes_of_vec =
+                    spec->ws[convWeightIndex].bytes_of_weight;
+            } else {
+                return false;
+            }
+            spec->ws[convWeightIndex].vec =
+                (U8 *)mt_malloc(spec->ws[convWeightIndex].bytes_of_vec);
+            UNI_MEMSET(
+                spec->ws[convWeightIndex].vec, 0, spec->ws[convWeightIndex].bytes_of_vec);
+        }
+        F32 *vecTemp = (F32 *)mt_malloc(spec->ws[convWeightIndex].bytes_of_vec);
+        UNI_MEMCPY(
+            vecTemp, spec->ws[convWeightIndex].vec, spec->ws[convWeightIndex].bytes_of_vec);
+        for (U32 m = 0; m < spec->ws[convWeightIndex].bytes_of_weight /
+                 bytesOf(spec->ws[convWeightIndex].mdt);
+             m++) {
+            weightTemp[m] *= spec->ops[powerOpIndex].ps.power_spec.scale;
+        }
+        for (U32 m = 0; m < spec->ws[convWeightIndex].bytes_of_vec /
+                 bytesOf(spec->ws[convWeightIndex].mdt);
+             m++) {
+            vecTemp[m] = vecTemp[m] * spec->ops[powerOpIndex].ps.power_spec.scale +
+                spec->ops[powerOpIndex].ps.power_spec.shift;
+        }
 
-                mt_free(spec->ws[convWeightIndex].vec, spec);
-                mt_free(spec->ws[convWeightIndex].weight, spec);
+        mt_free(spec->ws[convWeightIndex].vec, spec);
+        mt_free(spec->ws[convWeightIndex].weight, spec);
 
-                spec->ws[convWeightIndex].vec = (U8 *)vecTemp;
-                spec->ws[convWeightIndex].weight = (U8 *)weightTemp;
+        spec->ws[convWeightIndex].vec = (U8 *)vecTemp;
+        spec->ws[convWeightIndex].weight = (U8 *)weightTemp;
 
-                setOperatorInvalid(spec, powerOpIndex, true);
-                hasOptimized = true;
-                i--;
-            }
-        }
-        return hasOptimized;
+        removeOperator(powerOpIndex, true);
+        return true;
     }
 
-    bool optimize_scale(ModelSpec *spec)
+    bool optimize_scale(int prevOpIndex, int scaleOpIndex)
     {
-        bool hasOptimized = false;
-        for (int i = 0; i < spec->num_operator_specs - 1; i++) {
-            if (this->ops.find(spec->ops[i].type) != this->ops.end()) {
-                int prevOpIndex = i;
-                if (OT_Conv == spec->ops[prevOpIndex].type) {
-                    if (ACTIVATION_NULL != spec->ops[prevOpIndex].ps.conv_spec.dw_activation_type ||
-                        ACTIVATION_NULL != spec->ops[prevOpIndex].ps.conv_spec.pw_activation_type) {
-                        continue;
-                    }
-                }
-                std::vector<std::pair<int, int>> nextOpIndexes = searchOperatorIndexByInput(spec,
-                    spec->ops[prevOpIndex].output_tensors_name[0], prevOpIndex + 1,
-                    spec->num_operator_specs);
-                if (nextOpIndexes.size() != 1 || OT_Scale != spec->ops[nextOpIndexes[0].first].type) {
-                    continue;
-                }
-                int scaleOpIndex = nextOpIndexes[0].first;
-                if (spec->ops[scaleOpIndex].num_inputs > 1) {
-                    UNI_WARNING_LOG(
-                        "encounter unoptimize Scale layer(multi-inputs): %s\n", spec->ops[i].name);
-                    continue;
-                }
+        if (spec->ops[scaleOpIndex].num_inputs > 1) {
+            UNI_WARNING_LOG("encounter unoptimize Scale layer(multi-inputs): %s\n",
+                spec->ops[prevOpIndex].name);
+            return false;
+        }
 
-                // scale
-                int scaleWeightIndex = searchWeightIndex(spec, spec->ops[scaleOpIndex].name);
-                CHECK_REQUIREMENT(scaleWeightIndex >= 0);
-                CHECK_REQUIREMENT(spec->ws[scaleWeightIndex].mdt == DT_F32);
-                U32 channelAlpha = spec->ws[scaleWeightIndex].bytes_of_weight /
-                    bytesOf(spec->ws[scaleWeightIndex].mdt);
-                U32 channelBeta = spec->ws[scaleWeightIndex].bytes_of_vec /
-                    bytesOf(spec->ws[scaleWeightIndex].mdt);
-                U32 channelCur = UNI_MAX(channelAlpha, channelBeta);
-                F32 *alphaPtr = (F32 *)spec->ws[scaleWeightIndex].weight;
-                F32 *betaPtr = (F32 *)spec->ws[scaleWeightIndex].vec;
+        // scale
+        int scaleWeightIndex = graph.weightIndex(spec->ops[scaleOpIndex].name);
+        CHECK_REQUIREMENT(scaleWeightIndex >= 0);
+        CHECK_REQUIREMENT(spec->ws[scaleWeightIndex].mdt == DT_F32);
+        U32 channelAlpha = spec->ws[scaleWeightIndex].bytes_of_weight /
+            bytesOf(spec->ws[scaleWeightIndex].mdt);
+        U32 channelBeta = spec->ws[scaleWeightIndex].bytes_of_vec /
+            bytesOf(spec->ws[scaleWeightIndex].mdt);
+        U32 channelCur = UNI_MAX(channelAlpha, channelBeta);
+        F32 *alphaPtr = (F32 *)spec->ws[scaleWeightIndex].weight;
+        F32 *betaPtr = (F32 *)spec->ws[scaleWeightIndex].vec;
 
-                if (spec->ws[scaleWeightIndex].bytes_of_weight == 4 ||
-                    spec->ws[scaleWeightIndex].bytes_of_vec == 4) {
-                    continue;
-                }
+        if (spec->ws[scaleWeightIndex].bytes_of_weight == 4 ||
+            spec->ws[scaleWeightIndex].bytes_of_vec == 4) {
+            return false;
+        }
 
-                int convWeightIndex = searchWeightIndex(spec, spec->ops[prevOpIndex].name);
-                CHECK_REQUIREMENT(convWeightIndex >= 0);
-                // mdt can now be DT_BIN01 or DT_BIN11
-                U32 isBNN = 0;
-                if (spec->ws[convWeightIndex].mdt == DT_BIN01 ||
-                    spec->ws[convWeightIndex].mdt == DT_BIN11) {
-                    isBNN = 1;
-                }
+        int convWeightIndex = graph.weightIndex(spec->ops[prevOpIndex].name);
+        CHECK_REQUIREMENT(convWeightIndex >= 0);
+        // mdt can now be DT_BIN01 or DT_BIN11
+        U32 isBNN = 0;
+        if (spec->ws[convWeightIndex].mdt == DT_BIN01 ||
+            spec->ws[convWeightIndex].mdt == DT_BIN11) {
+            isBNN = 1;
+        }
 
-                // scale + scale
-                if (spec->ws[convWeightIndex].weight == nullptr ||
-                    spec->ws[convWeightIndex].bytes_of_weight == 0) {
-                    spec->ws[convWeightIndex].bytes_of_weight = channelCur * sizeof(F32);
-                    spec->ws[convWeightIndex].weight =
-                        (U8 *)mt_malloc(spec->ws[convWeightIndex].bytes_of_weight);
-                    F32 *ptr = (F32 *)spec->ws[convWeightIndex].weight;
-                    for (U32 m = 0; m < channelCur; m++) {
-                        ptr[m] = 1;
-                    }
+        // scale + scale
+        if (spec->ws[convWeightIndex].weight == nullptr ||
+            spec->ws[convWeightIndex].bytes_of_weight == 0) {
+            spec->ws[convWeightIndex].bytes_of_weight = channelCur * sizeof(F32);
+            spec->ws[convWeightIndex].weight =
+                (U8 *)mt_malloc(spec->ws[convWeightIndex].bytes_of_weight);
+            F32 *ptr = (F32 *)spec->ws[convWeightIndex].weight;
+            for (U32 m = 0; m < channelCur; m++) {
+                ptr[m] = 1;
+            }
+        }
+        F32 *weightTemp = (F32 *)mt_malloc(spec->ws[convWeightIndex].bytes_of_weight);
+        UNI_MEMCPY(weightTemp, spec->ws[convWeightIndex].weight,
+            spec->ws[convWeightIndex].bytes_of_weight);
+        if (spec->ws[convWeightIndex].vec == nullptr) {
+            spec->ws[convWeightIndex].bytes_of_vec = channelCur * sizeof(F32);
+            if (isBNN == 1) {
+                spec->ws[convWeightIndex].bytes_of_vec *= 2;
+            }
+            spec->ws[convWeightIndex].vec =
+                (U8 *)mt_malloc(spec->ws[convWeightIndex].bytes_of_vec);
+            if (isBNN == 1) {
+                F32 *scale = (F32 *)spec->ws[convWeightIndex].vec;
+                F32 *bias = scale + channelCur;
+                for (U32 m = 0; m < channelCur; m++) {
+                    scale[m] = 1;
+                    bias[m] = 0;
                 }
-                F32 *weightTemp = (F32 *)mt_malloc(spec->ws[convWeightIndex].bytes_of_weight);
-                UNI_MEMCPY(weightTemp, spec->ws[convWeightIndex].weight,
-                    spec->ws[convWeightIndex].bytes_of_weight);
-                if (spec->ws[convWeightIndex].vec == nullptr) {
-                    spec->ws[convWeightIndex].bytes_of_vec = channelCur * sizeof(F32);
-                    if (isBNN == 1) {
-                        spec->ws[convWeightIndex].bytes_of_vec *= 2;
-                    }
-                    spec->ws[convWeightIndex].vec =
-                        (U8 *)mt_malloc(spec->ws[convWeightIndex].bytes_of_vec);
-                    if (isBNN == 1) {
-                        F32 *scale = (F32 *)spec->ws[convWeightIndex].vec;
-                        F32 *bias = scale + channelCur;
-                        for (U32 m = 0; m < channelCur; m++) {
-                            scale[m] = 1;
-                            bias[m] = 0;
-                        }
-                    } else {
-                        UNI_MEMSET(spec->ws[convWeightIndex].vec, 0,
-                            spec->ws[convWeightIndex].bytes_of_vec);
-                    }
+            } else {
+                UNI_MEMSET(spec->ws[convWeightIndex].vec, 0,
+                    spec->ws[convWeightIndex].bytes_of_vec);
+            }
+        }
+        F32 *vecTemp = (F32 *)mt_malloc(spec->ws[convWeightIndex].bytes_of_vec);
+        UNI_MEMCPY(
+            vecTemp, spec->ws[convWeightIndex].vec, spec->ws[convWeightIndex].bytes_of_vec);
+        if (isBNN == 1) {
+            F32 *scale = vecTemp;
+            F32 *bias = vecTemp + channelCur;
+            for (U32 m = 0; m < channelCur; m++) {
+                if (alphaPtr != nullptr) {
+                    scale[m] *= alphaPtr[m];
+                    bias[m] *= alphaPtr[m];
                 }
-                F32 *vecTemp = (F32 *)mt_malloc(spec->ws[convWeightIndex].bytes_of_vec);
-                UNI_MEMCPY(
-                    vecTemp, spec->ws[convWeightIndex].vec, spec->ws[convWeightIndex].bytes_of_vec);
-                if (isBNN == 1) {
-                    F32 *scale = vecTemp;
-                    F32 *bias = vecTemp + channelCur;
-                    for (U32 m = 0; m < channelCur; m++) {
-                        if (alphaPtr != nullptr) {
-                            scale[m] *= alphaPtr[m];
-                            bias[m] *= alphaPtr[m];
-                        }
-                        if (betaPtr != nullptr) {
-                            bias[m] += betaPtr[m];
-                        }
-                    }
-                } else {
-                    int weightDataSize = spec->ws[convWeightIndex].bytes_of_weight /
-                        bytesOf(spec->ws[convWeightIndex].mdt);
-                    int weightPerChannel = weightDataSize / channelCur;
-                    // NCHW
-                    for (U32 m = 0; m < channelCur; m++) {
-                        F32 *convWeightPerChannel = weightTemp + weightPerChannel * m;
-                        if (alphaPtr != nullptr) {
-                            for (int n = 0; n < weightPerChannel; n++) {
-                                convWeightPerChannel[n] *= alphaPtr[m];
-                            }
-                            vecTemp[m] = alphaPtr[m] * vecTemp[m];
-                        }
-                        if (betaPtr != nullptr) {
-                            vecTemp[m] += betaPtr[m];
-                        }
+                if (betaPtr != nullptr) {
+                    bias[m] += betaPtr[m];
+                }
+            }
+        } else {
+            int weightDataSize = spec->ws[convWeightIndex].bytes_of_weight /
+                bytesOf(spec->ws[convWeightIndex].mdt);
+            int weightPerChannel = weightDataSize / channelCur;
+            // NCHW
+            for (U32 m = 0; m < channelCur; m++) {
+                F32 *convWeightPerChannel = weightTemp + weightPerChannel * m;
+                if (alphaPtr != nullptr) {
+                    for (int n = 0; n < weightPerChannel; n++) {
+                        convWeightPerChannel[n] *= alphaPtr[m];
                     }
+                    vecTemp[m] = alphaPtr[m] * vecTemp[m];
                 }
+                if (betaPtr != nullptr) {
+                    vecTemp[m] += betaPtr[m];
+                }
+            }
+        }
 
-                mt_free(spec->ws[convWeightIndex].weight, spec);
-                mt_free(spec->ws[convWeightIndex].vec, spec);
-                spec->ws[convWeightIndex].weight = (U8 *)weightTemp;
-                spec->ws[convWeightIndex].vec = (U8 *)vecTemp;
-
-                // if this op is output op, we shoule keep the origin output name
-                std::vector<int> outputIdxes = searchString(spec->output_names, spec->num_outputs,
-                        spec->ops[scaleOpIndex].output_tensors_name[0]);
+        mt_free(spec->ws[convWeightIndex].weight, spec);
+        mt_free(spec->ws[convWeightIndex].vec, spec);
+        spec->ws[convWeightIndex].weight = (U8 *)weightTemp;
+        spec->ws[convWeightIndex].vec = (U8 *)vecTemp;
 
-                setOperatorInvalid(spec, scaleOpIndex, true);
+        // if this op is output op, we shoule keep the origin output name
+        std::string originOutput = spec->ops[scaleOpIndex].output_tensors_name[0];
+        bool isOutput = graph.isModelOutput(originOutput);
 
-                if (!outputIdxes.empty()) {
-                    std::string originOutput =
-                        spec->ops[scaleOpIndex].output_tensors_name[0];
-                    str_copy(spec->output_names[outputIdxes[0]],
-                            originOutput.c_str(), NAME_LEN);
-                    std::vector<std::pair<int, int>> operatorIndexes0 = searchOperatorIndexByInput(
-                        spec, spec->ops[prevOpIndex].output_tensors_name[0], prevOpIndex + 1,
-                        spec->num_operator_specs);
-                    for (U32 j = 0; j < operatorIndexes0.size(); j++) {
-                        str_copy(spec->ops[operatorIndexes0[j].first]
-                                     .input_tensors_name[operatorIndexes0[j].second],
-                            originOutput.c_str(), NAME_LEN);
-                    }
-                    str_copy(spec->ops[prevOpIndex].output_tensors_name[0],
-                             originOutput.c_str(), NAME_LEN);
+        removeOperator(scaleOpIndex, true);
 
-                }
-                hasOptimized = true;
-                i--;
+        if (isOutput) {
+            std::string prevOutput = spec->ops[prevOpIndex].output_tensors_name[0];
+            graph.renameModelOutput(prevOutput, originOutput);
+            std::vector<std::pair<int, int>> operatorIndexes0 = consumers(prevOpIndex);
+            for (U32 j = 0; j < operatorIndexes0.size(); j++) {
+                graph.setInput(operatorIndexes0[j].first, operatorIndexes0[j].second, originOutput);
             }
+            graph.setOutput(prevOpIndex, 0, originOutput);
         }
-        return hasOptimized;
+        return true;
     }
 
-    bool optimize_power_scale(ModelSpec *spec)
+    bool optimize_power_scale(int powerOpIndex)
     {
-        bool hasOptimized = false;
-        for (int i = 0; i < spec->num_operator_specs - 1; i++) {
-            if (OT_Power == spec->ops[i].type && 1 == spec->ops[i].ps.power_spec.power) {
-                std::vector<std::pair<int, int>> nextOpIndexes = searchOperatorIndexByInput(
-                    spec, spec->ops[i].output_tensors_name[0], i + 1, spec->num_operator_specs);
-                if (nextOpIndexes.size() != 1 || OT_Scale != spec->ops[nextOpIndexes[0].first].type) {
-                    continue;
-                }
-                int scaleOpIndex = nextOpIndexes[0].first;
-                if (spec->ops[scaleOpIndex].num_inputs > 1) {
-                    UNI_WARNING_LOG(
-                        "encounter unoptimize Scale layer(multi-inputs): %s\n", spec->ops[i].name);
-                    continue;
-                }
+        if (1 != spec->ops[powerOpIndex].ps.power_spec.power) {
+            return false;
+        }
+        std::vector<std::pair<int, int>> nextOpIndexes = consumers(powerOpIndex);
+        if (nextOpIndexes.size() != 1 || OT_Scale != spec->ops[nextOpIndexes[0].first].type) {
+            return false;
+        }
+        int scaleOpIndex = nextOpIndexes[0].first;
+        if (spec->ops[scaleOpIndex].num_inputs > 1) {
+            UNI_WARNING_LOG("encounter unoptimize Scale layer(multi-inputs): %s\n",
+                spec->ops[powerOpIndex].name);
+            return false;
+        }
 
-                // scale
-                int scaleWeightIndex = searchWeightIndex(spec, spec->ops[scaleOpIndex].name);
-                CHECK_REQUIREMENT(scaleWeightIndex >= 0);
-                CHECK_REQUIREMENT(spec->ws[scaleWeightIndex].mdt == DT_F32);
-                U32 channelAlpha = spec->ws[scaleWeightIndex].bytes_of_weight /
-                    bytesOf(spec->ws[scaleWeightIndex].mdt);
-                U32 channelBeta = spec->ws[scaleWeightIndex].bytes_of_vec /
-                    bytesOf(spec->ws[scaleWeightIndex].mdt);
-                U32 channelCur = UNI_MAX(channelAlpha, channelBeta);
-                F32 *alpha0 = (F32 *)spec->ws[scaleWeightIndex].weight;
-                F32 *beta0 = (F32 *)spec->ws[scaleWeightIndex].vec;
+        // scale
+        int scaleWeightIndex = graph.weightIndex(spec->ops[scaleOpIndex].name);
+        CHECK_REQUIREMENT(scaleWeightIndex >= 0);
+        CHECK_REQUIREMENT(spec->ws[scaleWeightIndex].mdt == DT_F32);
+        U32 channelAlpha = spec->ws[scaleWeightIndex].bytes_of_weight /
+            bytesOf(spec->ws[scaleWeightIndex].mdt);
+        U32 channelBeta = spec->ws[scaleWeightIndex].bytes_of_vec /
+            bytesOf(spec->ws[scaleWeightIndex].mdt);
+        U32 channelCur = UNI_MAX(channelAlpha, channelBeta);
+        F32 *alpha0 = (F32 *)spec->ws[scaleWeightIndex].weight;
+        F32 *beta0 = (F32 *)spec->ws[scaleWeightIndex].vec;
 
-                spec->ws[scaleWeightIndex].bytes_of_weight =
-                    channelCur * bytesOf(spec->ws[scaleWeightIndex].mdt);
-                spec->ws[scaleWeightIndex].bytes_of_vec = spec->ws[scaleWeightIndex].bytes_of_weight;
-                spec->ws[scaleWeightIndex].weight =
-                    (U8 *)mt_malloc(spec->ws[scaleWeightIndex].bytes_of_weight);
-                spec->ws[scaleWeightIndex].vec =
-                    (U8 *)mt_malloc(spec->ws[scaleWeightIndex].bytes_of_vec);
-                F32 *alpha1 = (F32 *)spec->ws[scaleWeightIndex].weight;
-                F32 *beta1 = (F32 *)spec->ws[scaleWeightIndex].vec;
-                for (U32 m = 0; m < channelCur; m++) {
-                    F32 beta = spec->ops[i].ps.power_spec.shift;
-                    if (alpha0 == nullptr) {
-                        alpha1[m] = spec->ops[i].ps.power_spec.scale;
-                    } else {
-                        alpha1[m] = alpha0[m] * spec->ops[i].ps.power_spec.scale;
-                        beta *= alpha0[m];
-                    }
-                    if (beta0 == nullptr) {
-                        beta1[m] = beta;
-                    } else {
-                        beta1[m] = beta + beta0[m];
-                    }
-                }
-                mt_free(alpha0, spec);
-                mt_free(beta0, spec);
-                setOperatorInvalid(spec, i, true);
-                hasOptimized = true;
+        spec->ws[scaleWeightIndex].bytes_of_weight =
+            channelCur * bytesOf(spec->ws[scaleWeightIndex].mdt);
+        spec->ws[scaleWeightIndex].bytes_of_vec = spec->ws[scaleWeightIndex].bytes_of_weight;
+        spec->ws[scaleWeightIndex].weight =
+            (U8 *)mt_malloc(spec->ws[scaleWeightIndex].bytes_of_weight);
+        spec->ws[scaleWeightIndex].vec =
+            (U8 *)mt_malloc(spec->ws[scaleWeightIndex].bytes_of_vec);
+        F32 *alpha1 = (F32 *)spec->ws[scaleWeightIndex].weight;
+        F32 *beta1 = (F32 *)spec->ws[scaleWeightIndex].vec;
+        for (U32 m = 0; m < channelCur; m++) {
+            F32 beta = spec->ops[powerOpIndex].ps.power_spec.shift;
+            if (alpha0 == nullptr) {
+                alpha1[m] = spec->ops[powerOpIndex].ps.power_spec.scale;
+            } else {
+                alpha1[m] = alpha0[m] * spec->ops[powerOpIndex].ps.power_spec.scale;
+                beta *= alpha0[m];
+            }
+            if (beta0 == nullptr) {
+                beta1[m] = beta;
+            } else {
+                beta1[m] = beta + beta0[m];
             }
         }
-        return hasOptimized;
+        mt_free(alpha0, spec);
+        mt_free(beta0, spec);
+        removeOperator(powerOpIndex, true);
+        return true;
     }
 
 private:
@@ -0,0 +1,246 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#ifndef _H_MODELGRAPH
+#define _H_MODELGRAPH
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+#include "model_common.h"
+#include "string_functions.h"
+
+// Indexed view of the operators of a ModelSpec. Operators, weights and tensors are found by hash,
+// producers and consumers of a tensor by its edges, so a rewrite costs the size of its
+// neighbourhood instead of a scan of the model. Operators are rewritten in place in spec->ops,
+// rewrites that change edges must go through the graph to keep it valid.
+class ModelGraph {
+public:
+    void build(ModelSpec *spec)
+    {
+        this->spec = spec;
+        this->operators.clear();
+        this->weights.clear();
+        this->tensors.clear();
+        this->outputs.clear();
+        for (int i = 0; i < spec->num_operator_specs; i++) {
+            if (spec->ops[i].type != OT_None) {
+                add_operator(i);
+            }
+        }
+        for (int i = 0; i < spec->num_weight_specs; i++) {
+            this->weights.insert(std::make_pair(std::string(spec->ws[i].op_name), i));
+        }
+        for (int i = 0; i < spec->num_outputs; i++) {
+            this->outputs.insert(spec->output_names[i]);
+        }
+    }
+
+    int operatorIndex(const std::string &name) const
+    {
+        auto iter = this->operators.find(name);
+        return (iter == this->operators.end()) ? -1 : iter->second;
+    }
+
+    int weightIndex(const std::string &name) const
+    {
+        auto iter = this->weights.find(name);
+        return (iter == this->weights.end()) ? -1 : iter->second;
+    }
+
+    bool isModelOutput(const std::string &tensor) const
+    {
+        return this->outputs.find(tensor) != this->outputs.end();
+    }
+
+    // (operator, input slot) that read tensor from left, until the nearest operator that writes
+    // it again. It is the same as OPOptimizer::searchOperatorIndexByInput.
+    std::vector<std::pair<int, int>> consumers(const std::string &tensor, int left) const
+    {
+        std::vector<std::pair<int, int>> result;
+        auto iter = this->tensors.find(tensor);
+        if (iter == this->tensors.end()) {
+            return result;
+        }
+        const std::vector<std::pair<int, int>> &readers = iter->second.readers;
+        const std::vector<int> &writers = iter->second.writers;
+        auto r = std::lower_bound(readers.begin(), readers.end(), std::make_pair(left, -1));
+        if (r == readers.end()) {
+            return result;
+        }
+        auto w = std::lower_bound(writers.begin(), writers.end(), r->first);
+        for (; r != readers.end() && (w == writers.end() || r->first <= *w); r++) {
+            result.push_back(*r);
+        }
+        return result;
+    }
+
+    // the nearest operator before right that writes tensor, -1 means it is a model input or weight.
+    int producer(const std::string &tensor, int right) const
+    {
+        auto iter = this->tensors.find(tensor);
+        if (iter == this->tensors.end()) {
+            return -1;
+        }
+        const std::vector<int> &writers = iter->second.writers;
+        auto w = std::lower_bound(writers.begin(), writers.end(), right);
+        return (w == writers.begin()) ? -1 : *(w - 1);
+    }
+
+    void setInput(int op, int slot, const std::string &tensor)
+    {
+        OperatorSpec &p = this->spec->ops[op];
+        erase_reader(p.input_tensors_name[slot], op, slot);
+        str_copy(p.input_tensors_name[slot], tensor.c_str(), tensor.length());
+        insert_reader(tensor, op, slot);
+    }
+
+    void setOutput(int op, int slot, const std::string &tensor)
+    {
+        OperatorSpec &p = this->spec->ops[op];
+        erase_writer(p.output_tensors_name[slot], op);
+        str_copy(p.output_tensors_name[slot], tensor.c_str(), tensor.length());
+        insert_writer(tensor, op);
+    }
+
+    // model outputs named tensor are named name instead.
+    void renameModelOutput(const std::string &tensor, const std::string &name)
+    {
+        if (!isModelOutput(tensor)) {
+            return;
+        }
+        for (int i = 0; i < this->spec->num_outputs; i++) {
+            if (tensor == this->spec->output_names[i]) {
+                str_copy(this->spec->output_names[i], name.c_str(), name.length());
+            }
+        }
+        this->outputs.erase(tensor);
+        this->outputs.insert(name);
+    }
+
+    void removeInput(int op, int slot)
+    {
+        OperatorSpec &p = this->spec->ops[op];
+        for (U32 i = slot; i < p.num_inputs; i++) {
+            erase_reader(p.input_tensors_name[i], op, i);
+        }
+        mt_free(p.input_tensors_name[slot]);
+        for (U32 i = slot; i + 1 < p.num_inputs; i++) {
+            p.input_tensors_name[i] = p.input_tensors_name[i + 1];
+            insert_reader(p.input_tensors_name[i], op, i);
+        }
+        p.num_inputs--;
+    }
+
+    // same as OPOptimizer::setOperatorInvalid without weight release, consumers of the outputs
+    // read the first input instead when removeEdge is set.
+    void removeOperator(int op, bool removeEdge = false)
+    {
+        OperatorSpec &p = this->spec->ops[op];
+        UNI_DEBUG_LOG("remove operator:%s(%s) and edges(%d).\n", p.name,
+            OperatorTypeName()[p.type], removeEdge);
+        remove_operator(op);
+        p.type = OT_None;
+        if (!removeEdge || p.num_inputs == 0 ||
+            (p.num_inputs == 1 && p.num_outputs == 1 &&
+                std::string(p.input_tensors_name[0]) == std::string(p.output_tensors_name[0]))) {
+            return;
+        }
+        std::string input = p.input_tensors_name[0];
+        for (U32 i = 0; i < p.num_outputs; i++) {
+            std::string output = p.output_tensors_name[i];
+            std::vector<std::pair<int, int>> next = consumers(output, op + 1);
+            for (U32 j = 0; j < next.size(); j++) {
+                setInput(next[j].first, next[j].second, input);
+            }
+            renameModelOutput(output, input);
+        }
+    }
+
+private:
+    struct TensorEdges {
+        // sorted (operator, input slot) that read the tensor
+        std::vector<std::pair<int, int>> readers;
+        // sorted operators that write the tensor
+        std::vector<int> writers;
+    };
+
+    void insert_reader(const std::string &tensor, int op, int slot)
+    {
+        std::vector<std::pair<int, int>> &readers = this->tensors[tensor].readers;
+        std::pair<int, int> edge(op, slot);
+        readers.insert(std::lower_bound(readers.begin(), readers.end(), edge), edge);
+    }
+
+    void erase_reader(const std::string &tensor, int op, int slot)
+    {
+        std::vector<std::pair<int, int>> &readers = this->tensors[tensor].readers;
+        std::pair<int, int> edge(op, slot);
+        auto iter = std::lower_bound(readers.begin(), readers.end(), edge);
+        if (iter != readers.end() && *iter == edge) {
+            readers.erase(iter);
+        }
+    }
+
+    void insert_writer(const std::string &tensor, int op)
+    {
+        std::vector<int> &writers = this->tensors[tensor].writers;
+        writers.insert(std::lower_bound(writers.begin(), writers.end(), op), op);
+    }
+
+    void erase_writer(const std::string &tensor, int op)
+    {
+        std::vector<int> &writers = this->tensors[tensor].writers;
+        auto iter = std::lower_bound(writers.begin(), writers.end(), op);
+        if (iter != writers.end() && *iter == op) {
+            writers.erase(iter);
+        }
+    }
+
+    void add_operator(int op)
+    {
+        OperatorSpec &p = this->spec->ops[op];
+        this->operators.insert(std::make_pair(std::string(p.name), op));
+        for (U32 i = 0; i < p.num_inputs; i++) {
+            insert_reader(p.input_tensors_name[i], op, i);
+        }
+        for (U32 i = 0; i < p.num_outputs; i++) {
+            insert_writer(p.output_tensors_name[i], op);
+        }
+    }
+
+    void remove_operator(int op)
+    {
+        OperatorSpec &p = this->spec->ops[op];
+        auto iter = this->operators.find(p.name);
+        if (iter != this->operators.end() && iter->second == op) {
+            this->operators.erase(iter);
+        }
+        for (U32 i = 0; i < p.num_inputs; i++) {
+            erase_reader(p.input_tensors_name[i], op, i);
+        }
+        for (U32 i = 0; i < p.num_outputs; i++) {
+            erase_writer(p.output_tensors_name[i], op);
+        }
+    }
+
+    ModelSpec *spec = nullptr;
+    std::unordered_map<std::string, int> operators;
+    std::unordered_map<std::string, int> weights;
+    std::unordered_map<std::string, TensorEdges> tensors;
+    std::unordered_set<std::string> outputs;
+};
+#endif
@@ -16,6 +16,7 @@
 
 #include <memory>
 #include "model_common.h"
+#include "profiling.h"
 #include "OPOptimizers/DeprecatedOPOptimizer.hpp"
 #include "OPOptimizers/WeightBNOptimizer.hpp"
 #include "OPOptimizers/BNScaleOptimizer.hpp"
@@ -76,8 +77,11 @@
 #include "OPOptimizers/AdvancedLayerNormOptimizer.hpp"
 #include "OPOptimizers/ConstantFuseOptimizer.hpp"
 #include "OPOptimizers/WhereSoftmaxWhereOptimizer.hpp"
+#include "OPOptimizers/ScaledDotProductAttentionOptimizer.hpp"
 #include "OPOptimizers/Dynamic1ReshapeOptimizer.hpp"
 #include "OPOptimizers/Dynamic2ReshapeOptimizer.hpp"
+#include "OPOptimizers/PostOpFusionOptimizer.hpp"
+#include "OPOptimizers/NMSModeOptimizer.hpp"
 
 class ModelSpecOptimizer {
 public:
@@ -99,15 +103,18 @@ public:
 
         // kernel code
         bool optimizeOrNot = false;
+        this->times.clear();
         for (auto opo : opos) {
             auto &ptr = *opo.get();
             const char *classNameAll = typeid(ptr).name();
             char *className;
             strtol(classNameAll, &className, 10);
             UNI_DEBUG_LOG("run optimizer: %s.\n", className);
+            double start = ut_time_ms();
             if (opo->optimize(spec)) {
                 optimizeOrNot = true;
             }
+            this->times.push_back(std::make_pair(std::string(className), ut_time_ms() - start));
         }
 
         if (originalInputSize == spec->num_inputs && originalOutputSize == spec->num_outputs) {
@@ -116,9 +123,11 @@ public:
         return optimizeOrNot;
     }
 
-    void suggest(bool isPTQ)
+    // cpuFusion fuses operators into ones that only CPU supports, the model can not run on GPU.
+    void suggest(bool isPTQ, bool cpuFusion = false)
     {
-        // strict order
+        // strict order, Activation, Clip, Swish, Transpose, WeightBN, BNScale and WeightScale are
+        // GraphOptimizer passes.
         this->opos.push_back(std::shared_ptr<OPOptimizer>(new CleanInputsOutputsOptimizer()));
         this->opos.push_back(std::shared_ptr<OPOptimizer>(new ResizeFuseOptimizer()));
         this->opos.push_back(std::shared_ptr<OPOptimizer>(new ConstantFuseOptimizer()));
@@ -193,11 +202,20 @@ public:
         this->opos.push_back(std::shared_ptr<OPOptimizer>(new EltwiseConstantOptimizer()));
         this->opos.push_back(std::shared_ptr<OPOptimizer>(new ReshapeReduceMeanOptimizer()));
         this->opos.push_back(std::shared_ptr<OPOptimizer>(new WhereSoftmaxWhereOptimizer()));
+        // keep MatMuls of attention quantizable, GPU has no fused attention
+        if (!isPTQ && cpuFusion) {
+            this->opos.push_back(
+                std::shared_ptr<OPOptimizer>(new ScaledDotProductAttentionOptimizer()));
+        }
         this->opos.push_back(std::shared_ptr<OPOptimizer>(new Dynamic1ReshapeOptimizer()));
 	    this->opos.push_back(std::shared_ptr<OPOptimizer>(new Dynamic2ReshapeOptimizer()));
+        this->opos.push_back(std::shared_ptr<OPOptimizer>(new NMSModeOptimizer()));
 
         // Please leave MemoryReuseOptimizer at last
         if (!isPTQ) {
+            if (cpuFusion) {
+                this->opos.push_back(std::shared_ptr<OPOptimizer>(new PostOpFusionOptimizer()));
+            }
             this->opos.push_back(std::shared_ptr<OPOptimizer>(new InPlaceOptimizer()));
             this->opos.push_back(std::shared_ptr<OPOptimizer>(new MemoryReuseOptimizer()));
         }
@@ -241,8 +259,15 @@ public:
     void empty()
     {}
 
+    // (optimizer, time in ms) of every pass run by the last optimize, in running order.
+    const std::vector<std::pair<std::string, double>> &passTimes() const
+    {
+        return this->times;
+    }
+
 private:
     std::vector<std::shared_ptr<OPOptimizer>> opos;
+    std::vector<std::pair<std::string, double>> times;
 };
 
 #endif
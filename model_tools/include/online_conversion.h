@@ -18,7 +18,8 @@ void *OnlineModelConversion(const char *storagePath,
     const char *modelName,
     const char *inferPrecision,
     int removeProcessOpsNum = 0,
-    bool trainMode = false);
+    bool trainMode = false,
+    bool cpuFusion = false);
 
 void OnlineModelReclaim(void *ms);
 #endif
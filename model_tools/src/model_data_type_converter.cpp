@@ -77,27 +77,23 @@ void ws_datatype_converter_int8(U8 *originalPtr, U8 *targetPtr, int paramNum, F3
     }
 }
 
-void ws_datatype_converter_int4(U8 *originalPtr, U8 *targetPtr, int paramNum, F32 *scale)
+// weights are quantized by groups of group weights, each group has a scale.
+void ws_datatype_converter_int4(
+    U8 *originalPtr, U8 *targetPtr, int paramNum, int group, F32 *scale)
 {
     F32 *f32PtrParam = (F32 *)originalPtr;
     INT8 *targetPtrParam = (INT8 *)targetPtr;
-
-    F32 maxabs = 0;
-    for (int i = 0; i < paramNum; i++) {
-        if (abs(f32PtrParam[i]) > maxabs) {
-            maxabs = abs(f32PtrParam[i]);
+    UNI_MEMSET(targetPtrParam, 0, (paramNum + 1) / 2);
+    for (int g = 0; g < paramNum / group; g++) {
+        F32 maxabs = 0;
+        for (int i = g * group; i < (g + 1) * group; i++) {
+            maxabs = UNI_MAX(UNI_ABS(f32PtrParam[i]), maxabs);
+        }
+        scale[g] = (maxabs > 0) ? 7.0 / maxabs : 1;
+        for (int i = g * group; i < (g + 1) * group; i++) {
+            INT8 tmp = roundNearestEven(f32PtrParam[i] * scale[g]) + 7;
+            targetPtrParam[i / 2] |= tmp << ((i % 2) * 4);
         }
-    }
-
-    *scale = UNI_MAX(7.0 / maxabs, *scale);
-    int i = 0;
-    for (; i < paramNum - 1; i += 2) {
-        INT8 tmp0 = roundNearestEven(f32PtrParam[i] * 7.0 / maxabs) + 7;
-        INT8 tmp1 = roundNearestEven(f32PtrParam[i + 1] * 7.0 / maxabs) + 7;
-        targetPtrParam[i / 2] = (tmp1 << 4) | tmp0;
-    }
-    if (i < paramNum) {
-        targetPtrParam[(i / 2) + 1] = roundNearestEven(f32PtrParam[paramNum - 1] * scale[0]);
     }
 }
 
@@ -149,6 +145,8 @@ inline EE getTargetDataType(std::string inferPrecision, DataType *type)
         *type = DT_I4;
     } else if (inferPrecision == "BNN") {
         *type = DT_BIN01;
+    } else if (inferPrecision == "BF16") {
+        *type = DT_BF16;
     } else {
         return NOT_SUPPORTED;
     }
@@ -178,7 +176,8 @@ inline DataType get_storage_type(
         case DT_BIN11:
             return DT_F16;
         case DT_F32:
-        case DT_F16: {
+        case DT_F16:
+        case DT_BF16: {
             if (quantTypes.find(inferType) == quantTypes.end()) {
                 return storageType;
             }
@@ -225,6 +224,10 @@ EE ms_datatype_converter(ModelSpec *originalMs,
     DataType storageDt, inferDt;
     CHECK_STATUS(getTargetDataType(inferPrecision, &inferDt));
     CHECK_STATUS(getTargetDataType(storagePrecision, &storageDt));
+    // bf16 is only a weight storage type, features are still computed in fp32.
+    if (inferDt == DT_BF16) {
+        inferDt = DT_F32;
+    }
     targetMs->dt = inferDt;
 
     targetMs->num_inputs = originalMs->num_inputs;
@@ -335,6 +338,10 @@ EE ms_datatype_converter(ModelSpec *originalMs,
     F32 quantizationErrorThreshold = (environmentSetting != NULL) ? atof(environmentSetting) : 99999;
     UNI_INFO_LOG(
         "environment variable BOLT_INT8_STORAGE_ERROR_THRESHOLD: %f\n", quantizationErrorThreshold);
+    // 0 means a scale for a weight tensor, x86 FC keeps int4 weight packed when the group size
+    // is a multiple of 32 that divides the input channels.
+    environmentSetting = getenv("BOLT_INT4_GROUP_SIZE");
+    int int4GroupSize = (environmentSetting != NULL) ? atoi(environmentSetting) : 0;
     for (int i = 0; i < targetMs->num_weight_specs; i++) {
         str_copy(wsPtr[i].op_name, originalMs->ws[i].op_name, NAME_LEN);
 
@@ -431,6 +438,12 @@ EE ms_datatype_converter(ModelSpec *originalMs,
                         wsPtr[i].mdt, (float *)originalMs->ws[i].vec, wsPtr[i].vec, biasNum);
                     break;
                 }
+                case DT_BF16: {
+                    transformFromFloat(wsPtr[i].mdt, (float *)originalMs->ws[i].weight,
+                        wsPtr[i].weight, weightNum);
+                    transformFromFloat(vdt, (float *)originalMs->ws[i].vec, wsPtr[i].vec, biasNum);
+                    break;
+                }
                 case DT_F32_8Q:
                 case DT_F16_8Q:
                 case DT_I8: {
@@ -451,15 +464,24 @@ EE ms_datatype_converter(ModelSpec *originalMs,
                     break;
                 }
                 case DT_I4: {
+                    int group = UNI_MAX(weightNum, 1);
+                    if (int4GroupSize > 0 && weightNum % int4GroupSize == 0) {
+                        group = int4GroupSize;
+                    }
+                    int num = UNI_MAX(weightNum, 1) / group;
                     if (wsPtr[i].weight_scale == nullptr) {
                         wsPtr[i].num_quant_scale = 1;
                         wsPtr[i].weight_scale = (QuantSpec *)mt_malloc(sizeof(QuantSpec));
-                        wsPtr[i].weight_scale[0].num_scale = 1;
-                        wsPtr[i].weight_scale[0].scale = (F32 *)mt_malloc(sizeof(F32));
-                        wsPtr[i].weight_scale[0].scale[0] = -1;
+                        wsPtr[i].weight_scale[0].num_scale = 0;
+                        wsPtr[i].weight_scale[0].scale = nullptr;
+                    }
+                    if (wsPtr[i].weight_scale[0].num_scale != num) {
+                        mt_free(wsPtr[i].weight_scale[0].scale);
+                        wsPtr[i].weight_scale[0].num_scale = num;
+                        wsPtr[i].weight_scale[0].scale = (F32 *)mt_malloc(num * sizeof(F32));
                     }
                     ws_datatype_converter_int4(originalMs->ws[i].weight, wsPtr[i].weight, weightNum,
-                        wsPtr[i].weight_scale[0].scale);
+                        group, wsPtr[i].weight_scale[0].scale);
 
                     if (wsPtr[i].bytes_of_vec > 0) {
                         transformFromFloat(
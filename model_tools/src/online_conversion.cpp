@@ -21,7 +21,8 @@ void *OnlineModelConversion(const char *storagePath,
     const char *modelName,
     const char *inferPrecision,
     I32 removeProcessOpsNum,
-    bool trainMode)
+    bool trainMode,
+    bool cpuFusion)
 {
     ModelSpec *originalMs = new ModelSpec();
     ModelSpec *targetMs = new ModelSpec();
@@ -72,7 +73,7 @@ void *OnlineModelConversion(const char *storagePath,
     if (trainMode) {
         msOptimizer.suggest_for_training();
     } else {
-        msOptimizer.suggest(inferPrecision == std::string("PTQ"));
+        msOptimizer.suggest(inferPrecision == std::string("PTQ"), cpuFusion);
     }
     msOptimizer.optimize(originalMs);
 
@@ -19,8 +19,15 @@
 #include <google/protobuf/text_format.h>
 #include <google/protobuf/message.h>
 #include "onnx.pb.h"
+#if defined(__GLIBC__) || defined(__linux__)
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #include "model_adaptee.h"
+#include "file.h"
 
 class OnnxAdaptee : public ModelAdaptee {
 public:
@@ -34,6 +41,13 @@ public:
 
     ~OnnxAdaptee()
     {
+        for (auto &iter : this->externalFiles) {
+#if defined(__GLIBC__) || defined(__linux__)
+            munmap(iter.second.first, iter.second.second);
+#else
+            free(iter.second.first);
+#endif
+        }
         google::protobuf::ShutdownProtobufLibrary();
     }
 
@@ -47,6 +61,8 @@ protected:
 
         google::protobuf::io::IstreamInputStream input(&fs);
         google::protobuf::io::CodedInputStream codedstr(&input);
+        // protobuf can not parse a message larger than 2GB, weights of larger models must be
+        // saved as external data.
         codedstr.SetTotalBytesLimit(INT_MAX, INT_MAX / 2);
         if (!message->ParseFromCodedStream(&codedstr)) {
             UNI_ERROR_LOG("can not parse onnx model file %s.\n", modelPath);
@@ -58,6 +74,7 @@ protected:
     EE parse_file(std::string modelDirectory, std::string modelFileName) override
     {
         this->modelName = crop_name(modelFileName);
+        this->modelDirectory = modelDirectory;
         std::string modelPath = modelDirectory + "/" + modelFileName + ".onnx";
         CHECK_STATUS(read_file(modelPath.c_str(), (google::protobuf::Message *)(&onnxModel)));
 
@@ -389,10 +406,75 @@ protected:
         return ret;
     }
 
+    // external data files are mapped when their tensors are read, tensors are not copied.
+    U8 *map_external_file(const std::string &location)
+    {
+        if (this->externalFiles.find(location) == this->externalFiles.end()) {
+            std::string path = this->modelDirectory + "/" + location;
+            U8 *content = nullptr;
+            size_t length = 0;
+#if defined(__GLIBC__) || defined(__linux__)
+            int fd = open(path.c_str(), O_RDONLY);
+            struct stat ss;
+            if (fd == -1 || fstat(fd, &ss) == -1) {
+                UNI_ERROR_LOG("can not open onnx external data file %s.\n", path.c_str());
+            }
+            length = ss.st_size;
+            content = (U8 *)mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            close(fd);
+            if (content == MAP_FAILED) {
+                UNI_ERROR_LOG("can not map onnx external data file %s.\n", path.c_str());
+            }
+#else
+            CHECK_STATUS(load_binary(path.c_str(), (void **)&content, &length));
+#endif
+            this->externalFiles[location] = std::make_pair(content, length);
+        }
+        return this->externalFiles[location].first;
+    }
+
+    // data of external tensor is [offset, offset + length) of file location.
+    U8 *get_external_data(const onnx::TensorProto &tp, U64 *bytes)
+    {
+        std::string location;
+        U64 offset = 0;
+        *bytes = UINT64_MAX;
+        for (int i = 0; i < tp.external_data_size(); i++) {
+            const onnx::StringStringEntryProto &entry = tp.external_data(i);
+            if (entry.key() == "location") {
+                location = entry.value();
+            } else if (entry.key() == "offset") {
+                offset = std::stoull(entry.value());
+            } else if (entry.key() == "length") {
+                *bytes = std::stoull(entry.value());
+            }
+        }
+        if (*bytes == UINT64_MAX) {
+            *bytes = bytesOf(get_type(tp));
+            for (int i = 0; i < tp.dims_size(); i++) {
+                *bytes *= tp.dims(i);
+            }
+        }
+        U8 *ptr = map_external_file(location);
+        if (offset + *bytes > this->externalFiles[location].second) {
+            UNI_ERROR_LOG("onnx tensor:%s is out of range of external data file %s.\n",
+                tp.name().c_str(), location.c_str());
+        }
+        return ptr + offset;
+    }
+
+    bool is_external(const onnx::TensorProto &tp)
+    {
+        return tp.has_data_location() && tp.data_location() == onnx::TensorProto::EXTERNAL;
+    }
+
     U8 *get_ptr(const onnx::TensorProto &tp)
     {
         U8 *ptr = nullptr;
-        if (tp.has_raw_data()) {
+        if (is_external(tp)) {
+            U64 bytes;
+            ptr = get_external_data(tp, &bytes);
+        } else if (tp.has_raw_data()) {
             const std::string &raw = tp.raw_data();
             ptr = (U8 *)raw.data();
         } else if (tp.data_type() == onnx::TensorProto::FLOAT) {
@@ -413,7 +495,11 @@ protected:
     int get_length(const onnx::TensorProto &tp)
     {
         int length = 0;
-        if (tp.has_raw_data()) {
+        if (is_external(tp)) {
+            U64 bytes;
+            get_external_data(tp, &bytes);
+            length = bytes / bytesOf(get_type(tp));
+        } else if (tp.has_raw_data()) {
             length = tp.raw_data().size() / bytesOf(get_type(tp));
         } else if (tp.data_type() == onnx::TensorProto::FLOAT) {
             length = tp.float_data_size();
@@ -2969,6 +3055,9 @@ private:
     bool useShare;
 
     std::string modelName;
+    std::string modelDirectory;
+    // mapped external data files, location -> (content, length)
+    std::map<std::string, std::pair<U8 *, size_t>> externalFiles;
     onnx::ModelProto onnxModel;
     onnx::GraphProto onnxGraph;
     onnx::NodeProto onnxNode;
@@ -29,17 +29,26 @@ void print_X2bolt_usage()
                  "Tips: If your model is trained from caffe, please ensure the model file name of "
                  "prototxt and caffemodel are the same, otherwise error occurs.\n"
                  "3. -i [inferencePrecision]: The inference precision. Currently, you can only "
-                 "choose one of {FP32, FP16, PTQ, BNN}. PTQ produces the input for "
+                 "choose one of {FP32, FP16, BF16, PTQ, BNN}. BF16 stores weights in bfloat16 "
+                 "to halve the model size. Only fully connected layers on x86 compute with "
+                 "bfloat16 weights, all other weights are widened to FP32 (FP16 on ARM) when "
+                 "the model is loaded. PTQ produces the input for "
                  "int8 post_training_quantization tool. BNN supports 1-bit computation of convolution and "
                  "FP16 computation of other operators on ARMv8.2 machines. \n"
                  "4. -r [removeOperatorNum]: The number of preprocession operator in onnx model. default: 0.\n"
                  "5. -t : Generate training model for on-device finetuning.\n"
                  "6. -I : To modify input names of the model. You need to list all input names seperated with ','.\n"
                  "7. -O : To modify output names of the model. You need to list all output names seperated with ','.\n"
-                 "8. -v : X2bolt version information.\n"
-                 "9. -V : Bolt Model detail information.\n"
-                 "10. -B : Bolt Model binary information.\n"
-                 "11. -h : help information.\n"
+                 "8. -s [weightFileSize]: Store weights in side files <boltModel>.weight<i> of at "
+                 "most weightFileSize MB each, they must be kept in the directory of bolt model. "
+                 "default: 0, weights are stored in bolt model.\n"
+                 "9. -f : Fuse operators for CPU inference, elementwise operators after "
+                 "convolution, fully connected and matmul become their post ops, attention becomes "
+                 "ScaledDotProductAttention. The model can not run on GPU. default: off.\n"
+                 "10. -v : X2bolt version information.\n"
+                 "11. -V : Bolt Model detail information.\n"
+                 "12. -B : Bolt Model binary information.\n"
+                 "13. -h : help information.\n"
                  "Example: ./X2bolt -d /local/models/ -m resnet50 -i FP16\n"
                  "If model conversion is successful, you can find the resnet50_f16.bolt file in "
                  "/local/models. Otherwise, you should check the usage Intro above.\n"
@@ -74,9 +83,11 @@ int main(int argc, char *argv[])
     bool trainMode = false;
     std::string modifiedInputs = "";
     std::string modifiedOutputs = "";
+    U64 weightFileBytes = 0;
+    bool cpuFusion = false;
 
     int option;
-    const char *optionstring = "d:m:i:r:VBvtI:O:";
+    const char *optionstring = "d:m:i:r:s:fVBvtI:O:";
     while ((option = getopt(argc, argv, optionstring)) != -1) {
         switch (option) {
             case 'd':
@@ -98,6 +109,14 @@ int main(int argc, char *argv[])
                 std::cout << "option is -r [removeOperatorNum], value is: " << removeProcessOpsNum
                           << std::endl;
                 break;
+            case 's':
+                weightFileBytes = atoll(optarg) * 1024 * 1024;
+                std::cout << "option is -s [weightFileSize], value is: " << optarg << std::endl;
+                break;
+            case 'f':
+                cpuFusion = true;
+                std::cout << "option is -f, operators are fused for CPU inference." << std::endl;
+                break;
             case 'V':
                 printModel = true;
                 break;
@@ -129,7 +148,7 @@ int main(int argc, char *argv[])
     transform(inferPrecision.begin(), inferPrecision.end(), inferPrecision.begin(), toupper);
 
     void *onlineModel = OnlineModelConversion(storagePath.c_str(), modelFileName.c_str(),
-        inferPrecision.c_str(), removeProcessOpsNum, trainMode);
+        inferPrecision.c_str(), removeProcessOpsNum, trainMode, cpuFusion);
     ModelSpec *ms = (ModelSpec *)onlineModel;
 
     std::string modelStorePath = storagePath + "/" + modelFileName;
@@ -141,6 +160,8 @@ int main(int argc, char *argv[])
         modelStorePath += std::string("_f16_b.bolt");
     } else if (inferPrecision.compare(std::string("FP16")) == 0) {
         modelStorePath += std::string("_f16.bolt");
+    } else if (inferPrecision.compare(std::string("BF16")) == 0) {
+        modelStorePath += std::string("_bf16.bolt");
     } else if (inferPrecision.compare(std::string("FP32")) == 0) {
         modelStorePath += std::string("_f32.bolt");
     } else {
@@ -152,7 +173,7 @@ int main(int argc, char *argv[])
     modify_ms_inputs_and_outputs(ms, modifiedInputs, modifiedOutputs);
 
     UNI_INFO_LOG("Write bolt model to %s.\n", modelStorePath.c_str());
-    CHECK_STATUS(serialize_model_to_file(ms, modelStorePath.c_str()));
+    CHECK_STATUS(serialize_model_to_file(ms, modelStorePath.c_str(), weightFileBytes));
     OnlineModelReclaim(onlineModel);
     if (printModel) {
         ModelSpec resultMs;
@@ -0,0 +1,176 @@
+// Copyright (C) 2019. Huawei Technologies Co., Ltd. All rights reserved.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <getopt.h>
+#include <iostream>
+#include <algorithm>
+#include "model_common.h"
+#include "model_optimizer.hpp"
+
+// Conversion time of the suggested graph optimizers on a synthetic model, which repeats a block of
+// Conv, BatchNorm, Scale, Relu, a pair of Transposes, a chain of Clips, Swish and residual Eltwise.
+// Operators of a block are fused by the passes, so it shows how passes scale with model size.
+void print_optimizer_benchmark_usage()
+{
+    std::cout << "optimizer_benchmark usage:\n"
+                 "1. -n [blockNum]: The number of blocks of 11 operators. default: 2000.\n"
+                 "2. -t [topNum]: The number of slowest passes to print. default: 10.\n"
+              << std::endl;
+}
+
+static void set_names(I8 **names, const std::vector<std::string> &tensors)
+{
+    for (U32 i = 0; i < tensors.size(); i++) {
+        str_copy(names[i], tensors[i].c_str(), tensors[i].length());
+    }
+}
+
+static OperatorSpec &add_operator(ModelSpec *ms,
+    OperatorType type,
+    const std::vector<std::string> &inputs,
+    const std::string &output)
+{
+    std::string name = "op" + std::to_string(ms->num_operator_specs);
+    OperatorSpec &p = ms->ops[ms->num_operator_specs++];
+    p = mt_create_operator(name.c_str(), type, inputs.size(), 1);
+    set_names(p.input_tensors_name, inputs);
+    set_names(p.output_tensors_name, {output});
+    return p;
+}
+
+static void add_weight(ModelSpec *ms, U32 weightNum, U32 vecNum, F32 value)
+{
+    const char *name = ms->ops[ms->num_operator_specs - 1].name;
+    WeightSpec &w = ms->ws[ms->num_weight_specs++];
+    w = mt_create_weight(name, DT_F32, weightNum * sizeof(F32), vecNum * sizeof(F32), 0);
+    for (U32 i = 0; i < weightNum; i++) {
+        ((F32 *)w.weight)[i] = value;
+    }
+    for (U32 i = 0; i < vecNum; i++) {
+        ((F32 *)w.vec)[i] = value;
+    }
+}
+
+static void create_model(ModelSpec *ms, U32 blockNum)
+{
+    const U32 channels = 8;
+    CHECK_STATUS(mt_create_model(ms));
+    ms->dt = DT_F32;
+    ms->num_inputs = 1;
+    ms->input_names = (I8 **)mt_malloc(sizeof(I8 *));
+    ms->input_names[0] = (I8 *)mt_malloc(NAME_LEN);
+    str_copy(ms->input_names[0], "input", 5);
+    ms->input_dims = (TensorDesc *)mt_malloc(sizeof(TensorDesc));
+    ms->input_dims[0] = tensor4df(DT_F32, DF_NCHW, 1, channels, 16, 16);
+    ms->ops = (OperatorSpec *)mt_malloc(sizeof(OperatorSpec) * blockNum * 11);
+    ms->ws = (WeightSpec *)mt_malloc(sizeof(WeightSpec) * blockNum * 3);
+
+    std::string x = "input";
+    for (U32 i = 0; i < blockNum; i++) {
+        std::string id = std::to_string(i);
+        OperatorSpec &conv = add_operator(ms, OT_Conv, {x}, "conv" + id);
+        conv.ps.conv_spec = createConvolutionParamSpec(
+            1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, channels, CONVOLUTION_POINTWISE);
+        add_weight(ms, channels * channels, channels, 0.5);
+        OperatorSpec &bn = add_operator(ms, OT_BatchNorm, {"conv" + id}, "bn" + id);
+        bn.ps.bn_spec.axis = 1;
+        bn.ps.bn_spec.eps = 1e-5;
+        bn.ps.bn_spec.gama = 1;
+        add_weight(ms, channels, channels, 1);
+        OperatorSpec &scale = add_operator(ms, OT_Scale, {"bn" + id}, "scale" + id);
+        scale.ps.scale_spec.axis = 1;
+        add_weight(ms, channels, channels, 2);
+        add_operator(ms, OT_Relu, {"scale" + id}, "relu" + id);
+        std::string input = "relu" + id;
+        for (U32 j = 0; j < 2; j++) {
+            std::string output = "transpose" + id + "_" + std::to_string(j);
+            OperatorSpec &transpose = add_operator(ms, OT_Transpose, {input}, output);
+            U32 axes[4] = {0, 1, 3, 2};
+            UNI_MEMCPY(transpose.ps.transpose_spec.axes, axes, sizeof(axes));
+            transpose.ps.transpose_spec.num_axes = 4;
+            input = output;
+        }
+        for (U32 j = 0; j < 2; j++) {
+            std::string output = "clip" + id + "_" + std::to_string(j);
+            OperatorSpec &clip = add_operator(ms, OT_Clip, {input}, output);
+            clip.ps.clip_spec.min = -6.0f + j;
+            clip.ps.clip_spec.max = 6.0f - j;
+            input = output;
+        }
+        add_operator(ms, OT_Sigmoid, {input}, "sigmoid" + id);
+        OperatorSpec &swish =
+            add_operator(ms, OT_Eltwise, {input, "sigmoid" + id}, "swish" + id);
+        swish.ps.eltwise_spec.mode = ELTWISE_PROD;
+        OperatorSpec &sum = add_operator(ms, OT_Eltwise, {"swish" + id, x}, "sum" + id);
+        sum.ps.eltwise_spec.mode = ELTWISE_SUM;
+        x = "sum" + id;
+    }
+    ms->num_outputs = 1;
+    ms->output_names = (I8 **)mt_malloc(sizeof(I8 *));
+    ms->output_names[0] = (I8 *)mt_malloc(NAME_LEN);
+    str_copy(ms->output_names[0], x.c_str(), x.length());
+}
+
+static int valid_operator_num(const ModelSpec *ms)
+{
+    int num = 0;
+    for (int i = 0; i < ms->num_operator_specs; i++) {
+        if (ms->ops[i].type != OT_None) {
+            num++;
+        }
+    }
+    return num;
+}
+
+int main(int argc, char *argv[])
+{
+    U32 blockNum = 2000;
+    U32 topNum = 10;
+    int option;
+    while ((option = getopt(argc, argv, "n:t:h")) != -1) {
+        switch (option) {
+            case 'n':
+                blockNum = atoi(optarg);
+                break;
+            case 't':
+                topNum = atoi(optarg);
+                break;
+            default:
+                print_optimizer_benchmark_usage();
+                return 1;
+        }
+    }
+
+    ModelSpec ms;
+    create_model(&ms, blockNum);
+    int operatorNum = valid_operator_num(&ms);
+    ModelSpecOptimizer optimizer;
+    optimizer.suggest(false);
+    double start = ut_time_ms();
+    optimizer.optimize(&ms);
+    double time = ut_time_ms() - start;
+
+    printf("optimize %d operators to %d operators in %.3f ms.\n", operatorNum,
+        valid_operator_num(&ms), time);
+    std::vector<std::pair<std::string, double>> times = optimizer.passTimes();
+    std::stable_sort(times.begin(), times.end(),
+        [](const std::pair<std::string, double> &a, const std::pair<std::string, double> &b) {
+            return a.second > b.second;
+        });
+    for (U32 i = 0; i < times.size() && i < topNum; i++) {
+        printf("%40s %12.3f ms %7.2f%%\n", times[i].first.c_str(), times[i].second,
+            times[i].second / time * 100);
+    }
+    CHECK_STATUS(mt_destroy_model(&ms));
+    return 0;
+}